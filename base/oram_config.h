@@ -52,6 +52,47 @@ struct OramConfig {
   size_t odict_size;
   size_t client_cache_max_size;
 
+  // For Partition ORAM.
+  OramType partition_backend;
+  // The number of threads (and gRPC channels) used to set up the partitions.
+  size_t thread_num;
+  // Run the evictions in a background thread.
+  bool async_eviction;
+  // The back-pressure threshold of the asynchronous eviction (0 = automatic).
+  size_t max_slot_occupancy;
+
+  // For Square Root ORAM.
+  // Build the next permuted memory a slice per access instead of all at once.
+  bool sqrt_background_shuffle;
+
+  // For the server.
+  // The layout of the buckets of the tree storages.
+  TreeStorageEngineType tree_storage_engine;
+  // The directory of the files backing the tree storages.
+  std::string tree_storage_path;
+  // The number of top levels of a mapped tree locked into memory.
+  uint32_t mmap_locked_levels;
+  bool mmap_huge_pages;
+  // The number of top levels cached in memory by the io_uring engine.
+  uint32_t uring_cached_levels;
+  // How the map engine compresses the blocks.
+  BlockCodec block_codec;
+  // The number of threads serving the requests (0 = one per core).
+  size_t server_thread_num;
+  // The maximum size of a message in bytes.
+  size_t max_message_size;
+  // The memory quota of gRPC in megabytes (0 = unlimited).
+  size_t server_memory_quota;
+  // The maximum number of threads of gRPC (0 = unlimited).
+  size_t server_max_threads;
+  // The directory of the snapshots of the storages (empty = no snapshots).
+  std::string snapshot_path;
+  // How often the snapshots are taken in seconds (0 = only at shutdown).
+  uint32_t snapshot_interval;
+  // Log the write-backs to the tree storages next to the snapshots.
+  bool enable_wal;
+  WalSyncPolicy wal_sync_policy;
+
   bool disable_debugging;
 
   std::string filepath;
@@ -78,6 +119,28 @@ static const OramConfig default_config = {
     100000,
     32,
 
+    OramType::kPathOram,
+    4,
+    false,
+    0,
+
+    false,
+
+    TreeStorageEngineType::kArray,
+    ".",
+    10,
+    false,
+    10,
+    BlockCodec::kNone,
+    0,
+    64 * 1024 * 1024,
+    0,
+    0,
+    "",
+    0,
+    false,
+    WalSyncPolicy::kAlways,
+
     true,
     "",
 };
@@ -16,24 +16,89 @@
  */
 #include "oram_crypto.h"
 
-#include <bitset>
-#include <sstream>
-
 #include <spdlog/spdlog.h>
-#include <fpe.h>
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <thread>
+
+#include "oram_prg.h"
+#include "oram_prp.h"
 #include "oram_utils.h"
 
 extern std::shared_ptr<spdlog::logger> logger;
 
 namespace oram_crypto {
+// The number of indices handed to a thread at a time by `RandomPermutation`.
+static const size_t kPrpChunkSize = 1ul << 16;
+// The encrypted part of a block: everything after the cleartext header
+// fields.
+static const size_t kBlockCipherSize =
+    ORAM_BLOCK_SIZE - (DEFAULT_ORAM_ENCSKIP_SIZE);
+// The IVs of this many blocks are reserved at once.
+static const size_t kIvBatchSize = 64;
+
+#ifdef crypto_aead_aegis256_KEYBYTES
+static_assert(crypto_aead_aegis256_ABYTES <= DEFAULT_ORAM_TAG_SIZE,
+              "The tag slot of the block header is too small.");
+#endif
+
+bool IsSuiteAvailable(AeadSuite suite) {
+  // Idempotent; the CPU features are probed here.
+  if (sodium_init() == -1) {
+    return false;
+  }
+
+  switch (suite) {
+    case AeadSuite::kAes256Gcm:
+      return crypto_aead_aes256gcm_is_available() != 0;
+    case AeadSuite::kChaCha20Poly1305:
+      return true;
+    case AeadSuite::kAegis256:
+#ifdef crypto_aead_aegis256_KEYBYTES
+      // The software fallback is slower than ChaCha20.
+      return sodium_runtime_has_aesni() != 0;
+#else
+      return false;
+#endif
+    default:
+      return false;
+  }
+}
+
+std::string SuiteToName(AeadSuite suite) {
+  switch (suite) {
+    case AeadSuite::kAes256Gcm:
+      return "AES-256-GCM";
+    case AeadSuite::kChaCha20Poly1305:
+      return "ChaCha20-Poly1305";
+    case AeadSuite::kAegis256:
+      return "AEGIS-256";
+    default:
+      return "Unknown";
+  }
+}
+
 Cryptor::Cryptor() {
-  PANIC_IF(sodium_init() == -1, "Failed to initialize sodium.");
+  if (sodium_init() == -1) {
+    PANIC("Failed to initialize sodium.");
+  }
 
   // Initialize the random number.
   randombytes_buf(random_val_, sizeof(ORAM_CRYPTO_RANDOM_SIZE));
+
+  // Prefer the fastest suite the CPU supports.
+  suite_ = AeadSuite::kChaCha20Poly1305;
+  for (AeadSuite suite : {AeadSuite::kAegis256, AeadSuite::kAes256Gcm}) {
+    if (IsSuiteAvailable(suite)) {
+      suite_ = suite;
+      break;
+    }
+  }
+
   is_initialized = true;
-  INFO(logger, "Cryptor initialized.");
+  INFO(logger, "Cryptor initialized with {}.", SuiteToName(suite_));
 }
 
 Cryptor::~Cryptor() {
@@ -48,59 +113,157 @@ std::shared_ptr<Cryptor> Cryptor::GetInstance(void) {
 
 void Cryptor::CryptoPrelogue(void) {
   PANIC_IF(!is_initialized, "Cryptor is not initialized.");
-  PANIC_IF(crypto_aead_aes256gcm_is_available() == 0,
-           "AES-256-GCM is not available on this CPU.");
 }
 
-oram_impl::OramStatus RandomPermutation(std::vector<uint32_t>& array) {
-  // Pick up a PRP key.
-  oram_impl::OramStatus status = oram_impl::OramStatus::OK;
-  uint8_t prp_key[ORAM_PRP_KEY_SIZE];
-  memset(prp_key, 0, ORAM_PRP_KEY_SIZE);
-  randombytes_buf(prp_key, ORAM_PRP_KEY_SIZE);
+oram_impl::OramStatus Cryptor::SetSuite(AeadSuite suite) {
+  if (!IsSuiteAvailable(suite)) {
+    return oram_impl::OramStatus(
+        oram_impl::StatusCode::kInvalidArgument,
+        oram_utils::StrCat(SuiteToName(suite), " is not available"), __func__);
+  }
+
+  suite_ = suite;
+  if (is_setup) {
+    PrepareCipherState();
+  }
+  INFO(logger, "Blocks are sealed with {}.", SuiteToName(suite_));
+
+  return oram_impl::OramStatus::OK;
+}
+
+void Cryptor::PrepareCipherState(void) {
+  // The other suites have no per-key precomputation exposed by libsodium.
+  if (suite_ == AeadSuite::kAes256Gcm &&
+      crypto_aead_aes256gcm_beforenm(&cipher_state_, session_key_rx_) != 0) {
+    PANIC("Cannot expand the session key.");
+  }
+}
+
+void Cryptor::ResetIvSequence(void) {
+  RandomBytes(iv_prefix_, sizeof(iv_prefix_));
+  iv_counter_ = 0;
+}
 
+oram_impl::OramStatus Cryptor::NextIvs(uint8_t* const out, size_t num) {
+  PANIC_IF(num > kIvBatchSize, "Too many IVs are requested at once.");
+
+  // The counter is only moved forward if the whole range fits, so no IV is
+  // ever handed out twice under one key.
+  uint64_t first = iv_counter_.load();
+  do {
+    if (num > std::numeric_limits<uint64_t>::max() - first) {
+      return oram_impl::OramStatus(
+          oram_impl::StatusCode::kOutOfRange,
+          "The IVs of the session key are exhausted; negotiate a new key",
+          __func__);
+    }
+  } while (!iv_counter_.compare_exchange_weak(first, first + num));
+
+  for (size_t i = 0; i < num; i++) {
+    uint8_t* const iv = out + i * ORAM_CRYPTO_RANDOM_SIZE;
+    const uint64_t counter = first + i;
+    memcpy(iv, iv_prefix_, sizeof(iv_prefix_));
+    memcpy(iv + sizeof(iv_prefix_), &counter, sizeof(counter));
+  }
+
+  return oram_impl::OramStatus::OK;
+}
+
+int Cryptor::SealBlock(oram_impl::oram_block_t* const block) {
+  oram_impl::oram_block_header_t* const header = &block->header;
+  uint8_t* const payload =
+      reinterpret_cast<uint8_t*>(header) + DEFAULT_ORAM_ENCSKIP_SIZE;
+
+  switch (suite_) {
+    case AeadSuite::kAes256Gcm:
+      return crypto_aead_aes256gcm_encrypt_detached_afternm(
+          payload, header->mac_tag, nullptr, payload, kBlockCipherSize,
+          nullptr, 0, nullptr, header->iv, &cipher_state_);
+    case AeadSuite::kChaCha20Poly1305:
+      return crypto_aead_chacha20poly1305_ietf_encrypt_detached(
+          payload, header->mac_tag, nullptr, payload, kBlockCipherSize,
+          nullptr, 0, nullptr, header->iv, session_key_rx_);
+#ifdef crypto_aead_aegis256_KEYBYTES
+    case AeadSuite::kAegis256: {
+      // The IV is zero-extended to the 256-bit nonce.
+      uint8_t nonce[crypto_aead_aegis256_NPUBBYTES] = {0};
+      memcpy(nonce, header->iv, ORAM_CRYPTO_RANDOM_SIZE);
+      return crypto_aead_aegis256_encrypt_detached(
+          payload, header->mac_tag, nullptr, payload, kBlockCipherSize,
+          nullptr, 0, nullptr, nonce, session_key_rx_);
+    }
+#endif
+    default:
+      return -1;
+  }
+}
+
+int Cryptor::OpenBlock(oram_impl::oram_block_t* const block) {
+  oram_impl::oram_block_header_t* const header = &block->header;
+  uint8_t* const payload =
+      reinterpret_cast<uint8_t*>(header) + DEFAULT_ORAM_ENCSKIP_SIZE;
+
+  switch (suite_) {
+    case AeadSuite::kAes256Gcm:
+      return crypto_aead_aes256gcm_decrypt_detached_afternm(
+          payload, nullptr, payload, kBlockCipherSize, header->mac_tag,
+          nullptr, 0, header->iv, &cipher_state_);
+    case AeadSuite::kChaCha20Poly1305:
+      return crypto_aead_chacha20poly1305_ietf_decrypt_detached(
+          payload, nullptr, payload, kBlockCipherSize, header->mac_tag,
+          nullptr, 0, header->iv, session_key_rx_);
+#ifdef crypto_aead_aegis256_KEYBYTES
+    case AeadSuite::kAegis256: {
+      uint8_t nonce[crypto_aead_aegis256_NPUBBYTES] = {0};
+      memcpy(nonce, header->iv, ORAM_CRYPTO_RANDOM_SIZE);
+      return crypto_aead_aegis256_decrypt_detached(
+          payload, nullptr, payload, kBlockCipherSize, header->mac_tag,
+          nullptr, 0, nonce, session_key_rx_);
+    }
+#endif
+    default:
+      return -1;
+  }
+}
+
+oram_impl::OramStatus RandomPermutation(std::vector<uint32_t>& array) {
   const size_t size = array.size();
   if (size == 0) {
     return oram_impl::OramStatus(oram_impl::StatusCode::kInvalidArgument,
                                  "The input array cannot be empty", __func__);
+  } else if (size > std::numeric_limits<uint32_t>::max()) {
+    return oram_impl::OramStatus(oram_impl::StatusCode::kInvalidArgument,
+                                 "The input array is too large", __func__);
   }
 
-  // Calculate the highest order.
-  const uint32_t ord = (uint32_t)(std::log10(size) / std::log10(ORAM_RADIX));
-
-  // Generate FPE key. By default, the radix is 2, which is set by `ORAM_RADIX`.
-  FPE_KEY* fpe_key =
-      FPE_ff3_1_create_key(reinterpret_cast<char*>(prp_key), "", ORAM_RADIX);
-
-  // Start permutation. Prepare a buffer.
-  std::vector<uint32_t> perm_buf(size);
-  // The array size should be some power of 2 to ensure that there is round-up.
-  for (size_t i = 0; i < size; i++) {
-    std::bitset<sizeof(uint32_t)* 8> bit = array[i];
-    std::string bin = bit.to_string();
-    // Truncate the binary string.
-    bin = bin.substr(bin.size() - ord);
-
-    std::string out(bin.size(), '0');
-    FPE_ff3_encrypt(bin.data(), out.data(), fpe_key);
-
-    // Convert to uint32_t.
-    bit = 0;
-    std::stringstream ss(out);
-    ss >> bit;
-    perm_buf[i] = bit.to_ulong();
-  }
-
-  // Permute the array.
-  for (size_t i = 0; i < size; i++) {
-    std::swap(array[i], array[perm_buf[i]]);
+  // Values outside the domain could be trapped in a cycle that never enters
+  // it, so we reject them before walking.
+  if (std::any_of(array.begin(), array.end(),
+                  [size](uint32_t val) { return val >= size; })) {
+    return oram_impl::OramStatus(oram_impl::StatusCode::kInvalidArgument,
+                                 "The input array must be a permutation",
+                                 __func__);
   }
 
-  FPE_ff3_delete_key(fpe_key);
-  return oram_impl::OramStatus::OK;
+  // Pick up a PRP key.
+  uint8_t prp_key[ORAM_PRP_KEY_SIZE];
+  randombytes_buf(prp_key, ORAM_PRP_KEY_SIZE);
+  const Prp prp(size, prp_key);
+  sodium_memzero(prp_key, ORAM_PRP_KEY_SIZE);
+
+  // The chunks are independent.
+  const size_t chunk_num = (size + kPrpChunkSize - 1) / kPrpChunkSize;
+  return oram_utils::ParallelFor(
+      chunk_num, std::max(1u, std::thread::hardware_concurrency()),
+      [&](size_t i) {
+        const size_t begin = i * kPrpChunkSize;
+        const size_t num = std::min(kPrpChunkSize, size - begin);
+        prp.PermuteBatch(array.data() + begin, array.data() + begin, num);
+        return oram_impl::OramStatus::OK;
+      });
 }
 
-// The encryption algorithm also uses AES-GCM mode to encrypt the message.
+// Messages are sealed with ChaCha20-Poly1305, which every host supports.
 oram_impl::OramStatus Cryptor::Encrypt(const uint8_t* message, size_t length,
                                        uint8_t* const iv,
                                        std::string* const out) {
@@ -108,10 +271,10 @@ oram_impl::OramStatus Cryptor::Encrypt(const uint8_t* message, size_t length,
   PANIC_IF(!is_setup, "Cryptor is not yet correctly set up.");
 
   // Fill in the IV.
-  out->resize(crypto_aead_aes256gcm_ABYTES + length);
+  out->resize(crypto_aead_chacha20poly1305_ietf_ABYTES + length);
   unsigned long long ciphertext_len;
 
-  int ret = crypto_aead_aes256gcm_encrypt(
+  int ret = crypto_aead_chacha20poly1305_ietf_encrypt(
       (uint8_t*)out->data(), &ciphertext_len, message, length, nullptr, 0, NULL,
       iv, session_key_rx_);
 
@@ -129,21 +292,21 @@ oram_impl::OramStatus Cryptor::Decrypt(const uint8_t* message, size_t length,
   CryptoPrelogue();
   PANIC_IF(!is_setup, "Cryptor is not yet correctly set up.");
 
-  if (length < crypto_aead_aes256gcm_ABYTES) {
+  if (length < crypto_aead_chacha20poly1305_ietf_ABYTES) {
     return oram_impl::OramStatus(oram_impl::StatusCode::kInvalidArgument,
                                  "The length of the message is too short",
                                  __func__);
   }
 
-  // The message consists of the GCM MAC tag, the nonce, ant the
+  // The message consists of the MAC tag, the nonce, ant the
   // ciphertext itself, so it is easily for us to dertemine the length of the
   // plaintext because length of ciphertext = length of plaintext.
-  size_t message_len = length - crypto_aead_aes256gcm_ABYTES;
+  size_t message_len = length - crypto_aead_chacha20poly1305_ietf_ABYTES;
   uint8_t* const decrypted = (uint8_t*)malloc(message_len);
 
-  int ret = crypto_aead_aes256gcm_decrypt(decrypted, (ull*)&message_len,
-                                          nullptr, message, length, nullptr, 0,
-                                          iv, session_key_rx_);
+  int ret = crypto_aead_chacha20poly1305_ietf_decrypt(
+      decrypted, (ull*)&message_len, nullptr, message, length, nullptr, 0, iv,
+      session_key_rx_);
   *out = std::string((char*)decrypted, message_len);
 
   oram_impl::OramStatus err = oram_impl::OramStatus(
@@ -156,6 +319,57 @@ oram_impl::OramStatus Cryptor::Decrypt(const uint8_t* message, size_t length,
   return ret == 0 ? oram_impl::OramStatus::OK : err;
 }
 
+oram_impl::OramStatus Cryptor::EncryptBlocks(
+    oram_impl::oram_block_t* const blocks, size_t num) {
+  CryptoPrelogue();
+  PANIC_IF(!is_setup, "Cryptor is not yet correctly set up.");
+
+  uint8_t ivs[kIvBatchSize * ORAM_CRYPTO_RANDOM_SIZE];
+  for (size_t i = 0; i < num; i++) {
+    if (i % kIvBatchSize == 0) {
+      oram_impl::OramStatus status =
+          NextIvs(ivs, std::min(kIvBatchSize, num - i));
+      if (!status.ok()) {
+        return status;
+      }
+    }
+
+    oram_impl::oram_block_header_t* const header = &blocks[i].header;
+    memcpy(header->iv, ivs + (i % kIvBatchSize) * ORAM_CRYPTO_RANDOM_SIZE,
+           ORAM_CRYPTO_RANDOM_SIZE);
+    // Shorter tags leave part of the slot untouched, which must not carry
+    // anything that links the block to its previous versions.
+    sodium_memzero(header->mac_tag, sizeof(header->mac_tag));
+
+    if (SealBlock(&blocks[i]) != 0) {
+      return oram_impl::OramStatus(oram_impl::StatusCode::kUnknownError,
+                                   "Libsodium cannot encrypt the block!",
+                                   __func__);
+    }
+  }
+
+  sodium_memzero(ivs, sizeof(ivs));
+  return oram_impl::OramStatus::OK;
+}
+
+oram_impl::OramStatus Cryptor::DecryptBlocks(
+    oram_impl::oram_block_t* const blocks, size_t num) {
+  CryptoPrelogue();
+  PANIC_IF(!is_setup, "Cryptor is not yet correctly set up.");
+
+  for (size_t i = 0; i < num; i++) {
+    if (OpenBlock(&blocks[i]) != 0) {
+      return oram_impl::OramStatus(
+          oram_impl::StatusCode::kUnknownError,
+          "Libsodium cannot decrypt the block! Maybe the buffer "
+          "is truncated or corrupted.",
+          __func__);
+    }
+  }
+
+  return oram_impl::OramStatus::OK;
+}
+
 oram_impl::OramStatus Cryptor::Digest(const uint8_t* message, size_t length,
                                       std::string* const out) {
   uint8_t* const digest = (uint8_t*)malloc(crypto_hash_sha256_BYTES);
@@ -221,6 +435,8 @@ oram_impl::OramStatus Cryptor::SampleSessionKey(const std::string& peer_pk,
 
   if (ret == 0) {
     is_setup = true;
+    PrepareCipherState();
+    ResetIvSequence();
     return oram_impl::OramStatus::OK;
   } else {
     return oram_impl::OramStatus(
@@ -257,23 +473,18 @@ oram_impl::OramStatus UniformRandom(uint32_t min, uint32_t max,
         "The minimum value is greater than the maximum value");
   }
 
-  // @ref Chromium's base/rand_util.cc for the implementation.
-  uint32_t range = max - min + 1;
-  uint32_t max_acceptable_value =
-      (std::numeric_limits<uint32_t>::max() / range) * range - 1;
-  // We sample a random number and them map it to the range [min, max]
-  // (inclusive) in a uniform way by scaling.
-  uint32_t value;
+  // Use a strong RNG to generate a random number. This is important because
+  // we want this function to be pseudorandom and cannot be predicted by any
+  // adversary. The buffered PRG keeps the system RNG out of the hot path.
+  Prg& prg = Prg::ThreadLocal();
+  const uint32_t range = max - min + 1;
+  if (range == 0) {
+    // The whole 32-bit range.
+    prg.Fill(out, sizeof(uint32_t));
+  } else {
+    *out = prg.Uniform(range) + min;
+  }
 
-  do {
-    // Use a strong RNG to generate a random number.
-    // This is important because we want this function to be pseudorandom
-    // and cannot be predicted by any adversary.
-    value = randombytes_random();
-  } while (value > max_acceptable_value);
-
-  value = value % range + min;
-  *out = value;
   return oram_impl::OramStatus::OK;
 }
 
@@ -284,7 +495,7 @@ oram_impl::OramStatus RandomBytes(uint8_t* const out, size_t length) {
                                  __func__);
   }
 
-  randombytes_buf(out, length);
+  Prg::ThreadLocal().Fill(out, length);
   return oram_impl::OramStatus::OK;
 }
 
@@ -296,5 +507,7 @@ void Cryptor::NoNeedForSessionKey(void) {
   oram_impl::OramStatus status =
       RandomBytes(session_key_rx_, ORAM_CRYPTO_KEY_SIZE);
   oram_utils::CheckStatus(status, "Cannot sample ephermeral key.");
+  PrepareCipherState();
+  ResetIvSequence();
 }
 }  // namespace oram_crypto
\ No newline at end of file
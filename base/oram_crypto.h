@@ -19,6 +19,7 @@
 
 #include <sodium.h>
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <utility>
@@ -28,17 +29,39 @@
 
 #define ORAM_CRYPTO_KEY_SIZE crypto_aead_aes256gcm_KEYBYTES
 #define ORAM_CRYPTO_RANDOM_SIZE crypto_aead_aes256gcm_NPUBBYTES
-#define ORAM_PRP_KEY_SIZE 32ul
-#define ORAM_RADIX 2
 
 #define ull unsigned long long
 
 namespace oram_crypto {
+// The AEAD schemes that the blocks can be sealed with. All of them take the
+// 256-bit session key.
+enum class AeadSuite {
+  kAes256Gcm = 0,
+  kChaCha20Poly1305 = 1,
+  kAegis256 = 2,
+};
+
+// AES-256-GCM needs AES-NI and PCLMUL; AEGIS-256 needs a libsodium that ships
+// it and AES instructions to be fast. ChaCha20-Poly1305 runs anywhere.
+bool IsSuiteAvailable(AeadSuite suite);
+
+std::string SuiteToName(AeadSuite suite);
+
 class Cryptor {
   // The symmetric keys are valid only after key negotiation.
   uint8_t session_key_rx_[ORAM_CRYPTO_KEY_SIZE];
   uint8_t session_key_tx_[ORAM_CRYPTO_KEY_SIZE];
   uint8_t random_val_[ORAM_CRYPTO_RANDOM_SIZE];
+  // The suite sealing the blocks, picked from the CPU features on startup.
+  AeadSuite suite_;
+  // For AES-256-GCM: the expanded AES key and the GHASH key of
+  // `session_key_rx_`, so that the key schedule is not rerun for every block.
+  crypto_aead_aes256gcm_state cipher_state_;
+  // The IV of the i-th sealed block is the random `iv_prefix_` followed by
+  // the 64-bit counter i, so IVs never repeat under one key as long as the
+  // counter does not wrap. Both are reset along with the session key.
+  uint8_t iv_prefix_[ORAM_CRYPTO_RANDOM_SIZE - sizeof(uint64_t)];
+  std::atomic_uint64_t iv_counter_;
 
   // The public key and the secret key.
   uint8_t public_key_[crypto_kx_PUBLICKEYBYTES];
@@ -50,14 +73,35 @@ class Cryptor {
   Cryptor();
 
   void CryptoPrelogue(void);
+  // Must be called whenever `session_key_rx_` or `suite_` changes.
+  void PrepareCipherState(void);
+  void ResetIvSequence(void);
+  // Fills `out` with the next `num` IVs; `num` is at most `kIvBatchSize`.
+  // Fails once the counter would wrap.
+  oram_impl::OramStatus NextIvs(uint8_t* const out, size_t num);
+  int SealBlock(oram_impl::oram_block_t* const block);
+  int OpenBlock(oram_impl::oram_block_t* const block);
 
  public:
   static std::shared_ptr<Cryptor> GetInstance(void);
 
+  AeadSuite GetSuite(void) const { return suite_; }
+  // Blocks sealed under one suite cannot be opened under another, so this
+  // must be called before any block is encrypted.
+  oram_impl::OramStatus SetSuite(AeadSuite suite);
+
+  // Arbitrary messages (e.g., the hello message) are always sealed with
+  // ChaCha20-Poly1305 so that the peers need not agree on the suite.
   oram_impl::OramStatus Encrypt(const uint8_t* message, size_t length,
                                 uint8_t* const iv, std::string* const out);
   oram_impl::OramStatus Decrypt(const uint8_t* message, size_t length,
                                 const uint8_t* iv, std::string* const out);
+  // Encrypts or decrypts `num` contiguous blocks in place without touching the
+  // heap. Each block gets a fresh IV, and its MAC tag lives in the header.
+  oram_impl::OramStatus EncryptBlocks(oram_impl::oram_block_t* const blocks,
+                                      size_t num);
+  oram_impl::OramStatus DecryptBlocks(oram_impl::oram_block_t* const blocks,
+                                      size_t num);
   oram_impl::OramStatus Digest(const uint8_t* message, size_t length,
                                std::string* const out);
   oram_impl::OramStatus SampleKeyPair(void);
@@ -71,6 +115,7 @@ class Cryptor {
   virtual ~Cryptor();
 };
 
+// Both draw from the buffered PRG of the calling thread (see `Prg`).
 oram_impl::OramStatus RandomBytes(uint8_t* const out, size_t size);
 
 oram_impl::OramStatus UniformRandom(uint32_t min, uint32_t max,
@@ -110,9 +155,11 @@ oram_impl::OramStatus RandomShuffle(std::vector<Tp>& array) {
 // which can be regarded as a problem of how to encipher messages on a small
 // domain. In CRYPTO 2009, Morris et al. introduced a notion called Thorp
 // shuffle that takes use of deterministic encryption, which was a special
-// case of Format-Preserving Encryption (FPE).
+// case of Format-Preserving Encryption (FPE). We use a keyed Feistel network
+// with cycle-walking instead (see `Prp`), which works on any N.
 //
-// Note that the input array's size should be some power of 2.
+// The array must be a permutation of [0, N); each element x is replaced with
+// \pi(x).
 oram_impl::OramStatus RandomPermutation(std::vector<uint32_t>& array);
 }  // namespace oram_crypto
 
@@ -29,9 +29,10 @@
 #define DEFAULT_ORAM_METADATA_SIZE sizeof(oram_impl::BlockType) + sizeof(size_t)
 #define DEFAULT_ORAM_DATA_SIZE 512
 #define DEFAULT_COMPRESSED_BUF_SIZE 8192
-#define DEFAULT_ORAM_ENCSKIP_SIZE                                  \
-  crypto_aead_aes256gcm_NPUBBYTES + crypto_aead_aes256gcm_ABYTES + \
-      sizeof(uint32_t)
+// The tag slot fits the longest tag among the AEAD suites (AEGIS-256).
+#define DEFAULT_ORAM_TAG_SIZE 32
+#define DEFAULT_ORAM_ENCSKIP_SIZE \
+  crypto_aead_aes256gcm_NPUBBYTES + DEFAULT_ORAM_TAG_SIZE + sizeof(uint32_t)
 
 #define ORAM_BLOCK_SIZE sizeof(oram_impl::oram_block_t)
 #define CRASH(msg) crash(__PRETTY_FUNCTION__, msg)
@@ -69,7 +70,8 @@ enum class OramType {
   kPartitionOram = 3,
   kCuckooOram = 4,
   kOds = 5,
-  kInvalid = 6,
+  kLayeredOram = 6,
+  kInvalid = 7,
 };
 
 enum class OramStorageType {
@@ -80,15 +82,47 @@ enum class OramStorageType {
   kInvalidStorage = 4,
 };
 
+// How the server compresses the blocks it stores.
+enum class BlockCodec {
+  kNone = 0,
+  kLz4 = 1,
+  kZstd = 2,
+  kInvalid = 3,
+};
+
+// How the server lays out the buckets of a tree storage.
+enum class TreeStorageEngineType {
+  kMap = 0,
+  kArray = 1,
+  kMmap = 2,
+  kUring = 3,
+  kInvalid = 4,
+};
+
+// When the write-ahead log of the server is synchronized to the disk.
+enum class WalSyncPolicy {
+  // Before each write is acknowledged; concurrent writes share a sync.
+  kAlways = 0,
+  // Every few milliseconds in the background.
+  kPeriodic = 1,
+  // Left to the OS; only a crash of the server itself loses nothing.
+  kNever = 2,
+  kInvalid = 3,
+};
+
 // The header containing metadata.
 typedef struct _oram_block_header_t {
   // No need to encrypt (can be seen by the server).
   uint8_t iv[12];
-  uint8_t mac_tag[16];
+  uint8_t mac_tag[DEFAULT_ORAM_TAG_SIZE];
   uint32_t block_id;
 
   // Encrypted fields only accessible to client.
   BlockType type;
+  // A sealed copy of `block_id` for ORAMs whose layout would be revealed by
+  // the ids, which then blank `block_id`. It fills what was padding, so the
+  // size of the block is unchanged.
+  uint32_t sealed_id;
   size_t data_len;
 } oram_block_header_t;
 
@@ -114,11 +148,36 @@ static const std::string oram_write_err =
 // This factor can also be used to control the size of the Path ORAM to prevent
 // storage overflow.
 static const float kPartitionAdjustmentFactor = 1.;
+// Similarly, this factor controls the capacity of each level-based partition;
+// a partition overflows if it holds more blocks than its largest level.
+static const float kLayeredCapacityFactor = 1.25;
 
 static const uint32_t kMaximumOramStorageNum = 1e5;
 
+// Partitions of a Partition ORAM live in their own id space so that they never
+// collide with other ORAMs on the same server:
+//   [1 bit: partition flag][15 bits: parent id][16 bits: partition index].
+static const uint32_t kPartitionIdFlag = 0x80000000;
+static const uint32_t kPartitionIdShift = 16;
+static const uint32_t kPartitionIndexMask = 0xFFFF;
+
 static const uint32_t kInvalidMask = 0xFFFFFFFF;
 
+// Areas of the Square Root ORAM storage that can be accessed by ranges.
+static const uint32_t kSqrtMemoryArea = 0;
+static const uint32_t kSqrtTempArea = 1;
+// The memory of the next epoch built by the background shuffle.
+static const uint32_t kSqrtNextArea = 2;
+// Steps of the oblivious shuffle of the Square Root ORAM.
+static const uint32_t kSqrtShuffleBegin = 0;
+static const uint32_t kSqrtShuffleEnd = 1;
+static const uint32_t kSqrtShuffleBeginBackground = 2;
+static const uint32_t kSqrtShuffleSwap = 3;
+
+// Operations on the levels of the layered storage.
+static const uint32_t kLayeredAllocate = 0;
+static const uint32_t kLayeredPromote = 1;
+
 // Alias for SQRT ORam.
 using sqrt_oram_storage_t = std::vector<oram_block_t>;
 
@@ -129,14 +188,14 @@ using p_oram_path_t = std::vector<p_oram_bucket_t>;
 using p_oram_position_t = std::unordered_map<uint32_t, uint32_t>;
 // Alias for Partition ORAM.
 using pp_oram_slot_t = std::vector<std::vector<oram_block_t>>;
+// Alias for the level-based partitions: block id -> [level, offset].
+using l_oram_position_t =
+    std::unordered_map<uint32_t, std::pair<uint32_t, uint32_t>>;
 // Alias for server storage.
-using server_storage_data = std::vector<std::string>;
-using server_storage_tag_t = std::pair<uint32_t, uint32_t>;
-using server_tree_storage_t =
-    absl::flat_hash_map<server_storage_tag_t, server_storage_data>;
 using server_flat_storage_t = std::string;
-using server_sqrt_storage_t = std::vector<std::string>;
 using server_sqrt_shelter_t = std::vector<std::pair<uint32_t, std::string>>;
+using server_layered_level_t = std::vector<std::string>;
+using server_layered_storage_t = std::vector<server_layered_level_t>;
 
 struct BlockEqual {
  private:
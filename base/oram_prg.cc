@@ -0,0 +1,77 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "oram_prg.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace oram_crypto {
+Prg::Prg() : pos_(ORAM_PRG_BUFFER_SIZE) {
+  randombytes_buf(key_, sizeof(key_));
+}
+
+Prg::~Prg() {
+  sodium_memzero(key_, sizeof(key_));
+  sodium_memzero(buffer_, sizeof(buffer_));
+}
+
+Prg& Prg::ThreadLocal(void) {
+  static thread_local Prg prg;
+  return prg;
+}
+
+void Prg::Refill(void) {
+  // The nonce can stay fixed because every key is used once.
+  static const uint8_t nonce[crypto_stream_chacha20_ietf_NONCEBYTES] = {0};
+  crypto_stream_chacha20_ietf(buffer_, sizeof(buffer_), nonce, key_);
+
+  memcpy(key_, buffer_, sizeof(key_));
+  sodium_memzero(buffer_, sizeof(key_));
+  pos_ = sizeof(key_);
+}
+
+void Prg::Fill(void* const out, size_t size) {
+  uint8_t* dst = reinterpret_cast<uint8_t*>(out);
+  while (size != 0) {
+    if (pos_ == ORAM_PRG_BUFFER_SIZE) {
+      Refill();
+    }
+
+    const size_t length = std::min(size, ORAM_PRG_BUFFER_SIZE - pos_);
+    memcpy(dst, buffer_ + pos_, length);
+    // Bytes handed out must not stay around.
+    sodium_memzero(buffer_ + pos_, length);
+    pos_ += length;
+    dst += length;
+    size -= length;
+  }
+}
+
+uint32_t Prg::Uniform(uint32_t bound) {
+  // Rejecting the values above the largest multiple of `bound` removes the
+  // modulo bias.
+  const uint32_t max_acceptable_value =
+      (std::numeric_limits<uint32_t>::max() / bound) * bound - 1;
+  uint32_t value;
+  do {
+    Fill(&value, sizeof(value));
+  } while (value > max_acceptable_value);
+
+  return value % bound;
+}
+}  // namespace oram_crypto
@@ -0,0 +1,58 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef ORAM_IMPL_BASE_ORAM_PRG_H_
+#define ORAM_IMPL_BASE_ORAM_PRG_H_
+
+#include <sodium.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#define ORAM_PRG_BUFFER_SIZE 4096ul
+
+namespace oram_crypto {
+// A buffered ChaCha20 keystream generator seeded from the system RNG.
+//
+// Random bytes are handed out of a buffer of keystream that is refilled once
+// it runs dry, so the system RNG is queried once per thread instead of once
+// per sample. On every refill the first bytes of the new keystream replace
+// the key and are never handed out ("fast key erasure"), so a leaked state
+// does not reveal the bytes handed out before.
+//
+// Not thread-safe; use `Prg::ThreadLocal`.
+class Prg {
+  uint8_t key_[crypto_stream_chacha20_ietf_KEYBYTES];
+  uint8_t buffer_[ORAM_PRG_BUFFER_SIZE];
+  size_t pos_;
+
+  void Refill(void);
+
+ public:
+  Prg();
+
+  // The generator of the calling thread.
+  static Prg& ThreadLocal(void);
+
+  void Fill(void* const out, size_t size);
+  // Uniform in [0, bound); `bound` must be positive.
+  uint32_t Uniform(uint32_t bound);
+
+  ~Prg();
+};
+}  // namespace oram_crypto
+
+#endif  // ORAM_IMPL_BASE_ORAM_PRG_H_
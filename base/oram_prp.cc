@@ -0,0 +1,228 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "oram_prp.h"
+
+#include <cstring>
+#include <utility>
+
+#include "oram_defs.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define ORAM_PRP_HAS_AESNI 1
+#endif
+
+namespace oram_crypto {
+// The number of blocks encrypted together on the AES-NI path.
+static const size_t kPrpLanes = 8;
+
+static inline uint32_t Mask(uint32_t bits) { return (1u << bits) - 1; }
+
+#ifdef ORAM_PRP_HAS_AESNI
+#define ORAM_PRP_AESNI_TARGET __attribute__((target("aes,sse4.1")))
+
+ORAM_PRP_AESNI_TARGET static inline __m128i KeyExpandStep(__m128i key,
+                                                          __m128i keygened) {
+  keygened = _mm_shuffle_epi32(keygened, _MM_SHUFFLE(3, 3, 3, 3));
+  key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+  key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+  key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+  return _mm_xor_si128(key, keygened);
+}
+
+// The AES-128 key schedule.
+ORAM_PRP_AESNI_TARGET static void ExpandKey(const uint8_t* key,
+                                            __m128i* const rk) {
+  rk[0] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(key));
+#define ORAM_PRP_EXPAND(i, rcon) \
+  rk[i] = KeyExpandStep(rk[i - 1], _mm_aeskeygenassist_si128(rk[i - 1], rcon))
+  ORAM_PRP_EXPAND(1, 0x01);
+  ORAM_PRP_EXPAND(2, 0x02);
+  ORAM_PRP_EXPAND(3, 0x04);
+  ORAM_PRP_EXPAND(4, 0x08);
+  ORAM_PRP_EXPAND(5, 0x10);
+  ORAM_PRP_EXPAND(6, 0x20);
+  ORAM_PRP_EXPAND(7, 0x40);
+  ORAM_PRP_EXPAND(8, 0x80);
+  ORAM_PRP_EXPAND(9, 0x1b);
+  ORAM_PRP_EXPAND(10, 0x36);
+#undef ORAM_PRP_EXPAND
+}
+
+// The AES rounds of the lanes are interleaved so that the latency of `aesenc`
+// is hidden.
+ORAM_PRP_AESNI_TARGET void Prp::BuildTablesAesni(const uint8_t* key) {
+  __m128i rk[11];
+  ExpandKey(key, rk);
+
+  for (uint32_t r = 0; r < ORAM_PRP_ROUNDS; r++) {
+    std::vector<uint16_t>& table = round_tables_[r];
+    for (size_t b = 0; b < table.size(); b += kPrpLanes) {
+      __m128i block[kPrpLanes];
+      for (size_t l = 0; l < kPrpLanes; l++) {
+        block[l] = _mm_xor_si128(_mm_set_epi32(0, 0, r, b + l), rk[0]);
+      }
+      for (size_t k = 1; k < 10; k++) {
+        for (size_t l = 0; l < kPrpLanes; l++) {
+          block[l] = _mm_aesenc_si128(block[l], rk[k]);
+        }
+      }
+      for (size_t l = 0; l < kPrpLanes && b + l < table.size(); l++) {
+        block[l] = _mm_aesenclast_si128(block[l], rk[10]);
+        table[b + l] = _mm_cvtsi128_si32(block[l]);
+      }
+    }
+  }
+
+  sodium_memzero(rk, sizeof(rk));
+}
+#else
+void Prp::BuildTablesAesni(const uint8_t* key) {
+  BuildTablesSipHash(key + 16);
+}
+#endif
+
+void Prp::BuildTablesSipHash(const uint8_t* key) {
+  for (uint32_t r = 0; r < ORAM_PRP_ROUNDS; r++) {
+    std::vector<uint16_t>& table = round_tables_[r];
+    for (uint32_t b = 0; b < table.size(); b++) {
+      const uint32_t in[2] = {b, r};
+      uint8_t hash[crypto_shorthash_BYTES];
+      crypto_shorthash(hash, reinterpret_cast<const uint8_t*>(in), sizeof(in),
+                       key);
+      memcpy(&table[b], hash, sizeof(uint16_t));
+    }
+  }
+}
+
+Prp::Prp(uint32_t domain, const uint8_t* key) : domain_(domain) {
+  // At least one bit on each side.
+  uint32_t bits = 2;
+  while ((1ull << bits) < domain_) {
+    bits++;
+  }
+  left_bits_ = bits / 2;
+  right_bits_ = bits - left_bits_;
+
+  // The round function of round r is applied to the right half of its input,
+  // whose width alternates between the two halves.
+  for (uint32_t r = 0; r < ORAM_PRP_ROUNDS; r++) {
+    round_tables_[r].resize(POW2((r % 2 == 0) ? right_bits_ : left_bits_));
+  }
+
+  bool use_aesni = false;
+#ifdef ORAM_PRP_HAS_AESNI
+  __builtin_cpu_init();
+  use_aesni = __builtin_cpu_supports("aes");
+#endif
+  if (use_aesni) {
+    BuildTablesAesni(key);
+  } else {
+    BuildTablesSipHash(key + 16);
+  }
+}
+
+Prp::~Prp() {
+  for (auto& table : round_tables_) {
+    sodium_memzero(table.data(), table.size() * sizeof(uint16_t));
+  }
+}
+
+uint32_t Prp::Encrypt(uint32_t x) const {
+  uint32_t a = x >> right_bits_;
+  uint32_t b = x & Mask(right_bits_);
+  uint32_t width_a = left_bits_;
+  uint32_t width_b = right_bits_;
+
+  for (uint32_t r = 0; r < ORAM_PRP_ROUNDS; r++) {
+    const uint32_t next_b = (a ^ round_tables_[r][b]) & Mask(width_a);
+    a = b;
+    b = next_b;
+    std::swap(width_a, width_b);
+  }
+
+  return (a << width_b) | b;
+}
+
+uint32_t Prp::Permute(uint32_t x) const {
+  // Cycle-walking.
+  do {
+    x = Encrypt(x);
+  } while (x >= domain_);
+
+  return x;
+}
+
+void Prp::PermuteBatch(const uint32_t* in, uint32_t* const out,
+                       size_t num) const {
+  // The chains of table lookups of a single index are sequential, so we walk
+  // `kPrpLanes` indices in lockstep to overlap their memory latencies. A lane
+  // that lands inside the domain picks up the next index; idle lanes are
+  // harmless.
+  uint32_t lanes[kPrpLanes] = {0};
+  size_t owner[kPrpLanes];
+  bool active[kPrpLanes];
+  size_t next = 0;
+  size_t active_num = 0;
+  for (size_t l = 0; l < kPrpLanes; l++) {
+    active[l] = next < num;
+    if (active[l]) {
+      owner[l] = next;
+      lanes[l] = in[next++];
+      active_num++;
+    }
+  }
+
+  while (active_num != 0) {
+    uint32_t a[kPrpLanes];
+    uint32_t b[kPrpLanes];
+    for (size_t l = 0; l < kPrpLanes; l++) {
+      a[l] = lanes[l] >> right_bits_;
+      b[l] = lanes[l] & Mask(right_bits_);
+    }
+
+    uint32_t width_a = left_bits_;
+    uint32_t width_b = right_bits_;
+    for (uint32_t r = 0; r < ORAM_PRP_ROUNDS; r++) {
+      const uint16_t* table = round_tables_[r].data();
+      for (size_t l = 0; l < kPrpLanes; l++) {
+        const uint32_t next_b = (a[l] ^ table[b[l]]) & Mask(width_a);
+        a[l] = b[l];
+        b[l] = next_b;
+      }
+      std::swap(width_a, width_b);
+    }
+
+    for (size_t l = 0; l < kPrpLanes; l++) {
+      lanes[l] = (a[l] << width_b) | b[l];
+      if (!active[l] || lanes[l] >= domain_) {
+        continue;
+      }
+
+      // `in` may alias `out`, but in[owner[l]] has been consumed already.
+      out[owner[l]] = lanes[l];
+      if (next < num) {
+        owner[l] = next;
+        lanes[l] = in[next++];
+      } else {
+        active[l] = false;
+        active_num--;
+      }
+    }
+  }
+}
+}  // namespace oram_crypto
@@ -0,0 +1,66 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef ORAM_IMPL_BASE_ORAM_PRP_H_
+#define ORAM_IMPL_BASE_ORAM_PRP_H_
+
+#include <sodium.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#define ORAM_PRP_KEY_SIZE 32ul
+#define ORAM_PRP_ROUNDS 8
+
+namespace oram_crypto {
+// A keyed pseudorandom permutation over the integers [0, domain).
+//
+// The construction is an alternating (possibly unbalanced) Feistel network over
+// the smallest bit string that covers the domain; values that fall outside the
+// domain are re-encrypted until they land inside it (cycle-walking). Since the
+// bit domain is less than twice as large as the integer domain, less than two
+// encryptions are needed on average.
+//
+// Each half is at most 16 bits wide, so the round functions are tabulated once
+// per key: AES-128 on (round, half) with AES-NI, 8 blocks at a time, or
+// SipHash-2-4 on CPUs without it. Evaluating the permutation afterwards only
+// costs a few table lookups per index.
+class Prp {
+  uint32_t domain_;
+  // The bit widths of the two halves.
+  uint32_t left_bits_;
+  uint32_t right_bits_;
+  // round_tables_[r][b] is the output of the r-th round function on b.
+  std::vector<uint16_t> round_tables_[ORAM_PRP_ROUNDS];
+
+  void BuildTablesAesni(const uint8_t* key);
+  void BuildTablesSipHash(const uint8_t* key);
+  uint32_t Encrypt(uint32_t x) const;
+
+ public:
+  // `key` must hold `ORAM_PRP_KEY_SIZE` bytes; `domain` must be positive.
+  Prp(uint32_t domain, const uint8_t* key);
+
+  uint32_t Permute(uint32_t x) const;
+  // out[i] = Permute(in[i]) for every i in [0, num); `in` may alias `out`.
+  void PermuteBatch(const uint32_t* in, uint32_t* const out, size_t num) const;
+
+  ~Prp();
+};
+}  // namespace oram_crypto
+
+#endif  // ORAM_IMPL_BASE_ORAM_PRP_H_
@@ -19,18 +19,37 @@
 #include <lz4.h>
 #include <spdlog/fmt/bin_to_hex.h>
 #include <spdlog/spdlog.h>
+#ifdef ORAM_HAS_ZSTD
+#include <zstd.h>
+#endif
 
 #include <algorithm>
+#include <atomic>
 #include <cstdarg>
 #include <cstring>
 #include <fstream>
+#include <mutex>
 #include <sstream>
+#include <thread>
 
 #include "oram_crypto.h"
 
 extern std::shared_ptr<spdlog::logger> logger;
 
 namespace oram_utils {
+// The number of blocks handed to a thread at a time by `EncryptBlocks` and
+// `DecryptBlocks`.
+static const size_t kCryptoSliceSize = 64;
+// `ParallelFor` starts its threads on every call, which costs about as much as
+// sealing a few hundred blocks; so each thread is given at least this many
+// blocks, and smaller batches (e.g., a path) are sealed on the calling thread.
+static const size_t kCryptoBlocksPerThread = 1024;
+
+#ifdef ORAM_HAS_ZSTD
+// Favors speed; the blocks are small.
+static const int kZstdLevel = 1;
+#endif
+
 std::string ReadKeyCrtFile(const std::string& path) {
   std::ifstream file(path, std::ifstream::in);
   std::ostringstream oss;
@@ -62,6 +81,44 @@ std::vector<std::string> ReadDataFromFile(const std::string& path) {
   return data;
 }
 
+oram_impl::OramStatus ParallelFor(
+    size_t num, size_t thread_num,
+    const std::function<oram_impl::OramStatus(size_t)>& task) {
+  thread_num = std::max(1ul, std::min(thread_num, num));
+
+  std::atomic_size_t next(0ul);
+  std::mutex status_lock;
+  oram_impl::OramStatus ans = oram_impl::OramStatus::OK;
+
+  auto worker = [&]() {
+    for (size_t i = next++; i < num; i = next++) {
+      oram_impl::OramStatus status = task(i);
+
+      if (!status.ok()) {
+        std::lock_guard<std::mutex> guard(status_lock);
+        if (ans.ok()) {
+          ans = status;
+        }
+        // Other workers will exit on their next fetch.
+        next = num;
+        return;
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < thread_num; i++) {
+    threads.emplace_back(worker);
+  }
+  worker();
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  return ans;
+}
+
 void SafeFree(void* ptr) {
   if (ptr != nullptr) {
     free(ptr);
@@ -181,138 +238,173 @@ void PrintStash(const oram_impl::p_oram_stash_t& stash) {
   }
 }
 
-void PrintOramTree(const oram_impl::server_tree_storage_t& storage) {
-  DBG(logger, "The size of the ORAM tree is {}", storage.size());
-
-  for (auto iter = storage.begin(); iter != storage.end(); ++iter) {
-    DBG(logger, "Tag {}, {}: ", iter->first.first, iter->first.second);
+oram_impl::OramStatus EncryptBlock(oram_impl::oram_block_t* const block,
+                                   oram_crypto::Cryptor* const cryptor) {
+  return EncryptBlocks(block, 1, cryptor);
+}
 
-    for (const auto& block : iter->second) {
-      // Decompress the storage.
-      size_t size;
-      oram_impl::oram_block_t decompressed_block;
-      oram_impl::OramStatus status = DataDecompress(
-          reinterpret_cast<const uint8_t*>(block.data()), block.size(),
-          reinterpret_cast<uint8_t*>(&decompressed_block), &size);
+oram_impl::OramStatus DecryptBlock(oram_impl::oram_block_t* const block,
+                                   oram_crypto::Cryptor* const cryptor) {
+  return DecryptBlocks(block, 1, cryptor);
+}
 
-      if (!status.ok()) {
-        ERRS(logger, status.EmitString());
-      } else {
-        DBG(logger, "id: {}, type: {}", decompressed_block.header.block_id,
-            (int)decompressed_block.header.type);
-      }
-    }
+// Runs `crypt` over slices of at most `kCryptoSliceSize` blocks.
+static oram_impl::OramStatus CryptSlices(
+    oram_impl::oram_block_t* const blocks, size_t num, size_t thread_num,
+    const std::function<oram_impl::OramStatus(oram_impl::oram_block_t* const,
+                                              size_t)>& crypt) {
+  const size_t slice_num = (num + kCryptoSliceSize - 1) / kCryptoSliceSize;
+  thread_num = std::min(thread_num, num / kCryptoBlocksPerThread);
+  if (slice_num <= 1 || thread_num <= 1) {
+    return crypt(blocks, num);
   }
+
+  return ParallelFor(slice_num, thread_num, [&](size_t i) {
+    const size_t begin = i * kCryptoSliceSize;
+    return crypt(blocks + begin, std::min(kCryptoSliceSize, num - begin));
+  });
 }
 
-oram_impl::OramStatus EncryptBlock(oram_impl::oram_block_t* const block,
-                                   oram_crypto::Cryptor* const cryptor) {
-  // First let us generate the iv.
-  oram_impl::OramStatus status =
-      oram_crypto::RandomBytes(block->header.iv, ORAM_CRYPTO_RANDOM_SIZE);
-  CheckStatus(status, "Failed to generate iv!");
-
-  // Second prepare the buffer. The buffer includes part of the header.
-  std::string enc;
-  status =
-      cryptor->Encrypt((uint8_t*)(&block->header) + DEFAULT_ORAM_ENCSKIP_SIZE,
-                       DEFAULT_ORAM_DATA_SIZE + DEFAULT_ORAM_METADATA_SIZE,
-                       block->header.iv, &enc);
+oram_impl::OramStatus EncryptBlocks(oram_impl::oram_block_t* const blocks,
+                                    size_t num,
+                                    oram_crypto::Cryptor* const cryptor,
+                                    size_t thread_num) {
+  oram_impl::OramStatus status = CryptSlices(
+      blocks, num, thread_num,
+      [cryptor](oram_impl::oram_block_t* const slice, size_t length) {
+        return cryptor->EncryptBlocks(slice, length);
+      });
   if (!status.ok()) {
     return status.Append(oram_impl::OramStatus(
         oram_impl::StatusCode::kInvalidArgument,
         "Encryption failed (check if the data size is correct?)", __func__));
   }
 
-  // Third, let us split the mac tag to the header.
-  memcpy(block->header.mac_tag,
-         enc.data() + enc.size() - crypto_aead_aes256gcm_ABYTES,
-         crypto_aead_aes256gcm_ABYTES);
-
-  // Fourth, let us copy the encrypted data to the block.
-  memcpy((uint8_t*)(&block->header) + DEFAULT_ORAM_ENCSKIP_SIZE, enc.data(),
-         enc.size() - crypto_aead_aes256gcm_ABYTES);
-
   return oram_impl::OramStatus::OK;
 }
 
-oram_impl::OramStatus DecryptBlock(oram_impl::oram_block_t* const block,
-                                   oram_crypto::Cryptor* const cryptor) {
-  // First, let us prepare the buffer.
-  uint8_t* enc_data =
-      (uint8_t*)malloc(DEFAULT_ORAM_DATA_SIZE + DEFAULT_ORAM_METADATA_SIZE +
-                       crypto_aead_aes256gcm_ABYTES);
-
-  // Second, let us copy the encrypted data to the buffer.
-  memcpy(enc_data, (uint8_t*)(&block->header) + DEFAULT_ORAM_ENCSKIP_SIZE,
-         DEFAULT_ORAM_DATA_SIZE + DEFAULT_ORAM_METADATA_SIZE);
-
-  // Third, let us copy the mac tag to the buffer.
-  memcpy(enc_data + DEFAULT_ORAM_DATA_SIZE + DEFAULT_ORAM_METADATA_SIZE,
-         block->header.mac_tag, crypto_aead_aes256gcm_ABYTES);
-
-  // Fourth, let us decrypt the data.
-  std::string dec;
-  oram_impl::OramStatus status =
-      cryptor->Decrypt(enc_data,
-                       DEFAULT_ORAM_DATA_SIZE + DEFAULT_ORAM_METADATA_SIZE +
-                           crypto_aead_aes256gcm_ABYTES,
-                       block->header.iv, &dec);
+oram_impl::OramStatus DecryptBlocks(oram_impl::oram_block_t* const blocks,
+                                    size_t num,
+                                    oram_crypto::Cryptor* const cryptor,
+                                    size_t thread_num) {
+  oram_impl::OramStatus status = CryptSlices(
+      blocks, num, thread_num,
+      [cryptor](oram_impl::oram_block_t* const slice, size_t length) {
+        return cryptor->DecryptBlocks(slice, length);
+      });
   if (!status.ok()) {
     return status.Append(oram_impl::OramStatus(
         oram_impl::StatusCode::kInvalidArgument,
         "Decryption failed due to corrupted ciphertext", __func__));
   }
 
-  // Fifth, let us copy the decrypted data to the block.
-  memcpy((uint8_t*)(&block->header) + DEFAULT_ORAM_ENCSKIP_SIZE, dec.data(),
-         dec.size());
-
-  SafeFree(enc_data);
-
   return oram_impl::OramStatus::OK;
 }
 
-oram_impl::OramStatus DataCompress(const uint8_t* data, size_t data_size,
-                                   uint8_t* const out,
+oram_impl::OramStatus DataCompress(oram_impl::BlockCodec codec,
+                                   const uint8_t* data, size_t data_size,
+                                   uint8_t* const out, size_t out_size,
                                    size_t* const compressed_size) {
-  // Compress the source std::string with lz4 compression libarary.
-  // The compressed data will be stored in the destination buffer.
-  // The destination will be pre-allocated by the correct size.
-  const size_t max_allowed_size = LZ4_compressBound(data_size);
-  const size_t res = LZ4_compress_default(reinterpret_cast<const char*>(data),
-                                          reinterpret_cast<char*>(out),
-                                          data_size, max_allowed_size);
-
-  if (res == 0) {
-    return oram_impl::OramStatus(oram_impl::StatusCode::kExternalError,
-                                 "lz4 returned a zero compressed size",
-                                 __func__);
+  switch (codec) {
+    case oram_impl::BlockCodec::kNone: {
+      if (out_size < data_size) {
+        break;
+      }
+
+      memcpy(out, data, data_size);
+      *compressed_size = data_size;
+      return oram_impl::OramStatus::OK;
+    }
+
+    case oram_impl::BlockCodec::kLz4: {
+      const int res = LZ4_compress_default(
+          reinterpret_cast<const char*>(data), reinterpret_cast<char*>(out),
+          data_size, out_size);
+      if (res <= 0) {
+        return oram_impl::OramStatus(oram_impl::StatusCode::kExternalError,
+                                     "lz4 returned a zero compressed size",
+                                     __func__);
+      }
+
+      *compressed_size = res;
+      return oram_impl::OramStatus::OK;
+    }
+
+#ifdef ORAM_HAS_ZSTD
+    case oram_impl::BlockCodec::kZstd: {
+      const size_t res =
+          ZSTD_compress(out, out_size, data, data_size, kZstdLevel);
+      if (ZSTD_isError(res)) {
+        return oram_impl::OramStatus(oram_impl::StatusCode::kExternalError,
+                                     ZSTD_getErrorName(res), __func__);
+      }
+
+      *compressed_size = res;
+      return oram_impl::OramStatus::OK;
+    }
+#endif
+
+    default:
+      return oram_impl::OramStatus(oram_impl::StatusCode::kUnimplemented,
+                                   "The codec is unavailable.", __func__);
   }
 
-  *compressed_size = res;
-  return oram_impl::OramStatus::OK;
+  return oram_impl::OramStatus(oram_impl::StatusCode::kOutOfRange,
+                               "The output buffer is too small.", __func__);
 }
 
-oram_impl::OramStatus DataDecompress(const uint8_t* data, size_t data_size,
-                                     uint8_t* const out,
+oram_impl::OramStatus DataDecompress(oram_impl::BlockCodec codec,
+                                     const uint8_t* data, size_t data_size,
+                                     uint8_t* const out, size_t out_size,
                                      size_t* const decompressed_size) {
-  // Decompress the source std::string with lz4 compression
-  // library.
-  const size_t max_allowed_size = data_size * 2;
-  const size_t res = LZ4_decompress_safe(reinterpret_cast<const char*>(data),
-                                         reinterpret_cast<char*>(out),
-                                         data_size, max_allowed_size);
-
-  if (res == 0) {
-    return oram_impl::OramStatus(
-        oram_impl::StatusCode::kExternalError,
-        "lz4 returned a zero decompressed size (the input may be corrupted)",
-        __func__);
+  // The output is bounded by `out_size` rather than by a guess from the
+  // input size, which does not hold for incompressible data.
+  switch (codec) {
+    case oram_impl::BlockCodec::kNone: {
+      if (out_size < data_size) {
+        break;
+      }
+
+      memcpy(out, data, data_size);
+      *decompressed_size = data_size;
+      return oram_impl::OramStatus::OK;
+    }
+
+    case oram_impl::BlockCodec::kLz4: {
+      const int res = LZ4_decompress_safe(
+          reinterpret_cast<const char*>(data), reinterpret_cast<char*>(out),
+          data_size, out_size);
+      if (res < 0) {
+        return oram_impl::OramStatus(
+            oram_impl::StatusCode::kExternalError,
+            "lz4 failed to decompress (the input may be corrupted)",
+            __func__);
+      }
+
+      *decompressed_size = res;
+      return oram_impl::OramStatus::OK;
+    }
+
+#ifdef ORAM_HAS_ZSTD
+    case oram_impl::BlockCodec::kZstd: {
+      const size_t res = ZSTD_decompress(out, out_size, data, data_size);
+      if (ZSTD_isError(res)) {
+        return oram_impl::OramStatus(oram_impl::StatusCode::kExternalError,
+                                     ZSTD_getErrorName(res), __func__);
+      }
+
+      *decompressed_size = res;
+      return oram_impl::OramStatus::OK;
+    }
+#endif
+
+    default:
+      return oram_impl::OramStatus(oram_impl::StatusCode::kUnimplemented,
+                                   "The codec is unavailable.", __func__);
   }
 
-  *decompressed_size = res;
-  return oram_impl::OramStatus::OK;
+  return oram_impl::OramStatus(oram_impl::StatusCode::kOutOfRange,
+                               "The output buffer is too small.", __func__);
 }
 
 std::string TypeToName(oram_impl::OramType oram_type) {
@@ -327,6 +419,8 @@ std::string TypeToName(oram_impl::OramType oram_type) {
       return "PartitionOram";
     case oram_impl::OramType::kCuckooOram:
       return "CuckooOram";
+    case oram_impl::OramType::kLayeredOram:
+      return "LayeredOram";
 
     default:
       return "InvalidOram";
@@ -356,10 +450,63 @@ oram_impl::OramType StrToType(const std::string& type) {
     return oram_impl::OramType::kPartitionOram;
   } else if (type == "CuckooOram") {
     return oram_impl::OramType::kCuckooOram;
+  } else if (type == "LayeredOram") {
+    return oram_impl::OramType::kLayeredOram;
   } else if (type == "ODS") {
     return oram_impl::OramType::kOds;
   } else {
     return oram_impl::OramType::kInvalid;
   }
 }
+
+oram_impl::TreeStorageEngineType StrToEngineType(const std::string& engine) {
+  if (engine == "Map") {
+    return oram_impl::TreeStorageEngineType::kMap;
+  } else if (engine == "Array") {
+    return oram_impl::TreeStorageEngineType::kArray;
+  } else if (engine == "Mmap") {
+    return oram_impl::TreeStorageEngineType::kMmap;
+  } else if (engine == "Uring") {
+    return oram_impl::TreeStorageEngineType::kUring;
+  } else {
+    return oram_impl::TreeStorageEngineType::kInvalid;
+  }
+}
+
+oram_impl::BlockCodec StrToCodec(const std::string& codec) {
+  if (codec == "None") {
+    return oram_impl::BlockCodec::kNone;
+  } else if (codec == "LZ4") {
+    return oram_impl::BlockCodec::kLz4;
+  } else if (codec == "Zstd") {
+    return oram_impl::BlockCodec::kZstd;
+  } else {
+    return oram_impl::BlockCodec::kInvalid;
+  }
+}
+
+oram_impl::WalSyncPolicy StrToSyncPolicy(const std::string& policy) {
+  if (policy == "Always") {
+    return oram_impl::WalSyncPolicy::kAlways;
+  } else if (policy == "Periodic") {
+    return oram_impl::WalSyncPolicy::kPeriodic;
+  } else if (policy == "Never") {
+    return oram_impl::WalSyncPolicy::kNever;
+  } else {
+    return oram_impl::WalSyncPolicy::kInvalid;
+  }
+}
+
+std::string CodecToName(oram_impl::BlockCodec codec) {
+  switch (codec) {
+    case oram_impl::BlockCodec::kNone:
+      return "None";
+    case oram_impl::BlockCodec::kLz4:
+      return "LZ4";
+    case oram_impl::BlockCodec::kZstd:
+      return "Zstd";
+    default:
+      return "Invalid";
+  }
+}
 }  // namespace oram_utils
@@ -18,8 +18,13 @@
 #define ORAM_IMPL_BASE_ORAM_UTILS_H_
 
 #include <cassert>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <utility>
 
 #include "oram_crypto.h"
 #include "oram_defs.h"
@@ -45,6 +50,7 @@
 #define DBG(logger, fmt, ...) logger->debug(fmt, ##__VA_ARGS__)
 #define ERRS(logger, fmt, ...) logger->error(fmt, ##__VA_ARGS__)
 #define INFO(logger, fmt, ...) logger->info(fmt, ##__VA_ARGS__)
+#define WARN(logger, fmt, ...) logger->warn(fmt, ##__VA_ARGS__)
 
 namespace oram_utils {
 std::string ReadKeyCrtFile(const std::string& path);
@@ -64,16 +70,21 @@ constexpr typename std::underlying_type<E>::type to_underlying(E e) noexcept {
 
 template <typename T>
 void PermuteBy(const std::vector<uint32_t>& perm, std::vector<T>& arr) {
-  // A temporary buffer.
-  std::vector<T> clone = arr;
-
-  for (size_t i = 0; i < arr.size(); i++) {
-    // Perm[i] = The i-th element is placed to perm[i]-th position.
-    clone[perm[i]] = arr[i];
+  // Perm[i] = The i-th element is placed to perm[i]-th position. The cycles of
+  // the permutation are followed in place, so `arr` is never copied.
+  std::vector<bool> visited(arr.size(), false);
+  for (size_t start = 0; start < arr.size(); start++) {
+    if (visited[start]) {
+      continue;
+    }
+
+    visited[start] = true;
+    for (size_t cur = perm[start]; cur != start; cur = perm[cur]) {
+      // arr[start] holds the element that belongs to `cur`.
+      std::swap(arr[start], arr[cur]);
+      visited[cur] = true;
+    }
   }
-
-  arr.clear();
-  arr.assign(clone.begin(), clone.end());
 }
 
 template <typename... Args>
@@ -102,6 +113,62 @@ oram_impl::OramStatus TryExec(Fn&& target_func) {
 
 std::vector<std::string> ReadDataFromFile(const std::string& path);
 
+// Runs `task(i)` for every i in [0, num) on `thread_num` threads (including the
+// calling one). Stops handing out new indices after the first failure and
+// returns that status.
+oram_impl::OramStatus ParallelFor(
+    size_t num, size_t thread_num,
+    const std::function<oram_impl::OramStatus(size_t)>& task);
+
+// A blocking FIFO of bounded capacity connecting the stages of a pipeline.
+// Once closed, `Push` fails and `Pop` drains what is left before failing.
+template <typename T>
+class BoundedQueue {
+  const size_t capacity_;
+  bool closed_;
+  std::deque<T> items_;
+  std::mutex lock_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+
+ public:
+  explicit BoundedQueue(size_t capacity)
+      : capacity_(capacity), closed_(false) {}
+
+  bool Push(T&& item) {
+    std::unique_lock<std::mutex> guard(lock_);
+    not_full_.wait(guard,
+                   [this] { return closed_ || items_.size() < capacity_; });
+    if (closed_) {
+      return false;
+    }
+
+    items_.emplace_back(std::move(item));
+    not_empty_.notify_one();
+    return true;
+  }
+
+  bool Pop(T* const item) {
+    std::unique_lock<std::mutex> guard(lock_);
+    not_empty_.wait(guard, [this] { return closed_ || !items_.empty(); });
+    if (items_.empty()) {
+      return false;
+    }
+
+    *item = std::move(items_.front());
+    items_.pop_front();
+    not_full_.notify_one();
+    return true;
+  }
+
+  void Close(void) {
+    std::lock_guard<std::mutex> guard(lock_);
+    closed_ = true;
+    not_empty_.notify_all();
+    not_full_.notify_all();
+  }
+};
+
 std::vector<std::string> SerializeToStringVector(
     const oram_impl::p_oram_bucket_t& bucket);
 
@@ -128,20 +195,33 @@ void PadStash(oram_impl::p_oram_stash_t* const stash, const size_t bucket_size);
 
 void PrintStash(const oram_impl::p_oram_stash_t& stash);
 
-void PrintOramTree(const oram_impl::server_tree_storage_t& storage);
-
 oram_impl::OramStatus EncryptBlock(oram_impl::oram_block_t* const block,
                                    oram_crypto::Cryptor* const cryptor);
 
 oram_impl::OramStatus DecryptBlock(oram_impl::oram_block_t* const block,
                                    oram_crypto::Cryptor* const cryptor);
 
-oram_impl::OramStatus DataCompress(const uint8_t* data, size_t data_size,
-                                   uint8_t* const out,
+// Encrypt or decrypt `num` contiguous blocks in place, in slices spread over
+// `thread_num` threads.
+oram_impl::OramStatus EncryptBlocks(oram_impl::oram_block_t* const blocks,
+                                    size_t num,
+                                    oram_crypto::Cryptor* const cryptor,
+                                    size_t thread_num = 1);
+
+oram_impl::OramStatus DecryptBlocks(oram_impl::oram_block_t* const blocks,
+                                    size_t num,
+                                    oram_crypto::Cryptor* const cryptor,
+                                    size_t thread_num = 1);
+
+// `out` holds at most `out_size` bytes.
+oram_impl::OramStatus DataCompress(oram_impl::BlockCodec codec,
+                                   const uint8_t* data, size_t data_size,
+                                   uint8_t* const out, size_t out_size,
                                    size_t* const compressed_size);
 
-oram_impl::OramStatus DataDecompress(const uint8_t* data, size_t data_size,
-                                     uint8_t* const out,
+oram_impl::OramStatus DataDecompress(oram_impl::BlockCodec codec,
+                                     const uint8_t* data, size_t data_size,
+                                     uint8_t* const out, size_t out_size,
                                      size_t* const decompressed_size);
 
 std::string TypeToName(oram_impl::OramType oram_type);
@@ -149,6 +229,14 @@ std::string TypeToName(oram_impl::OramType oram_type);
 std::vector<std::string> split(const std::string& str, char delim);
 
 oram_impl::OramType StrToType(const std::string& type);
+
+oram_impl::TreeStorageEngineType StrToEngineType(const std::string& engine);
+
+oram_impl::BlockCodec StrToCodec(const std::string& codec);
+
+oram_impl::WalSyncPolicy StrToSyncPolicy(const std::string& policy);
+
+std::string CodecToName(oram_impl::BlockCodec codec);
 }  // namespace oram_utils
 
 #endif  // ORAM_IMPL_BASE_ORAM_UTILS_H_
\ No newline at end of file
@@ -23,7 +23,8 @@ extern std::shared_ptr<spdlog::logger> logger;
 namespace oram_impl {
 
 static std::shared_ptr<oram_server::Stub> CreateStub(
-    const std::string& address, uint32_t port, const std::string& crt_path) {
+    const std::string& address, uint32_t port, const std::string& crt_path,
+    uint32_t channel_id = 0) {
   const std::string full_address = oram_utils::StrCat(address, ":", port);
 
   // Configure the SSL connection.
@@ -33,26 +34,40 @@ static std::shared_ptr<oram_server::Stub> CreateStub(
   std::shared_ptr<grpc::ChannelCredentials> ssl_creds =
       grpc::SslCredentials(ssl_opts);
 
+  // Channels with identical arguments would share one connection, so each
+  // channel gets a private subchannel pool.
+  grpc::ChannelArguments args;
+  args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+  args.SetInt("oram.channel_id", channel_id);
+
   // Make this stub shared among all.
-  return oram_server::NewStub(grpc::CreateChannel(full_address, ssl_creds));
+  return oram_server::NewStub(
+      grpc::CreateCustomChannel(full_address, ssl_creds, args));
 }
 
 OramClient::OramClient(const OramConfig& config) : config_(config) {
-  std::shared_ptr<oram_server::Stub> stub;
+  std::vector<std::shared_ptr<oram_server::Stub>> stubs;
+  // Only the Partition ORAM talks to the server on multiple channels.
+  const size_t channel_num = config.oram_type == OramType::kPartitionOram
+                                 ? std::max(config.thread_num, 1ul)
+                                 : 1ul;
 
   // Check if the proxy should be enabled.
   // If the `enable_proxy` is set to `true`, then the user may need to manaully
   // configure the envoy proxy server in `envoy.yaml`.
-  if (!config.enable_proxy) {
-    stub = std::move(
-        CreateStub(config.server_address, config.server_port, config.crt_path));
+  for (size_t i = 0; i < channel_num; i++) {
+    if (!config.enable_proxy) {
+      stubs.emplace_back(CreateStub(config.server_address, config.server_port,
+                                    config.crt_path, i));
 
-    // Unset it.
-    unsetenv("https_proxy");
-  } else {
-    stub = std::move(
-        CreateStub(config.proxy_address, config.proxy_port, config.crt_path));
+      // Unset it.
+      unsetenv("https_proxy");
+    } else {
+      stubs.emplace_back(CreateStub(config.proxy_address, config.proxy_port,
+                                    config.crt_path, i));
+    }
   }
+  std::shared_ptr<oram_server::Stub> stub = stubs.front();
 
   // Initialize the cryptor.
   oram_crypto::Cryptor::GetInstance();
@@ -70,12 +85,27 @@ OramClient::OramClient(const OramConfig& config) : config_(config) {
       break;
     }
     case OramType::kPartitionOram: {
-      oram_controller_ = std::move(PartitionOramController::GetInstance());
+      std::unique_ptr<PartitionOramController> controller =
+          PartitionOramController::GetInstance(config.id);
+      controller->SetSubOramType(config.partition_backend);
+      controller->SetThreadNum(config.thread_num);
+      controller->SetAsyncEviction(config.async_eviction,
+                                   config.max_slot_occupancy);
+      controller->SetStubs(stubs);
+      oram_controller_ = std::move(controller);
+      break;
+    }
+    case OramType::kCuckooOram: {
+      oram_controller_ = std::make_unique<CuckooOramController>(
+          config.id, true, config.block_num);
       break;
     }
     case OramType::kSquareOram: {
-      oram_controller_ = std::move(std::make_unique<SquareRootOramController>(
-          config.id, true, config.block_num));
+      std::unique_ptr<SquareRootOramController> controller =
+          std::make_unique<SquareRootOramController>(config.id, true,
+                                                     config.block_num);
+      controller->SetBackgroundShuffle(config.sqrt_background_shuffle);
+      oram_controller_ = std::move(controller);
       break;
     }
     default: {
@@ -120,6 +150,36 @@ OramStatus OramClient::Write(uint32_t address, oram_block_t* const block) {
   return status;
 }
 
+OramStatus OramClient::AccessBatch(const std::vector<Operation>& op_types,
+                                   const std::vector<uint32_t>& addresses,
+                                   std::vector<oram_block_t>* const blocks) {
+  OramStatus status = OramStatus::OK;
+  if (oram_controller_->GetOramType() == OramType::kLinearOram) {
+    LinearOramController* const linear_oram_controller =
+        oram_utils::TryCast<OramController, LinearOramController>(
+            oram_controller_.get());
+
+    status = linear_oram_controller->AccessBatch(op_types, addresses, blocks);
+  } else if (op_types.size() != addresses.size() ||
+             blocks->size() != addresses.size()) {
+    status = OramStatus(StatusCode::kInvalidArgument,
+                        "The sizes of the batch do not match", __func__);
+  } else {
+    for (size_t i = 0; i < addresses.size() && status.ok(); i++) {
+      status = oram_controller_->Access(op_types[i], addresses[i],
+                                        &(*blocks)[i]);
+    }
+  }
+
+  if (!status.ok()) {
+    return status.Append(OramStatus(StatusCode::kInvalidOperation,
+                                    "The client cannot access the batch!",
+                                    __func__));
+  }
+
+  return status;
+}
+
 OramStatus OramClient::Ready(void) {
   auto cryptor_ = oram_crypto::Cryptor::GetInstance();
 
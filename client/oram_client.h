@@ -32,6 +32,11 @@ class OramClient {
   // READ / WRITE Interfaces.
   OramStatus Read(uint32_t address, oram_block_t* const block);
   OramStatus Write(uint32_t address, oram_block_t* const block);
+  // Runs the operations in order. The Linear ORAM answers the whole batch with
+  // a single scan; the other ORAMs access the blocks one by one.
+  OramStatus AccessBatch(const std::vector<Operation>& op_types,
+                         const std::vector<uint32_t>& addresses,
+                         std::vector<oram_block_t>* const blocks);
   OramStatus FillWithData(void);
   OramStatus Ready(void);
 
@@ -0,0 +1,804 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "cuckoo_oram_controller.h"
+
+#include <sodium.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+#include <thread>
+
+#include "oram.h"
+#include "base/oram_utils.h"
+
+extern std::shared_ptr<spdlog::logger> logger;
+
+using std::chrono_literals::operator""us;
+
+namespace oram_impl {
+// The number of blocks per message, which is also the window of the sort.
+// Must be a power of two.
+static const size_t kCuckooWindow = 4096;
+// The insertion of an id gives up after this many evictions and resorts to the
+// stash.
+static const size_t kCuckooMaxKicks = 512;
+// The number of hash keys tried before the placement gives up.
+static const size_t kCuckooPlaceRetries = 16;
+// Marks the keys of dummy probes; real block ids never have this bit.
+static const uint32_t kCuckooDummyFlag = 0x80000000;
+
+static size_t CryptoThreadNum(void) {
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// A dummy whose block id holds its sort key.
+static void FillCuckooDummy(oram_block_t* const block, uint32_t key) {
+  memset(reinterpret_cast<void*>(block), 0, ORAM_BLOCK_SIZE);
+  block->header.type = BlockType::kDummy;
+  block->header.block_id = key;
+}
+
+CuckooOramController::CuckooOramController(uint32_t id, bool standalone,
+                                           size_t block_num)
+    : OramController(id, standalone, block_num, OramType::kCuckooOram),
+      top_num_(0ul),
+      network_time_(0us),
+      network_communication_(0ul) {
+  PANIC_IF(block_num >= kCuckooDummyFlag, "Too many blocks!");
+
+  top_size_ = std::max<size_t>(
+      4ul, std::ceil(LOG_BASE(std::max<size_t>(block_num, 2ul), 2)));
+  // Level i >= 1 holds T * 2^{i - 1} blocks, and the last one holds them all.
+  level_num_ = 2;
+  while (top_size_ * (1ul << (level_num_ - 2)) < block_num) {
+    level_num_++;
+  }
+  scratch_level_ = level_num_;
+
+  keys_.resize(level_num_);
+  table_sizes_.resize(level_num_, 0ul);
+  stash_sizes_.resize(level_num_, 0ul);
+  filled_.resize(level_num_, false);
+  stale_.resize(level_num_);
+  dummy_counters_.resize(level_num_, 0ul);
+  for (uint32_t i = 1; i < level_num_; i++) {
+    const size_t capacity = LevelCapacity(i);
+    table_sizes_[i] = capacity + capacity / 8 + 1;
+    stash_sizes_[i] = std::max<size_t>(
+        2ul, std::ceil(LOG_BASE(std::max<size_t>(capacity, 2ul), 2)));
+  }
+
+  DBG(logger,
+      "CuckooORAM Config:\nid: {}, block_num: {}, level_num: {}, top size: "
+      "{}\n",
+      id_, block_num_, level_num_, top_size_);
+}
+
+size_t CuckooOramController::LevelCapacity(uint32_t level) const {
+  if (level == 0) {
+    return top_size_;
+  } else if (level == level_num_ - 1) {
+    return block_num_;
+  }
+
+  return std::min(block_num_, top_size_ << (level - 1));
+}
+
+size_t CuckooOramController::LevelSize(uint32_t level) const {
+  return level == 0 ? top_size_
+                    : 2 * table_sizes_[level] + stash_sizes_[level];
+}
+
+size_t CuckooOramController::ReportNetworkCommunication(void) const {
+  return network_communication_ * ORAM_BLOCK_SIZE;
+}
+
+uint32_t CuckooOramController::Hash(uint32_t level, uint32_t table,
+                                    uint32_t id) const {
+  const uint32_t in[2] = {id, table};
+  uint8_t out[crypto_shorthash_BYTES];
+  crypto_shorthash(out, reinterpret_cast<const uint8_t*>(in), sizeof(in),
+                   keys_[level].data());
+
+  uint64_t hash;
+  memcpy(&hash, out, sizeof(hash));
+  return table * table_sizes_[level] + hash % table_sizes_[level];
+}
+
+OramStatus CuckooOramController::Place(uint32_t level,
+                                       const std::vector<uint32_t>& ids,
+                                       slot_list_t* const slots) {
+  const size_t table_size = table_sizes_[level];
+
+  for (size_t attempt = 0; attempt < kCuckooPlaceRetries; attempt++) {
+    keys_[level].resize(crypto_shorthash_KEYBYTES);
+    randombytes_buf(keys_[level].data(), keys_[level].size());
+
+    // [slot] -> id.
+    std::vector<uint32_t> tables(2 * table_size, kInvalidMask);
+    std::vector<uint32_t> stash;
+    for (uint32_t cur : ids) {
+      uint32_t table = 0;
+      for (size_t kicks = 0; kicks < kCuckooMaxKicks; kicks++) {
+        const uint32_t slot = Hash(level, table, cur);
+        std::swap(cur, tables[slot]);
+        if (cur == kInvalidMask) {
+          break;
+        }
+
+        // The evicted id moves to its slot in the other table.
+        table = slot < table_size ? 1 : 0;
+      }
+
+      if (cur != kInvalidMask) {
+        stash.emplace_back(cur);
+      }
+    }
+
+    if (stash.size() > stash_sizes_[level]) {
+      DBG(logger, "The stash of level {} overflows; trying another key.",
+          level);
+      continue;
+    }
+
+    slots->clear();
+    slots->reserve(ids.size());
+    for (size_t i = 0; i < tables.size(); i++) {
+      if (tables[i] != kInvalidMask) {
+        slots->emplace_back(tables[i], i);
+      }
+    }
+    for (size_t i = 0; i < stash.size(); i++) {
+      slots->emplace_back(stash[i], tables.size() + i);
+    }
+    std::sort(slots->begin(), slots->end());
+
+    return OramStatus::OK;
+  }
+
+  return OramStatus(
+      StatusCode::kUnknownError,
+      oram_utils::StrCat("Cannot build the cuckoo table of level ", level),
+      __func__);
+}
+
+OramStatus CuckooOramController::InitOram(void) {
+  grpc::ClientContext context;
+  InitLayeredOramRequest request;
+  google::protobuf::Empty empty;
+
+  ASSEMBLE_HEADER(request, id_, instance_hash_, GetVersion());
+  // One more level serves as the scratch space of the rebuilds.
+  request.set_level_num(level_num_ + 1);
+  request.set_block_size(ORAM_BLOCK_SIZE);
+
+  grpc::Status status = stub_->InitLayeredOram(&context, request, &empty);
+  if (!status.ok()) {
+    return OramStatus(StatusCode::kServerError, status.error_message(),
+                      __func__);
+  }
+
+  return OramStatus::OK;
+}
+
+OramStatus CuckooOramController::FillWithData(
+    const std::vector<oram_block_t>& data) {
+  // All the blocks go to the last level. The client holds all of them anyway,
+  // so the table is built locally.
+  const uint32_t level = level_num_ - 1;
+  std::vector<uint32_t> ids;
+  // (id, index in `data`), sorted like the slots.
+  std::vector<std::pair<uint32_t, uint32_t>> indices;
+  for (size_t i = 0; i < data.size(); i++) {
+    if (data[i].header.type == BlockType::kNormal) {
+      ids.emplace_back(data[i].header.block_id);
+      indices.emplace_back(data[i].header.block_id, i);
+    }
+  }
+
+  if (ids.size() > LevelCapacity(level)) {
+    return OramStatus(StatusCode::kOutOfRange, "Too many blocks", __func__);
+  }
+
+  slot_list_t slots;
+  OramStatus status = Place(level, ids, &slots);
+  if (!status.ok()) {
+    return status;
+  }
+  std::vector<uint32_t>().swap(ids);
+  std::sort(indices.begin(), indices.end());
+
+  const size_t level_size = LevelSize(level);
+  std::vector<uint32_t> occupants(level_size, kInvalidMask);
+  for (size_t i = 0; i < slots.size(); i++) {
+    occupants[slots[i].second] = indices[i].second;
+  }
+  slot_list_t().swap(slots);
+  std::vector<std::pair<uint32_t, uint32_t>>().swap(indices);
+
+  if (!(status = LevelControl(kLayeredAllocate, level, level_size, 0, {}))
+           .ok()) {
+    return status;
+  }
+  for (size_t begin = 0; begin < level_size; begin += kCuckooWindow) {
+    const size_t end = std::min(level_size, begin + kCuckooWindow);
+    std::vector<oram_block_t> blocks(end - begin);
+    for (size_t i = begin; i < end; i++) {
+      if (occupants[i] == kInvalidMask) {
+        FillCuckooDummy(&blocks[i - begin], kInvalidMask);
+      } else {
+        blocks[i - begin] = data[occupants[i]];
+      }
+    }
+
+    if (!(status = WriteRange(level, begin, blocks)).ok()) {
+      return status;
+    }
+  }
+
+  filled_[level] = true;
+  stale_[level].assign(level_size, false);
+  dummy_counters_[level] = 0;
+
+  // Level 0 starts empty.
+  std::vector<oram_block_t> top(top_size_);
+  for (auto& block : top) {
+    FillCuckooDummy(&block, kInvalidMask);
+  }
+  top_num_ = 0;
+  if (!(status = WriteTop(top, {})).ok()) {
+    return status;
+  }
+
+  // Set initialized.
+  is_initialized_ = true;
+
+  return OramStatus::OK;
+}
+
+OramStatus CuckooOramController::ReadBlocks(
+    const std::vector<uint32_t>& levels, const std::vector<uint32_t>& offsets,
+    std::vector<oram_block_t>* const blocks) {
+  grpc::ClientContext context;
+  ReadLayeredRequest request;
+  LayeredBlocksMessage response;
+
+  ASSEMBLE_HEADER(request, id_, instance_hash_, GetVersion());
+  request.mutable_levels()->Add(levels.begin(), levels.end());
+  request.mutable_offsets()->Add(offsets.begin(), offsets.end());
+
+  auto begin = std::chrono::high_resolution_clock::now();
+  grpc::Status status = stub_->ReadLayeredBlocks(&context, request, &response);
+  auto end = std::chrono::high_resolution_clock::now();
+
+  network_time_ +=
+      std::chrono::duration_cast<std::chrono::microseconds>(end - begin);
+
+  if (!status.ok()) {
+    return OramStatus(StatusCode::kServerError, status.error_message(),
+                      __func__);
+  }
+
+  network_communication_ += response.contents_size();
+
+  // Append to what is already there.
+  const size_t base = blocks->size();
+  blocks->resize(base + response.contents_size());
+  for (int i = 0; i < response.contents_size(); i++) {
+    oram_utils::ConvertToBlock(response.contents(i), &(*blocks)[base + i]);
+  }
+  return oram_utils::DecryptBlocks(blocks->data() + base,
+                                   response.contents_size(), cryptor_.get(),
+                                   CryptoThreadNum());
+}
+
+OramStatus CuckooOramController::ReadRange(
+    uint32_t level, size_t offset, size_t num,
+    std::vector<oram_block_t>* const blocks) {
+  for (size_t begin = 0; begin < num; begin += kCuckooWindow) {
+    const size_t length = std::min(kCuckooWindow, num - begin);
+    std::vector<uint32_t> offsets(length);
+    std::iota(offsets.begin(), offsets.end(), offset + begin);
+
+    OramStatus status = ReadBlocks(std::vector<uint32_t>(length, level),
+                                   offsets, blocks);
+    if (!status.ok()) {
+      return status;
+    }
+  }
+
+  return OramStatus::OK;
+}
+
+OramStatus CuckooOramController::WriteRange(uint32_t level, size_t offset,
+                                            std::vector<oram_block_t>& blocks) {
+  // Re-encrypt everything so that the server cannot link the blocks.
+  OramStatus status = oram_utils::EncryptBlocks(
+      blocks.data(), blocks.size(), cryptor_.get(), CryptoThreadNum());
+  if (!status.ok()) {
+    return status;
+  }
+
+  std::vector<std::string> contents(blocks.size());
+  for (size_t i = 0; i < blocks.size(); i++) {
+    oram_utils::ConvertToString(&blocks[i], &contents[i]);
+  }
+
+  for (size_t begin = 0; begin < contents.size(); begin += kCuckooWindow) {
+    const size_t end = std::min(contents.size(), begin + kCuckooWindow);
+
+    grpc::ClientContext context;
+    WriteLayeredRangeRequest request;
+    google::protobuf::Empty empty;
+    ASSEMBLE_HEADER(request, id_, instance_hash_, GetVersion());
+    request.set_level(level);
+    request.set_offset(offset + begin);
+    for (size_t i = begin; i < end; i++) {
+      request.add_contents(std::move(contents[i]));
+    }
+
+    network_communication_ += end - begin;
+
+    auto begin_time = std::chrono::high_resolution_clock::now();
+    grpc::Status status = stub_->WriteLayeredRange(&context, request, &empty);
+    auto end_time = std::chrono::high_resolution_clock::now();
+
+    network_time_ += std::chrono::duration_cast<std::chrono::microseconds>(
+        end_time - begin_time);
+
+    if (!status.ok()) {
+      return OramStatus(StatusCode::kServerError, status.error_message(),
+                        __func__);
+    }
+  }
+
+  return OramStatus::OK;
+}
+
+OramStatus CuckooOramController::WriteTop(
+    std::vector<oram_block_t>& blocks,
+    const std::vector<uint32_t>& cleared_levels) {
+  grpc::ClientContext context;
+  WriteLayeredRequest request;
+  google::protobuf::Empty empty;
+
+  ASSEMBLE_HEADER(request, id_, instance_hash_, GetVersion());
+  request.set_level(0);
+  request.mutable_cleared_levels()->Add(cleared_levels.begin(),
+                                       cleared_levels.end());
+
+  for (auto& block : blocks) {
+    // Encrypt the block.
+    oram_utils::EncryptBlock(&block, cryptor_.get());
+
+    std::string block_str;
+    oram_utils::ConvertToString(&block, &block_str);
+    request.add_contents(std::move(block_str));
+  }
+
+  network_communication_ += blocks.size();
+
+  auto begin = std::chrono::high_resolution_clock::now();
+  grpc::Status status = stub_->WriteLayeredLevel(&context, request, &empty);
+  auto end = std::chrono::high_resolution_clock::now();
+
+  network_time_ +=
+      std::chrono::duration_cast<std::chrono::microseconds>(end - begin);
+
+  if (!status.ok()) {
+    return OramStatus(StatusCode::kServerError, status.error_message(),
+                      __func__);
+  }
+
+  return OramStatus::OK;
+}
+
+OramStatus CuckooOramController::LevelControl(
+    uint32_t type, uint32_t level, size_t size, uint32_t target,
+    const std::vector<uint32_t>& cleared_levels) {
+  grpc::ClientContext context;
+  LayeredControlRequest request;
+  google::protobuf::Empty empty;
+
+  ASSEMBLE_HEADER(request, id_, instance_hash_, GetVersion());
+  request.set_type(type);
+  request.set_level(level);
+  request.set_size(size);
+  request.set_target(target);
+  request.mutable_cleared_levels()->Add(cleared_levels.begin(),
+                                       cleared_levels.end());
+
+  grpc::Status status = stub_->LayeredLevelControl(&context, request, &empty);
+  if (!status.ok()) {
+    return OramStatus(StatusCode::kServerError, status.error_message(),
+                      __func__);
+  }
+
+  return OramStatus::OK;
+}
+
+OramStatus CuckooOramController::Lookup(uint32_t level, uint32_t address,
+                                        bool* const found,
+                                        oram_block_t* const block,
+                                        uint32_t* const slot) {
+  // Each key is probed at most once per build of the level, so the probed
+  // slots look random to the server.
+  const uint32_t key =
+      *found ? (kCuckooDummyFlag | dummy_counters_[level]++) : address;
+
+  std::vector<uint32_t> offsets = {Hash(level, 0, key), Hash(level, 1, key)};
+  // The whole stash is always read.
+  for (size_t i = 0; i < stash_sizes_[level]; i++) {
+    offsets.emplace_back(2 * table_sizes_[level] + i);
+  }
+
+  std::vector<oram_block_t> blocks;
+  OramStatus status = ReadBlocks(
+      std::vector<uint32_t>(offsets.size(), level), offsets, &blocks);
+  if (!status.ok() || *found) {
+    return status;
+  }
+
+  for (size_t i = 0; i < blocks.size(); i++) {
+    if (blocks[i].header.type == BlockType::kNormal &&
+        blocks[i].header.block_id == address && !stale_[level][offsets[i]]) {
+      memcpy(reinterpret_cast<void*>(block),
+             reinterpret_cast<const void*>(&blocks[i]), ORAM_BLOCK_SIZE);
+      *slot = offsets[i];
+      *found = true;
+      break;
+    }
+  }
+
+  return OramStatus::OK;
+}
+
+OramStatus CuckooOramController::Rebuild(void) {
+  auto begin_time = std::chrono::high_resolution_clock::now();
+
+  // Levels 0, ..., target - 1 (and the target itself if it is the last one)
+  // are merged into the first empty level.
+  uint32_t target = 1;
+  while (target < level_num_ - 1 && filled_[target]) {
+    target++;
+  }
+
+  std::vector<uint32_t> inputs = {0};
+  std::vector<uint32_t> cleared_levels;
+  for (uint32_t i = 1; i <= target; i++) {
+    if (filled_[i]) {
+      inputs.emplace_back(i);
+      if (i != target) {
+        cleared_levels.emplace_back(i);
+      }
+    }
+  }
+
+  size_t input_size = 0;
+  for (const uint32_t level : inputs) {
+    input_size += LevelSize(level);
+  }
+  const size_t level_size = LevelSize(target);
+  // There must be room for a dummy per slot of the new level.
+  size_t size = 1;
+  while (size < input_size + level_size) {
+    size <<= 1;
+  }
+
+  OramStatus status =
+      LevelControl(kLayeredAllocate, scratch_level_, size, 0, {});
+  if (!status.ok()) {
+    return status;
+  }
+
+  // Step 1: copy the levels to the scratch level; stale copies become dummies.
+  std::vector<uint32_t> ids;
+  size_t offset = 0;
+  for (const uint32_t level : inputs) {
+    const size_t num = LevelSize(level);
+    for (size_t begin = 0; begin < num; begin += kCuckooWindow) {
+      const size_t length = std::min(kCuckooWindow, num - begin);
+      std::vector<oram_block_t> blocks;
+      if (!(status = ReadRange(level, begin, length, &blocks)).ok()) {
+        return status;
+      }
+
+      for (size_t i = 0; i < blocks.size(); i++) {
+        if (blocks[i].header.type == BlockType::kNormal &&
+            (level == 0 || !stale_[level][begin + i])) {
+          ids.emplace_back(blocks[i].header.block_id);
+        } else {
+          FillCuckooDummy(&blocks[i], kInvalidMask);
+        }
+      }
+
+      if (!(status = WriteRange(scratch_level_, offset, blocks)).ok()) {
+        return status;
+      }
+      offset += blocks.size();
+    }
+  }
+
+  // Step 2: place the ids locally.
+  if (ids.size() > LevelCapacity(target)) {
+    return OramStatus(StatusCode::kUnknownError,
+                      oram_utils::StrCat("Level ", target, " overflows"),
+                      __func__);
+  }
+  slot_list_t slots;
+  if (!(status = Place(target, ids, &slots)).ok()) {
+    return status;
+  }
+  std::vector<uint32_t>().swap(ids);
+
+  // Step 3: one dummy for each empty slot; the rest is sorted to the end.
+  std::vector<bool> occupied(level_size, false);
+  for (const auto& slot : slots) {
+    occupied[slot.second] = true;
+  }
+  size_t next_empty = 0;
+  for (; offset < size;) {
+    std::vector<oram_block_t> blocks(std::min(kCuckooWindow, size - offset));
+    for (auto& block : blocks) {
+      while (next_empty < level_size && occupied[next_empty]) {
+        next_empty++;
+      }
+      FillCuckooDummy(&block,
+                      next_empty < level_size ? next_empty++ : kInvalidMask);
+    }
+
+    if (!(status = WriteRange(scratch_level_, offset, blocks)).ok()) {
+      return status;
+    }
+    offset += blocks.size();
+  }
+
+  // Step 4: sort by the slots and keep the first `level_size` blocks.
+  if (!(status = Sort(size, slots, level_size)).ok() ||
+      !(status = LevelControl(kLayeredPromote, scratch_level_, level_size,
+                              target, cleared_levels))
+           .ok()) {
+    return status.Append(OramStatus(StatusCode::kInvalidOperation,
+                                    "Cannot rebuild the level", __func__));
+  }
+
+  for (const uint32_t level : cleared_levels) {
+    filled_[level] = false;
+    std::vector<bool>().swap(stale_[level]);
+  }
+  filled_[target] = true;
+  stale_[target].assign(level_size, false);
+  dummy_counters_[target] = 0;
+
+  std::vector<oram_block_t> top(top_size_);
+  for (auto& block : top) {
+    FillCuckooDummy(&block, kInvalidMask);
+  }
+  top_num_ = 0;
+  if (!(status = WriteTop(top, {})).ok()) {
+    return status;
+  }
+
+  auto end_time = std::chrono::high_resolution_clock::now();
+  INFO(logger, "[+] Rebuilt level {} ({} slots) in {} ms.", target, level_size,
+       std::chrono::duration_cast<std::chrono::milliseconds>(end_time -
+                                                             begin_time)
+           .count());
+
+  return OramStatus::OK;
+}
+
+// A bitonic sorting network over the scratch level. The comparators of the
+// stages whose distance is at least the window are evaluated on pairs of
+// half-windows; the remaining stages of a merge stay within a window, whose
+// content is bitonic by then, so the client simply sorts the window. The reads
+// and writes only depend on `size`.
+OramStatus CuckooOramController::Sort(size_t size, const slot_list_t& slots,
+                                      size_t table_slots) {
+  auto key = [&slots](const oram_block_t& block) -> uint32_t {
+    if (block.header.type != BlockType::kNormal) {
+      return block.header.block_id;
+    }
+
+    auto iter = std::lower_bound(
+        slots.begin(), slots.end(),
+        std::make_pair(block.header.block_id, static_cast<uint32_t>(0)));
+    return iter == slots.end() || iter->first != block.header.block_id
+               ? kInvalidMask
+               : iter->second;
+  };
+
+  const size_t window = std::min(size, kCuckooWindow);
+  const size_t half = window / 2;
+
+  // Sorts every window in the direction of the merge of size `merge`.
+  auto sort_windows = [&](size_t merge) {
+    for (size_t begin = 0; begin < size; begin += window) {
+      std::vector<oram_block_t> blocks;
+      OramStatus status = ReadRange(scratch_level_, begin, window, &blocks);
+      if (!status.ok()) {
+        return status;
+      }
+
+      std::vector<std::pair<uint32_t, size_t>> keys(blocks.size());
+      for (size_t i = 0; i < blocks.size(); i++) {
+        keys[i] = std::make_pair(key(blocks[i]), i);
+      }
+      if ((begin & merge) == 0) {
+        std::sort(keys.begin(), keys.end());
+      } else {
+        std::sort(keys.rbegin(), keys.rend());
+      }
+
+      std::vector<oram_block_t> sorted(blocks.size());
+      for (size_t i = 0; i < blocks.size(); i++) {
+        sorted[i] = blocks[keys[i].second];
+
+        // The final pass checks the result.
+        if (merge == size && begin + i < table_slots &&
+            keys[i].first != begin + i) {
+          return OramStatus(
+              StatusCode::kUnknownError,
+              oram_utils::StrCat("Slot ", begin + i, " is not filled"),
+              __func__);
+        }
+      }
+
+      if (!(status = WriteRange(scratch_level_, begin, sorted)).ok()) {
+        return status;
+      }
+    }
+
+    return OramStatus::OK;
+  };
+
+  // All the merges of size at most the window.
+  OramStatus status = sort_windows(window);
+  for (size_t merge = 2 * window; merge <= size && status.ok(); merge <<= 1) {
+    for (size_t distance = merge / 2; distance >= window; distance >>= 1) {
+      for (size_t begin = 0; begin < size; begin += 2 * distance) {
+        for (size_t low = begin; low < begin + distance; low += half) {
+          std::vector<uint32_t> offsets(2 * half);
+          std::iota(offsets.begin(), offsets.begin() + half, low);
+          std::iota(offsets.begin() + half, offsets.end(), low + distance);
+
+          std::vector<oram_block_t> blocks;
+          status = ReadBlocks(std::vector<uint32_t>(offsets.size(),
+                                                    scratch_level_),
+                              offsets, &blocks);
+          if (!status.ok()) {
+            return status;
+          }
+
+          const bool ascending = (low & merge) == 0;
+          for (size_t i = 0; i < half; i++) {
+            const uint32_t lhs = key(blocks[i]);
+            const uint32_t rhs = key(blocks[half + i]);
+            if (ascending ? lhs > rhs : lhs < rhs) {
+              std::swap(blocks[i], blocks[half + i]);
+            }
+          }
+
+          std::vector<oram_block_t> high(blocks.begin() + half, blocks.end());
+          blocks.resize(half);
+          if (!(status = WriteRange(scratch_level_, low, blocks)).ok() ||
+              !(status = WriteRange(scratch_level_, low + distance, high))
+                   .ok()) {
+            return status;
+          }
+        }
+      }
+    }
+
+    status = sort_windows(merge);
+  }
+
+  return status;
+}
+
+// Every access reads the whole level 0, probes every non-empty level, and
+// appends exactly one block to level 0, so the schedule of the rebuilds is
+// fixed. Dummy accesses append a dummy block.
+OramStatus CuckooOramController::InternalAccess(Operation op_type,
+                                                uint32_t address,
+                                                oram_block_t* const data,
+                                                bool dummy) {
+  if (!is_initialized_) {
+    return OramStatus(StatusCode::kInvalidOperation,
+                      "Cannot access ORAM before it is initialized."
+                      " You may need to call `InitOram()` and `FillWithData()` "
+                      "method first.",
+                      __func__);
+  }
+
+  DBG(logger, "ORAM ID: {}, Accessing address {}, op_type {}, dummy {} ", id_,
+      address, (int)op_type, dummy);
+  PANIC_IF(op_type == Operation::kInvalid, "Invalid operation.");
+
+  OramStatus status = OramStatus::OK;
+  // A previous rebuild failed; level 0 has no room until it is redone.
+  if (top_num_ >= top_size_ && !(status = Rebuild()).ok()) {
+    return status.Append(OramStatus(StatusCode::kInvalidOperation,
+                                    "Level 0 is full and cannot be rebuilt",
+                                    __func__));
+  }
+
+  std::vector<oram_block_t> top;
+  if (!(status = ReadRange(0, 0, top_size_, &top)).ok()) {
+    return status;
+  }
+
+  // Dummy accesses probe every level with dummy keys.
+  bool found = dummy;
+  oram_block_t block;
+  for (size_t i = 0; i < top.size() && !found; i++) {
+    if (top[i].header.type == BlockType::kNormal &&
+        top[i].header.block_id == address) {
+      block = top[i];
+      // It will be appended again.
+      FillCuckooDummy(&top[i], kInvalidMask);
+      found = true;
+    }
+  }
+
+  // The level and the slot the block is taken from, if not from level 0.
+  uint32_t found_level = 0;
+  uint32_t found_slot = 0;
+  for (uint32_t i = 1; i < level_num_; i++) {
+    const bool was_found = found;
+    if (filled_[i] &&
+        !(status = Lookup(i, address, &found, &block, &found_slot)).ok()) {
+      return status.Append(OramStatus(StatusCode::kInvalidOperation,
+                                      "Cannot probe the level", __func__));
+    }
+    if (found && !was_found) {
+      found_level = i;
+    }
+  }
+
+  if (!found) {
+    return OramStatus(
+        StatusCode::kObjectNotFound,
+        oram_utils::StrCat("Failed to find the block ", address, "!"),
+        __func__);
+  }
+
+  if (dummy) {
+    FillCuckooDummy(&block, kInvalidMask);
+  } else if (op_type == Operation::kWrite) {
+    memcpy(block.data, data->data, DEFAULT_ORAM_DATA_SIZE);
+    block.header.data_len = data->header.data_len;
+  } else {
+    memcpy(data, &block, ORAM_BLOCK_SIZE);
+  }
+
+  top[top_num_] = block;
+  if (!(status = WriteTop(top, {})).ok()) {
+    return status;
+  }
+  // Only now has the block moved to level 0, so its old copy is outdated.
+  top_num_++;
+  if (found_level != 0) {
+    stale_[found_level][found_slot] = true;
+  }
+
+  return top_num_ == top_size_ ? Rebuild() : OramStatus::OK;
+}
+}  // namespace oram_impl
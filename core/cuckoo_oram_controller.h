@@ -0,0 +1,128 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef ORAM_IMPL_CORE_CUCKOO_ORAM_CONTROLLER_H_
+#define ORAM_IMPL_CORE_CUCKOO_ORAM_CONTROLLER_H_
+
+#include <utility>
+#include <vector>
+
+#include "oram_controller.h"
+
+namespace oram_impl {
+// A hierarchical ORAM (Goldreich and Ostrovsky) whose levels are cuckoo hash
+// tables with a stash (Pinkas and Reinman, "Oblivious RAM Revisited").
+//
+// Level 0 is a small buffer of T blocks that is always read and rewritten as a
+// whole. Level i >= 1 holds at most C_i = T * 2^{i - 1} blocks (the last one
+// holds all N blocks) in two tables of (1 + 1/8) C_i slots each, followed by a
+// stash. A lookup reads both candidate slots and the stash of every non-empty
+// level; once the block is found, the remaining levels are probed with fresh
+// dummy keys. The block then goes to level 0.
+//
+// When level 0 is full, levels 0, ..., j are merged into the first empty level
+// j (or the last one) with a new hash key. The merge is oblivious: the client
+// streams the levels into a scratch level, marks stale copies as dummies,
+// computes the cuckoo placement of the ids it saw, and sorts the scratch level
+// by the destination slots with a bitonic network whose comparators are
+// evaluated in windows of a few thousand blocks.
+//
+// The blocks only pass through the client a window at a time, and between the
+// rebuilds the client keeps the hash keys and a stale bit per slot. The
+// placement, however, is computed locally: while level i is rebuilt, the
+// client holds the two tables, the ids, and the slot of every id, i.e., about
+// 21 bytes per block of C_i. The rebuilds of the last level thus peak at O(N)
+// words (about 84 MB for N = 2^22); an oblivious placement on the server would
+// avoid this at a much higher bandwidth.
+class CuckooOramController : public OramController {
+  // (id, slot) pairs sorted by the id.
+  using slot_list_t = std::vector<std::pair<uint32_t, uint32_t>>;
+
+  // The capacity of level 0.
+  size_t top_size_;
+  // The number of levels including level 0.
+  uint32_t level_num_;
+  // The index of the scratch level on the server.
+  uint32_t scratch_level_;
+
+  // Per level: the hash key, the size of each of the two tables, the size of
+  // the stash, whether it is filled, the slots whose block is stale (i.e., has
+  // been moved to level 0), and the number of dummy probes so far.
+  std::vector<std::vector<uint8_t>> keys_;
+  std::vector<size_t> table_sizes_;
+  std::vector<size_t> stash_sizes_;
+  std::vector<bool> filled_;
+  std::vector<std::vector<bool>> stale_;
+  std::vector<uint32_t> dummy_counters_;
+
+  // The number of occupied slots of level 0.
+  size_t top_num_;
+
+  // Networking time.
+  std::chrono::microseconds network_time_;
+  // Networking communication.
+  size_t network_communication_;
+
+  // ==================== Begin private methods ==================== //
+  size_t LevelSize(uint32_t level) const;
+  size_t LevelCapacity(uint32_t level) const;
+  uint32_t Hash(uint32_t level, uint32_t table, uint32_t id) const;
+  // Maps each id to a slot of the level; may resample the key of the level.
+  OramStatus Place(uint32_t level, const std::vector<uint32_t>& ids,
+                   slot_list_t* const slots);
+
+  OramStatus ReadBlocks(const std::vector<uint32_t>& levels,
+                        const std::vector<uint32_t>& offsets,
+                        std::vector<oram_block_t>* const blocks);
+  OramStatus ReadRange(uint32_t level, size_t offset, size_t num,
+                       std::vector<oram_block_t>* const blocks);
+  OramStatus WriteRange(uint32_t level, size_t offset,
+                        std::vector<oram_block_t>& blocks);
+  OramStatus WriteTop(std::vector<oram_block_t>& blocks,
+                      const std::vector<uint32_t>& cleared_levels);
+  OramStatus LevelControl(uint32_t type, uint32_t level, size_t size,
+                          uint32_t target,
+                          const std::vector<uint32_t>& cleared_levels);
+
+  // Probes the level for `address` (or a dummy key if `found`) and returns the
+  // block and its slot if it is there. The slot is not marked stale here.
+  OramStatus Lookup(uint32_t level, uint32_t address, bool* const found,
+                    oram_block_t* const block, uint32_t* const slot);
+  OramStatus Rebuild(void);
+  OramStatus Sort(size_t size, const slot_list_t& slots, size_t table_slots);
+  // ==================== End private methods ==================== //
+ protected:
+  virtual OramStatus InternalAccess(Operation op_type, uint32_t address,
+                                    oram_block_t* const data,
+                                    bool dummy = false) override;
+
+ public:
+  CuckooOramController(uint32_t id, bool standalone, size_t block_num);
+
+  virtual OramStatus InitOram(void) override;
+  virtual OramStatus FillWithData(
+      const std::vector<oram_block_t>& data) override;
+
+  uint32_t GetLevelNum(void) const { return level_num_; }
+  virtual size_t ReportNetworkCommunication(void) const override;
+  virtual std::chrono::microseconds ReportNetworkingTime(
+      void) const override {
+    return network_time_;
+  }
+};
+}  // namespace oram_impl
+
+#endif  // ORAM_IMPL_CORE_CUCKOO_ORAM_CONTROLLER_H_
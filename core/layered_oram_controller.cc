@@ -0,0 +1,410 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "layered_oram_controller.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "oram.h"
+#include "base/oram_crypto.h"
+#include "base/oram_utils.h"
+
+extern std::shared_ptr<spdlog::logger> logger;
+
+using std::chrono_literals::operator""us;
+
+namespace oram_impl {
+LayeredOramController::LayeredOramController(uint32_t id, uint32_t block_num,
+                                             bool standalone)
+    : OramController(id, standalone, block_num, OramType::kLayeredOram),
+      network_time_(0us),
+      network_communication_(0ul) {
+  // The largest level must be able to hold all the real blocks.
+  level_num_ = std::ceil(LOG_BASE(std::max(block_num, 1u), 2)) + 1;
+
+  filled_.resize(level_num_, false);
+  reads_.resize(level_num_, 0ul);
+  unread_.resize(level_num_);
+  dummies_.resize(level_num_);
+
+  DBG(logger, "LayeredORAM Config:\nid: {}, block_num: {}, level_num: {}\n",
+      id_, block_num_, level_num_);
+}
+
+size_t LayeredOramController::ReportClientStorage(void) const {
+  // The client only keeps metadata; no block is cached across accesses.
+  return 0ul;
+}
+
+size_t LayeredOramController::ReportNetworkCommunication(void) const {
+  return network_communication_ * ORAM_BLOCK_SIZE;
+}
+
+OramStatus LayeredOramController::InitOram(void) {
+  grpc::ClientContext context;
+  InitLayeredOramRequest request;
+  google::protobuf::Empty empty;
+
+  ASSEMBLE_HEADER(request, id_, instance_hash_, GetVersion());
+  request.set_level_num(level_num_);
+  request.set_block_size(ORAM_BLOCK_SIZE);
+
+  grpc::Status status = stub_->InitLayeredOram(&context, request, &empty);
+  if (!status.ok()) {
+    return OramStatus(StatusCode::kServerError, status.error_message(),
+                      __func__);
+  }
+
+  return OramStatus::OK;
+}
+
+OramStatus LayeredOramController::FillWithData(
+    const std::vector<oram_block_t>& data) {
+  // All the real blocks are placed in the largest level; smaller levels are
+  // filled gradually by evictions.
+  std::vector<oram_block_t> blocks;
+  std::copy_if(data.begin(), data.end(), std::back_inserter(blocks),
+               [](const oram_block_t& block) {
+                 return block.header.type == BlockType::kNormal;
+               });
+
+  OramStatus status = BuildLevel(level_num_ - 1, blocks, {});
+  if (!status.ok()) {
+    return status.Append(OramStatus(StatusCode::kInvalidOperation,
+                                    "Failed to fill the partition", __func__));
+  }
+
+  // Set initialized.
+  is_initialized_ = true;
+
+  return OramStatus::OK;
+}
+
+OramStatus LayeredOramController::ReadBlocks(
+    const std::vector<uint32_t>& levels, const std::vector<uint32_t>& offsets,
+    std::vector<oram_block_t>* const blocks) {
+  grpc::ClientContext context;
+  ReadLayeredRequest request;
+  LayeredBlocksMessage response;
+
+  ASSEMBLE_HEADER(request, id_, instance_hash_, GetVersion());
+  request.mutable_levels()->Add(levels.begin(), levels.end());
+  request.mutable_offsets()->Add(offsets.begin(), offsets.end());
+
+  auto begin = std::chrono::high_resolution_clock::now();
+  grpc::Status status = stub_->ReadLayeredBlocks(&context, request, &response);
+  auto end = std::chrono::high_resolution_clock::now();
+
+  network_time_ +=
+      std::chrono::duration_cast<std::chrono::microseconds>(end - begin);
+
+  if (!status.ok()) {
+    return OramStatus(StatusCode::kServerError, status.error_message(),
+                      __func__);
+  }
+
+  for (const auto& content : response.contents()) {
+    oram_block_t block;
+    oram_utils::ConvertToBlock(content, &block);
+
+    // Decrypt the block.
+    oram_utils::DecryptBlock(&block, cryptor_.get());
+
+    blocks->emplace_back(block);
+  }
+
+  network_communication_ += response.contents_size();
+
+  return OramStatus::OK;
+}
+
+OramStatus LayeredOramController::WriteLevel(
+    uint32_t level, std::vector<oram_block_t>& blocks,
+    const std::vector<uint32_t>& cleared_levels) {
+  grpc::ClientContext context;
+  WriteLayeredRequest request;
+  google::protobuf::Empty empty;
+
+  ASSEMBLE_HEADER(request, id_, instance_hash_, GetVersion());
+  request.set_level(level);
+  request.mutable_cleared_levels()->Add(cleared_levels.begin(),
+                                       cleared_levels.end());
+
+  for (auto& block : blocks) {
+    // Encrypt the block.
+    oram_utils::EncryptBlock(&block, cryptor_.get());
+
+    std::string block_str;
+    oram_utils::ConvertToString(&block, &block_str);
+    request.add_contents(std::move(block_str));
+  }
+
+  network_communication_ += blocks.size();
+
+  auto begin = std::chrono::high_resolution_clock::now();
+  grpc::Status status = stub_->WriteLayeredLevel(&context, request, &empty);
+  auto end = std::chrono::high_resolution_clock::now();
+
+  network_time_ +=
+      std::chrono::duration_cast<std::chrono::microseconds>(end - begin);
+
+  if (!status.ok()) {
+    return OramStatus(StatusCode::kServerError, status.error_message(),
+                      __func__);
+  }
+
+  return OramStatus::OK;
+}
+
+// Pads the real blocks with dummies to 2 * 2^level blocks, shuffles them and
+// uploads the result as the new content of `level`.
+OramStatus LayeredOramController::BuildLevel(
+    uint32_t level, std::vector<oram_block_t>& blocks,
+    const std::vector<uint32_t>& cleared_levels) {
+  const size_t level_size = 2 * POW2(level);
+  if (blocks.size() > static_cast<size_t>(POW2(level))) {
+    return OramStatus(
+        StatusCode::kOutOfRange,
+        oram_utils::StrCat("The partition ", id_, " overflows at level ",
+                           level, " with ", blocks.size(), " blocks."),
+        __func__);
+  }
+
+  while (blocks.size() < level_size) {
+    oram_block_t dummy;
+    memset(&dummy, 0, ORAM_BLOCK_SIZE);
+    dummy.header.block_id = kInvalidMask;
+    dummy.header.type = BlockType::kDummy;
+    blocks.emplace_back(dummy);
+  }
+
+  OramStatus status = oram_crypto::RandomShuffle(blocks);
+  if (!status.ok()) {
+    return status;
+  }
+
+  // Update the metadata before the blocks are encrypted in place.
+  for (const uint32_t cleared_level : cleared_levels) {
+    filled_[cleared_level] = false;
+    reads_[cleared_level] = 0ul;
+    unread_[cleared_level].clear();
+    dummies_[cleared_level].clear();
+  }
+
+  dummies_[level].clear();
+  for (size_t i = 0; i < blocks.size(); i++) {
+    if (blocks[i].header.type == BlockType::kNormal) {
+      position_map_[blocks[i].header.block_id] = std::make_pair(level, i);
+    } else {
+      dummies_[level].emplace_back(i);
+    }
+  }
+
+  // Dummies must be consumed in a random order; otherwise the server could
+  // tell dummy reads from real ones by their offsets.
+  if (!(status = oram_crypto::RandomShuffle(dummies_[level])).ok()) {
+    return status;
+  }
+
+  filled_[level] = true;
+  reads_[level] = 0ul;
+  unread_[level].assign(level_size, true);
+
+  return WriteLevel(level, blocks, cleared_levels);
+}
+
+// Merges levels 0, ..., `level` and the optional new block into `level`. Only
+// slots that have not been fetched yet are downloaded: the client already holds
+// everything else, so this is the cheaper variant of the level shuffle. The set
+// of downloaded slots only depends on the public access history.
+OramStatus LayeredOramController::Shuffle(uint32_t level,
+                                          const oram_block_t* const block) {
+  std::vector<uint32_t> levels;
+  std::vector<uint32_t> offsets;
+  std::vector<uint32_t> cleared_levels;
+
+  for (uint32_t i = 0; i <= level; i++) {
+    if (!filled_[i]) {
+      continue;
+    }
+
+    for (size_t j = 0; j < unread_[i].size(); j++) {
+      if (unread_[i][j]) {
+        levels.emplace_back(i);
+        offsets.emplace_back(j);
+      }
+    }
+
+    if (i != level) {
+      cleared_levels.emplace_back(i);
+    }
+  }
+
+  std::vector<oram_block_t> fetched;
+  if (!levels.empty()) {
+    OramStatus status = ReadBlocks(levels, offsets, &fetched);
+    if (!status.ok()) {
+      return status.Append(OramStatus(StatusCode::kInvalidOperation,
+                                      "Failed to fetch levels", __func__));
+    }
+  }
+
+  std::vector<oram_block_t> blocks;
+  std::copy_if(fetched.begin(), fetched.end(), std::back_inserter(blocks),
+               [](const oram_block_t& block) {
+                 return block.header.type == BlockType::kNormal;
+               });
+  if (block != nullptr) {
+    blocks.emplace_back(*block);
+  }
+
+  return BuildLevel(level, blocks, cleared_levels);
+}
+
+OramStatus LayeredOramController::WritePartition(
+    const oram_block_t* const block) {
+  // Find the first empty level; if all the levels are filled, everything is
+  // merged into the largest one.
+  uint32_t level = 0;
+  while (level < level_num_ - 1 && filled_[level]) {
+    level++;
+  }
+
+  return Shuffle(level, block);
+}
+
+OramStatus LayeredOramController::ReadPartition(uint32_t address,
+                                                oram_block_t* const data,
+                                                bool dummy) {
+  // Level i is guaranteed to have at least 2^i dummies, so it must be rebuilt
+  // before it serves more reads than that. The number of reads is public, so
+  // this does not leak anything.
+  for (uint32_t i = 0; i < level_num_; i++) {
+    if (filled_[i] && reads_[i] >= static_cast<size_t>(POW2(i))) {
+      OramStatus status = Shuffle(level_num_ - 1, nullptr);
+      if (!status.ok()) {
+        return status;
+      }
+      break;
+    }
+  }
+
+  auto iter = dummy ? position_map_.end() : position_map_.find(address);
+  const bool hit = iter != position_map_.end();
+
+  // Read one block from each filled level: the real block if it lives in this
+  // level, or an unread dummy otherwise.
+  std::vector<uint32_t> levels;
+  std::vector<uint32_t> offsets;
+  for (uint32_t i = 0; i < level_num_; i++) {
+    if (!filled_[i]) {
+      continue;
+    }
+
+    uint32_t offset;
+    if (hit && iter->second.first == i) {
+      offset = iter->second.second;
+    } else {
+      offset = dummies_[i].back();
+      dummies_[i].pop_back();
+    }
+
+    reads_[i]++;
+    unread_[i][offset] = false;
+    levels.emplace_back(i);
+    offsets.emplace_back(offset);
+  }
+
+  std::vector<oram_block_t> blocks;
+  if (!levels.empty()) {
+    OramStatus status = ReadBlocks(levels, offsets, &blocks);
+    if (!status.ok()) {
+      return status;
+    }
+  }
+
+  if (dummy) {
+    return OramStatus::OK;
+  } else if (!hit) {
+    return OramStatus(
+        StatusCode::kObjectNotFound,
+        oram_utils::StrCat("Failed to find the block ", address,
+                           " in the partition ", id_, "!"),
+        __func__);
+  }
+
+  auto block_iter =
+      std::find_if(blocks.begin(), blocks.end(), BlockEqual(address));
+  if (block_iter == blocks.end()) {
+    return OramStatus(StatusCode::kObjectNotFound, oram_block_id_mismatch_err,
+                      __func__);
+  }
+
+  // READ AND REMOVE: the copy on the server is now stale.
+  memcpy(data, &(*block_iter), ORAM_BLOCK_SIZE);
+  position_map_.erase(iter);
+
+  return OramStatus::OK;
+}
+
+// As the backbone of the Partition ORAM:
+//  - A read operation reads and removes the block from the partition;
+//  - A write operation writes the block into the partition (eviction).
+// Dummy operations are indistinguishable from the real ones.
+//
+// As a standalone ORAM, the block is always read first and written back.
+OramStatus LayeredOramController::InternalAccess(Operation op_type,
+                                                 uint32_t address,
+                                                 oram_block_t* const data,
+                                                 bool dummy) {
+  if (!is_initialized_) {
+    return OramStatus(StatusCode::kInvalidOperation,
+                      "Cannot access ORAM before it is initialized."
+                      " You may need to call `InitOram()` and `FillWithData()` "
+                      "method first.",
+                      __func__);
+  }
+
+  DBG(logger, "ORAM ID: {}, Accessing address {}, op_type {}, dummy {} ", id_,
+      address, (int)op_type, dummy);
+  PANIC_IF(op_type == Operation::kInvalid, "Invalid operation.");
+
+  if (!standalone_) {
+    return op_type == Operation::kRead
+               ? ReadPartition(address, data, dummy)
+               : WritePartition(dummy ? nullptr : data);
+  }
+
+  oram_block_t block;
+  OramStatus status = ReadPartition(address, &block, dummy);
+  if (!status.ok()) {
+    return status;
+  }
+
+  if (op_type == Operation::kWrite) {
+    memcpy(block.data, data->data, DEFAULT_ORAM_DATA_SIZE);
+    block.header.data_len = data->header.data_len;
+  } else {
+    memcpy(data, &block, ORAM_BLOCK_SIZE);
+  }
+
+  return WritePartition(dummy ? nullptr : &block);
+}
+}  // namespace oram_impl
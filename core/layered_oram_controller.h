@@ -0,0 +1,85 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef ORAM_IMPL_CORE_LAYERED_ORAM_CONTROLLER_H_
+#define ORAM_IMPL_CORE_LAYERED_ORAM_CONTROLLER_H_
+
+#include "oram_controller.h"
+
+namespace oram_impl {
+// This class implements the level-based partition described in Stefanov et
+// al.'s "Towards Practical Oblivious RAM". A partition consists of levels
+// 0, 1, ..., L - 1 where level i is either empty or holds 2 * 2^i shuffled
+// blocks, at most half of which are real. It is mainly used as the backbone of
+// the Partition ORAM, but can also be used on its own.
+class LayeredOramController : public OramController {
+  friend class PartitionOramController;
+
+  // The number of levels.
+  uint32_t level_num_;
+  // Position map: [block_id] -> [level, offset].
+  l_oram_position_t position_map_;
+  // Whether each level currently holds a shuffled array on the server.
+  std::vector<bool> filled_;
+  // The number of reads issued to each level since it was last built.
+  std::vector<size_t> reads_;
+  // Slots of each level that have not been fetched since it was last built.
+  std::vector<std::vector<bool>> unread_;
+  // Offsets of unread dummies of each level, popped in random order.
+  std::vector<std::vector<uint32_t>> dummies_;
+  // Networking time.
+  std::chrono::microseconds network_time_;
+  // Networking communication.
+  size_t network_communication_;
+
+  // ==================== Begin private methods ==================== //
+  OramStatus ReadBlocks(const std::vector<uint32_t>& levels,
+                        const std::vector<uint32_t>& offsets,
+                        std::vector<oram_block_t>* const blocks);
+  OramStatus WriteLevel(uint32_t level, std::vector<oram_block_t>& blocks,
+                        const std::vector<uint32_t>& cleared_levels);
+  OramStatus BuildLevel(uint32_t level, std::vector<oram_block_t>& blocks,
+                        const std::vector<uint32_t>& cleared_levels);
+
+  OramStatus ReadPartition(uint32_t address, oram_block_t* const data,
+                           bool dummy);
+  OramStatus WritePartition(const oram_block_t* const block);
+  OramStatus Shuffle(uint32_t level, const oram_block_t* const block);
+  // ==================== End private methods ==================== //
+ protected:
+  virtual OramStatus InternalAccess(Operation op_type, uint32_t address,
+                                    oram_block_t* const data,
+                                    bool dummy = false) override;
+
+ public:
+  LayeredOramController(uint32_t id, uint32_t block_num,
+                        bool standalone = true);
+
+  virtual OramStatus InitOram(void) override;
+  virtual OramStatus FillWithData(
+      const std::vector<oram_block_t>& data) override;
+
+  uint32_t GetLevelNum(void) const { return level_num_; }
+  virtual size_t ReportClientStorage(void) const override;
+  virtual size_t ReportNetworkCommunication(void) const override;
+  virtual std::chrono::microseconds ReportNetworkingTime(
+      void) const override {
+    return network_time_;
+  }
+};
+}  // namespace oram_impl
+
+#endif  // ORAM_IMPL_CORE_LAYERED_ORAM_CONTROLLER_H_
@@ -19,48 +19,206 @@
 #include <spdlog/fmt/bin_to_hex.h>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <unordered_map>
+
 #include "oram.h"
 
 extern std::shared_ptr<spdlog::logger> logger;
 
 namespace oram_impl {
-OramStatus LinearOramController::ReadFromServer(std::string* const out) {
-  grpc::ClientContext context;
-  ReadFlatRequest request;
-  FlatVectorMessage response;
-
-  ASSEMBLE_HEADER(request, id_, instance_hash_, GetVersion());
-
-  // Read the whole storage from the remote storage.
-  grpc::Status status = stub_->ReadFlatMemory(&context, request, &response);
+// The storage is moved in chunks of this many blocks, and at most this many
+// chunks wait between two stages of the pipeline.
+static const size_t kFlatChunkBlocks = 1024;
+static const size_t kFlatPipelineDepth = 4;
 
-  if (status.ok()) {
-    *out = response.content();
+static size_t CryptoThreadNum(void) {
+  return std::max(1u, std::thread::hardware_concurrency());
+}
 
-    return OramStatus::OK;
+static OramStatus CheckChunk(const FlatChunkMessage& chunk) {
+  if (chunk.content().size() % ORAM_BLOCK_SIZE != 0) {
+    return OramStatus(StatusCode::kInvalidOperation,
+                      "The chunk is not aligned to blocks", __func__);
   }
 
-  return OramStatus(StatusCode::kServerError, status.error_message(), __func__);
+  return OramStatus::OK;
 }
 
-OramStatus LinearOramController::WriteToServer(const std::string& input) {
-  grpc::ClientContext context;
-  FlatVectorMessage request;
+OramStatus LinearOramController::Scan(
+    const std::function<void(oram_block_t* const)>& visit) {
+  grpc::ClientContext read_context;
+  grpc::ClientContext write_context;
+  ReadFlatStreamRequest request;
   google::protobuf::Empty empty;
 
   ASSEMBLE_HEADER(request, id_, instance_hash_, GetVersion());
-  request.set_content(input);
+  request.set_chunk_blocks(kFlatChunkBlocks);
+
+  std::unique_ptr<grpc::ClientReader<FlatChunkMessage>> reader =
+      stub_->ReadFlatStream(&read_context, request);
+  std::unique_ptr<grpc::ClientWriter<FlatChunkMessage>> writer =
+      stub_->WriteFlatStream(&write_context, &empty);
+
+  // receive -> decrypt, visit, encrypt -> send.
+  oram_utils::BoundedQueue<FlatChunkMessage> received(kFlatPipelineDepth);
+  oram_utils::BoundedQueue<FlatChunkMessage> processed(kFlatPipelineDepth);
+
+  // Set by any stage that fails; the last chunk is then never marked, so the
+  // server keeps what was not written back.
+  std::atomic_bool failed(false);
+
+  grpc::Status read_status;
+  std::thread receiver([&]() {
+    FlatChunkMessage chunk;
+    while (reader->Read(&chunk) && received.Push(std::move(chunk))) {
+    }
+    read_status = reader->Finish();
+    if (!read_status.ok()) {
+      // The chunks after the break were never read back.
+      failed = true;
+      write_context.TryCancel();
+    }
+    received.Close();
+  });
+
+  grpc::Status write_status;
+  std::thread sender([&]() {
+    // A chunk is held back until the next one arrives, so that the last one
+    // can be marked.
+    FlatChunkMessage held;
+    FlatChunkMessage chunk;
+    bool first = true;
+    bool holding = false;
+    bool broken = false;
+    while (!broken && processed.Pop(&chunk)) {
+      if (first) {
+        ASSEMBLE_HEADER(chunk, id_, instance_hash_, GetVersion());
+        first = false;
+      }
+
+      broken = holding && !writer->Write(held);
+      held = std::move(chunk);
+      holding = true;
+    }
+    if (!broken && holding && !failed) {
+      held.set_last(true);
+      writer->Write(held);
+    }
+    // Unblock the crypto stage if the stream broke.
+    processed.Close();
+    writer->WritesDone();
+    write_status = writer->Finish();
+  });
+
+  OramStatus status = OramStatus::OK;
+  FlatChunkMessage chunk;
+  while (status.ok() && received.Pop(&chunk)) {
+    if (!(status = CheckChunk(chunk)).ok()) {
+      break;
+    }
+
+    oram_block_t* const blocks =
+        reinterpret_cast<oram_block_t*>(chunk.mutable_content()->data());
+    const size_t block_num = chunk.content().size() / ORAM_BLOCK_SIZE;
+
+    status = oram_utils::DecryptBlocks(blocks, block_num, cryptor_.get(),
+                                       CryptoThreadNum());
+    if (!status.ok()) {
+      break;
+    }
+
+    for (size_t i = 0; i < block_num; i++) {
+      visit(&blocks[i]);
+    }
 
-  grpc::Status status = stub_->WriteFlatMemory(&context, request, &empty);
+    status = oram_utils::EncryptBlocks(blocks, block_num, cryptor_.get(),
+                                       CryptoThreadNum());
+    if (status.ok() && !processed.Push(std::move(chunk))) {
+      status = OramStatus(StatusCode::kServerError,
+                          "The write stream is closed", __func__);
+    }
+  }
+
+  if (!status.ok()) {
+    // A half-written storage is of no use; abort both streams.
+    failed = true;
+    read_context.TryCancel();
+    write_context.TryCancel();
+    received.Close();
+  }
+  processed.Close();
+  receiver.join();
+  sender.join();
 
   if (!status.ok()) {
-    return OramStatus(StatusCode::kServerError, status.error_message(),
+    return status;
+  } else if (!read_status.ok()) {
+    return OramStatus(StatusCode::kServerError, read_status.error_message(),
+                      __func__);
+  } else if (!write_status.ok()) {
+    return OramStatus(StatusCode::kServerError, write_status.error_message(),
                       __func__);
   }
 
   return OramStatus::OK;
 }
 
+OramStatus LinearOramController::ScanBatch(
+    const std::vector<Operation>& op_types,
+    const std::vector<uint32_t>& addresses, oram_block_t* const data) {
+  // [block id] -> the indices of the operations on it, in order.
+  std::unordered_map<uint32_t, std::vector<size_t>> requests;
+  for (size_t i = 0; i < addresses.size(); i++) {
+    PANIC_IF(op_types[i] == Operation::kInvalid, "Invalid ORAM operation!");
+    requests[addresses[i]].emplace_back(i);
+  }
+
+  return Scan([&](oram_block_t* const block) {
+    if (block->header.type != BlockType::kNormal) {
+      return;
+    }
+
+    auto iter = requests.find(block->header.block_id);
+    if (iter == requests.end()) {
+      return;
+    }
+
+    for (size_t i : iter->second) {
+      // Read or write.
+      if (op_types[i] == Operation::kRead) {
+        memcpy(&data[i], block, ORAM_BLOCK_SIZE);
+      } else {
+        memcpy(block->data, data[i].data, DEFAULT_ORAM_DATA_SIZE);
+      }
+    }
+  });
+}
+
+OramStatus LinearOramController::AccessBatch(
+    const std::vector<Operation>& op_types,
+    const std::vector<uint32_t>& addresses,
+    std::vector<oram_block_t>* const data) {
+  if (!is_initialized_) {
+    return OramStatus(StatusCode::kInvalidOperation,
+                      "Cannot access ORAM before it is initialized", __func__);
+  } else if (op_types.size() != addresses.size() ||
+             data->size() != addresses.size()) {
+    return OramStatus(StatusCode::kInvalidArgument,
+                      "The sizes of the batch do not match", __func__);
+  }
+
+  OramStatus status = ScanBatch(op_types, addresses, data->data());
+  if (!status.ok()) {
+    return status.Append(OramStatus(StatusCode::kServerError,
+                                    "Cannot scan the storage", __func__));
+  }
+
+  return OramStatus::OK;
+}
+
 OramStatus LinearOramController::InternalAccess(Operation op_type,
                                                 uint32_t address,
                                                 oram_block_t* const data,
@@ -72,41 +230,15 @@ OramStatus LinearOramController::InternalAccess(Operation op_type,
   //    – Re-encrypts each item after possibly changing it.
   //    – Writes the item back to remote storage.
   // O(n) overhead per each R/W operation.
-  std::string storage;
-  OramStatus status = OramStatus::OK;
-  if (!(status = ReadFromServer(&storage)).ok()) {
-    return status.Append(OramStatus(StatusCode::kInvalidOperation,
-                                    "Cannot read from the server", __func__));
-  }
-
-  // Reinterpret the storage as an array of oram_block_t.
-  oram_block_t* block_ptr = reinterpret_cast<oram_block_t*>(storage.data());
-  for (size_t i = 0; i < (storage.size() / ORAM_BLOCK_SIZE); i++) {
-    // Decrypt the block.
-    oram_utils::DecryptBlock(block_ptr, cryptor_.get());
-
-    if (block_ptr->header.type == BlockType::kNormal &&
-        block_ptr->header.block_id == address) {
-      // Read or write.
-      if (op_type == Operation::kRead) {
-        memcpy(data, block_ptr, ORAM_BLOCK_SIZE);
-      } else {
-        memcpy(block_ptr->data, data->data, DEFAULT_ORAM_DATA_SIZE);
-      }
-    }
+  // A single access is a batch of one.
+  OramStatus status = ScanBatch({op_type}, {address}, data);
 
-    // Re-encrypt the block whenever this is the target block.
-    oram_utils::EncryptBlock(block_ptr, cryptor_.get());
-
-    // Increment the pointer.
-    block_ptr += 1;
+  if (!status.ok()) {
+    return status.Append(OramStatus(StatusCode::kServerError,
+                                    "Cannot scan the storage", __func__));
   }
 
-  return WriteToServer(storage).ok()
-             ? OramStatus::OK
-             : OramStatus(StatusCode::kServerError,
-                          "Cannot invoke WriteToServer on the server side",
-                          __func__);
+  return OramStatus::OK;
 }
 
 OramStatus LinearOramController::InitOram(void) {
@@ -129,27 +261,48 @@ OramStatus LinearOramController::FillWithData(
     const std::vector<oram_block_t>& data) {
   // We always assume that `data` is properly permuted in a secure way.
   grpc::ClientContext context;
-  FlatVectorMessage request;
   google::protobuf::Empty empty;
 
-  ASSEMBLE_HEADER(request, id_, instance_hash_, GetVersion());
+  std::unique_ptr<grpc::ClientWriter<FlatChunkMessage>> writer =
+      stub_->WriteFlatStream(&context, &empty);
 
-  std::string content;
-  for (size_t i = 0; i < data.size(); i++) {
-    oram_block_t block = data[i];
-    oram_utils::EncryptBlock(&block, cryptor_.get());
-    content.append(
-        std::string(reinterpret_cast<char*>(&block), ORAM_BLOCK_SIZE));
+  OramStatus status = OramStatus::OK;
+  for (size_t begin = 0; begin < data.size(); begin += kFlatChunkBlocks) {
+    const size_t block_num = std::min(kFlatChunkBlocks, data.size() - begin);
+
+    FlatChunkMessage chunk;
+    if (begin == 0) {
+      ASSEMBLE_HEADER(chunk, id_, instance_hash_, GetVersion());
+    }
+    chunk.set_offset(begin * ORAM_BLOCK_SIZE);
+    chunk.set_last(begin + block_num == data.size());
+    chunk.mutable_content()->assign(
+        reinterpret_cast<const char*>(data.data() + begin),
+        block_num * ORAM_BLOCK_SIZE);
+
+    oram_block_t* const blocks =
+        reinterpret_cast<oram_block_t*>(chunk.mutable_content()->data());
+    status = oram_utils::EncryptBlocks(blocks, block_num, cryptor_.get(),
+                                       CryptoThreadNum());
+    if (!status.ok() || !writer->Write(chunk)) {
+      context.TryCancel();
+      break;
+    }
+  }
+  writer->WritesDone();
+  grpc::Status grpc_status = writer->Finish();
+
+  if (!status.ok()) {
+    return status;
+  } else if (!grpc_status.ok()) {
+    return OramStatus(StatusCode::kServerError,
+                      "Cannot invoke WriteFlatStream on the server side",
+                      __func__);
   }
-  request.set_content(content);
 
   // Set initialized.
   is_initialized_ = true;
 
-  return stub_->WriteFlatMemory(&context, request, &empty).ok()
-             ? OramStatus::OK
-             : OramStatus(StatusCode::kServerError,
-                          "Cannot invoke WriteFlatMemory on the server side",
-                          __func__);
+  return OramStatus::OK;
 }
-}  // namespace oram_impl
\ No newline at end of file
+}  // namespace oram_impl
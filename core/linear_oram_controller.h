@@ -17,6 +17,8 @@
 #ifndef ORAM_IMPL_CORE_LINEAR_ORAM_CONTROLLER_H_
 #define ORAM_IMPL_CORE_LINEAR_ORAM_CONTROLLER_H_
 
+#include <functional>
+
 #include "oram_controller.h"
 
 #include "base/oram_status.h"
@@ -25,11 +27,17 @@ namespace oram_impl {
 // A trivial solution for ORAM. It only has educational meaning. Do not use it
 // in any productive environment.
 class LinearOramController : public OramController {
- private:
-  OramStatus ReadFromServer(std::string* const out);
-  OramStatus WriteToServer(const std::string& input);
-
  protected:
+  // Streams the whole storage through `visit`, which may modify the decrypted
+  // blocks, and writes it back re-encrypted. Receiving, the crypto and sending
+  // overlap, and only a few chunks are held by the client at a time.
+  OramStatus Scan(const std::function<void(oram_block_t* const)>& visit);
+  // Applies the i-th operation on `addresses[i]` to `data[i]`, all in a
+  // single scan.
+  OramStatus ScanBatch(const std::vector<Operation>& op_types,
+                       const std::vector<uint32_t>& addresses,
+                       oram_block_t* const data);
+
   virtual OramStatus InternalAccess(Operation op_type, uint32_t address,
                                     oram_block_t* const data,
                                     bool dummy = false) override;
@@ -40,6 +48,13 @@ class LinearOramController : public OramController {
   virtual OramStatus InitOram(void) override;
   virtual OramStatus FillWithData(
       const std::vector<oram_block_t>& data) override;
+
+  // Answers a batch of reads and writes with one pass over the storage, so
+  // each operation costs N/k rather than N. The operations take effect in
+  // order, i.e., a read sees the writes to the same address before it.
+  OramStatus AccessBatch(const std::vector<Operation>& op_types,
+                         const std::vector<uint32_t>& addresses,
+                         std::vector<oram_block_t>* const data);
 };
 } // namespace oram_impl
 
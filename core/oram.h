@@ -19,6 +19,8 @@
 
 #include <string>
 
+#include "cuckoo_oram_controller.h"
+#include "layered_oram_controller.h"
 #include "linear_oram_controller.h"
 #include "odict_controller.h"
 #include "ods_cache.h"
@@ -34,6 +34,9 @@
 
 namespace oram_impl {
 class OramController {
+  // The Partition ORAM drives its sub-ORAMs via `InternalAccess`.
+  friend class PartitionOramController;
+
  protected:
   const uint32_t id_;
   // Whether this pathoram conroller is a standalone controller
@@ -85,6 +88,12 @@ class OramController {
   virtual bool IsStandAlone(void) const { return standalone_; }
   virtual bool IsInitialized(void) const { return is_initialized_; }
 
+  virtual size_t ReportClientStorage(void) const { return 0ul; }
+  virtual size_t ReportNetworkCommunication(void) const { return 0ul; }
+  virtual std::chrono::microseconds ReportNetworkingTime(void) const {
+    return std::chrono::microseconds(0);
+  }
+
   virtual void SetStub(std::shared_ptr<oram_server::Stub> stub) {
     stub_ = stub;
   }
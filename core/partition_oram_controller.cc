@@ -19,20 +19,28 @@
 #include <spdlog/fmt/bin_to_hex.h>
 #include <spdlog/spdlog.h>
 
+#include <atomic>
+
 extern std::shared_ptr<spdlog::logger> logger;
 
 using std::chrono_literals::operator""us;
 
 namespace oram_impl {
-size_t PartitionOramController::counter_ = 0;
-
-// The ownership of ORAM main controller cannot be multiple.
-// This cannot be shared.
-std::unique_ptr<PartitionOramController>
-PartitionOramController::GetInstance() {
-  static std::unique_ptr<PartitionOramController> instance(
-      new PartitionOramController());
-  return std::move(instance);
+// Logs every time another tenth of the partitions is done.
+static void ReportProgress(const std::string& stage, size_t finished,
+                           size_t total) {
+  if (finished == total || (finished * 10 / total) !=
+                               ((finished - 1) * 10 / total)) {
+    INFO(logger, "[+] {}: {} / {} partitions done.", stage, finished, total);
+  }
+}
+
+// The ownership of ORAM main controller cannot be multiple, so each instance is
+// handed out as a unique pointer.
+std::unique_ptr<PartitionOramController> PartitionOramController::GetInstance(
+    uint32_t id) {
+  return std::unique_ptr<PartitionOramController>(
+      new PartitionOramController(id));
 }
 
 // @ ref Towards Practical Oblivious RAM's access algorithm.
@@ -46,12 +54,28 @@ PartitionOramController::GetInstance() {
 OramStatus PartitionOramController::Access(Operation op_type, uint32_t address,
                                            oram_block_t* const data) {
   auto begin_access = std::chrono::high_resolution_clock::now();
+  if (async_eviction_) {
+    // Back-pressure: let the worker catch up if the slots grow too large.
+    std::unique_lock<std::mutex> lock(slots_lock_);
+    occupancy_cv_.wait(lock, [this]() {
+      return !eviction_status_.ok() || eviction_queue_.empty() ||
+             slot_occupancy_ <= max_slot_occupancy_;
+    });
+
+    if (!eviction_status_.ok()) {
+      OramStatus status = eviction_status_;
+      return status.Append(OramStatus(StatusCode::kInvalidOperation,
+                                      "The background eviction failed",
+                                      __func__));
+    }
+  }
+
   // A temporary buffer that holds the data.
   oram_block_t block;
   // Sample a new random slot id for this block.
   uint32_t new_slot_id;
   OramStatus status = oram_crypto::UniformRandom(
-      0, path_oram_controllers_.size() - 1, &new_slot_id);
+      0, sub_oram_controllers_.size() - 1, &new_slot_id);
   oram_utils::CheckStatus(status, "Failed to sample a new slot id.");
 
   // Get the position (i.e., the slot id) from the position map.
@@ -62,25 +86,44 @@ OramStatus PartitionOramController::Access(Operation op_type, uint32_t address,
 
   DBG(logger, "New slot id: {} for address: {}", new_slot_id, address);
 
-  // Get the PathOram controller.
-  PathOramController* const controller = path_oram_controllers_[slot_id].get();
-  // Check if the block is already in the slot.
-  // If there is no such block, we read it from the server and then
-  // add it to the slot.
-  auto iter = std::find_if(slots_[slot_id].begin(), slots_[slot_id].end(),
-                           BlockEqual(address));
-  if (iter == slots_[slot_id].end()) {
-    // Read the block from the PathORAM controller.
-    status = controller->InternalAccess(op_type, address, &block, false);
-  } else {
-    // Invoke a dummy read.
-    OramStatus status =
-        controller->InternalAccess(Operation::kRead, address, nullptr, true);
-    oram_utils::CheckStatus(status, "Cannot perform fake read!");
-    // Read the block directly from the slot.
-    block = *iter;
-    // Expire the iterator.
-    slots_[slot_id].erase(iter);
+  // Get the controller of the partition.
+  OramController* const controller = sub_oram_controllers_[slot_id].get();
+  {
+    // Keep the worker from evicting into this partition until we are done.
+    std::lock_guard<std::mutex> partition_lock(*partition_locks_[slot_id]);
+
+    // Check if the block is already in the slot.
+    // If there is no such block, we read it from the server and then
+    // add it to the slot.
+    bool in_slot = false;
+    {
+      std::lock_guard<std::mutex> lock(slots_lock_);
+      auto iter = std::find_if(slots_[slot_id].begin(), slots_[slot_id].end(),
+                               BlockEqual(address));
+      if (iter != slots_[slot_id].end()) {
+        in_slot = true;
+        // Read the block directly from the slot.
+        block = *iter;
+        // Expire the iterator.
+        slots_[slot_id].erase(iter);
+        slot_occupancy_--;
+      }
+    }
+
+    if (!in_slot) {
+      // Read (and remove) the block from the partition.
+      status = controller->InternalAccess(Operation::kRead, address, &block,
+                                          false);
+      if (!status.ok()) {
+        return status.Append(OramStatus(StatusCode::kInvalidOperation,
+                                        "Cannot read the partition", __func__));
+      }
+    } else {
+      // Invoke a dummy read.
+      OramStatus status =
+          controller->InternalAccess(Operation::kRead, address, nullptr, true);
+      oram_utils::CheckStatus(status, "Cannot perform fake read!");
+    }
   }
 
   // Update the block if the operation is write.
@@ -91,7 +134,11 @@ OramStatus PartitionOramController::Access(Operation op_type, uint32_t address,
   }
 
   // Add the block to the slot.
-  slots_[new_slot_id].emplace_back(block);
+  {
+    std::lock_guard<std::mutex> lock(slots_lock_);
+    slots_[new_slot_id].emplace_back(block);
+    slot_occupancy_++;
+  }
 
   auto end_access = std::chrono::high_resolution_clock::now();
 
@@ -100,12 +147,24 @@ OramStatus PartitionOramController::Access(Operation op_type, uint32_t address,
                                                              begin_access)
            .count());
 
+  if (async_eviction_) {
+    return ScheduleEviction(slot_id);
+  }
+
   // Call piggy-backed eviction. (optional)
-  // NO piggyback-ed eviction is implemented for PathORAM.
+  // NO piggyback-ed eviction is implemented for PathORAM. For level-based
+  // partitions, one of the \nu evictions goes to the partition that was just
+  // read; this is safe because its id has already been revealed.
+  auto begin_evict = std::chrono::high_resolution_clock::now();
+  size_t evict_num = nu_;
+  if (sub_oram_type_ == OramType::kLayeredOram && evict_num != 0) {
+    status = Evict(slot_id);
+    oram_utils::CheckStatus(status, "Failed to perform eviction!");
+    evict_num--;
+  }
 
   // status = SequentialEvict();
-  auto begin_evict = std::chrono::high_resolution_clock::now();
-  status = RandomEvict();
+  status = RandomEvict(evict_num);
   oram_utils::CheckStatus(status, "Failed to perform eviction!");
   auto end_evict = std::chrono::high_resolution_clock::now();
 
@@ -119,29 +178,131 @@ OramStatus PartitionOramController::Access(Operation op_type, uint32_t address,
 
 OramStatus PartitionOramController::Evict(uint32_t id) {
   DBG(logger, "Evicting slot {}", id);
-  PathOramController* const controller = path_oram_controllers_[id].get();
-  if (slots_[id].empty()) {
+  OramController* const controller = sub_oram_controllers_[id].get();
+  // Between leaving the slot and reaching the partition, the block is in
+  // neither of them; holding the partition lock hides this from `Access`.
+  std::lock_guard<std::mutex> partition_lock(*partition_locks_[id]);
+
+  oram_block_t block;
+  bool dummy = true;
+  {
+    std::lock_guard<std::mutex> lock(slots_lock_);
+    if (!slots_[id].empty()) {
+      dummy = false;
+      DBG(logger, "---------------EVICT------------------");
+      oram_utils::PrintStash(slots_[id]);
+      DBG(logger, "---------------EVICT------------------");
+      block = slots_[id].back();
+      slots_[id].pop_back();
+      slot_occupancy_--;
+    }
+  }
+
+  if (dummy) {
     // Perform a fake write.
     return controller->InternalAccess(Operation::kWrite, 0, nullptr, true);
   } else {
-    DBG(logger, "---------------EVICT------------------");
-    oram_utils::PrintStash(slots_[id]);
-    DBG(logger, "---------------EVICT------------------");
-    oram_block_t block = slots_[id].back();
-    slots_[id].pop_back();
     return controller->InternalAccess(Operation::kWrite, block.header.block_id,
                                       &block, false);
   }
 }
 
+OramStatus PartitionOramController::ScheduleEviction(uint32_t slot_id) {
+  // The same targets as the synchronous path: the piggy-backed eviction for
+  // level-based partitions and then random ones.
+  std::vector<uint32_t> targets;
+  size_t evict_num = nu_;
+  if (sub_oram_type_ == OramType::kLayeredOram && evict_num != 0) {
+    targets.emplace_back(slot_id);
+    evict_num--;
+  }
+
+  for (size_t i = 0; i < evict_num; i++) {
+    uint32_t id;
+    OramStatus status =
+        oram_crypto::UniformRandom(0, sub_oram_controllers_.size() - 1, &id);
+    if (!status.ok()) {
+      return status.Append(OramStatus(StatusCode::kInvalidOperation,
+                                      "Failed to sample a new slot id.",
+                                      __func__));
+    }
+    targets.emplace_back(id);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(slots_lock_);
+    eviction_queue_.insert(eviction_queue_.end(), targets.begin(),
+                           targets.end());
+  }
+  eviction_cv_.notify_one();
+
+  return OramStatus::OK;
+}
+
+void PartitionOramController::EvictionWorker(void) {
+  std::unique_lock<std::mutex> lock(slots_lock_);
+  while (true) {
+    eviction_cv_.wait(lock, [this]() {
+      return stop_eviction_ || !eviction_queue_.empty();
+    });
+
+    // Pending evictions are drained before the worker stops.
+    if (eviction_queue_.empty()) {
+      break;
+    }
+
+    const uint32_t id = eviction_queue_.front();
+    eviction_queue_.pop_front();
+    lock.unlock();
+    OramStatus status = Evict(id);
+    lock.lock();
+
+    if (!status.ok()) {
+      ERRS(logger, "[-] Background eviction failed: {}", status.EmitString());
+      eviction_status_ = status;
+      eviction_queue_.clear();
+    }
+    occupancy_cv_.notify_all();
+  }
+}
+
+void PartitionOramController::StartEvictionWorker(void) {
+  if (!async_eviction_ || eviction_worker_.joinable()) {
+    return;
+  }
+
+  if (max_slot_occupancy_ == 0) {
+    max_slot_occupancy_ = slots_.size();
+  }
+  stop_eviction_ = false;
+  eviction_status_ = OramStatus::OK;
+  eviction_worker_ = std::thread(&PartitionOramController::EvictionWorker, this);
+
+  INFO(logger, "[+] Background eviction started. Maximum slot occupancy: {}.",
+       max_slot_occupancy_);
+}
+
+void PartitionOramController::StopEvictionWorker(void) {
+  if (!eviction_worker_.joinable()) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(slots_lock_);
+    stop_eviction_ = true;
+  }
+  eviction_cv_.notify_one();
+  eviction_worker_.join();
+}
+
 // RandomEvict samples \nu \in \mathbb{N} random slots (with replacement) to
 // evict from.
-OramStatus PartitionOramController::RandomEvict(void) {
+OramStatus PartitionOramController::RandomEvict(size_t evict_num) {
   // For simplicity, we use uniform random sampling.
-  for (size_t i = 0; i < nu_; i++) {
+  for (size_t i = 0; i < evict_num; i++) {
     uint32_t id;
     oram_utils::CheckStatus(
-        oram_crypto::UniformRandom(0, path_oram_controllers_.size() - 1, &id),
+        oram_crypto::UniformRandom(0, sub_oram_controllers_.size() - 1, &id),
         "Failed to sample a new slot id.");
 
     OramStatus status;
@@ -160,7 +321,7 @@ OramStatus PartitionOramController::RandomEvict(void) {
 OramStatus PartitionOramController::SequentialEvict(void) {
   size_t evict_num;
   oram_utils::CheckStatus(
-      oram_crypto::UniformRandom(0, path_oram_controllers_.size() - 1,
+      oram_crypto::UniformRandom(0, sub_oram_controllers_.size() - 1,
                                  (uint32_t*)&evict_num),
       "Failed to sample eviction number.");
   for (size_t i = 0; i < evict_num; i++) {
@@ -194,19 +355,54 @@ OramStatus PartitionOramController::Run(uint32_t block_num,
 }
 
 OramStatus PartitionOramController::InitOram(void) {
-  for (size_t i = 0; i < slots_.size(); i++) {
-    // We create the PathORAM controller for each slot.
-    path_oram_controllers_.emplace_back(std::make_unique<PathOramController>(
-        i, partition_size_, bucket_size_, false));
-    path_oram_controllers_.back()->SetStub(stub_);
+  // Check if the partitions fit in the id space.
+  if (id_ >= POW2(31 - kPartitionIdShift)) {
+    return OramStatus(StatusCode::kOutOfRange,
+                      "The id is too large for a Partition ORAM.", __func__);
+  } else if (slots_.size() > kPartitionIndexMask + 1ul) {
+    return OramStatus(StatusCode::kOutOfRange, "Too many partitions.",
+                      __func__);
+  }
 
-    // Then invoke the intialization procedure.
-    OramStatus status = path_oram_controllers_.back()->InitOram();
-    if (!status.ok()) {
-      return status;
+  auto begin = std::chrono::high_resolution_clock::now();
+
+  for (size_t i = 0; i < slots_.size(); i++) {
+    // We create the controller of the partition for each slot.
+    if (sub_oram_type_ == OramType::kLayeredOram) {
+      const size_t capacity =
+          std::ceil(partition_size_ * kLayeredCapacityFactor);
+      sub_oram_controllers_.emplace_back(
+          std::make_unique<LayeredOramController>(SubOramId(i), capacity,
+                                                  false));
+    } else {
+      sub_oram_controllers_.emplace_back(std::make_unique<PathOramController>(
+          SubOramId(i), partition_size_, bucket_size_, false));
     }
+    sub_oram_controllers_.back()->SetStub(
+        stubs_.empty() ? stub_ : stubs_[i % stubs_.size()]);
+    partition_locks_.emplace_back(std::make_unique<std::mutex>());
+  }
+
+  // Then invoke the intialization procedure; the partitions are independent.
+  std::atomic_size_t finished(0ul);
+  OramStatus status = oram_utils::ParallelFor(
+      sub_oram_controllers_.size(), thread_num_, [&](size_t i) {
+        OramStatus status = sub_oram_controllers_[i]->InitOram();
+        if (status.ok()) {
+          ReportProgress("InitOram", ++finished, sub_oram_controllers_.size());
+        }
+        return status;
+      });
+  if (!status.ok()) {
+    return status;
   }
 
+  auto end = std::chrono::high_resolution_clock::now();
+  INFO(logger, "[+] {} partitions created. Elapsed time is {} us.",
+       sub_oram_controllers_.size(),
+       std::chrono::duration_cast<std::chrono::microseconds>(end - begin)
+           .count());
+
   return OramStatus::OK;
 }
 
@@ -222,31 +418,54 @@ OramStatus PartitionOramController::ProcessSlot(
   return OramStatus::OK;
 }
 
+size_t PartitionOramController::SubOramDataSize(void) const {
+  if (sub_oram_type_ == OramType::kLayeredOram) {
+    return sub_oram_controllers_.front()->GetBlockNum();
+  }
+
+  const size_t level = oram_utils::TryCast<OramController, PathOramController>(
+                           sub_oram_controllers_.front().get())
+                           ->GetTreeLevel();
+  return (POW2(level + 1) - 1) * bucket_size_;
+}
+
 OramStatus PartitionOramController::FillWithData(
     const std::vector<oram_block_t>& data) {
-  const size_t level = path_oram_controllers_.front()->GetTreeLevel();
-  const size_t tree_size = (POW2(level + 1) - 1) * bucket_size_;
+  const size_t tree_size = SubOramDataSize();
   // Check if the data size is consistent with the block number (note that this
   // includes dummy blocks).
-  if (data.size() != tree_size * path_oram_controllers_.size()) {
+  if (data.size() != tree_size * sub_oram_controllers_.size()) {
     return OramStatus(StatusCode::kInvalidArgument, "Data size is wrong",
                       __func__);
   }
 
-  // Send the data vector to each PathORAM controller.
+  // Send the data vector to each partition.
   auto begin = std::chrono::high_resolution_clock::now();
-  for (size_t i = 0; i < path_oram_controllers_.size(); i++) {
+  // The position map is shared by all the partitions, so it is built first.
+  for (size_t i = 0; i < sub_oram_controllers_.size(); i++) {
     // Slice the data vector.
     const std::vector<oram_block_t> cur_data(
         data.begin() + i * tree_size, data.begin() + (i + 1) * tree_size);
     OramStatus status = ProcessSlot(cur_data, i);
     oram_utils::CheckStatus(status, "Failed to process slot!");
-
-    // Initialize the Path Oram.
-    status = path_oram_controllers_[i]->FillWithData(cur_data);
-    oram_utils::CheckStatus(status,
-                            "Failed to fill the data into the Path ORAM.");
   }
+
+  std::atomic_size_t finished(0ul);
+  OramStatus status = oram_utils::ParallelFor(
+      sub_oram_controllers_.size(), thread_num_, [&](size_t i) {
+        const std::vector<oram_block_t> cur_data(
+            data.begin() + i * tree_size, data.begin() + (i + 1) * tree_size);
+
+        // Initialize the partition.
+        OramStatus status = sub_oram_controllers_[i]->FillWithData(cur_data);
+        if (status.ok()) {
+          ReportProgress("FillWithData", ++finished,
+                         sub_oram_controllers_.size());
+        }
+        return status;
+      });
+  oram_utils::CheckStatus(status,
+                          "Failed to fill the data into the partition.");
   auto end = std::chrono::high_resolution_clock::now();
 
   INFO(logger,
@@ -257,18 +476,23 @@ OramStatus PartitionOramController::FillWithData(
 
   // Set initialized.
   is_initialized_ = true;
+  StartEvictionWorker();
 
   return OramStatus::OK;
 }
 
 OramStatus PartitionOramController::TestPathOram(uint32_t controller_id) {
-  if (controller_id >= path_oram_controllers_.size()) {
+  if (controller_id >= sub_oram_controllers_.size()) {
     return OramStatus(StatusCode::kOutOfRange,
                       "The controller id is out of range.", __func__);
+  } else if (sub_oram_type_ != OramType::kPathOram) {
+    return OramStatus(StatusCode::kInvalidOperation,
+                      "The partitions are not Path ORAMs.", __func__);
   }
 
   PathOramController* const controller =
-      path_oram_controllers_[controller_id].get();
+      oram_utils::TryCast<OramController, PathOramController>(
+          sub_oram_controllers_[controller_id].get());
 
   const size_t level = controller->GetTreeLevel();
   const size_t tree_size = (POW2(level + 1) - 1) * bucket_size_;
@@ -318,11 +542,10 @@ OramStatus PartitionOramController::TestPathOram(uint32_t controller_id) {
 
 OramStatus PartitionOramController::TestPartitionOram(void) {
   std::vector<oram_block_t> blocks;
-  const size_t level = path_oram_controllers_.front()->GetTreeLevel();
-  const size_t tree_size = (POW2(level + 1) - 1) * bucket_size_;
+  const size_t tree_size = SubOramDataSize();
 
   // Sample random data.
-  for (size_t i = 0; i < path_oram_controllers_.size(); i++) {
+  for (size_t i = 0; i < sub_oram_controllers_.size(); i++) {
     const std::vector<oram_block_t> block =
         std::move(oram_utils::SampleRandomBucket(partition_size_, tree_size,
                                                  i * partition_size_ / 2));
@@ -379,12 +602,11 @@ OramStatus PartitionOramController::TestPartitionOram(void) {
 size_t PartitionOramController::ReportClientStorage(void) const {
   size_t client_storage = 0;
 
-  std::for_each(
-      path_oram_controllers_.begin(), path_oram_controllers_.end(),
-      [&client_storage](
-          const std::unique_ptr<PathOramController>& path_oram_controller) {
-        client_storage += path_oram_controller->ReportClientStorage();
-      });
+  std::for_each(sub_oram_controllers_.begin(), sub_oram_controllers_.end(),
+                [&client_storage](
+                    const std::unique_ptr<OramController>& controller) {
+                  client_storage += controller->ReportClientStorage();
+                });
 
   client_storage += slots_.size() * ORAM_BLOCK_SIZE;
   return client_storage;
@@ -394,7 +616,7 @@ std::chrono::microseconds PartitionOramController::ReportNetworkingTime(
     void) const {
   std::chrono::microseconds ans = 0us;
 
-  for (const auto& controller : path_oram_controllers_) {
+  for (const auto& controller : sub_oram_controllers_) {
     ans += controller->ReportNetworkingTime();
   }
 
@@ -404,7 +626,7 @@ std::chrono::microseconds PartitionOramController::ReportNetworkingTime(
 size_t PartitionOramController::ReportNetworkCommunication(void) const {
   size_t ans = 0;
 
-  for (const auto& controller : path_oram_controllers_) {
+  for (const auto& controller : sub_oram_controllers_) {
     ans += controller->ReportNetworkCommunication();
   }
 
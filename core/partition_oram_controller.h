@@ -17,6 +17,12 @@
 #ifndef ORAM_IMPL_CORE_PARTITION_ORAM_CONTROLLER_H_
 #define ORAM_IMPL_CORE_PARTITION_ORAM_CONTROLLER_H_
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "layered_oram_controller.h"
 #include "oram_controller.h"
 #include "path_oram_controller.h"
 
@@ -26,25 +32,72 @@ class PartitionOramController final : public OramController {
   size_t partition_size_;
   size_t bucket_size_;
   size_t nu_;
-  static size_t counter_;
+  // The cursor of the sequential eviction.
+  size_t counter_;
+  // The type of each partition: either Path ORAM or the level-based partition
+  // from the original Partition ORAM paper.
+  OramType sub_oram_type_;
+  // The number of worker threads used to set up the partitions.
+  size_t thread_num_;
+  // Partitions are spread across these channels in a round-robin fashion.
+  std::vector<std::shared_ptr<oram_server::Stub>> stubs_;
   // Position map: [key] -> [slot_id].
   p_oram_position_t position_map_;
   // Slots: [slot_id] -> [block1, block2, ..., block_n].
   pp_oram_slot_t slots_;
   // Controllers for each slot: [slot_id] -> [controller_1, controller_2, ...,
   //                                          controller_n].
-  std::vector<std::unique_ptr<PathOramController>> path_oram_controllers_;
+  std::vector<std::unique_ptr<OramController>> sub_oram_controllers_;
+  // A partition is accessed by at most one thread at a time.
+  std::vector<std::unique_ptr<std::mutex>> partition_locks_;
+
+  // Asynchronous eviction: the evictions are queued by `Access` and run by a
+  // background worker.
+  bool async_eviction_;
+  // `Access` blocks while the slots hold more blocks than this and evictions
+  // are pending. 0 means the number of partitions.
+  size_t max_slot_occupancy_;
+  // The number of blocks currently held in the slots.
+  size_t slot_occupancy_;
+  // Guards the slots and the eviction queue. Always acquired after the lock of
+  // a partition.
+  std::mutex slots_lock_;
+  std::condition_variable eviction_cv_;
+  std::condition_variable occupancy_cv_;
+  std::deque<uint32_t> eviction_queue_;
+  // The first error encountered by the worker.
+  OramStatus eviction_status_;
+  bool stop_eviction_;
+  std::thread eviction_worker_;
 
   PartitionOramController(uint32_t id = 0ul)
-      : OramController(id, true, 0ul, OramType::kPartitionOram) {}
+      : OramController(id, true, 0ul, OramType::kPartitionOram),
+        counter_(0ul),
+        sub_oram_type_(OramType::kPathOram),
+        thread_num_(1ul),
+        async_eviction_(false),
+        max_slot_occupancy_(0ul),
+        slot_occupancy_(0ul),
+        stop_eviction_(false) {}
 
   // ==================== Begin private methods ==================== //
   OramStatus Evict(uint32_t id);
   OramStatus SequentialEvict(void);
-  OramStatus RandomEvict(void);
+  OramStatus RandomEvict(size_t evict_num);
+  // Pushes the evictions of one access to the queue of the worker.
+  OramStatus ScheduleEviction(uint32_t slot_id);
+  void EvictionWorker(void);
+  void StartEvictionWorker(void);
+  void StopEvictionWorker(void);
 
   OramStatus ProcessSlot(const std::vector<oram_block_t>& data,
                          uint32_t slot_id);
+  // The number of blocks (including dummies) each partition is filled with.
+  size_t SubOramDataSize(void) const;
+  // The server-side id of the i-th partition.
+  uint32_t SubOramId(uint32_t i) const {
+    return kPartitionIdFlag | (id_ << kPartitionIdShift) | i;
+  }
   // ==================== End private methods ==================== //
  protected:
   virtual OramStatus InternalAccess(Operation op_type, uint32_t address,
@@ -54,10 +107,28 @@ class PartitionOramController final : public OramController {
   }
 
  public:
-  static std::unique_ptr<PartitionOramController> GetInstance();
+  // Each call creates a new, independent instance. Instances sharing a server
+  // must have distinct ids.
+  static std::unique_ptr<PartitionOramController> GetInstance(
+      uint32_t id = 0ul);
 
   void SetBucketSize(size_t bucket_size) { bucket_size_ = bucket_size; }
   void SetNu(size_t nu) { nu_ = nu; }
+  // Must be called before `InitOram`.
+  void SetSubOramType(OramType sub_oram_type) {
+    sub_oram_type_ = sub_oram_type;
+  }
+  void SetThreadNum(size_t thread_num) { thread_num_ = thread_num; }
+  // Must be called before `FillWithData`.
+  void SetAsyncEviction(bool async_eviction, size_t max_slot_occupancy) {
+    async_eviction_ = async_eviction;
+    max_slot_occupancy_ = max_slot_occupancy;
+  }
+  // Each stub should be backed by its own channel.
+  void SetStubs(const std::vector<std::shared_ptr<oram_server::Stub>>& stubs) {
+    stubs_ = stubs;
+    SetStub(stubs_.front());
+  }
 
   virtual OramStatus Access(Operation op_type, uint32_t address,
                             oram_block_t* const data) override;
@@ -71,18 +142,22 @@ class PartitionOramController final : public OramController {
   OramStatus TestPathOram(uint32_t controller_id);
   OramStatus TestPartitionOram(void);
 
-  size_t ReportClientStorage(void) const;
-  size_t ReportNetworkCommunication(void) const;
-  std::chrono::microseconds ReportNetworkingTime(void) const;
+  virtual size_t ReportClientStorage(void) const override;
+  virtual size_t ReportNetworkCommunication(void) const override;
+  virtual std::chrono::microseconds ReportNetworkingTime(
+      void) const override;
 
   void Reset(uint32_t block_num) {
+    StopEvictionWorker();
     block_num_ = block_num;
     position_map_.clear();
     slots_.clear();
-    path_oram_controllers_.clear();
+    slot_occupancy_ = 0ul;
+    sub_oram_controllers_.clear();
+    partition_locks_.clear();
   }
 
-  virtual ~PartitionOramController() {}
+  virtual ~PartitionOramController() { StopEvictionWorker(); }
 };
 }  // namespace oram_impl
 
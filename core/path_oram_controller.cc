@@ -98,10 +98,15 @@ OramStatus PathOramController::AccurateWriteBucket(
   request.set_offset(offset);
   request.set_type(Type::kInit);
 
-  // Copy the buckets into the buffer of WriteBucketRequest.
-  for (auto block : bucket) {
-    // Encrypt the block.
-    oram_utils::EncryptBlock(&block, cryptor_.get());
+  // Encrypt a copy of the bucket and put it into the buffer of
+  // WriteBucketRequest.
+  p_oram_bucket_t blocks = bucket;
+  OramStatus encrypt_status =
+      oram_utils::EncryptBlocks(blocks.data(), blocks.size(), cryptor_.get());
+  if (!encrypt_status.ok()) {
+    return encrypt_status;
+  }
+  for (const auto& block : blocks) {
     std::string block_str;
     oram_utils::ConvertToString(&block, &block_str);
     request.add_bucket(block_str);
@@ -213,11 +218,11 @@ OramStatus PathOramController::FillWithData(
   return OramStatus::OK;
 }
 
-OramStatus PathOramController::ReadBucket(uint32_t path, uint32_t level,
-                                          p_oram_bucket_t* const bucket) {
-  if (path >= number_of_leafs_ || level > tree_level_) {
+OramStatus PathOramController::ReadPath(uint32_t path,
+                                        p_oram_bucket_t* const blocks) {
+  if (path >= number_of_leafs_) {
     return OramStatus(StatusCode::kInvalidArgument,
-                      "The path or the level given is not correct", __func__);
+                      "The path given is not correct", __func__);
   }
 
   grpc::ClientContext context;
@@ -228,10 +233,9 @@ OramStatus PathOramController::ReadBucket(uint32_t path, uint32_t level,
 
   ASSEMBLE_HEADER(request, id_, instance_hash_, GetVersion());
   request.set_path(path);
-  request.set_level(level);
 
   auto begin = std::chrono::high_resolution_clock::now();
-  grpc::Status status = stub_->ReadPath(&context, request, &response);
+  grpc::Status status = stub_->ReadFullPath(&context, request, &response);
   auto end = std::chrono::high_resolution_clock::now();
 
   network_time_ +=
@@ -242,50 +246,54 @@ OramStatus PathOramController::ReadBucket(uint32_t path, uint32_t level,
                       __func__);
   }
 
-  const size_t bucket_size = response.bucket_size();
-  // Then copy the bucket to the vector.
-  for (size_t j = 0; j < bucket_size; j++) {
-    oram_block_t block;
-    oram_utils::ConvertToBlock(response.bucket(j), &block);
-
-    // Decrypt the block.
-    oram_utils::DecryptBlock(&block, cryptor_.get());
-
-    bucket->emplace_back(block);
+  const size_t block_num = response.bucket_size();
+  // Then copy the blocks to the vector and decrypt them.
+  const size_t base = blocks->size();
+  blocks->resize(base + block_num);
+  for (size_t j = 0; j < block_num; j++) {
+    oram_utils::ConvertToBlock(response.bucket(j), &(*blocks)[base + j]);
+  }
+  OramStatus decrypt_status = oram_utils::DecryptBlocks(
+      blocks->data() + base, block_num, cryptor_.get());
+  if (!decrypt_status.ok()) {
+    return decrypt_status;
   }
 
-  network_communication_ += response.bucket_size();
+  network_communication_ += block_num;
 
   return OramStatus::OK;
 }
 
-OramStatus PathOramController::WriteBucket(uint32_t path, uint32_t level,
-                                           const p_oram_bucket_t& bucket) {
-  DBG(logger, "[+] Writing bucket at path {}, level {}", path, level);
+OramStatus PathOramController::WritePath(uint32_t path,
+                                         const p_oram_path_t& buckets) {
+  DBG(logger, "[+] Writing path {}", path);
 
   grpc::ClientContext context;
-  WritePathRequest request;
+  WriteFullPathRequest request;
   WritePathResponse response;
 
   ASSEMBLE_HEADER(request, id_, instance_hash_, GetVersion());
   request.set_path(path);
-  request.set_level(level);
-  request.set_type(Type::kNormal);
 
-  // Copy the buckets into the buffer of WriteBucketRequest.
-  for (auto block : bucket) {
-    // Encrypt the block.
-    oram_utils::EncryptBlock(&block, cryptor_.get());
+  // Encrypt a copy of each bucket and put it into the request.
+  for (const auto& bucket : buckets) {
+    p_oram_bucket_t blocks = bucket;
+    OramStatus encrypt_status = oram_utils::EncryptBlocks(
+        blocks.data(), blocks.size(), cryptor_.get());
+    if (!encrypt_status.ok()) {
+      return encrypt_status;
+    }
 
-    std::string block_str;
-    oram_utils::ConvertToString(&block, &block_str);
-    request.add_bucket(block_str);
-  }
+    BucketMessage* const message = request.add_buckets();
+    for (const auto& block : blocks) {
+      oram_utils::ConvertToString(&block, message->add_bucket());
+    }
 
-  network_communication_ += bucket.size();
+    network_communication_ += bucket.size();
+  }
 
   auto begin = std::chrono::high_resolution_clock::now();
-  grpc::Status status = stub_->WritePath(&context, request, &response);
+  grpc::Status status = stub_->WriteFullPath(&context, request, &response);
   auto end = std::chrono::high_resolution_clock::now();
 
   network_time_ +=
@@ -367,19 +375,12 @@ OramStatus PathOramController::InternalAccessDirect(Operation op_type,
                                                     oram_block_t* const data,
                                                     bool dummy) {
   // Step 3-5: Read the whole path from the server into the stash.
-  p_oram_path_t bucket_this_path;
-
-  for (size_t i = 0; i <= tree_level_; i++) {
-    p_oram_bucket_t bucket_this_level;
-    OramStatus status = ReadBucket(x, i, &bucket_this_level);
-
-    if (!status.ok()) {
-      return status.Append(OramStatus(
-          StatusCode::kInvalidOperation,
-          oram_utils::StrCat("Failed to write bucket ", x), __func__));
-    }
-
-    bucket_this_path.emplace_back(bucket_this_level);
+  p_oram_bucket_t blocks_this_path;
+  OramStatus read_status = ReadPath(x, &blocks_this_path);
+  if (!read_status.ok()) {
+    return read_status.Append(OramStatus(
+        StatusCode::kInvalidOperation,
+        oram_utils::StrCat("Failed to read path ", x), __func__));
   }
 
   if (dummy) {
@@ -388,19 +389,15 @@ OramStatus PathOramController::InternalAccessDirect(Operation op_type,
   }
 
   // Read all the blocks into the stash.
-  for (size_t i = 0; i <= tree_level_; i++) {
-    for (size_t j = 0; j < bucket_this_path[i].size(); j++) {
-      oram_block_t block = bucket_this_path[i][j];
-
-      // Check if the block is already in the stash.
-      // If there is no such block, we add it to the stash.
-      //
-      // <=> S = S ∪ ReadBucket(P(x, l))
-      auto iter = std::find_if(stash_.begin(), stash_.end(),
-                               BlockEqual(block.header.block_id));
-      if (iter == stash_.end() && block.header.type == BlockType::kNormal) {
-        stash_.emplace_back(block);
-      }
+  for (const auto& block : blocks_this_path) {
+    // Check if the block is already in the stash.
+    // If there is no such block, we add it to the stash.
+    //
+    // <=> S = S ∪ ReadBucket(P(x, l))
+    auto iter = std::find_if(stash_.begin(), stash_.end(),
+                             BlockEqual(block.header.block_id));
+    if (iter == stash_.end() && block.header.type == BlockType::kNormal) {
+      stash_.emplace_back(block);
     }
   }
 
@@ -446,6 +443,8 @@ OramStatus PathOramController::InternalAccessDirect(Operation op_type,
   // the leaf of block a' intersects the path accessed P(x) at level l. In
   // other words, if P(x, l) = P(position[a'], l).
 
+  // The buckets are sent together once all of them are filled.
+  p_oram_path_t bucket_this_path(tree_level_ + 1);
   // Prevent overflow for unsigned variable...
   for (size_t i = tree_level_ + 1; i >= 1; i--) {
     // Find a subset S' of stash such that the element in S' intersects with
@@ -453,13 +452,13 @@ OramStatus PathOramController::InternalAccessDirect(Operation op_type,
     // P(position[a'], l)} Select min(|S'|, Z) blocks. If |S'| < Z, then we
     // pad S' with dummy blocks. Expire all blocks in S that are in S'. Write
     // them back.
-    p_oram_stash_t subset = std::move(FindSubsetOf(x));
-    OramStatus status = WriteBucket(x, i - 1, subset);
+    bucket_this_path[i - 1] = std::move(FindSubsetOf(x));
+  }
 
-    if (!status.ok()) {
-      return status.Append(OramStatus(StatusCode::kInvalidOperation,
-                                      "Failed to write bucket", __func__));
-    }
+  OramStatus write_status = WritePath(x, bucket_this_path);
+  if (!write_status.ok()) {
+    return write_status.Append(OramStatus(StatusCode::kInvalidOperation,
+                                          "Failed to write path", __func__));
   }
 
   return OramStatus::OK;
@@ -44,10 +44,10 @@ class PathOramController : public OramController {
   size_t network_communication_;
 
   // ==================== Begin private methods ==================== //
-  OramStatus ReadBucket(uint32_t path, uint32_t level,
-                        p_oram_bucket_t* const bucket);
-  OramStatus WriteBucket(uint32_t path, uint32_t level,
-                         const p_oram_bucket_t& bucket);
+  // Reads the blocks on the path, or writes its buckets from the root to the
+  // leaf, in one round trip.
+  OramStatus ReadPath(uint32_t path, p_oram_bucket_t* const blocks);
+  OramStatus WritePath(uint32_t path, const p_oram_path_t& buckets);
   OramStatus AccurateWriteBucket(uint32_t level, uint32_t offset,
                                  const p_oram_bucket_t& bucket);
   OramStatus PrintOramTree(void);
@@ -84,10 +84,11 @@ class PathOramController : public OramController {
 
   p_oram_position_t GetPositionMap(void) const { return position_map_; }
   uint32_t GetTreeLevel(void) const { return tree_level_; }
-  size_t ReportClientStorage(void) const;
+  virtual size_t ReportClientStorage(void) const override;
   size_t ReportStashSize(void) const { return stash_size_; }
-  size_t ReportNetworkCommunication(void) const;
-  std::chrono::microseconds ReportNetworkingTime(void) const {
+  virtual size_t ReportNetworkCommunication(void) const override;
+  virtual std::chrono::microseconds ReportNetworkingTime(
+      void) const override {
     return network_time_;
   }
 };
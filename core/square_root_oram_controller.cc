@@ -18,11 +18,57 @@
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
 #include "oram.h"
 
 extern std::shared_ptr<spdlog::logger> logger;
 
 namespace oram_impl {
+// The expected number of blocks a chunk sends to a bucket in the shuffle.
+static const size_t kShuffleLoad = 256;
+// A bucket overflows with probability at most 2^{-kShuffleSecurity}.
+static const size_t kShuffleSecurity = 40;
+// The number of permutations tried before giving up.
+static const size_t kShuffleRetries = 3;
+// Keeps the messages of the shuffle below the default limit of gRPC (4 MB).
+static const size_t kShuffleMessageBlocks = 4096;
+
+static size_t CryptoThreadNum(void) {
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Every position of the memory holds a normal or an invalid block, so the
+// dummies of the shuffle are told apart by their (sealed) type alone.
+static void FillShuffleDummy(oram_block_t* const block) {
+  memset(reinterpret_cast<void*>(block), 0, ORAM_BLOCK_SIZE);
+  block->header.type = BlockType::kDummy;
+}
+
+static bool IsShuffleDummy(const oram_block_t& block) {
+  return block.header.type == BlockType::kDummy;
+}
+
+// The id in the clear would tell the server where each block is, and so the
+// permutation and the accessed addresses; it is only sent sealed. Must be
+// called right before the blocks are encrypted.
+static void SealIds(oram_block_t* const blocks, size_t num) {
+  for (size_t i = 0; i < num; i++) {
+    blocks[i].header.sealed_id = blocks[i].header.block_id;
+    blocks[i].header.block_id = 0;
+  }
+}
+
+// Must be called right after the blocks are decrypted.
+static void UnsealIds(oram_block_t* const blocks, size_t num) {
+  for (size_t i = 0; i < num; i++) {
+    blocks[i].header.block_id = blocks[i].header.sealed_id;
+  }
+}
+
 static std::vector<oram_block_t> Padded(const std::vector<oram_block_t>& data,
                                         size_t num) {
   std::vector<oram_block_t> ans = data;
@@ -96,7 +142,10 @@ OramStatus SquareRootOramController::FillWithData(
 
   // Get the permutation vector.
   std::vector<uint32_t> perm = std::move(CreateVec(padded_data.size()));
-  oram_crypto::RandomPermutation(perm);
+  OramStatus perm_status = oram_crypto::RandomPermutation(perm);
+  if (!perm_status.ok()) {
+    return perm_status;
+  }
   UpdatePosition(perm);
 
   // First we need to make sure that original array is sorted.
@@ -110,16 +159,20 @@ OramStatus SquareRootOramController::FillWithData(
   // Randomly permute the contents of locations 1 through m + \sqrt{m}. That is,
   // select a permutation π over the integers 1 through m + \sqrt{m} and
   // relocate the contents of word i into word pi(i).
+  SealIds(padded_data.data(), padded_data.size());
+  OramStatus encrypt_status = oram_utils::EncryptBlocks(
+      padded_data.data(), padded_data.size(), cryptor_.get(), CryptoThreadNum());
+  if (!encrypt_status.ok()) {
+    return encrypt_status;
+  }
+
   for (size_t i = 0; i < padded_data.size(); i++) {
     // Load the Square Root ORAM with permutation.
-    oram_block_t block = padded_data[i];
-
     DBG(logger, "Perm: {}, {}; visiting block {}", i, perm[i],
-        block.header.block_id);
+        padded_data[i].header.block_id);
 
     std::string block_str;
-    oram_utils::EncryptBlock(&block, cryptor_.get());
-    oram_utils::ConvertToString(&block, &block_str);
+    oram_utils::ConvertToString(&padded_data[i], &block_str);
 
     // Add to request.
     request.add_contents(block_str);
@@ -131,44 +184,85 @@ OramStatus SquareRootOramController::FillWithData(
                       __func__);
   }
 
+  if (background_shuffle_) {
+    OramStatus shuffle_status = StartBackgroundShuffle();
+    if (!shuffle_status.ok()) {
+      return shuffle_status;
+    }
+  }
+
   is_initialized_ = true;
 
   return OramStatus::OK;
 }
 
-OramStatus SquareRootOramController::ReadShelter(oram_block_t* const data) {
-  bool found = false;
-  // Scan the whole shelter.
-  for (size_t i = 0; i < sqrt_m_; i++) {
-    grpc::ClientContext context;
+OramStatus SquareRootOramController::FetchShelter(
+    std::vector<oram_block_t>* const blocks) {
+  // Fetch the whole shelter in one round trip.
+  grpc::ClientContext context;
+  ReadShelterRequest request;
+  ShelterMessage response;
 
-    ReadSqrtRequest request;
-    SqrtMessage response;
+  ASSEMBLE_HEADER(request, id_, instance_hash_, GetVersion());
 
-    ASSEMBLE_HEADER(request, id_, instance_hash_, GetVersion());
-    request.set_read_from(kShelter);
-    request.set_tag(i);
+  grpc::Status status = stub_->ReadShelter(&context, request, &response);
+  if (!status.ok()) {
+    return OramStatus(StatusCode::kServerError, status.error_message(),
+                      __func__);
+  }
 
-    grpc::Status status = stub_->ReadSqrtMemory(&context, request, &response);
-    if (!status.ok()) {
-      return OramStatus(StatusCode::kServerError, status.error_message(),
-                        __func__);
+  // Decrypt all the occupied slots in parallel.
+  const size_t slot_num = response.contents_size();
+  std::vector<oram_block_t> slots(slot_num);
+  std::vector<uint8_t> occupied(slot_num, 0);
+  OramStatus decrypt_status = oram_utils::ParallelFor(
+      slot_num, CryptoThreadNum(), [&](size_t i) {
+        // Need to check if the block is empty.
+        if (response.contents(i).empty()) {
+          return OramStatus::OK;
+        }
+
+        occupied[i] = 1;
+        // Deserialze the received block.
+        oram_utils::ConvertToBlock(response.contents(i), &slots[i]);
+        // Decrypt the block.
+        OramStatus status = oram_utils::DecryptBlock(&slots[i], cryptor_.get());
+        UnsealIds(&slots[i], 1);
+        return status;
+      });
+  if (!decrypt_status.ok()) {
+    return decrypt_status.Append(OramStatus(StatusCode::kInvalidOperation,
+                                            "Cannot decrypt the shelter",
+                                            __func__));
+  }
+
+  blocks->clear();
+  for (size_t i = 0; i < slot_num; i++) {
+    if (occupied[i]) {
+      blocks->emplace_back(slots[i]);
     }
+  }
 
-    // Need to check if the block is empty.
-    if (!response.content().empty()) {
-      oram_block_t block;
-      // Deserialze the received block.
-      oram_utils::ConvertToBlock(response.content(), &block);
-      // Decrypt the block.
-      oram_utils::DecryptBlock(&block, cryptor_.get());
-      // Check if the block id matches.
-      if (block.header.type == BlockType::kNormal &&
-          block.header.block_id == data->header.block_id) {
-        memcpy(reinterpret_cast<void*>(data), reinterpret_cast<void*>(&block),
-               ORAM_BLOCK_SIZE);
-        found = true;
-      }
+  return OramStatus::OK;
+}
+
+OramStatus SquareRootOramController::ReadShelter(oram_block_t* const data) {
+  std::vector<oram_block_t> blocks;
+  OramStatus status = FetchShelter(&blocks);
+  if (!status.ok()) {
+    return status;
+  }
+
+  // Scan the whole shelter. A block written more than once in this epoch
+  // appears several times; the latest copy wins.
+  bool found = false;
+  for (const oram_block_t& block : blocks) {
+    // Check if the block id matches.
+    if (block.header.type == BlockType::kNormal &&
+        block.header.block_id == data->header.block_id) {
+      memcpy(reinterpret_cast<void*>(data),
+             reinterpret_cast<const void*>(&block), ORAM_BLOCK_SIZE);
+      found = true;
     }
   }
 
@@ -210,6 +304,7 @@ OramStatus SquareRootOramController::ReadBlock(uint32_t from, uint32_t pos,
       oram_utils::ConvertToBlock(response.content(), data);
       // Decrypt the block.
       oram_utils::DecryptBlock(data, cryptor_.get());
+      UnsealIds(data, 1);
     } else {
       // Not found. Should panic?
       return OramStatus(
@@ -234,6 +329,7 @@ OramStatus SquareRootOramController::WriteBlock(uint32_t position,
   // Serialize the the block into request type.
   std::string data_str;
   // Encrypt the block.
+  SealIds(data, 1);
   oram_utils::EncryptBlock(data, cryptor_.get());
   oram_utils::ConvertToString(data, &data_str);
   request.set_content(data_str);
@@ -253,67 +349,497 @@ SquareRootOramController::SquareRootOramController(uint32_t id, bool standalone,
     : OramController(id, standalone, block_num, OramType::kSquareOram),
       sqrt_m_((size_t)std::ceil(std::sqrt(block_num))),
       next_dummy_(0ul),
-      counter_(0ul) {
-  // Check if the input is valid according to the current implementation of FPE.
-  PANIC_IF(
-      ((sqrt_m_ + block_num) & (sqrt_m_ + block_num - 1)) != 0,
-      "Currently, m + \\sqrt{m} should be some power of 2, where m denotes "
-      "the block number.");
+      counter_(0ul),
+      background_shuffle_(false),
+      shuffle_steps_per_access_(0ul) {
+  const size_t n = block_num + sqrt_m_;
+  shuffle_bucket_size_ =
+      std::min(n, (size_t)std::ceil(std::sqrt((double)n * kShuffleLoad)));
+  shuffle_bucket_num_ = (n + shuffle_bucket_size_ - 1) / shuffle_bucket_size_;
+
+  // By the Chernoff bound, a chunk sends more than load + t blocks to a bucket
+  // with probability at most exp(-t^2 / (2 (load + t / 3))); we take the union
+  // bound over all the (chunk, bucket) pairs.
+  const double load = (double)shuffle_bucket_size_ * shuffle_bucket_size_ / n;
+  const double l = std::log((double)shuffle_bucket_num_ * shuffle_bucket_num_) +
+                   kShuffleSecurity * std::log(2.0);
+  const double t = (2 * l / 3 + std::sqrt(4 * l * l / 9 + 8 * l * load)) / 2;
+  shuffle_padding_ =
+      std::min(shuffle_bucket_size_, (size_t)std::ceil(load + t));
+}
+
+OramStatus SquareRootOramController::ResamplePermutation(void) {
+  shuffle_perm_ = std::move(CreateVec(block_num_ + sqrt_m_));
+  return oram_crypto::RandomPermutation(shuffle_perm_);
 }
 
 OramStatus SquareRootOramController::PermuteOnFull(void) {
-  OramStatus status = OramStatus::OK;
   // Increment the counter and check if we need to permute the oram again.
-  // The permutation is done on the server side; we just need to update the
-  // position map.
-  if (++counter_ == sqrt_m_) {
-    DBG(logger, "Performing Permutation!");
-
-    // First let us clear the counter.
-    counter_ = 0ul;
-    // Also clear next_dummy_.
-    next_dummy_ = 0ul;
-
-    // Then we create a random permutation.
-    std::vector<uint32_t> perm = std::move(CreateVec(block_num_ + sqrt_m_));
-    status = oram_crypto::RandomPermutation(perm);
+  // The permutation is driven by the client; the server only sees the
+  // re-encrypted blocks moving through fixed access patterns.
+  if (++counter_ != sqrt_m_) {
+    return OramStatus::OK;
+  }
+
+  DBG(logger, "Performing Permutation!");
+
+  // First let us clear the counter.
+  counter_ = 0ul;
+  // Also clear next_dummy_.
+  next_dummy_ = 0ul;
+
+  if (background_shuffle_) {
+    // The next memory is (almost) ready.
+    return SwapMemory();
+  }
+
+  // Then we create a random permutation.
+  OramStatus status = ResamplePermutation();
+  if (!status.ok()) {
+    return status.Append(OramStatus(
+        StatusCode::kInvalidOperation,
+        "Sqaure Root Oram Controller cannot permute the memory", __func__));
+  }
+
+  return Shuffle();
+}
+
+// A variant of the Melbourne shuffle (Ohrimenko et al., ICALP 2014).
+//
+// Distribution: the memory is read chunk by chunk; each chunk is split into
+// buckets by the destination of its blocks, and each bucket is padded with
+// dummies to the same size before being written to the temporary area.
+// Cleanup: each bucket collects its parts from all the chunks, drops the
+// dummies, and writes the blocks to their destinations, which form a
+// contiguous range of the memory.
+//
+// All the blocks are re-encrypted on the way and the reads and writes depend
+// only on the size of the memory. A bucket overflows with negligible
+// probability, in which case we start over with a fresh permutation.
+OramStatus SquareRootOramController::Shuffle(void) {
+  auto begin = std::chrono::high_resolution_clock::now();
+  const size_t temp_size =
+      shuffle_bucket_num_ * shuffle_bucket_num_ * shuffle_padding_;
+
+  OramStatus status = OramStatus::OK;
+  for (size_t attempt = 0; attempt < kShuffleRetries; attempt++) {
+    // This also merges the shelter back into the memory.
+    if (!(status = ShuffleControl(kSqrtShuffleBegin, temp_size)).ok()) {
+      return status;
+    }
+
+    PlanShuffle(kSqrtMemoryArea);
+    status = RunShuffleTasks(shuffle_tasks_.size());
+    if (status.error_code() == StatusCode::kOutOfRange) {
+      // Nothing has been written to the memory yet.
+      INFO(logger, "[-] A bucket overflows; resampling the permutation.");
+      if (!(status = ResamplePermutation()).ok()) {
+        return status;
+      }
+      continue;
+    } else if (!status.ok()) {
+      return status;
+    }
+
+    if (!(status = ShuffleControl(kSqrtShuffleEnd, 0)).ok()) {
+      return status;
+    }
+
+    // Flush position map.
+    // This update should be done at the tag level.
+    // So the internal logic is a little bit different.
+    // address -> [tag -> tag] (We are doing this)
+    UpdatePosition(shuffle_perm_);
+
+    auto end = std::chrono::high_resolution_clock::now();
+    const auto elapsed =
+        std::chrono::duration_cast<std::chrono::microseconds>(end - begin);
+    INFO(logger,
+         "[+] Shuffled {} blocks in {} ms ({} blocks/s, temporary area: {} "
+         "blocks).",
+         shuffle_perm_.size(), elapsed.count() / 1000,
+         shuffle_perm_.size() * 1e6 / std::max<int64_t>(elapsed.count(), 1),
+         temp_size);
+
+    return OramStatus::OK;
+  }
+
+  return OramStatus(StatusCode::kUnknownError,
+                    "The shuffle kept overflowing; the parameters are wrong.",
+                    __func__);
+}
+
+OramStatus SquareRootOramController::ShuffleControl(uint32_t type,
+                                                    size_t temp_size) {
+  grpc::ClientContext context;
+  SqrtShuffleRequest request;
+  google::protobuf::Empty empty;
+
+  ASSEMBLE_HEADER(request, id_, instance_hash_, GetVersion());
+  request.set_type(type);
+  request.set_temp_size(temp_size);
+
+  grpc::Status status = stub_->SqrtShuffleControl(&context, request, &empty);
+  if (!status.ok()) {
+    return OramStatus(StatusCode::kServerError, status.error_message(),
+                      __func__);
+  }
+
+  return OramStatus::OK;
+}
+
+void SquareRootOramController::PlanShuffle(uint32_t target_area) {
+  shuffle_tasks_.clear();
+  shuffle_in_.clear();
+  shuffle_out_.clear();
+
+  const size_t n = shuffle_perm_.size();
+  const size_t chunk_out = shuffle_bucket_num_ * shuffle_padding_;
+
+  // Distribution: read the chunk, spread it, and write it to the temporary
+  // area.
+  for (size_t i = 0; i < shuffle_bucket_num_; i++) {
+    const size_t begin = i * shuffle_bucket_size_;
+    const size_t end = std::min(n, begin + shuffle_bucket_size_);
+    for (size_t offset = begin; offset < end; offset += kShuffleMessageBlocks) {
+      const size_t length = std::min(kShuffleMessageBlocks, end - offset);
+      shuffle_tasks_.emplace_back([this, offset, length]() {
+        return ReadRanges(kSqrtMemoryArea, {{offset, length}}, &shuffle_in_);
+      });
+    }
+    shuffle_tasks_.emplace_back([this, i]() { return DistributeChunk(i); });
+    PlanWrite(kSqrtTempArea, i * chunk_out, chunk_out);
+  }
+
+  // Cleanup: read the parts of the bucket written by each chunk, put them in
+  // place, and write them to the target.
+  for (size_t j = 0; j < shuffle_bucket_num_; j++) {
+    std::vector<std::pair<uint32_t, uint32_t>> ranges;
+    size_t range_blocks = 0;
+    for (size_t i = 0; i < shuffle_bucket_num_; i++) {
+      ranges.emplace_back((i * shuffle_bucket_num_ + j) * shuffle_padding_,
+                          shuffle_padding_);
+      range_blocks += shuffle_padding_;
+
+      if (i + 1 == shuffle_bucket_num_ ||
+          range_blocks + shuffle_padding_ > kShuffleMessageBlocks) {
+        shuffle_tasks_.emplace_back([this, ranges]() {
+          return ReadRanges(kSqrtTempArea, ranges, &shuffle_in_);
+        });
+        ranges.clear();
+        range_blocks = 0;
+      }
+    }
+    shuffle_tasks_.emplace_back([this, j]() { return CleanupBucket(j); });
+
+    const size_t begin = j * shuffle_bucket_size_;
+    PlanWrite(target_area, begin, std::min(shuffle_bucket_size_, n - begin));
+  }
+}
+
+void SquareRootOramController::PlanWrite(uint32_t area, size_t offset,
+                                         size_t num) {
+  // Writes `shuffle_out_` out a message at a time.
+  for (size_t begin = 0; begin < num; begin += kShuffleMessageBlocks) {
+    const size_t length = std::min(kShuffleMessageBlocks, num - begin);
+    shuffle_tasks_.emplace_back([this, area, offset, begin, length]() {
+      std::vector<oram_block_t> blocks(shuffle_out_.begin() + begin,
+                                       shuffle_out_.begin() + begin + length);
+      return WriteRange(area, offset + begin, blocks);
+    });
+  }
+}
+
+OramStatus SquareRootOramController::RunShuffleTasks(size_t num) {
+  for (size_t i = 0; i < num && !shuffle_tasks_.empty(); i++) {
+    std::function<OramStatus(void)> task = std::move(shuffle_tasks_.front());
+    shuffle_tasks_.pop_front();
+
+    OramStatus status = task();
     if (!status.ok()) {
-      return status.Append(OramStatus(
-          StatusCode::kInvalidOperation,
-          "Sqaure Root Oram Controller cannot permute the memory", __func__));
-    } else {
-      // Send the whole vector to the server.
-      return DoPermute(perm);
+      // The shared state is meaningless now; the caller has to start over.
+      shuffle_tasks_.clear();
+      shuffle_in_.clear();
+      shuffle_out_.clear();
+      return status;
     }
   }
 
-  // Nothing happens or the permutation is done correctly.
+  return OramStatus::OK;
+}
+
+OramStatus SquareRootOramController::DistributeChunk(size_t chunk) {
+  const size_t begin = chunk * shuffle_bucket_size_;
+  const size_t length =
+      std::min(shuffle_bucket_size_, shuffle_perm_.size() - begin);
+  if (shuffle_in_.size() != length) {
+    return OramStatus(StatusCode::kUnknownError,
+                      "The chunk is not read completely", __func__);
+  }
+
+  if (background_shuffle_) {
+    // The memory lags one epoch behind; bring the blocks up to date.
+    for (oram_block_t& block : shuffle_in_) {
+      if (block.header.type != BlockType::kNormal) {
+        continue;
+      }
+
+      auto iter = old_shelter_.find(block.header.block_id);
+      if (iter != old_shelter_.end()) {
+        block = iter->second;
+      }
+    }
+  }
+
+  // Group the blocks by the buckets of their destinations.
+  std::vector<std::vector<size_t>> buckets(shuffle_bucket_num_);
+  for (size_t i = 0; i < length; i++) {
+    buckets[shuffle_perm_[begin + i] / shuffle_bucket_size_].emplace_back(i);
+  }
+
+  shuffle_out_.resize(shuffle_bucket_num_ * shuffle_padding_);
+  for (size_t j = 0; j < shuffle_bucket_num_; j++) {
+    if (buckets[j].size() > shuffle_padding_) {
+      return OramStatus(StatusCode::kOutOfRange, "A bucket overflows.",
+                        __func__);
+    }
+
+    for (size_t k = 0; k < shuffle_padding_; k++) {
+      oram_block_t* const slot = &shuffle_out_[j * shuffle_padding_ + k];
+      if (k < buckets[j].size()) {
+        *slot = shuffle_in_[buckets[j][k]];
+      } else {
+        FillShuffleDummy(slot);
+      }
+    }
+  }
+
+  shuffle_in_.clear();
+  return OramStatus::OK;
+}
+
+OramStatus SquareRootOramController::CleanupBucket(size_t bucket) {
+  const size_t begin = bucket * shuffle_bucket_size_;
+  const size_t length =
+      std::min(shuffle_bucket_size_, shuffle_perm_.size() - begin);
+  shuffle_out_.resize(length);
+  std::vector<bool> placed(length, false);
+  size_t placed_num = 0;
+  for (const oram_block_t& block : shuffle_in_) {
+    if (IsShuffleDummy(block)) {
+      continue;
+    }
+
+    // The blocks are still indexed by their old positions.
+    auto iter = position_map_.find(block.header.block_id);
+    if (iter == position_map_.end() || iter->second >= shuffle_perm_.size()) {
+      return OramStatus(StatusCode::kUnknownError,
+                        oram_utils::StrCat("Unknown block ",
+                                           block.header.block_id),
+                        __func__);
+    }
+
+    const size_t dst = shuffle_perm_[iter->second];
+    if (dst < begin || dst >= begin + length || placed[dst - begin]) {
+      return OramStatus(StatusCode::kUnknownError,
+                        oram_utils::StrCat("Block ", block.header.block_id,
+                                           " is misplaced in the shuffle"),
+                        __func__);
+    }
+
+    shuffle_out_[dst - begin] = block;
+    placed[dst - begin] = true;
+    placed_num++;
+  }
+
+  if (placed_num != length) {
+    return OramStatus(StatusCode::kUnknownError,
+                      "Some blocks are lost in the shuffle", __func__);
+  }
+
+  shuffle_in_.clear();
+  return OramStatus::OK;
+}
+
+// De-amortized shuffle. The memory of epoch E holds the data as of the end of
+// epoch E - 2 and `old_shelter_` the updates of epoch E - 1; during epoch E,
+// the shuffle merges the two into the next memory, which therefore holds the
+// data as of the end of epoch E - 1, while the accesses of epoch E go to the
+// shelter as usual. At the end of the epoch, the next memory replaces the
+// current one and the shelter of epoch E becomes `old_shelter_`.
+//
+// The accesses still touch each position of the memory at most once per epoch
+// since a block found in `old_shelter_` is treated as if it were found in the
+// shelter.
+OramStatus SquareRootOramController::StartBackgroundShuffle(void) {
+  const size_t temp_size =
+      shuffle_bucket_num_ * shuffle_bucket_num_ * shuffle_padding_;
+
+  OramStatus status = ResamplePermutation();
+  if (!status.ok()) {
+    return status;
+  } else if (!(status = ShuffleControl(kSqrtShuffleBeginBackground, temp_size))
+                  .ok()) {
+    return status;
+  }
+
+  PlanShuffle(kSqrtNextArea);
+  // Spread the steps evenly over the accesses of the epoch.
+  shuffle_steps_per_access_ = (shuffle_tasks_.size() + sqrt_m_ - 1) / sqrt_m_;
+
+  return OramStatus::OK;
+}
+
+OramStatus SquareRootOramController::AdvanceBackgroundShuffle(void) {
+  if (!background_shuffle_) {
+    return OramStatus::OK;
+  }
+
+  OramStatus status = RunShuffleTasks(shuffle_steps_per_access_);
+  if (status.error_code() == StatusCode::kOutOfRange) {
+    // Nothing has been written to the next memory yet.
+    INFO(logger, "[-] A bucket overflows; resampling the permutation.");
+    if (!(status = ResamplePermutation()).ok()) {
+      return status;
+    }
+
+    PlanShuffle(kSqrtNextArea);
+    // What cannot be done within this epoch is done at its end.
+    const size_t remaining = std::max<size_t>(1ul, sqrt_m_ - counter_ - 1);
+    shuffle_steps_per_access_ =
+        (shuffle_tasks_.size() + remaining - 1) / remaining;
+  }
+
   return status;
 }
 
-OramStatus SquareRootOramController::DoPermute(
-    const std::vector<uint32_t>& perm) {
-  grpc::ClientContext context;
-  google::protobuf::Empty response;
+OramStatus SquareRootOramController::SwapMemory(void) {
+  OramStatus status = OramStatus::OK;
+  while (!shuffle_tasks_.empty()) {
+    if (!(status = AdvanceBackgroundShuffle()).ok()) {
+      return status;
+    }
+  }
+
+  // The swap clears the shelter, so we keep its blocks for the next shuffle.
+  std::vector<oram_block_t> shelter;
+  if (!(status = FetchShelter(&shelter)).ok() ||
+      !(status = ShuffleControl(kSqrtShuffleSwap, 0)).ok()) {
+    return status.Append(OramStatus(StatusCode::kInvalidOperation,
+                                    "Cannot swap in the next memory",
+                                    __func__));
+  }
+
+  old_shelter_.clear();
+  for (const oram_block_t& block : shelter) {
+    // The latest copy wins.
+    if (block.header.type == BlockType::kNormal) {
+      old_shelter_[block.header.block_id] = block;
+    }
+  }
 
-  SqrtPermMessage request;
+  UpdatePosition(shuffle_perm_);
+
+  return StartBackgroundShuffle();
+}
+
+OramStatus SquareRootOramController::ReadRanges(
+    uint32_t area, const std::vector<std::pair<uint32_t, uint32_t>>& ranges,
+    std::vector<oram_block_t>* const out) {
+  std::vector<std::string> contents;
+  ReadSqrtRangeRequest request;
   ASSEMBLE_HEADER(request, id_, instance_hash_, GetVersion());
+  request.set_area(area);
 
-  for (size_t i = 0; i < perm.size(); i++) {
-    request.add_perms(perm[i]);
+  size_t request_blocks = 0;
+  auto flush = [&]() {
+    grpc::ClientContext context;
+    SqrtRangeMessage response;
+    grpc::Status status = stub_->ReadSqrtRange(&context, request, &response);
+    if (!status.ok()) {
+      return OramStatus(StatusCode::kServerError, status.error_message(),
+                        __func__);
+    }
+
+    for (auto& content : *response.mutable_contents()) {
+      contents.emplace_back(std::move(content));
+    }
+    request.clear_offsets();
+    request.clear_lengths();
+    request_blocks = 0;
+    return OramStatus::OK;
+  };
+
+  OramStatus status = OramStatus::OK;
+  for (const auto& range : ranges) {
+    // Split the range if it does not fit in a message.
+    for (uint32_t offset = range.first; offset < range.first + range.second;) {
+      const uint32_t length =
+          std::min<size_t>(range.first + range.second - offset,
+                           kShuffleMessageBlocks - request_blocks);
+      request.add_offsets(offset);
+      request.add_lengths(length);
+      request_blocks += length;
+      offset += length;
+
+      if (request_blocks == kShuffleMessageBlocks &&
+          !(status = flush()).ok()) {
+        return status;
+      }
+    }
+  }
+  if (request_blocks != 0 && !(status = flush()).ok()) {
+    return status;
   }
 
-  grpc::Status status = stub_->SqrtPermute(&context, request, &response);
+  // Append to what is already there.
+  const size_t base = out->size();
+  out->resize(base + contents.size());
+  for (size_t i = 0; i < contents.size(); i++) {
+    oram_utils::ConvertToBlock(contents[i], &(*out)[base + i]);
+  }
+  OramStatus decrypt_status = oram_utils::DecryptBlocks(
+      out->data() + base, contents.size(), cryptor_.get(), CryptoThreadNum());
+  UnsealIds(out->data() + base, contents.size());
+  return decrypt_status;
+}
+
+OramStatus SquareRootOramController::WriteRange(
+    uint32_t area, uint32_t offset, std::vector<oram_block_t>& blocks) {
+  // Re-encrypt everything so that the server cannot link the blocks. Neither
+  // the ids nor the dummies are visible, so the layout reveals nothing.
+  SealIds(blocks.data(), blocks.size());
+  OramStatus status = oram_utils::EncryptBlocks(
+      blocks.data(), blocks.size(), cryptor_.get(), CryptoThreadNum());
   if (!status.ok()) {
-    return OramStatus(StatusCode::kServerError, status.error_message(),
-                      __func__);
+    return status;
   }
 
-  // Flush position map.
-  // This update should be done at the tag level.
-  // So the internal logic is a little bit different.
-  // address -> [tag -> tag] (We are doing this)
-  UpdatePosition(perm);
+  std::vector<std::string> contents(blocks.size());
+  for (size_t i = 0; i < blocks.size(); i++) {
+    oram_utils::ConvertToString(&blocks[i], &contents[i]);
+  }
+
+  for (size_t begin = 0; begin < contents.size();
+       begin += kShuffleMessageBlocks) {
+    const size_t end = std::min(contents.size(), begin + kShuffleMessageBlocks);
+
+    grpc::ClientContext context;
+    WriteSqrtRangeRequest request;
+    google::protobuf::Empty empty;
+    ASSEMBLE_HEADER(request, id_, instance_hash_, GetVersion());
+    request.set_area(area);
+    request.set_offset(offset + begin);
+    for (size_t i = begin; i < end; i++) {
+      request.add_contents(std::move(contents[i]));
+    }
+
+    grpc::Status status = stub_->WriteSqrtRange(&context, request, &empty);
+    if (!status.ok()) {
+      return OramStatus(StatusCode::kServerError, status.error_message(),
+                        __func__);
+    }
+  }
 
   return OramStatus::OK;
 }
@@ -390,6 +916,15 @@ OramStatus SquareRootOramController::InternalAccess(Operation op_type,
     in_shelter = true;
   }
 
+  if (!in_shelter && background_shuffle_) {
+    // The updates of the previous epoch are not in the memory yet.
+    auto iter = old_shelter_.find(address);
+    if (iter != old_shelter_.end()) {
+      block = iter->second;
+      in_shelter = true;
+    }
+  }
+
   // Step 2: If not found in the cache, read from main; else read next dummy.
   if (in_shelter) {
     // Can be permuted, but for convenience, we just "literally" read the next
@@ -433,16 +968,25 @@ OramStatus SquareRootOramController::InternalAccess(Operation op_type,
     // Copy the block to the user side.
     memcpy(reinterpret_cast<void*>(data), reinterpret_cast<void*>(&block),
            ORAM_BLOCK_SIZE);
-    // Immediately write it back.
-    status = WriteBlock(position, data);
   } else {
-    // Simply Call write.
-    status = WriteBlock(position, data);
-    // Propagate the error.
-    if (!status.ok()) {
-      return status.Append(OramStatus(StatusCode::kInvalidOperation,
-                                      "Cannot write back the block", __func__));
-    }
+    memcpy(reinterpret_cast<void*>(&block), reinterpret_cast<void*>(data),
+           ORAM_BLOCK_SIZE);
+  }
+
+  // Exactly one shelter write per access. `WriteBlock` encrypts in place, so
+  // the user's buffer is never passed to it.
+  status = WriteBlock(position, &block);
+  // Propagate the error.
+  if (!status.ok()) {
+    return status.Append(OramStatus(StatusCode::kInvalidOperation,
+                                    "Cannot write back the block", __func__));
+  }
+
+  // Build a slice of the next memory, if any.
+  if (!(status = AdvanceBackgroundShuffle()).ok()) {
+    return status.Append(OramStatus(StatusCode::kUnknownError,
+                                    "The background shuffle failed",
+                                    __func__));
   }
 
   // Check if we need to permute the oram storage.
@@ -17,6 +17,9 @@
 #ifndef ORAM_IMPL_CORE_SQUARE_ROOT_ORAM_CONTROLLER_H_
 #define ORAM_IMPL_CORE_SQUARE_ROOT_ORAM_CONTROLLER_H_
 
+#include <deque>
+#include <functional>
+
 #include "oram_controller.h"
 
 namespace oram_impl {
@@ -36,8 +39,8 @@ class SquareRootOramController : public OramController {
   //
   // In our implementation, we make two modifications:
   // 1. We will use an alternative algorithm for achieving pseudorandom
-  // permutation: the format-preserving encryption that maps each value within
-  // the plaintext domain.
+  // permutation: a keyed Feistel network with cycle-walking that maps each
+  // value within the plaintext domain.
   // 2. We will locally maintain the position map with O(sizeof(uint32_t) * N)
   // storage.
   //
@@ -56,6 +59,30 @@ class SquareRootOramController : public OramController {
   // After m operations, we will permute the whole ORAM storage.
   uint32_t counter_;
 
+  // Parameters of the oblivious shuffle. The memory is read in chunks of
+  // `shuffle_bucket_size_` blocks, each of which is spread over
+  // `shuffle_bucket_num_` buckets padded to `shuffle_padding_` blocks.
+  size_t shuffle_bucket_size_;
+  size_t shuffle_bucket_num_;
+  size_t shuffle_padding_;
+
+  // The shuffle is a queue of small steps, each of which moves at most one
+  // message worth of blocks, sharing the state below.
+  std::deque<std::function<OramStatus(void)>> shuffle_tasks_;
+  std::vector<uint32_t> shuffle_perm_;
+  std::vector<oram_block_t> shuffle_in_;
+  std::vector<oram_block_t> shuffle_out_;
+
+  // De-amortized mode: while an epoch is served, the memory of the next epoch
+  // is built in the background of the server by running a few steps of the
+  // shuffle after each access; the two are swapped at the end of the epoch.
+  bool background_shuffle_;
+  size_t shuffle_steps_per_access_;
+  // The next memory is built from the current one, which lags one epoch
+  // behind, plus the shelter of the previous epoch kept here:
+  // [block id] -> the latest copy.
+  std::unordered_map<uint32_t, oram_block_t> old_shelter_;
+
   // Shelter avaibility mapping. This is always synchronized with the server.
   // sqrt_shelter_empty_t shelter_status_;
 
@@ -64,20 +91,46 @@ class SquareRootOramController : public OramController {
                                     oram_block_t* const data,
                                     bool dummy = false) override;
 
+  // Returns the occupied slots of the shelter in order.
+  OramStatus FetchShelter(std::vector<oram_block_t>* const blocks);
   virtual OramStatus ReadShelter(oram_block_t* const data);
   virtual OramStatus ReadBlock(uint32_t from, uint32_t pos,
                                oram_block_t* const data);
   virtual OramStatus WriteBlock(uint32_t position, oram_block_t* const data);
   virtual OramStatus PermuteOnFull(void);
-  virtual OramStatus DoPermute(const std::vector<uint32_t>& perm);
+  OramStatus ResamplePermutation(void);
+  // Obliviously relocates the block at position i to position
+  // shuffle_perm_[i]. The permutation is resampled if a bucket overflows.
+  virtual OramStatus Shuffle(void);
+  OramStatus ShuffleControl(uint32_t type, size_t temp_size);
+  // Fills `shuffle_tasks_` with the steps that shuffle the memory by
+  // `shuffle_perm_` into `target_area`.
+  void PlanShuffle(uint32_t target_area);
+  void PlanWrite(uint32_t area, size_t offset, size_t num);
+  OramStatus RunShuffleTasks(size_t num);
+  OramStatus DistributeChunk(size_t chunk);
+  OramStatus CleanupBucket(size_t bucket);
+  // For the de-amortized mode.
+  OramStatus StartBackgroundShuffle(void);
+  OramStatus AdvanceBackgroundShuffle(void);
+  OramStatus SwapMemory(void);
+  // Both of them fetch or store the blocks in messages of bounded size.
+  OramStatus ReadRanges(
+      uint32_t area, const std::vector<std::pair<uint32_t, uint32_t>>& ranges,
+      std::vector<oram_block_t>* const out);
+  OramStatus WriteRange(uint32_t area, uint32_t offset,
+                        std::vector<oram_block_t>& blocks);
 
   void UpdatePosition(const std::vector<uint32_t>& perm);
 
  public:
-  // For the convenience of format-preserving encryption, we will round up the
-  // block_num to a value such that m + \sqrt{m} =  2^{n}, for some integer n.
   SquareRootOramController(uint32_t id, bool standalone, size_t block_num);
 
+  // Must be called before `FillWithData`.
+  void SetBackgroundShuffle(bool background_shuffle) {
+    background_shuffle_ = background_shuffle;
+  }
+
   virtual OramStatus InitOram(void) override;
   // The user should prepare a permuted initial data vector.
   virtual OramStatus FillWithData(
@@ -47,6 +47,52 @@ ABSL_FLAG(uint32_t, bucket_size, 4,
 ABSL_FLAG(uint32_t, odict_size, 1e5, "The size of the oblivious dictionary.");
 ABSL_FLAG(uint32_t, client_cache_size, 32, "The size of the client cache.");
 
+ABSL_FLAG(std::string, partition_backend, "PathOram",
+          "The type of each partition of the Partition ORAM.");
+ABSL_FLAG(uint32_t, thread_num, 4,
+          "The number of threads and channels used to set up the partitions.");
+ABSL_FLAG(bool, async_eviction, false,
+          "Run the evictions of the Partition ORAM in the background.");
+ABSL_FLAG(uint32_t, max_slot_occupancy, 0,
+          "The number of blocks in the slots above which accesses wait for "
+          "the background eviction. (0 = the number of partitions)");
+ABSL_FLAG(bool, sqrt_background_shuffle, false,
+          "Reshuffle the Square Root ORAM in the background of the accesses.");
+
+// For the server.
+ABSL_FLAG(std::string, tree_storage_engine, "Array",
+          "The layout of the tree storages on the server (Map, Array, Mmap "
+          "or Uring).");
+ABSL_FLAG(std::string, tree_storage_path, ".",
+          "The directory of the files backing the tree storages.");
+ABSL_FLAG(uint32_t, mmap_locked_levels, 10,
+          "The number of top levels of a mapped tree locked into memory.");
+ABSL_FLAG(bool, mmap_huge_pages, false,
+          "Back the mapped tree storages with huge pages if possible.");
+ABSL_FLAG(uint32_t, uring_cached_levels, 10,
+          "The number of top levels cached in memory by the io_uring engine.");
+ABSL_FLAG(std::string, block_codec, "None",
+          "How the Map engine compresses the blocks (None, LZ4 or Zstd).");
+ABSL_FLAG(size_t, server_thread_num, 0,
+          "The number of threads serving the requests (0 = one per core).");
+ABSL_FLAG(size_t, max_message_size, 64 * 1024 * 1024,
+          "The maximum size of a message in bytes.");
+ABSL_FLAG(size_t, server_memory_quota, 0,
+          "The memory quota of gRPC in megabytes (0 = unlimited).");
+ABSL_FLAG(size_t, server_max_threads, 0,
+          "The maximum number of threads of gRPC (0 = unlimited).");
+ABSL_FLAG(std::string, snapshot_path, "",
+          "The directory of the snapshots of the storages (empty = no "
+          "snapshots).");
+ABSL_FLAG(uint32_t, snapshot_interval, 0,
+          "How often the snapshots are taken in seconds (0 = only at "
+          "shutdown).");
+ABSL_FLAG(bool, enable_wal, false,
+          "Log the write-backs to the tree storages next to the snapshots.");
+ABSL_FLAG(std::string, wal_sync_policy, "Always",
+          "When the log is synchronized to the disk (Always, Periodic or "
+          "Never).");
+
 // Log settings.
 ABSL_FLAG(uint32_t, log_level, 2, "The level of the log.");
 ABSL_FLAG(uint32_t, log_frequency, 3,
@@ -153,6 +199,97 @@ oram_impl::OramStatus YamlParser::DoParse(const YAML::const_iterator& cur_iter,
       config.client_cache_max_size = cur_iter->second.as<size_t>();
     });
 
+  } else if (key == "PartitionBackend") {
+    return oram_utils::TryExec([&]() {
+      config.partition_backend =
+          oram_utils::StrToType(cur_iter->second.as<std::string>());
+    });
+
+  } else if (key == "ThreadNum") {
+    return oram_utils::TryExec(
+        [&]() { config.thread_num = cur_iter->second.as<size_t>(); });
+
+  } else if (key == "AsyncEviction") {
+    return oram_utils::TryExec(
+        [&]() { config.async_eviction = cur_iter->second.as<bool>(); });
+
+  } else if (key == "MaxSlotOccupancy") {
+    return oram_utils::TryExec([&]() {
+      config.max_slot_occupancy = cur_iter->second.as<size_t>();
+    });
+
+  } else if (key == "SqrtBackgroundShuffle") {
+    return oram_utils::TryExec([&]() {
+      config.sqrt_background_shuffle = cur_iter->second.as<bool>();
+    });
+
+  } else if (key == "TreeStorageEngine") {
+    return oram_utils::TryExec([&]() {
+      config.tree_storage_engine =
+          oram_utils::StrToEngineType(cur_iter->second.as<std::string>());
+    });
+
+  } else if (key == "TreeStoragePath") {
+    return oram_utils::TryExec([&]() {
+      config.tree_storage_path = cur_iter->second.as<std::string>();
+    });
+
+  } else if (key == "MmapLockedLevels") {
+    return oram_utils::TryExec([&]() {
+      config.mmap_locked_levels = cur_iter->second.as<uint32_t>();
+    });
+
+  } else if (key == "MmapHugePages") {
+    return oram_utils::TryExec(
+        [&]() { config.mmap_huge_pages = cur_iter->second.as<bool>(); });
+
+  } else if (key == "UringCachedLevels") {
+    return oram_utils::TryExec([&]() {
+      config.uring_cached_levels = cur_iter->second.as<uint32_t>();
+    });
+
+  } else if (key == "BlockCodec") {
+    return oram_utils::TryExec([&]() {
+      config.block_codec =
+          oram_utils::StrToCodec(cur_iter->second.as<std::string>());
+    });
+
+  } else if (key == "ServerThreadNum") {
+    return oram_utils::TryExec(
+        [&]() { config.server_thread_num = cur_iter->second.as<size_t>(); });
+
+  } else if (key == "MaxMessageSize") {
+    return oram_utils::TryExec(
+        [&]() { config.max_message_size = cur_iter->second.as<size_t>(); });
+
+  } else if (key == "ServerMemoryQuota") {
+    return oram_utils::TryExec([&]() {
+      config.server_memory_quota = cur_iter->second.as<size_t>();
+    });
+
+  } else if (key == "ServerMaxThreads") {
+    return oram_utils::TryExec(
+        [&]() { config.server_max_threads = cur_iter->second.as<size_t>(); });
+
+  } else if (key == "SnapshotPath") {
+    return oram_utils::TryExec(
+        [&]() { config.snapshot_path = cur_iter->second.as<std::string>(); });
+
+  } else if (key == "SnapshotInterval") {
+    return oram_utils::TryExec([&]() {
+      config.snapshot_interval = cur_iter->second.as<uint32_t>();
+    });
+
+  } else if (key == "EnableWal") {
+    return oram_utils::TryExec(
+        [&]() { config.enable_wal = cur_iter->second.as<bool>(); });
+
+  } else if (key == "WalSyncPolicy") {
+    return oram_utils::TryExec([&]() {
+      config.wal_sync_policy =
+          oram_utils::StrToSyncPolicy(cur_iter->second.as<std::string>());
+    });
+
   } else if (key == "FilePath") {
     return oram_utils::TryExec(
         [&]() { config.filepath = cur_iter->second.as<std::string>(); });
@@ -184,6 +321,29 @@ oram_impl::OramStatus YamlParser::DoCommandLine(oram_impl::OramConfig& config) {
   config.log_frequency = absl::GetFlag(FLAGS_log_frequency);
   config.odict_size = absl::GetFlag(FLAGS_odict_size);
   config.client_cache_max_size = absl::GetFlag(FLAGS_client_cache_size);
+  config.partition_backend =
+      oram_utils::StrToType(absl::GetFlag(FLAGS_partition_backend));
+  config.thread_num = absl::GetFlag(FLAGS_thread_num);
+  config.async_eviction = absl::GetFlag(FLAGS_async_eviction);
+  config.max_slot_occupancy = absl::GetFlag(FLAGS_max_slot_occupancy);
+  config.sqrt_background_shuffle =
+      absl::GetFlag(FLAGS_sqrt_background_shuffle);
+  config.tree_storage_engine =
+      oram_utils::StrToEngineType(absl::GetFlag(FLAGS_tree_storage_engine));
+  config.tree_storage_path = absl::GetFlag(FLAGS_tree_storage_path);
+  config.mmap_locked_levels = absl::GetFlag(FLAGS_mmap_locked_levels);
+  config.mmap_huge_pages = absl::GetFlag(FLAGS_mmap_huge_pages);
+  config.uring_cached_levels = absl::GetFlag(FLAGS_uring_cached_levels);
+  config.block_codec = oram_utils::StrToCodec(absl::GetFlag(FLAGS_block_codec));
+  config.server_thread_num = absl::GetFlag(FLAGS_server_thread_num);
+  config.max_message_size = absl::GetFlag(FLAGS_max_message_size);
+  config.server_memory_quota = absl::GetFlag(FLAGS_server_memory_quota);
+  config.server_max_threads = absl::GetFlag(FLAGS_server_max_threads);
+  config.snapshot_path = absl::GetFlag(FLAGS_snapshot_path);
+  config.snapshot_interval = absl::GetFlag(FLAGS_snapshot_interval);
+  config.enable_wal = absl::GetFlag(FLAGS_enable_wal);
+  config.wal_sync_policy =
+      oram_utils::StrToSyncPolicy(absl::GetFlag(FLAGS_wal_sync_policy));
   config.disable_debugging = absl::GetFlag(FLAGS_disable_debugging);
   config.filepath = absl::GetFlag(FLAGS_file_path);
 
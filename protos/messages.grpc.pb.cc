@@ -29,11 +29,23 @@ static const char* oram_server_method_names[] = {
   "/oram_impl.oram_server/PrintOramTree",
   "/oram_impl.oram_server/ReadPath",
   "/oram_impl.oram_server/WritePath",
+  "/oram_impl.oram_server/ReadFullPath",
+  "/oram_impl.oram_server/WriteFullPath",
   "/oram_impl.oram_server/ReadFlatMemory",
   "/oram_impl.oram_server/WriteFlatMemory",
+  "/oram_impl.oram_server/ReadFlatStream",
+  "/oram_impl.oram_server/WriteFlatStream",
   "/oram_impl.oram_server/ReadSqrtMemory",
+  "/oram_impl.oram_server/ReadShelter",
   "/oram_impl.oram_server/WriteSqrtMemory",
-  "/oram_impl.oram_server/SqrtPermute",
+  "/oram_impl.oram_server/SqrtShuffleControl",
+  "/oram_impl.oram_server/ReadSqrtRange",
+  "/oram_impl.oram_server/WriteSqrtRange",
+  "/oram_impl.oram_server/InitLayeredOram",
+  "/oram_impl.oram_server/ReadLayeredBlocks",
+  "/oram_impl.oram_server/WriteLayeredLevel",
+  "/oram_impl.oram_server/WriteLayeredRange",
+  "/oram_impl.oram_server/LayeredLevelControl",
   "/oram_impl.oram_server/CloseConnection",
   "/oram_impl.oram_server/KeyExchange",
   "/oram_impl.oram_server/SendHello",
@@ -55,16 +67,28 @@ oram_server::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channe
   , rpcmethod_PrintOramTree_(oram_server_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_ReadPath_(oram_server_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_WritePath_(oram_server_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_ReadFlatMemory_(oram_server_method_names[7], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_WriteFlatMemory_(oram_server_method_names[8], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_ReadSqrtMemory_(oram_server_method_names[9], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_WriteSqrtMemory_(oram_server_method_names[10], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_SqrtPermute_(oram_server_method_names[11], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_CloseConnection_(oram_server_method_names[12], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_KeyExchange_(oram_server_method_names[13], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_SendHello_(oram_server_method_names[14], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_ReportServerInformation_(oram_server_method_names[15], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_ResetServer_(oram_server_method_names[16], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ReadFullPath_(oram_server_method_names[7], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_WriteFullPath_(oram_server_method_names[8], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ReadFlatMemory_(oram_server_method_names[9], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_WriteFlatMemory_(oram_server_method_names[10], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ReadFlatStream_(oram_server_method_names[11], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_WriteFlatStream_(oram_server_method_names[12], options.suffix_for_stats(),::grpc::internal::RpcMethod::CLIENT_STREAMING, channel)
+  , rpcmethod_ReadSqrtMemory_(oram_server_method_names[13], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ReadShelter_(oram_server_method_names[14], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_WriteSqrtMemory_(oram_server_method_names[15], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SqrtShuffleControl_(oram_server_method_names[16], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ReadSqrtRange_(oram_server_method_names[17], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_WriteSqrtRange_(oram_server_method_names[18], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_InitLayeredOram_(oram_server_method_names[19], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ReadLayeredBlocks_(oram_server_method_names[20], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_WriteLayeredLevel_(oram_server_method_names[21], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_WriteLayeredRange_(oram_server_method_names[22], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_LayeredLevelControl_(oram_server_method_names[23], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_CloseConnection_(oram_server_method_names[24], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_KeyExchange_(oram_server_method_names[25], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SendHello_(oram_server_method_names[26], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ReportServerInformation_(oram_server_method_names[27], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ResetServer_(oram_server_method_names[28], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status oram_server::Stub::InitTreeOram(::grpc::ClientContext* context, const ::oram_impl::InitTreeOramRequest& request, ::google::protobuf::Empty* response) {
@@ -228,6 +252,52 @@ void oram_server::Stub::async::WritePath(::grpc::ClientContext* context, const :
   return result;
 }
 
+::grpc::Status oram_server::Stub::ReadFullPath(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest& request, ::oram_impl::ReadPathResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::oram_impl::ReadPathRequest, ::oram_impl::ReadPathResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ReadFullPath_, context, request, response);
+}
+
+void oram_server::Stub::async::ReadFullPath(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest* request, ::oram_impl::ReadPathResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::oram_impl::ReadPathRequest, ::oram_impl::ReadPathResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ReadFullPath_, context, request, response, std::move(f));
+}
+
+void oram_server::Stub::async::ReadFullPath(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest* request, ::oram_impl::ReadPathResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ReadFullPath_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::oram_impl::ReadPathResponse>* oram_server::Stub::PrepareAsyncReadFullPathRaw(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::oram_impl::ReadPathResponse, ::oram_impl::ReadPathRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_ReadFullPath_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::oram_impl::ReadPathResponse>* oram_server::Stub::AsyncReadFullPathRaw(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncReadFullPathRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status oram_server::Stub::WriteFullPath(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest& request, ::oram_impl::WritePathResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::oram_impl::WriteFullPathRequest, ::oram_impl::WritePathResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_WriteFullPath_, context, request, response);
+}
+
+void oram_server::Stub::async::WriteFullPath(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest* request, ::oram_impl::WritePathResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::oram_impl::WriteFullPathRequest, ::oram_impl::WritePathResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_WriteFullPath_, context, request, response, std::move(f));
+}
+
+void oram_server::Stub::async::WriteFullPath(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest* request, ::oram_impl::WritePathResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_WriteFullPath_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>* oram_server::Stub::PrepareAsyncWriteFullPathRaw(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::oram_impl::WritePathResponse, ::oram_impl::WriteFullPathRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_WriteFullPath_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>* oram_server::Stub::AsyncWriteFullPathRaw(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncWriteFullPathRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 ::grpc::Status oram_server::Stub::ReadFlatMemory(::grpc::ClientContext* context, const ::oram_impl::ReadFlatRequest& request, ::oram_impl::FlatVectorMessage* response) {
   return ::grpc::internal::BlockingUnaryCall< ::oram_impl::ReadFlatRequest, ::oram_impl::FlatVectorMessage, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ReadFlatMemory_, context, request, response);
 }
@@ -274,6 +344,38 @@ void oram_server::Stub::async::WriteFlatMemory(::grpc::ClientContext* context, c
   return result;
 }
 
+::grpc::ClientReader< ::oram_impl::FlatChunkMessage>* oram_server::Stub::ReadFlatStreamRaw(::grpc::ClientContext* context, const ::oram_impl::ReadFlatStreamRequest& request) {
+  return ::grpc::internal::ClientReaderFactory< ::oram_impl::FlatChunkMessage>::Create(channel_.get(), rpcmethod_ReadFlatStream_, context, request);
+}
+
+void oram_server::Stub::async::ReadFlatStream(::grpc::ClientContext* context, const ::oram_impl::ReadFlatStreamRequest* request, ::grpc::ClientReadReactor< ::oram_impl::FlatChunkMessage>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::oram_impl::FlatChunkMessage>::Create(stub_->channel_.get(), stub_->rpcmethod_ReadFlatStream_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::oram_impl::FlatChunkMessage>* oram_server::Stub::AsyncReadFlatStreamRaw(::grpc::ClientContext* context, const ::oram_impl::ReadFlatStreamRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::oram_impl::FlatChunkMessage>::Create(channel_.get(), cq, rpcmethod_ReadFlatStream_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::oram_impl::FlatChunkMessage>* oram_server::Stub::PrepareAsyncReadFlatStreamRaw(::grpc::ClientContext* context, const ::oram_impl::ReadFlatStreamRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::oram_impl::FlatChunkMessage>::Create(channel_.get(), cq, rpcmethod_ReadFlatStream_, context, request, false, nullptr);
+}
+
+::grpc::ClientWriter< ::oram_impl::FlatChunkMessage>* oram_server::Stub::WriteFlatStreamRaw(::grpc::ClientContext* context, ::google::protobuf::Empty* response) {
+  return ::grpc::internal::ClientWriterFactory< ::oram_impl::FlatChunkMessage>::Create(channel_.get(), rpcmethod_WriteFlatStream_, context, response);
+}
+
+void oram_server::Stub::async::WriteFlatStream(::grpc::ClientContext* context, ::google::protobuf::Empty* response, ::grpc::ClientWriteReactor< ::oram_impl::FlatChunkMessage>* reactor) {
+  ::grpc::internal::ClientCallbackWriterFactory< ::oram_impl::FlatChunkMessage>::Create(stub_->channel_.get(), stub_->rpcmethod_WriteFlatStream_, context, response, reactor);
+}
+
+::grpc::ClientAsyncWriter< ::oram_impl::FlatChunkMessage>* oram_server::Stub::AsyncWriteFlatStreamRaw(::grpc::ClientContext* context, ::google::protobuf::Empty* response, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncWriterFactory< ::oram_impl::FlatChunkMessage>::Create(channel_.get(), cq, rpcmethod_WriteFlatStream_, context, response, true, tag);
+}
+
+::grpc::ClientAsyncWriter< ::oram_impl::FlatChunkMessage>* oram_server::Stub::PrepareAsyncWriteFlatStreamRaw(::grpc::ClientContext* context, ::google::protobuf::Empty* response, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncWriterFactory< ::oram_impl::FlatChunkMessage>::Create(channel_.get(), cq, rpcmethod_WriteFlatStream_, context, response, false, nullptr);
+}
+
 ::grpc::Status oram_server::Stub::ReadSqrtMemory(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRequest& request, ::oram_impl::SqrtMessage* response) {
   return ::grpc::internal::BlockingUnaryCall< ::oram_impl::ReadSqrtRequest, ::oram_impl::SqrtMessage, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ReadSqrtMemory_, context, request, response);
 }
@@ -297,6 +399,29 @@ void oram_server::Stub::async::ReadSqrtMemory(::grpc::ClientContext* context, co
   return result;
 }
 
+::grpc::Status oram_server::Stub::ReadShelter(::grpc::ClientContext* context, const ::oram_impl::ReadShelterRequest& request, ::oram_impl::ShelterMessage* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::oram_impl::ReadShelterRequest, ::oram_impl::ShelterMessage, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ReadShelter_, context, request, response);
+}
+
+void oram_server::Stub::async::ReadShelter(::grpc::ClientContext* context, const ::oram_impl::ReadShelterRequest* request, ::oram_impl::ShelterMessage* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::oram_impl::ReadShelterRequest, ::oram_impl::ShelterMessage, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ReadShelter_, context, request, response, std::move(f));
+}
+
+void oram_server::Stub::async::ReadShelter(::grpc::ClientContext* context, const ::oram_impl::ReadShelterRequest* request, ::oram_impl::ShelterMessage* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ReadShelter_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::oram_impl::ShelterMessage>* oram_server::Stub::PrepareAsyncReadShelterRaw(::grpc::ClientContext* context, const ::oram_impl::ReadShelterRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::oram_impl::ShelterMessage, ::oram_impl::ReadShelterRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_ReadShelter_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::oram_impl::ShelterMessage>* oram_server::Stub::AsyncReadShelterRaw(::grpc::ClientContext* context, const ::oram_impl::ReadShelterRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncReadShelterRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 ::grpc::Status oram_server::Stub::WriteSqrtMemory(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtMessage& request, ::google::protobuf::Empty* response) {
   return ::grpc::internal::BlockingUnaryCall< ::oram_impl::WriteSqrtMessage, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_WriteSqrtMemory_, context, request, response);
 }
@@ -320,25 +445,186 @@ void oram_server::Stub::async::WriteSqrtMemory(::grpc::ClientContext* context, c
   return result;
 }
 
-::grpc::Status oram_server::Stub::SqrtPermute(::grpc::ClientContext* context, const ::oram_impl::SqrtPermMessage& request, ::google::protobuf::Empty* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::oram_impl::SqrtPermMessage, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SqrtPermute_, context, request, response);
+::grpc::Status oram_server::Stub::SqrtShuffleControl(::grpc::ClientContext* context, const ::oram_impl::SqrtShuffleRequest& request, ::google::protobuf::Empty* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::oram_impl::SqrtShuffleRequest, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SqrtShuffleControl_, context, request, response);
+}
+
+void oram_server::Stub::async::SqrtShuffleControl(::grpc::ClientContext* context, const ::oram_impl::SqrtShuffleRequest* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::oram_impl::SqrtShuffleRequest, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SqrtShuffleControl_, context, request, response, std::move(f));
+}
+
+void oram_server::Stub::async::SqrtShuffleControl(::grpc::ClientContext* context, const ::oram_impl::SqrtShuffleRequest* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SqrtShuffleControl_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* oram_server::Stub::PrepareAsyncSqrtShuffleControlRaw(::grpc::ClientContext* context, const ::oram_impl::SqrtShuffleRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::google::protobuf::Empty, ::oram_impl::SqrtShuffleRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SqrtShuffleControl_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* oram_server::Stub::AsyncSqrtShuffleControlRaw(::grpc::ClientContext* context, const ::oram_impl::SqrtShuffleRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncSqrtShuffleControlRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status oram_server::Stub::ReadSqrtRange(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRangeRequest& request, ::oram_impl::SqrtRangeMessage* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::oram_impl::ReadSqrtRangeRequest, ::oram_impl::SqrtRangeMessage, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ReadSqrtRange_, context, request, response);
 }
 
-void oram_server::Stub::async::SqrtPermute(::grpc::ClientContext* context, const ::oram_impl::SqrtPermMessage* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::oram_impl::SqrtPermMessage, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SqrtPermute_, context, request, response, std::move(f));
+void oram_server::Stub::async::ReadSqrtRange(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRangeRequest* request, ::oram_impl::SqrtRangeMessage* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::oram_impl::ReadSqrtRangeRequest, ::oram_impl::SqrtRangeMessage, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ReadSqrtRange_, context, request, response, std::move(f));
 }
 
-void oram_server::Stub::async::SqrtPermute(::grpc::ClientContext* context, const ::oram_impl::SqrtPermMessage* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SqrtPermute_, context, request, response, reactor);
+void oram_server::Stub::async::ReadSqrtRange(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRangeRequest* request, ::oram_impl::SqrtRangeMessage* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ReadSqrtRange_, context, request, response, reactor);
 }
 
-::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* oram_server::Stub::PrepareAsyncSqrtPermuteRaw(::grpc::ClientContext* context, const ::oram_impl::SqrtPermMessage& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::google::protobuf::Empty, ::oram_impl::SqrtPermMessage, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SqrtPermute_, context, request);
+::grpc::ClientAsyncResponseReader< ::oram_impl::SqrtRangeMessage>* oram_server::Stub::PrepareAsyncReadSqrtRangeRaw(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRangeRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::oram_impl::SqrtRangeMessage, ::oram_impl::ReadSqrtRangeRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_ReadSqrtRange_, context, request);
 }
 
-::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* oram_server::Stub::AsyncSqrtPermuteRaw(::grpc::ClientContext* context, const ::oram_impl::SqrtPermMessage& request, ::grpc::CompletionQueue* cq) {
+::grpc::ClientAsyncResponseReader< ::oram_impl::SqrtRangeMessage>* oram_server::Stub::AsyncReadSqrtRangeRaw(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRangeRequest& request, ::grpc::CompletionQueue* cq) {
   auto* result =
-    this->PrepareAsyncSqrtPermuteRaw(context, request, cq);
+    this->PrepareAsyncReadSqrtRangeRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status oram_server::Stub::WriteSqrtRange(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtRangeRequest& request, ::google::protobuf::Empty* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::oram_impl::WriteSqrtRangeRequest, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_WriteSqrtRange_, context, request, response);
+}
+
+void oram_server::Stub::async::WriteSqrtRange(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtRangeRequest* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::oram_impl::WriteSqrtRangeRequest, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_WriteSqrtRange_, context, request, response, std::move(f));
+}
+
+void oram_server::Stub::async::WriteSqrtRange(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtRangeRequest* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_WriteSqrtRange_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* oram_server::Stub::PrepareAsyncWriteSqrtRangeRaw(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtRangeRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::google::protobuf::Empty, ::oram_impl::WriteSqrtRangeRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_WriteSqrtRange_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* oram_server::Stub::AsyncWriteSqrtRangeRaw(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtRangeRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncWriteSqrtRangeRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status oram_server::Stub::InitLayeredOram(::grpc::ClientContext* context, const ::oram_impl::InitLayeredOramRequest& request, ::google::protobuf::Empty* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::oram_impl::InitLayeredOramRequest, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_InitLayeredOram_, context, request, response);
+}
+
+void oram_server::Stub::async::InitLayeredOram(::grpc::ClientContext* context, const ::oram_impl::InitLayeredOramRequest* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::oram_impl::InitLayeredOramRequest, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_InitLayeredOram_, context, request, response, std::move(f));
+}
+
+void oram_server::Stub::async::InitLayeredOram(::grpc::ClientContext* context, const ::oram_impl::InitLayeredOramRequest* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_InitLayeredOram_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* oram_server::Stub::PrepareAsyncInitLayeredOramRaw(::grpc::ClientContext* context, const ::oram_impl::InitLayeredOramRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::google::protobuf::Empty, ::oram_impl::InitLayeredOramRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_InitLayeredOram_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* oram_server::Stub::AsyncInitLayeredOramRaw(::grpc::ClientContext* context, const ::oram_impl::InitLayeredOramRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncInitLayeredOramRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status oram_server::Stub::ReadLayeredBlocks(::grpc::ClientContext* context, const ::oram_impl::ReadLayeredRequest& request, ::oram_impl::LayeredBlocksMessage* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::oram_impl::ReadLayeredRequest, ::oram_impl::LayeredBlocksMessage, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ReadLayeredBlocks_, context, request, response);
+}
+
+void oram_server::Stub::async::ReadLayeredBlocks(::grpc::ClientContext* context, const ::oram_impl::ReadLayeredRequest* request, ::oram_impl::LayeredBlocksMessage* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::oram_impl::ReadLayeredRequest, ::oram_impl::LayeredBlocksMessage, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ReadLayeredBlocks_, context, request, response, std::move(f));
+}
+
+void oram_server::Stub::async::ReadLayeredBlocks(::grpc::ClientContext* context, const ::oram_impl::ReadLayeredRequest* request, ::oram_impl::LayeredBlocksMessage* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ReadLayeredBlocks_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::oram_impl::LayeredBlocksMessage>* oram_server::Stub::PrepareAsyncReadLayeredBlocksRaw(::grpc::ClientContext* context, const ::oram_impl::ReadLayeredRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::oram_impl::LayeredBlocksMessage, ::oram_impl::ReadLayeredRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_ReadLayeredBlocks_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::oram_impl::LayeredBlocksMessage>* oram_server::Stub::AsyncReadLayeredBlocksRaw(::grpc::ClientContext* context, const ::oram_impl::ReadLayeredRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncReadLayeredBlocksRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status oram_server::Stub::WriteLayeredLevel(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRequest& request, ::google::protobuf::Empty* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::oram_impl::WriteLayeredRequest, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_WriteLayeredLevel_, context, request, response);
+}
+
+void oram_server::Stub::async::WriteLayeredLevel(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRequest* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::oram_impl::WriteLayeredRequest, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_WriteLayeredLevel_, context, request, response, std::move(f));
+}
+
+void oram_server::Stub::async::WriteLayeredLevel(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRequest* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_WriteLayeredLevel_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* oram_server::Stub::PrepareAsyncWriteLayeredLevelRaw(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::google::protobuf::Empty, ::oram_impl::WriteLayeredRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_WriteLayeredLevel_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* oram_server::Stub::AsyncWriteLayeredLevelRaw(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncWriteLayeredLevelRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status oram_server::Stub::WriteLayeredRange(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRangeRequest& request, ::google::protobuf::Empty* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::oram_impl::WriteLayeredRangeRequest, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_WriteLayeredRange_, context, request, response);
+}
+
+void oram_server::Stub::async::WriteLayeredRange(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRangeRequest* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::oram_impl::WriteLayeredRangeRequest, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_WriteLayeredRange_, context, request, response, std::move(f));
+}
+
+void oram_server::Stub::async::WriteLayeredRange(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRangeRequest* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_WriteLayeredRange_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* oram_server::Stub::PrepareAsyncWriteLayeredRangeRaw(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRangeRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::google::protobuf::Empty, ::oram_impl::WriteLayeredRangeRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_WriteLayeredRange_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* oram_server::Stub::AsyncWriteLayeredRangeRaw(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRangeRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncWriteLayeredRangeRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status oram_server::Stub::LayeredLevelControl(::grpc::ClientContext* context, const ::oram_impl::LayeredControlRequest& request, ::google::protobuf::Empty* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::oram_impl::LayeredControlRequest, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_LayeredLevelControl_, context, request, response);
+}
+
+void oram_server::Stub::async::LayeredLevelControl(::grpc::ClientContext* context, const ::oram_impl::LayeredControlRequest* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::oram_impl::LayeredControlRequest, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_LayeredLevelControl_, context, request, response, std::move(f));
+}
+
+void oram_server::Stub::async::LayeredLevelControl(::grpc::ClientContext* context, const ::oram_impl::LayeredControlRequest* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_LayeredLevelControl_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* oram_server::Stub::PrepareAsyncLayeredLevelControlRaw(::grpc::ClientContext* context, const ::oram_impl::LayeredControlRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::google::protobuf::Empty, ::oram_impl::LayeredControlRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_LayeredLevelControl_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* oram_server::Stub::AsyncLayeredLevelControlRaw(::grpc::ClientContext* context, const ::oram_impl::LayeredControlRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncLayeredLevelControlRaw(context, request, cq);
   result->StartCall();
   return result;
 }
@@ -532,6 +818,26 @@ oram_server::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       oram_server_method_names[7],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::ReadPathRequest, ::oram_impl::ReadPathResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](oram_server::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::oram_impl::ReadPathRequest* req,
+             ::oram_impl::ReadPathResponse* resp) {
+               return service->ReadFullPath(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      oram_server_method_names[8],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::WriteFullPathRequest, ::oram_impl::WritePathResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](oram_server::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::oram_impl::WriteFullPathRequest* req,
+             ::oram_impl::WritePathResponse* resp) {
+               return service->WriteFullPath(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      oram_server_method_names[9],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::ReadFlatRequest, ::oram_impl::FlatVectorMessage, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](oram_server::Service* service,
              ::grpc::ServerContext* ctx,
@@ -540,7 +846,7 @@ oram_server::Service::Service() {
                return service->ReadFlatMemory(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      oram_server_method_names[8],
+      oram_server_method_names[10],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::FlatVectorMessage, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](oram_server::Service* service,
@@ -550,7 +856,27 @@ oram_server::Service::Service() {
                return service->WriteFlatMemory(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      oram_server_method_names[9],
+      oram_server_method_names[11],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< oram_server::Service, ::oram_impl::ReadFlatStreamRequest, ::oram_impl::FlatChunkMessage>(
+          [](oram_server::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::oram_impl::ReadFlatStreamRequest* req,
+             ::grpc::ServerWriter<::oram_impl::FlatChunkMessage>* writer) {
+               return service->ReadFlatStream(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      oram_server_method_names[12],
+      ::grpc::internal::RpcMethod::CLIENT_STREAMING,
+      new ::grpc::internal::ClientStreamingHandler< oram_server::Service, ::oram_impl::FlatChunkMessage, ::google::protobuf::Empty>(
+          [](oram_server::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReader<::oram_impl::FlatChunkMessage>* reader,
+             ::google::protobuf::Empty* resp) {
+               return service->WriteFlatStream(ctx, reader, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      oram_server_method_names[13],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::ReadSqrtRequest, ::oram_impl::SqrtMessage, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](oram_server::Service* service,
@@ -560,7 +886,17 @@ oram_server::Service::Service() {
                return service->ReadSqrtMemory(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      oram_server_method_names[10],
+      oram_server_method_names[14],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::ReadShelterRequest, ::oram_impl::ShelterMessage, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](oram_server::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::oram_impl::ReadShelterRequest* req,
+             ::oram_impl::ShelterMessage* resp) {
+               return service->ReadShelter(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      oram_server_method_names[15],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::WriteSqrtMessage, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](oram_server::Service* service,
@@ -570,17 +906,87 @@ oram_server::Service::Service() {
                return service->WriteSqrtMemory(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      oram_server_method_names[11],
+      oram_server_method_names[16],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::SqrtPermMessage, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+      new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::SqrtShuffleRequest, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](oram_server::Service* service,
              ::grpc::ServerContext* ctx,
-             const ::oram_impl::SqrtPermMessage* req,
+             const ::oram_impl::SqrtShuffleRequest* req,
              ::google::protobuf::Empty* resp) {
-               return service->SqrtPermute(ctx, req, resp);
+               return service->SqrtShuffleControl(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      oram_server_method_names[12],
+      oram_server_method_names[17],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::ReadSqrtRangeRequest, ::oram_impl::SqrtRangeMessage, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](oram_server::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::oram_impl::ReadSqrtRangeRequest* req,
+             ::oram_impl::SqrtRangeMessage* resp) {
+               return service->ReadSqrtRange(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      oram_server_method_names[18],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::WriteSqrtRangeRequest, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](oram_server::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::oram_impl::WriteSqrtRangeRequest* req,
+             ::google::protobuf::Empty* resp) {
+               return service->WriteSqrtRange(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      oram_server_method_names[19],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::InitLayeredOramRequest, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](oram_server::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::oram_impl::InitLayeredOramRequest* req,
+             ::google::protobuf::Empty* resp) {
+               return service->InitLayeredOram(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      oram_server_method_names[20],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::ReadLayeredRequest, ::oram_impl::LayeredBlocksMessage, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](oram_server::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::oram_impl::ReadLayeredRequest* req,
+             ::oram_impl::LayeredBlocksMessage* resp) {
+               return service->ReadLayeredBlocks(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      oram_server_method_names[21],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::WriteLayeredRequest, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](oram_server::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::oram_impl::WriteLayeredRequest* req,
+             ::google::protobuf::Empty* resp) {
+               return service->WriteLayeredLevel(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      oram_server_method_names[22],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::WriteLayeredRangeRequest, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](oram_server::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::oram_impl::WriteLayeredRangeRequest* req,
+             ::google::protobuf::Empty* resp) {
+               return service->WriteLayeredRange(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      oram_server_method_names[23],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::LayeredControlRequest, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](oram_server::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::oram_impl::LayeredControlRequest* req,
+             ::google::protobuf::Empty* resp) {
+               return service->LayeredLevelControl(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      oram_server_method_names[24],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::google::protobuf::Empty, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](oram_server::Service* service,
@@ -590,7 +996,7 @@ oram_server::Service::Service() {
                return service->CloseConnection(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      oram_server_method_names[13],
+      oram_server_method_names[25],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::KeyExchangeRequest, ::oram_impl::KeyExchangeResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](oram_server::Service* service,
@@ -600,7 +1006,7 @@ oram_server::Service::Service() {
                return service->KeyExchange(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      oram_server_method_names[14],
+      oram_server_method_names[26],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::oram_impl::HelloMessage, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](oram_server::Service* service,
@@ -610,7 +1016,7 @@ oram_server::Service::Service() {
                return service->SendHello(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      oram_server_method_names[15],
+      oram_server_method_names[27],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::google::protobuf::Empty, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](oram_server::Service* service,
@@ -620,7 +1026,7 @@ oram_server::Service::Service() {
                return service->ReportServerInformation(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      oram_server_method_names[16],
+      oram_server_method_names[28],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< oram_server::Service, ::google::protobuf::Empty, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](oram_server::Service* service,
@@ -683,6 +1089,20 @@ oram_server::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status oram_server::Service::ReadFullPath(::grpc::ServerContext* context, const ::oram_impl::ReadPathRequest* request, ::oram_impl::ReadPathResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status oram_server::Service::WriteFullPath(::grpc::ServerContext* context, const ::oram_impl::WriteFullPathRequest* request, ::oram_impl::WritePathResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 ::grpc::Status oram_server::Service::ReadFlatMemory(::grpc::ServerContext* context, const ::oram_impl::ReadFlatRequest* request, ::oram_impl::FlatVectorMessage* response) {
   (void) context;
   (void) request;
@@ -697,6 +1117,20 @@ oram_server::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status oram_server::Service::ReadFlatStream(::grpc::ServerContext* context, const ::oram_impl::ReadFlatStreamRequest* request, ::grpc::ServerWriter< ::oram_impl::FlatChunkMessage>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status oram_server::Service::WriteFlatStream(::grpc::ServerContext* context, ::grpc::ServerReader< ::oram_impl::FlatChunkMessage>* reader, ::google::protobuf::Empty* response) {
+  (void) context;
+  (void) reader;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 ::grpc::Status oram_server::Service::ReadSqrtMemory(::grpc::ServerContext* context, const ::oram_impl::ReadSqrtRequest* request, ::oram_impl::SqrtMessage* response) {
   (void) context;
   (void) request;
@@ -704,6 +1138,13 @@ oram_server::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status oram_server::Service::ReadShelter(::grpc::ServerContext* context, const ::oram_impl::ReadShelterRequest* request, ::oram_impl::ShelterMessage* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 ::grpc::Status oram_server::Service::WriteSqrtMemory(::grpc::ServerContext* context, const ::oram_impl::WriteSqrtMessage* request, ::google::protobuf::Empty* response) {
   (void) context;
   (void) request;
@@ -711,7 +1152,56 @@ oram_server::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
-::grpc::Status oram_server::Service::SqrtPermute(::grpc::ServerContext* context, const ::oram_impl::SqrtPermMessage* request, ::google::protobuf::Empty* response) {
+::grpc::Status oram_server::Service::SqrtShuffleControl(::grpc::ServerContext* context, const ::oram_impl::SqrtShuffleRequest* request, ::google::protobuf::Empty* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status oram_server::Service::ReadSqrtRange(::grpc::ServerContext* context, const ::oram_impl::ReadSqrtRangeRequest* request, ::oram_impl::SqrtRangeMessage* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status oram_server::Service::WriteSqrtRange(::grpc::ServerContext* context, const ::oram_impl::WriteSqrtRangeRequest* request, ::google::protobuf::Empty* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status oram_server::Service::InitLayeredOram(::grpc::ServerContext* context, const ::oram_impl::InitLayeredOramRequest* request, ::google::protobuf::Empty* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status oram_server::Service::ReadLayeredBlocks(::grpc::ServerContext* context, const ::oram_impl::ReadLayeredRequest* request, ::oram_impl::LayeredBlocksMessage* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status oram_server::Service::WriteLayeredLevel(::grpc::ServerContext* context, const ::oram_impl::WriteLayeredRequest* request, ::google::protobuf::Empty* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status oram_server::Service::WriteLayeredRange(::grpc::ServerContext* context, const ::oram_impl::WriteLayeredRangeRequest* request, ::google::protobuf::Empty* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status oram_server::Service::LayeredLevelControl(::grpc::ServerContext* context, const ::oram_impl::LayeredControlRequest* request, ::google::protobuf::Empty* response) {
   (void) context;
   (void) request;
   (void) response;
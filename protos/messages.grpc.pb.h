@@ -87,6 +87,22 @@ class oram_server final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::WritePathResponse>> PrepareAsyncWritePath(::grpc::ClientContext* context, const ::oram_impl::WritePathRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::WritePathResponse>>(PrepareAsyncWritePathRaw(context, request, cq));
     }
+    // Read or write all the buckets on a path at once. The level of the request
+    // is ignored.
+    virtual ::grpc::Status ReadFullPath(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest& request, ::oram_impl::ReadPathResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::ReadPathResponse>> AsyncReadFullPath(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::ReadPathResponse>>(AsyncReadFullPathRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::ReadPathResponse>> PrepareAsyncReadFullPath(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::ReadPathResponse>>(PrepareAsyncReadFullPathRaw(context, request, cq));
+    }
+    virtual ::grpc::Status WriteFullPath(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest& request, ::oram_impl::WritePathResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::WritePathResponse>> AsyncWriteFullPath(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::WritePathResponse>>(AsyncWriteFullPathRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::WritePathResponse>> PrepareAsyncWriteFullPath(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::WritePathResponse>>(PrepareAsyncWriteFullPathRaw(context, request, cq));
+    }
     virtual ::grpc::Status ReadFlatMemory(::grpc::ClientContext* context, const ::oram_impl::ReadFlatRequest& request, ::oram_impl::FlatVectorMessage* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::FlatVectorMessage>> AsyncReadFlatMemory(::grpc::ClientContext* context, const ::oram_impl::ReadFlatRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::FlatVectorMessage>>(AsyncReadFlatMemoryRaw(context, request, cq));
@@ -101,6 +117,28 @@ class oram_server final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>> PrepareAsyncWriteFlatMemory(::grpc::ClientContext* context, const ::oram_impl::FlatVectorMessage& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>>(PrepareAsyncWriteFlatMemoryRaw(context, request, cq));
     }
+    // Streams the flat storage in chunks so that neither side needs to hold
+    // the whole storage in a single message.
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::oram_impl::FlatChunkMessage>> ReadFlatStream(::grpc::ClientContext* context, const ::oram_impl::ReadFlatStreamRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::oram_impl::FlatChunkMessage>>(ReadFlatStreamRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::oram_impl::FlatChunkMessage>> AsyncReadFlatStream(::grpc::ClientContext* context, const ::oram_impl::ReadFlatStreamRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::oram_impl::FlatChunkMessage>>(AsyncReadFlatStreamRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::oram_impl::FlatChunkMessage>> PrepareAsyncReadFlatStream(::grpc::ClientContext* context, const ::oram_impl::ReadFlatStreamRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::oram_impl::FlatChunkMessage>>(PrepareAsyncReadFlatStreamRaw(context, request, cq));
+    }
+    // Only the first chunk needs to carry a header. The storage ends at the end
+    // of the last chunk.
+    std::unique_ptr< ::grpc::ClientWriterInterface< ::oram_impl::FlatChunkMessage>> WriteFlatStream(::grpc::ClientContext* context, ::google::protobuf::Empty* response) {
+      return std::unique_ptr< ::grpc::ClientWriterInterface< ::oram_impl::FlatChunkMessage>>(WriteFlatStreamRaw(context, response));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::oram_impl::FlatChunkMessage>> AsyncWriteFlatStream(::grpc::ClientContext* context, ::google::protobuf::Empty* response, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::oram_impl::FlatChunkMessage>>(AsyncWriteFlatStreamRaw(context, response, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::oram_impl::FlatChunkMessage>> PrepareAsyncWriteFlatStream(::grpc::ClientContext* context, ::google::protobuf::Empty* response, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::oram_impl::FlatChunkMessage>>(PrepareAsyncWriteFlatStreamRaw(context, response, cq));
+    }
     virtual ::grpc::Status ReadSqrtMemory(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRequest& request, ::oram_impl::SqrtMessage* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::SqrtMessage>> AsyncReadSqrtMemory(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::SqrtMessage>>(AsyncReadSqrtMemoryRaw(context, request, cq));
@@ -108,6 +146,13 @@ class oram_server final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::SqrtMessage>> PrepareAsyncReadSqrtMemory(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::SqrtMessage>>(PrepareAsyncReadSqrtMemoryRaw(context, request, cq));
     }
+    virtual ::grpc::Status ReadShelter(::grpc::ClientContext* context, const ::oram_impl::ReadShelterRequest& request, ::oram_impl::ShelterMessage* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::ShelterMessage>> AsyncReadShelter(::grpc::ClientContext* context, const ::oram_impl::ReadShelterRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::ShelterMessage>>(AsyncReadShelterRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::ShelterMessage>> PrepareAsyncReadShelter(::grpc::ClientContext* context, const ::oram_impl::ReadShelterRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::ShelterMessage>>(PrepareAsyncReadShelterRaw(context, request, cq));
+    }
     virtual ::grpc::Status WriteSqrtMemory(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtMessage& request, ::google::protobuf::Empty* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>> AsyncWriteSqrtMemory(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtMessage& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>>(AsyncWriteSqrtMemoryRaw(context, request, cq));
@@ -115,12 +160,61 @@ class oram_server final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>> PrepareAsyncWriteSqrtMemory(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtMessage& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>>(PrepareAsyncWriteSqrtMemoryRaw(context, request, cq));
     }
-    virtual ::grpc::Status SqrtPermute(::grpc::ClientContext* context, const ::oram_impl::SqrtPermMessage& request, ::google::protobuf::Empty* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>> AsyncSqrtPermute(::grpc::ClientContext* context, const ::oram_impl::SqrtPermMessage& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>>(AsyncSqrtPermuteRaw(context, request, cq));
+    virtual ::grpc::Status SqrtShuffleControl(::grpc::ClientContext* context, const ::oram_impl::SqrtShuffleRequest& request, ::google::protobuf::Empty* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>> AsyncSqrtShuffleControl(::grpc::ClientContext* context, const ::oram_impl::SqrtShuffleRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>>(AsyncSqrtShuffleControlRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>> PrepareAsyncSqrtShuffleControl(::grpc::ClientContext* context, const ::oram_impl::SqrtShuffleRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>>(PrepareAsyncSqrtShuffleControlRaw(context, request, cq));
+    }
+    virtual ::grpc::Status ReadSqrtRange(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRangeRequest& request, ::oram_impl::SqrtRangeMessage* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::SqrtRangeMessage>> AsyncReadSqrtRange(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRangeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::SqrtRangeMessage>>(AsyncReadSqrtRangeRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::SqrtRangeMessage>> PrepareAsyncReadSqrtRange(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRangeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::SqrtRangeMessage>>(PrepareAsyncReadSqrtRangeRaw(context, request, cq));
+    }
+    virtual ::grpc::Status WriteSqrtRange(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtRangeRequest& request, ::google::protobuf::Empty* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>> AsyncWriteSqrtRange(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtRangeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>>(AsyncWriteSqrtRangeRaw(context, request, cq));
     }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>> PrepareAsyncSqrtPermute(::grpc::ClientContext* context, const ::oram_impl::SqrtPermMessage& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>>(PrepareAsyncSqrtPermuteRaw(context, request, cq));
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>> PrepareAsyncWriteSqrtRange(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtRangeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>>(PrepareAsyncWriteSqrtRangeRaw(context, request, cq));
+    }
+    virtual ::grpc::Status InitLayeredOram(::grpc::ClientContext* context, const ::oram_impl::InitLayeredOramRequest& request, ::google::protobuf::Empty* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>> AsyncInitLayeredOram(::grpc::ClientContext* context, const ::oram_impl::InitLayeredOramRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>>(AsyncInitLayeredOramRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>> PrepareAsyncInitLayeredOram(::grpc::ClientContext* context, const ::oram_impl::InitLayeredOramRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>>(PrepareAsyncInitLayeredOramRaw(context, request, cq));
+    }
+    virtual ::grpc::Status ReadLayeredBlocks(::grpc::ClientContext* context, const ::oram_impl::ReadLayeredRequest& request, ::oram_impl::LayeredBlocksMessage* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::LayeredBlocksMessage>> AsyncReadLayeredBlocks(::grpc::ClientContext* context, const ::oram_impl::ReadLayeredRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::LayeredBlocksMessage>>(AsyncReadLayeredBlocksRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::LayeredBlocksMessage>> PrepareAsyncReadLayeredBlocks(::grpc::ClientContext* context, const ::oram_impl::ReadLayeredRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::LayeredBlocksMessage>>(PrepareAsyncReadLayeredBlocksRaw(context, request, cq));
+    }
+    virtual ::grpc::Status WriteLayeredLevel(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRequest& request, ::google::protobuf::Empty* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>> AsyncWriteLayeredLevel(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>>(AsyncWriteLayeredLevelRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>> PrepareAsyncWriteLayeredLevel(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>>(PrepareAsyncWriteLayeredLevelRaw(context, request, cq));
+    }
+    virtual ::grpc::Status WriteLayeredRange(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRangeRequest& request, ::google::protobuf::Empty* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>> AsyncWriteLayeredRange(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRangeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>>(AsyncWriteLayeredRangeRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>> PrepareAsyncWriteLayeredRange(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRangeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>>(PrepareAsyncWriteLayeredRangeRaw(context, request, cq));
+    }
+    virtual ::grpc::Status LayeredLevelControl(::grpc::ClientContext* context, const ::oram_impl::LayeredControlRequest& request, ::google::protobuf::Empty* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>> AsyncLayeredLevelControl(::grpc::ClientContext* context, const ::oram_impl::LayeredControlRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>>(AsyncLayeredLevelControlRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>> PrepareAsyncLayeredLevelControl(::grpc::ClientContext* context, const ::oram_impl::LayeredControlRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>>(PrepareAsyncLayeredLevelControlRaw(context, request, cq));
     }
     virtual ::grpc::Status CloseConnection(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::google::protobuf::Empty* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>> AsyncCloseConnection(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) {
@@ -179,16 +273,44 @@ class oram_server final {
       virtual void ReadPath(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest* request, ::oram_impl::ReadPathResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void WritePath(::grpc::ClientContext* context, const ::oram_impl::WritePathRequest* request, ::oram_impl::WritePathResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void WritePath(::grpc::ClientContext* context, const ::oram_impl::WritePathRequest* request, ::oram_impl::WritePathResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Read or write all the buckets on a path at once. The level of the request
+      // is ignored.
+      virtual void ReadFullPath(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest* request, ::oram_impl::ReadPathResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void ReadFullPath(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest* request, ::oram_impl::ReadPathResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void WriteFullPath(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest* request, ::oram_impl::WritePathResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void WriteFullPath(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest* request, ::oram_impl::WritePathResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void ReadFlatMemory(::grpc::ClientContext* context, const ::oram_impl::ReadFlatRequest* request, ::oram_impl::FlatVectorMessage* response, std::function<void(::grpc::Status)>) = 0;
       virtual void ReadFlatMemory(::grpc::ClientContext* context, const ::oram_impl::ReadFlatRequest* request, ::oram_impl::FlatVectorMessage* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void WriteFlatMemory(::grpc::ClientContext* context, const ::oram_impl::FlatVectorMessage* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) = 0;
       virtual void WriteFlatMemory(::grpc::ClientContext* context, const ::oram_impl::FlatVectorMessage* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Streams the flat storage in chunks so that neither side needs to hold
+      // the whole storage in a single message.
+      virtual void ReadFlatStream(::grpc::ClientContext* context, const ::oram_impl::ReadFlatStreamRequest* request, ::grpc::ClientReadReactor< ::oram_impl::FlatChunkMessage>* reactor) = 0;
+      // Only the first chunk needs to carry a header. The storage ends at the end
+      // of the last chunk.
+      virtual void WriteFlatStream(::grpc::ClientContext* context, ::google::protobuf::Empty* response, ::grpc::ClientWriteReactor< ::oram_impl::FlatChunkMessage>* reactor) = 0;
       virtual void ReadSqrtMemory(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRequest* request, ::oram_impl::SqrtMessage* response, std::function<void(::grpc::Status)>) = 0;
       virtual void ReadSqrtMemory(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRequest* request, ::oram_impl::SqrtMessage* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void ReadShelter(::grpc::ClientContext* context, const ::oram_impl::ReadShelterRequest* request, ::oram_impl::ShelterMessage* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void ReadShelter(::grpc::ClientContext* context, const ::oram_impl::ReadShelterRequest* request, ::oram_impl::ShelterMessage* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void WriteSqrtMemory(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtMessage* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) = 0;
       virtual void WriteSqrtMemory(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtMessage* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void SqrtPermute(::grpc::ClientContext* context, const ::oram_impl::SqrtPermMessage* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void SqrtPermute(::grpc::ClientContext* context, const ::oram_impl::SqrtPermMessage* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void SqrtShuffleControl(::grpc::ClientContext* context, const ::oram_impl::SqrtShuffleRequest* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void SqrtShuffleControl(::grpc::ClientContext* context, const ::oram_impl::SqrtShuffleRequest* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void ReadSqrtRange(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRangeRequest* request, ::oram_impl::SqrtRangeMessage* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void ReadSqrtRange(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRangeRequest* request, ::oram_impl::SqrtRangeMessage* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void WriteSqrtRange(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtRangeRequest* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void WriteSqrtRange(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtRangeRequest* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void InitLayeredOram(::grpc::ClientContext* context, const ::oram_impl::InitLayeredOramRequest* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void InitLayeredOram(::grpc::ClientContext* context, const ::oram_impl::InitLayeredOramRequest* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void ReadLayeredBlocks(::grpc::ClientContext* context, const ::oram_impl::ReadLayeredRequest* request, ::oram_impl::LayeredBlocksMessage* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void ReadLayeredBlocks(::grpc::ClientContext* context, const ::oram_impl::ReadLayeredRequest* request, ::oram_impl::LayeredBlocksMessage* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void WriteLayeredLevel(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRequest* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void WriteLayeredLevel(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRequest* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void WriteLayeredRange(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRangeRequest* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void WriteLayeredRange(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRangeRequest* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void LayeredLevelControl(::grpc::ClientContext* context, const ::oram_impl::LayeredControlRequest* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void LayeredLevelControl(::grpc::ClientContext* context, const ::oram_impl::LayeredControlRequest* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void CloseConnection(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) = 0;
       virtual void CloseConnection(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       // ============ Key Exchange Using Diffie-Hellman ============ //
@@ -222,16 +344,42 @@ class oram_server final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::ReadPathResponse>* PrepareAsyncReadPathRaw(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::WritePathResponse>* AsyncWritePathRaw(::grpc::ClientContext* context, const ::oram_impl::WritePathRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::WritePathResponse>* PrepareAsyncWritePathRaw(::grpc::ClientContext* context, const ::oram_impl::WritePathRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::ReadPathResponse>* AsyncReadFullPathRaw(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::ReadPathResponse>* PrepareAsyncReadFullPathRaw(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::WritePathResponse>* AsyncWriteFullPathRaw(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::WritePathResponse>* PrepareAsyncWriteFullPathRaw(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::FlatVectorMessage>* AsyncReadFlatMemoryRaw(::grpc::ClientContext* context, const ::oram_impl::ReadFlatRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::FlatVectorMessage>* PrepareAsyncReadFlatMemoryRaw(::grpc::ClientContext* context, const ::oram_impl::ReadFlatRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* AsyncWriteFlatMemoryRaw(::grpc::ClientContext* context, const ::oram_impl::FlatVectorMessage& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* PrepareAsyncWriteFlatMemoryRaw(::grpc::ClientContext* context, const ::oram_impl::FlatVectorMessage& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::oram_impl::FlatChunkMessage>* ReadFlatStreamRaw(::grpc::ClientContext* context, const ::oram_impl::ReadFlatStreamRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::oram_impl::FlatChunkMessage>* AsyncReadFlatStreamRaw(::grpc::ClientContext* context, const ::oram_impl::ReadFlatStreamRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::oram_impl::FlatChunkMessage>* PrepareAsyncReadFlatStreamRaw(::grpc::ClientContext* context, const ::oram_impl::ReadFlatStreamRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientWriterInterface< ::oram_impl::FlatChunkMessage>* WriteFlatStreamRaw(::grpc::ClientContext* context, ::google::protobuf::Empty* response) = 0;
+    virtual ::grpc::ClientAsyncWriterInterface< ::oram_impl::FlatChunkMessage>* AsyncWriteFlatStreamRaw(::grpc::ClientContext* context, ::google::protobuf::Empty* response, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncWriterInterface< ::oram_impl::FlatChunkMessage>* PrepareAsyncWriteFlatStreamRaw(::grpc::ClientContext* context, ::google::protobuf::Empty* response, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::SqrtMessage>* AsyncReadSqrtMemoryRaw(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::SqrtMessage>* PrepareAsyncReadSqrtMemoryRaw(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::ShelterMessage>* AsyncReadShelterRaw(::grpc::ClientContext* context, const ::oram_impl::ReadShelterRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::ShelterMessage>* PrepareAsyncReadShelterRaw(::grpc::ClientContext* context, const ::oram_impl::ReadShelterRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* AsyncWriteSqrtMemoryRaw(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtMessage& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* PrepareAsyncWriteSqrtMemoryRaw(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtMessage& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* AsyncSqrtPermuteRaw(::grpc::ClientContext* context, const ::oram_impl::SqrtPermMessage& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* PrepareAsyncSqrtPermuteRaw(::grpc::ClientContext* context, const ::oram_impl::SqrtPermMessage& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* AsyncSqrtShuffleControlRaw(::grpc::ClientContext* context, const ::oram_impl::SqrtShuffleRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* PrepareAsyncSqrtShuffleControlRaw(::grpc::ClientContext* context, const ::oram_impl::SqrtShuffleRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::SqrtRangeMessage>* AsyncReadSqrtRangeRaw(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRangeRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::SqrtRangeMessage>* PrepareAsyncReadSqrtRangeRaw(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRangeRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* AsyncWriteSqrtRangeRaw(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtRangeRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* PrepareAsyncWriteSqrtRangeRaw(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtRangeRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* AsyncInitLayeredOramRaw(::grpc::ClientContext* context, const ::oram_impl::InitLayeredOramRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* PrepareAsyncInitLayeredOramRaw(::grpc::ClientContext* context, const ::oram_impl::InitLayeredOramRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::LayeredBlocksMessage>* AsyncReadLayeredBlocksRaw(::grpc::ClientContext* context, const ::oram_impl::ReadLayeredRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::LayeredBlocksMessage>* PrepareAsyncReadLayeredBlocksRaw(::grpc::ClientContext* context, const ::oram_impl::ReadLayeredRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* AsyncWriteLayeredLevelRaw(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* PrepareAsyncWriteLayeredLevelRaw(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* AsyncWriteLayeredRangeRaw(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRangeRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* PrepareAsyncWriteLayeredRangeRaw(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRangeRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* AsyncLayeredLevelControlRaw(::grpc::ClientContext* context, const ::oram_impl::LayeredControlRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* PrepareAsyncLayeredLevelControlRaw(::grpc::ClientContext* context, const ::oram_impl::LayeredControlRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* AsyncCloseConnectionRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* PrepareAsyncCloseConnectionRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::oram_impl::KeyExchangeResponse>* AsyncKeyExchangeRaw(::grpc::ClientContext* context, const ::oram_impl::KeyExchangeRequest& request, ::grpc::CompletionQueue* cq) = 0;
@@ -295,6 +443,20 @@ class oram_server final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>> PrepareAsyncWritePath(::grpc::ClientContext* context, const ::oram_impl::WritePathRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>>(PrepareAsyncWritePathRaw(context, request, cq));
     }
+    ::grpc::Status ReadFullPath(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest& request, ::oram_impl::ReadPathResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::ReadPathResponse>> AsyncReadFullPath(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::ReadPathResponse>>(AsyncReadFullPathRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::ReadPathResponse>> PrepareAsyncReadFullPath(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::ReadPathResponse>>(PrepareAsyncReadFullPathRaw(context, request, cq));
+    }
+    ::grpc::Status WriteFullPath(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest& request, ::oram_impl::WritePathResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>> AsyncWriteFullPath(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>>(AsyncWriteFullPathRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>> PrepareAsyncWriteFullPath(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>>(PrepareAsyncWriteFullPathRaw(context, request, cq));
+    }
     ::grpc::Status ReadFlatMemory(::grpc::ClientContext* context, const ::oram_impl::ReadFlatRequest& request, ::oram_impl::FlatVectorMessage* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::FlatVectorMessage>> AsyncReadFlatMemory(::grpc::ClientContext* context, const ::oram_impl::ReadFlatRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::FlatVectorMessage>>(AsyncReadFlatMemoryRaw(context, request, cq));
@@ -309,6 +471,24 @@ class oram_server final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>> PrepareAsyncWriteFlatMemory(::grpc::ClientContext* context, const ::oram_impl::FlatVectorMessage& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>>(PrepareAsyncWriteFlatMemoryRaw(context, request, cq));
     }
+    std::unique_ptr< ::grpc::ClientReader< ::oram_impl::FlatChunkMessage>> ReadFlatStream(::grpc::ClientContext* context, const ::oram_impl::ReadFlatStreamRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::oram_impl::FlatChunkMessage>>(ReadFlatStreamRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::oram_impl::FlatChunkMessage>> AsyncReadFlatStream(::grpc::ClientContext* context, const ::oram_impl::ReadFlatStreamRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::oram_impl::FlatChunkMessage>>(AsyncReadFlatStreamRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::oram_impl::FlatChunkMessage>> PrepareAsyncReadFlatStream(::grpc::ClientContext* context, const ::oram_impl::ReadFlatStreamRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::oram_impl::FlatChunkMessage>>(PrepareAsyncReadFlatStreamRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientWriter< ::oram_impl::FlatChunkMessage>> WriteFlatStream(::grpc::ClientContext* context, ::google::protobuf::Empty* response) {
+      return std::unique_ptr< ::grpc::ClientWriter< ::oram_impl::FlatChunkMessage>>(WriteFlatStreamRaw(context, response));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriter< ::oram_impl::FlatChunkMessage>> AsyncWriteFlatStream(::grpc::ClientContext* context, ::google::protobuf::Empty* response, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriter< ::oram_impl::FlatChunkMessage>>(AsyncWriteFlatStreamRaw(context, response, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriter< ::oram_impl::FlatChunkMessage>> PrepareAsyncWriteFlatStream(::grpc::ClientContext* context, ::google::protobuf::Empty* response, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriter< ::oram_impl::FlatChunkMessage>>(PrepareAsyncWriteFlatStreamRaw(context, response, cq));
+    }
     ::grpc::Status ReadSqrtMemory(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRequest& request, ::oram_impl::SqrtMessage* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::SqrtMessage>> AsyncReadSqrtMemory(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::SqrtMessage>>(AsyncReadSqrtMemoryRaw(context, request, cq));
@@ -316,6 +496,13 @@ class oram_server final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::SqrtMessage>> PrepareAsyncReadSqrtMemory(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::SqrtMessage>>(PrepareAsyncReadSqrtMemoryRaw(context, request, cq));
     }
+    ::grpc::Status ReadShelter(::grpc::ClientContext* context, const ::oram_impl::ReadShelterRequest& request, ::oram_impl::ShelterMessage* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::ShelterMessage>> AsyncReadShelter(::grpc::ClientContext* context, const ::oram_impl::ReadShelterRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::ShelterMessage>>(AsyncReadShelterRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::ShelterMessage>> PrepareAsyncReadShelter(::grpc::ClientContext* context, const ::oram_impl::ReadShelterRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::ShelterMessage>>(PrepareAsyncReadShelterRaw(context, request, cq));
+    }
     ::grpc::Status WriteSqrtMemory(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtMessage& request, ::google::protobuf::Empty* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>> AsyncWriteSqrtMemory(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtMessage& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>>(AsyncWriteSqrtMemoryRaw(context, request, cq));
@@ -323,12 +510,61 @@ class oram_server final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>> PrepareAsyncWriteSqrtMemory(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtMessage& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>>(PrepareAsyncWriteSqrtMemoryRaw(context, request, cq));
     }
-    ::grpc::Status SqrtPermute(::grpc::ClientContext* context, const ::oram_impl::SqrtPermMessage& request, ::google::protobuf::Empty* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>> AsyncSqrtPermute(::grpc::ClientContext* context, const ::oram_impl::SqrtPermMessage& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>>(AsyncSqrtPermuteRaw(context, request, cq));
+    ::grpc::Status SqrtShuffleControl(::grpc::ClientContext* context, const ::oram_impl::SqrtShuffleRequest& request, ::google::protobuf::Empty* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>> AsyncSqrtShuffleControl(::grpc::ClientContext* context, const ::oram_impl::SqrtShuffleRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>>(AsyncSqrtShuffleControlRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>> PrepareAsyncSqrtShuffleControl(::grpc::ClientContext* context, const ::oram_impl::SqrtShuffleRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>>(PrepareAsyncSqrtShuffleControlRaw(context, request, cq));
+    }
+    ::grpc::Status ReadSqrtRange(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRangeRequest& request, ::oram_impl::SqrtRangeMessage* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::SqrtRangeMessage>> AsyncReadSqrtRange(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRangeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::SqrtRangeMessage>>(AsyncReadSqrtRangeRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::SqrtRangeMessage>> PrepareAsyncReadSqrtRange(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRangeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::SqrtRangeMessage>>(PrepareAsyncReadSqrtRangeRaw(context, request, cq));
+    }
+    ::grpc::Status WriteSqrtRange(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtRangeRequest& request, ::google::protobuf::Empty* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>> AsyncWriteSqrtRange(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtRangeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>>(AsyncWriteSqrtRangeRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>> PrepareAsyncWriteSqrtRange(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtRangeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>>(PrepareAsyncWriteSqrtRangeRaw(context, request, cq));
+    }
+    ::grpc::Status InitLayeredOram(::grpc::ClientContext* context, const ::oram_impl::InitLayeredOramRequest& request, ::google::protobuf::Empty* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>> AsyncInitLayeredOram(::grpc::ClientContext* context, const ::oram_impl::InitLayeredOramRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>>(AsyncInitLayeredOramRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>> PrepareAsyncInitLayeredOram(::grpc::ClientContext* context, const ::oram_impl::InitLayeredOramRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>>(PrepareAsyncInitLayeredOramRaw(context, request, cq));
+    }
+    ::grpc::Status ReadLayeredBlocks(::grpc::ClientContext* context, const ::oram_impl::ReadLayeredRequest& request, ::oram_impl::LayeredBlocksMessage* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::LayeredBlocksMessage>> AsyncReadLayeredBlocks(::grpc::ClientContext* context, const ::oram_impl::ReadLayeredRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::LayeredBlocksMessage>>(AsyncReadLayeredBlocksRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::LayeredBlocksMessage>> PrepareAsyncReadLayeredBlocks(::grpc::ClientContext* context, const ::oram_impl::ReadLayeredRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::oram_impl::LayeredBlocksMessage>>(PrepareAsyncReadLayeredBlocksRaw(context, request, cq));
+    }
+    ::grpc::Status WriteLayeredLevel(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRequest& request, ::google::protobuf::Empty* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>> AsyncWriteLayeredLevel(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>>(AsyncWriteLayeredLevelRaw(context, request, cq));
     }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>> PrepareAsyncSqrtPermute(::grpc::ClientContext* context, const ::oram_impl::SqrtPermMessage& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>>(PrepareAsyncSqrtPermuteRaw(context, request, cq));
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>> PrepareAsyncWriteLayeredLevel(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>>(PrepareAsyncWriteLayeredLevelRaw(context, request, cq));
+    }
+    ::grpc::Status WriteLayeredRange(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRangeRequest& request, ::google::protobuf::Empty* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>> AsyncWriteLayeredRange(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRangeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>>(AsyncWriteLayeredRangeRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>> PrepareAsyncWriteLayeredRange(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRangeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>>(PrepareAsyncWriteLayeredRangeRaw(context, request, cq));
+    }
+    ::grpc::Status LayeredLevelControl(::grpc::ClientContext* context, const ::oram_impl::LayeredControlRequest& request, ::google::protobuf::Empty* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>> AsyncLayeredLevelControl(::grpc::ClientContext* context, const ::oram_impl::LayeredControlRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>>(AsyncLayeredLevelControlRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>> PrepareAsyncLayeredLevelControl(::grpc::ClientContext* context, const ::oram_impl::LayeredControlRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>>(PrepareAsyncLayeredLevelControlRaw(context, request, cq));
     }
     ::grpc::Status CloseConnection(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::google::protobuf::Empty* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>> AsyncCloseConnection(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) {
@@ -382,16 +618,38 @@ class oram_server final {
       void ReadPath(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest* request, ::oram_impl::ReadPathResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
       void WritePath(::grpc::ClientContext* context, const ::oram_impl::WritePathRequest* request, ::oram_impl::WritePathResponse* response, std::function<void(::grpc::Status)>) override;
       void WritePath(::grpc::ClientContext* context, const ::oram_impl::WritePathRequest* request, ::oram_impl::WritePathResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void ReadFullPath(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest* request, ::oram_impl::ReadPathResponse* response, std::function<void(::grpc::Status)>) override;
+      void ReadFullPath(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest* request, ::oram_impl::ReadPathResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void WriteFullPath(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest* request, ::oram_impl::WritePathResponse* response, std::function<void(::grpc::Status)>) override;
+      void WriteFullPath(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest* request, ::oram_impl::WritePathResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
       void ReadFlatMemory(::grpc::ClientContext* context, const ::oram_impl::ReadFlatRequest* request, ::oram_impl::FlatVectorMessage* response, std::function<void(::grpc::Status)>) override;
       void ReadFlatMemory(::grpc::ClientContext* context, const ::oram_impl::ReadFlatRequest* request, ::oram_impl::FlatVectorMessage* response, ::grpc::ClientUnaryReactor* reactor) override;
       void WriteFlatMemory(::grpc::ClientContext* context, const ::oram_impl::FlatVectorMessage* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) override;
       void WriteFlatMemory(::grpc::ClientContext* context, const ::oram_impl::FlatVectorMessage* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void ReadFlatStream(::grpc::ClientContext* context, const ::oram_impl::ReadFlatStreamRequest* request, ::grpc::ClientReadReactor< ::oram_impl::FlatChunkMessage>* reactor) override;
+      void WriteFlatStream(::grpc::ClientContext* context, ::google::protobuf::Empty* response, ::grpc::ClientWriteReactor< ::oram_impl::FlatChunkMessage>* reactor) override;
       void ReadSqrtMemory(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRequest* request, ::oram_impl::SqrtMessage* response, std::function<void(::grpc::Status)>) override;
       void ReadSqrtMemory(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRequest* request, ::oram_impl::SqrtMessage* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void ReadShelter(::grpc::ClientContext* context, const ::oram_impl::ReadShelterRequest* request, ::oram_impl::ShelterMessage* response, std::function<void(::grpc::Status)>) override;
+      void ReadShelter(::grpc::ClientContext* context, const ::oram_impl::ReadShelterRequest* request, ::oram_impl::ShelterMessage* response, ::grpc::ClientUnaryReactor* reactor) override;
       void WriteSqrtMemory(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtMessage* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) override;
       void WriteSqrtMemory(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtMessage* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void SqrtPermute(::grpc::ClientContext* context, const ::oram_impl::SqrtPermMessage* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) override;
-      void SqrtPermute(::grpc::ClientContext* context, const ::oram_impl::SqrtPermMessage* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void SqrtShuffleControl(::grpc::ClientContext* context, const ::oram_impl::SqrtShuffleRequest* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) override;
+      void SqrtShuffleControl(::grpc::ClientContext* context, const ::oram_impl::SqrtShuffleRequest* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void ReadSqrtRange(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRangeRequest* request, ::oram_impl::SqrtRangeMessage* response, std::function<void(::grpc::Status)>) override;
+      void ReadSqrtRange(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRangeRequest* request, ::oram_impl::SqrtRangeMessage* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void WriteSqrtRange(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtRangeRequest* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) override;
+      void WriteSqrtRange(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtRangeRequest* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void InitLayeredOram(::grpc::ClientContext* context, const ::oram_impl::InitLayeredOramRequest* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) override;
+      void InitLayeredOram(::grpc::ClientContext* context, const ::oram_impl::InitLayeredOramRequest* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void ReadLayeredBlocks(::grpc::ClientContext* context, const ::oram_impl::ReadLayeredRequest* request, ::oram_impl::LayeredBlocksMessage* response, std::function<void(::grpc::Status)>) override;
+      void ReadLayeredBlocks(::grpc::ClientContext* context, const ::oram_impl::ReadLayeredRequest* request, ::oram_impl::LayeredBlocksMessage* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void WriteLayeredLevel(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRequest* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) override;
+      void WriteLayeredLevel(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRequest* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void WriteLayeredRange(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRangeRequest* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) override;
+      void WriteLayeredRange(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRangeRequest* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void LayeredLevelControl(::grpc::ClientContext* context, const ::oram_impl::LayeredControlRequest* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) override;
+      void LayeredLevelControl(::grpc::ClientContext* context, const ::oram_impl::LayeredControlRequest* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) override;
       void CloseConnection(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) override;
       void CloseConnection(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) override;
       void KeyExchange(::grpc::ClientContext* context, const ::oram_impl::KeyExchangeRequest* request, ::oram_impl::KeyExchangeResponse* response, std::function<void(::grpc::Status)>) override;
@@ -427,16 +685,42 @@ class oram_server final {
     ::grpc::ClientAsyncResponseReader< ::oram_impl::ReadPathResponse>* PrepareAsyncReadPathRaw(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>* AsyncWritePathRaw(::grpc::ClientContext* context, const ::oram_impl::WritePathRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>* PrepareAsyncWritePathRaw(::grpc::ClientContext* context, const ::oram_impl::WritePathRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::oram_impl::ReadPathResponse>* AsyncReadFullPathRaw(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::oram_impl::ReadPathResponse>* PrepareAsyncReadFullPathRaw(::grpc::ClientContext* context, const ::oram_impl::ReadPathRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>* AsyncWriteFullPathRaw(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::oram_impl::WritePathResponse>* PrepareAsyncWriteFullPathRaw(::grpc::ClientContext* context, const ::oram_impl::WriteFullPathRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::oram_impl::FlatVectorMessage>* AsyncReadFlatMemoryRaw(::grpc::ClientContext* context, const ::oram_impl::ReadFlatRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::oram_impl::FlatVectorMessage>* PrepareAsyncReadFlatMemoryRaw(::grpc::ClientContext* context, const ::oram_impl::ReadFlatRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* AsyncWriteFlatMemoryRaw(::grpc::ClientContext* context, const ::oram_impl::FlatVectorMessage& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* PrepareAsyncWriteFlatMemoryRaw(::grpc::ClientContext* context, const ::oram_impl::FlatVectorMessage& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::oram_impl::FlatChunkMessage>* ReadFlatStreamRaw(::grpc::ClientContext* context, const ::oram_impl::ReadFlatStreamRequest& request) override;
+    ::grpc::ClientAsyncReader< ::oram_impl::FlatChunkMessage>* AsyncReadFlatStreamRaw(::grpc::ClientContext* context, const ::oram_impl::ReadFlatStreamRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::oram_impl::FlatChunkMessage>* PrepareAsyncReadFlatStreamRaw(::grpc::ClientContext* context, const ::oram_impl::ReadFlatStreamRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientWriter< ::oram_impl::FlatChunkMessage>* WriteFlatStreamRaw(::grpc::ClientContext* context, ::google::protobuf::Empty* response) override;
+    ::grpc::ClientAsyncWriter< ::oram_impl::FlatChunkMessage>* AsyncWriteFlatStreamRaw(::grpc::ClientContext* context, ::google::protobuf::Empty* response, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncWriter< ::oram_impl::FlatChunkMessage>* PrepareAsyncWriteFlatStreamRaw(::grpc::ClientContext* context, ::google::protobuf::Empty* response, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::oram_impl::SqrtMessage>* AsyncReadSqrtMemoryRaw(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::oram_impl::SqrtMessage>* PrepareAsyncReadSqrtMemoryRaw(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::oram_impl::ShelterMessage>* AsyncReadShelterRaw(::grpc::ClientContext* context, const ::oram_impl::ReadShelterRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::oram_impl::ShelterMessage>* PrepareAsyncReadShelterRaw(::grpc::ClientContext* context, const ::oram_impl::ReadShelterRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* AsyncWriteSqrtMemoryRaw(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtMessage& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* PrepareAsyncWriteSqrtMemoryRaw(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtMessage& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* AsyncSqrtPermuteRaw(::grpc::ClientContext* context, const ::oram_impl::SqrtPermMessage& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* PrepareAsyncSqrtPermuteRaw(::grpc::ClientContext* context, const ::oram_impl::SqrtPermMessage& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* AsyncSqrtShuffleControlRaw(::grpc::ClientContext* context, const ::oram_impl::SqrtShuffleRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* PrepareAsyncSqrtShuffleControlRaw(::grpc::ClientContext* context, const ::oram_impl::SqrtShuffleRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::oram_impl::SqrtRangeMessage>* AsyncReadSqrtRangeRaw(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRangeRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::oram_impl::SqrtRangeMessage>* PrepareAsyncReadSqrtRangeRaw(::grpc::ClientContext* context, const ::oram_impl::ReadSqrtRangeRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* AsyncWriteSqrtRangeRaw(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtRangeRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* PrepareAsyncWriteSqrtRangeRaw(::grpc::ClientContext* context, const ::oram_impl::WriteSqrtRangeRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* AsyncInitLayeredOramRaw(::grpc::ClientContext* context, const ::oram_impl::InitLayeredOramRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* PrepareAsyncInitLayeredOramRaw(::grpc::ClientContext* context, const ::oram_impl::InitLayeredOramRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::oram_impl::LayeredBlocksMessage>* AsyncReadLayeredBlocksRaw(::grpc::ClientContext* context, const ::oram_impl::ReadLayeredRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::oram_impl::LayeredBlocksMessage>* PrepareAsyncReadLayeredBlocksRaw(::grpc::ClientContext* context, const ::oram_impl::ReadLayeredRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* AsyncWriteLayeredLevelRaw(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* PrepareAsyncWriteLayeredLevelRaw(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* AsyncWriteLayeredRangeRaw(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRangeRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* PrepareAsyncWriteLayeredRangeRaw(::grpc::ClientContext* context, const ::oram_impl::WriteLayeredRangeRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* AsyncLayeredLevelControlRaw(::grpc::ClientContext* context, const ::oram_impl::LayeredControlRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* PrepareAsyncLayeredLevelControlRaw(::grpc::ClientContext* context, const ::oram_impl::LayeredControlRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* AsyncCloseConnectionRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* PrepareAsyncCloseConnectionRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::oram_impl::KeyExchangeResponse>* AsyncKeyExchangeRaw(::grpc::ClientContext* context, const ::oram_impl::KeyExchangeRequest& request, ::grpc::CompletionQueue* cq) override;
@@ -454,11 +738,23 @@ class oram_server final {
     const ::grpc::internal::RpcMethod rpcmethod_PrintOramTree_;
     const ::grpc::internal::RpcMethod rpcmethod_ReadPath_;
     const ::grpc::internal::RpcMethod rpcmethod_WritePath_;
+    const ::grpc::internal::RpcMethod rpcmethod_ReadFullPath_;
+    const ::grpc::internal::RpcMethod rpcmethod_WriteFullPath_;
     const ::grpc::internal::RpcMethod rpcmethod_ReadFlatMemory_;
     const ::grpc::internal::RpcMethod rpcmethod_WriteFlatMemory_;
+    const ::grpc::internal::RpcMethod rpcmethod_ReadFlatStream_;
+    const ::grpc::internal::RpcMethod rpcmethod_WriteFlatStream_;
     const ::grpc::internal::RpcMethod rpcmethod_ReadSqrtMemory_;
+    const ::grpc::internal::RpcMethod rpcmethod_ReadShelter_;
     const ::grpc::internal::RpcMethod rpcmethod_WriteSqrtMemory_;
-    const ::grpc::internal::RpcMethod rpcmethod_SqrtPermute_;
+    const ::grpc::internal::RpcMethod rpcmethod_SqrtShuffleControl_;
+    const ::grpc::internal::RpcMethod rpcmethod_ReadSqrtRange_;
+    const ::grpc::internal::RpcMethod rpcmethod_WriteSqrtRange_;
+    const ::grpc::internal::RpcMethod rpcmethod_InitLayeredOram_;
+    const ::grpc::internal::RpcMethod rpcmethod_ReadLayeredBlocks_;
+    const ::grpc::internal::RpcMethod rpcmethod_WriteLayeredLevel_;
+    const ::grpc::internal::RpcMethod rpcmethod_WriteLayeredRange_;
+    const ::grpc::internal::RpcMethod rpcmethod_LayeredLevelControl_;
     const ::grpc::internal::RpcMethod rpcmethod_CloseConnection_;
     const ::grpc::internal::RpcMethod rpcmethod_KeyExchange_;
     const ::grpc::internal::RpcMethod rpcmethod_SendHello_;
@@ -479,11 +775,29 @@ class oram_server final {
     virtual ::grpc::Status PrintOramTree(::grpc::ServerContext* context, const ::oram_impl::PrintOramTreeRequest* request, ::google::protobuf::Empty* response);
     virtual ::grpc::Status ReadPath(::grpc::ServerContext* context, const ::oram_impl::ReadPathRequest* request, ::oram_impl::ReadPathResponse* response);
     virtual ::grpc::Status WritePath(::grpc::ServerContext* context, const ::oram_impl::WritePathRequest* request, ::oram_impl::WritePathResponse* response);
+    // Read or write all the buckets on a path at once. The level of the request
+    // is ignored.
+    virtual ::grpc::Status ReadFullPath(::grpc::ServerContext* context, const ::oram_impl::ReadPathRequest* request, ::oram_impl::ReadPathResponse* response);
+    virtual ::grpc::Status WriteFullPath(::grpc::ServerContext* context, const ::oram_impl::WriteFullPathRequest* request, ::oram_impl::WritePathResponse* response);
     virtual ::grpc::Status ReadFlatMemory(::grpc::ServerContext* context, const ::oram_impl::ReadFlatRequest* request, ::oram_impl::FlatVectorMessage* response);
     virtual ::grpc::Status WriteFlatMemory(::grpc::ServerContext* context, const ::oram_impl::FlatVectorMessage* request, ::google::protobuf::Empty* response);
+    // Streams the flat storage in chunks so that neither side needs to hold
+    // the whole storage in a single message.
+    virtual ::grpc::Status ReadFlatStream(::grpc::ServerContext* context, const ::oram_impl::ReadFlatStreamRequest* request, ::grpc::ServerWriter< ::oram_impl::FlatChunkMessage>* writer);
+    // Only the first chunk needs to carry a header. The storage ends at the end
+    // of the last chunk.
+    virtual ::grpc::Status WriteFlatStream(::grpc::ServerContext* context, ::grpc::ServerReader< ::oram_impl::FlatChunkMessage>* reader, ::google::protobuf::Empty* response);
     virtual ::grpc::Status ReadSqrtMemory(::grpc::ServerContext* context, const ::oram_impl::ReadSqrtRequest* request, ::oram_impl::SqrtMessage* response);
+    virtual ::grpc::Status ReadShelter(::grpc::ServerContext* context, const ::oram_impl::ReadShelterRequest* request, ::oram_impl::ShelterMessage* response);
     virtual ::grpc::Status WriteSqrtMemory(::grpc::ServerContext* context, const ::oram_impl::WriteSqrtMessage* request, ::google::protobuf::Empty* response);
-    virtual ::grpc::Status SqrtPermute(::grpc::ServerContext* context, const ::oram_impl::SqrtPermMessage* request, ::google::protobuf::Empty* response);
+    virtual ::grpc::Status SqrtShuffleControl(::grpc::ServerContext* context, const ::oram_impl::SqrtShuffleRequest* request, ::google::protobuf::Empty* response);
+    virtual ::grpc::Status ReadSqrtRange(::grpc::ServerContext* context, const ::oram_impl::ReadSqrtRangeRequest* request, ::oram_impl::SqrtRangeMessage* response);
+    virtual ::grpc::Status WriteSqrtRange(::grpc::ServerContext* context, const ::oram_impl::WriteSqrtRangeRequest* request, ::google::protobuf::Empty* response);
+    virtual ::grpc::Status InitLayeredOram(::grpc::ServerContext* context, const ::oram_impl::InitLayeredOramRequest* request, ::google::protobuf::Empty* response);
+    virtual ::grpc::Status ReadLayeredBlocks(::grpc::ServerContext* context, const ::oram_impl::ReadLayeredRequest* request, ::oram_impl::LayeredBlocksMessage* response);
+    virtual ::grpc::Status WriteLayeredLevel(::grpc::ServerContext* context, const ::oram_impl::WriteLayeredRequest* request, ::google::protobuf::Empty* response);
+    virtual ::grpc::Status WriteLayeredRange(::grpc::ServerContext* context, const ::oram_impl::WriteLayeredRangeRequest* request, ::google::protobuf::Empty* response);
+    virtual ::grpc::Status LayeredLevelControl(::grpc::ServerContext* context, const ::oram_impl::LayeredControlRequest* request, ::google::protobuf::Empty* response);
     virtual ::grpc::Status CloseConnection(::grpc::ServerContext* context, const ::google::protobuf::Empty* request, ::google::protobuf::Empty* response);
     // ============ Key Exchange Using Diffie-Hellman ============ //
     // For evaluating the performance when encryption is introduced, 
@@ -635,12 +949,52 @@ class oram_server final {
     }
   };
   template <class BaseClass>
+  class WithAsyncMethod_ReadFullPath : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_ReadFullPath() {
+      ::grpc::Service::MarkMethodAsync(7);
+    }
+    ~WithAsyncMethod_ReadFullPath() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadFullPath(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadPathRequest* /*request*/, ::oram_impl::ReadPathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestReadFullPath(::grpc::ServerContext* context, ::oram_impl::ReadPathRequest* request, ::grpc::ServerAsyncResponseWriter< ::oram_impl::ReadPathResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_WriteFullPath : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_WriteFullPath() {
+      ::grpc::Service::MarkMethodAsync(8);
+    }
+    ~WithAsyncMethod_WriteFullPath() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteFullPath(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteFullPathRequest* /*request*/, ::oram_impl::WritePathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestWriteFullPath(::grpc::ServerContext* context, ::oram_impl::WriteFullPathRequest* request, ::grpc::ServerAsyncResponseWriter< ::oram_impl::WritePathResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithAsyncMethod_ReadFlatMemory : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_ReadFlatMemory() {
-      ::grpc::Service::MarkMethodAsync(7);
+      ::grpc::Service::MarkMethodAsync(9);
     }
     ~WithAsyncMethod_ReadFlatMemory() override {
       BaseClassMustBeDerivedFromService(this);
@@ -651,7 +1005,7 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestReadFlatMemory(::grpc::ServerContext* context, ::oram_impl::ReadFlatRequest* request, ::grpc::ServerAsyncResponseWriter< ::oram_impl::FlatVectorMessage>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -660,7 +1014,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_WriteFlatMemory() {
-      ::grpc::Service::MarkMethodAsync(8);
+      ::grpc::Service::MarkMethodAsync(10);
     }
     ~WithAsyncMethod_WriteFlatMemory() override {
       BaseClassMustBeDerivedFromService(this);
@@ -671,7 +1025,47 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestWriteFlatMemory(::grpc::ServerContext* context, ::oram_impl::FlatVectorMessage* request, ::grpc::ServerAsyncResponseWriter< ::google::protobuf::Empty>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_ReadFlatStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_ReadFlatStream() {
+      ::grpc::Service::MarkMethodAsync(11);
+    }
+    ~WithAsyncMethod_ReadFlatStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadFlatStream(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadFlatStreamRequest* /*request*/, ::grpc::ServerWriter< ::oram_impl::FlatChunkMessage>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestReadFlatStream(::grpc::ServerContext* context, ::oram_impl::ReadFlatStreamRequest* request, ::grpc::ServerAsyncWriter< ::oram_impl::FlatChunkMessage>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(11, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_WriteFlatStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_WriteFlatStream() {
+      ::grpc::Service::MarkMethodAsync(12);
+    }
+    ~WithAsyncMethod_WriteFlatStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteFlatStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::oram_impl::FlatChunkMessage>* /*reader*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestWriteFlatStream(::grpc::ServerContext* context, ::grpc::ServerAsyncReader< ::google::protobuf::Empty, ::oram_impl::FlatChunkMessage>* reader, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncClientStreaming(12, context, reader, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -680,7 +1074,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_ReadSqrtMemory() {
-      ::grpc::Service::MarkMethodAsync(9);
+      ::grpc::Service::MarkMethodAsync(13);
     }
     ~WithAsyncMethod_ReadSqrtMemory() override {
       BaseClassMustBeDerivedFromService(this);
@@ -691,7 +1085,27 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestReadSqrtMemory(::grpc::ServerContext* context, ::oram_impl::ReadSqrtRequest* request, ::grpc::ServerAsyncResponseWriter< ::oram_impl::SqrtMessage>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(13, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_ReadShelter : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_ReadShelter() {
+      ::grpc::Service::MarkMethodAsync(14);
+    }
+    ~WithAsyncMethod_ReadShelter() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadShelter(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadShelterRequest* /*request*/, ::oram_impl::ShelterMessage* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestReadShelter(::grpc::ServerContext* context, ::oram_impl::ReadShelterRequest* request, ::grpc::ServerAsyncResponseWriter< ::oram_impl::ShelterMessage>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(14, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -700,7 +1114,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_WriteSqrtMemory() {
-      ::grpc::Service::MarkMethodAsync(10);
+      ::grpc::Service::MarkMethodAsync(15);
     }
     ~WithAsyncMethod_WriteSqrtMemory() override {
       BaseClassMustBeDerivedFromService(this);
@@ -711,27 +1125,167 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestWriteSqrtMemory(::grpc::ServerContext* context, ::oram_impl::WriteSqrtMessage* request, ::grpc::ServerAsyncResponseWriter< ::google::protobuf::Empty>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(15, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithAsyncMethod_SqrtPermute : public BaseClass {
+  class WithAsyncMethod_SqrtShuffleControl : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithAsyncMethod_SqrtPermute() {
-      ::grpc::Service::MarkMethodAsync(11);
+    WithAsyncMethod_SqrtShuffleControl() {
+      ::grpc::Service::MarkMethodAsync(16);
+    }
+    ~WithAsyncMethod_SqrtShuffleControl() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SqrtShuffleControl(::grpc::ServerContext* /*context*/, const ::oram_impl::SqrtShuffleRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSqrtShuffleControl(::grpc::ServerContext* context, ::oram_impl::SqrtShuffleRequest* request, ::grpc::ServerAsyncResponseWriter< ::google::protobuf::Empty>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(16, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_ReadSqrtRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_ReadSqrtRange() {
+      ::grpc::Service::MarkMethodAsync(17);
+    }
+    ~WithAsyncMethod_ReadSqrtRange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadSqrtRange(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadSqrtRangeRequest* /*request*/, ::oram_impl::SqrtRangeMessage* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestReadSqrtRange(::grpc::ServerContext* context, ::oram_impl::ReadSqrtRangeRequest* request, ::grpc::ServerAsyncResponseWriter< ::oram_impl::SqrtRangeMessage>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(17, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_WriteSqrtRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_WriteSqrtRange() {
+      ::grpc::Service::MarkMethodAsync(18);
+    }
+    ~WithAsyncMethod_WriteSqrtRange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteSqrtRange(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteSqrtRangeRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestWriteSqrtRange(::grpc::ServerContext* context, ::oram_impl::WriteSqrtRangeRequest* request, ::grpc::ServerAsyncResponseWriter< ::google::protobuf::Empty>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(18, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_InitLayeredOram : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_InitLayeredOram() {
+      ::grpc::Service::MarkMethodAsync(19);
+    }
+    ~WithAsyncMethod_InitLayeredOram() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status InitLayeredOram(::grpc::ServerContext* /*context*/, const ::oram_impl::InitLayeredOramRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestInitLayeredOram(::grpc::ServerContext* context, ::oram_impl::InitLayeredOramRequest* request, ::grpc::ServerAsyncResponseWriter< ::google::protobuf::Empty>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(19, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_ReadLayeredBlocks : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_ReadLayeredBlocks() {
+      ::grpc::Service::MarkMethodAsync(20);
+    }
+    ~WithAsyncMethod_ReadLayeredBlocks() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadLayeredBlocks(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadLayeredRequest* /*request*/, ::oram_impl::LayeredBlocksMessage* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestReadLayeredBlocks(::grpc::ServerContext* context, ::oram_impl::ReadLayeredRequest* request, ::grpc::ServerAsyncResponseWriter< ::oram_impl::LayeredBlocksMessage>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(20, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_WriteLayeredLevel : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_WriteLayeredLevel() {
+      ::grpc::Service::MarkMethodAsync(21);
+    }
+    ~WithAsyncMethod_WriteLayeredLevel() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteLayeredLevel(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteLayeredRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestWriteLayeredLevel(::grpc::ServerContext* context, ::oram_impl::WriteLayeredRequest* request, ::grpc::ServerAsyncResponseWriter< ::google::protobuf::Empty>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(21, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_WriteLayeredRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_WriteLayeredRange() {
+      ::grpc::Service::MarkMethodAsync(22);
+    }
+    ~WithAsyncMethod_WriteLayeredRange() override {
+      BaseClassMustBeDerivedFromService(this);
     }
-    ~WithAsyncMethod_SqrtPermute() override {
+    // disable synchronous version of this method
+    ::grpc::Status WriteLayeredRange(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteLayeredRangeRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestWriteLayeredRange(::grpc::ServerContext* context, ::oram_impl::WriteLayeredRangeRequest* request, ::grpc::ServerAsyncResponseWriter< ::google::protobuf::Empty>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(22, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_LayeredLevelControl : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_LayeredLevelControl() {
+      ::grpc::Service::MarkMethodAsync(23);
+    }
+    ~WithAsyncMethod_LayeredLevelControl() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SqrtPermute(::grpc::ServerContext* /*context*/, const ::oram_impl::SqrtPermMessage* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+    ::grpc::Status LayeredLevelControl(::grpc::ServerContext* /*context*/, const ::oram_impl::LayeredControlRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestSqrtPermute(::grpc::ServerContext* context, ::oram_impl::SqrtPermMessage* request, ::grpc::ServerAsyncResponseWriter< ::google::protobuf::Empty>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
+    void RequestLayeredLevelControl(::grpc::ServerContext* context, ::oram_impl::LayeredControlRequest* request, ::grpc::ServerAsyncResponseWriter< ::google::protobuf::Empty>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(23, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -740,7 +1294,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_CloseConnection() {
-      ::grpc::Service::MarkMethodAsync(12);
+      ::grpc::Service::MarkMethodAsync(24);
     }
     ~WithAsyncMethod_CloseConnection() override {
       BaseClassMustBeDerivedFromService(this);
@@ -751,7 +1305,7 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestCloseConnection(::grpc::ServerContext* context, ::google::protobuf::Empty* request, ::grpc::ServerAsyncResponseWriter< ::google::protobuf::Empty>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(24, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -760,7 +1314,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_KeyExchange() {
-      ::grpc::Service::MarkMethodAsync(13);
+      ::grpc::Service::MarkMethodAsync(25);
     }
     ~WithAsyncMethod_KeyExchange() override {
       BaseClassMustBeDerivedFromService(this);
@@ -771,7 +1325,7 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestKeyExchange(::grpc::ServerContext* context, ::oram_impl::KeyExchangeRequest* request, ::grpc::ServerAsyncResponseWriter< ::oram_impl::KeyExchangeResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(13, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(25, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -780,7 +1334,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_SendHello() {
-      ::grpc::Service::MarkMethodAsync(14);
+      ::grpc::Service::MarkMethodAsync(26);
     }
     ~WithAsyncMethod_SendHello() override {
       BaseClassMustBeDerivedFromService(this);
@@ -791,7 +1345,7 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestSendHello(::grpc::ServerContext* context, ::oram_impl::HelloMessage* request, ::grpc::ServerAsyncResponseWriter< ::google::protobuf::Empty>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(14, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(26, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -800,7 +1354,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_ReportServerInformation() {
-      ::grpc::Service::MarkMethodAsync(15);
+      ::grpc::Service::MarkMethodAsync(27);
     }
     ~WithAsyncMethod_ReportServerInformation() override {
       BaseClassMustBeDerivedFromService(this);
@@ -811,7 +1365,7 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestReportServerInformation(::grpc::ServerContext* context, ::google::protobuf::Empty* request, ::grpc::ServerAsyncResponseWriter< ::google::protobuf::Empty>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(15, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(27, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -820,7 +1374,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_ResetServer() {
-      ::grpc::Service::MarkMethodAsync(16);
+      ::grpc::Service::MarkMethodAsync(28);
     }
     ~WithAsyncMethod_ResetServer() override {
       BaseClassMustBeDerivedFromService(this);
@@ -831,10 +1385,10 @@ class oram_server final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestResetServer(::grpc::ServerContext* context, ::google::protobuf::Empty* request, ::grpc::ServerAsyncResponseWriter< ::google::protobuf::Empty>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(16, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(28, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_InitTreeOram<WithAsyncMethod_InitFlatOram<WithAsyncMethod_InitSqrtOram<WithAsyncMethod_LoadSqrtOram<WithAsyncMethod_PrintOramTree<WithAsyncMethod_ReadPath<WithAsyncMethod_WritePath<WithAsyncMethod_ReadFlatMemory<WithAsyncMethod_WriteFlatMemory<WithAsyncMethod_ReadSqrtMemory<WithAsyncMethod_WriteSqrtMemory<WithAsyncMethod_SqrtPermute<WithAsyncMethod_CloseConnection<WithAsyncMethod_KeyExchange<WithAsyncMethod_SendHello<WithAsyncMethod_ReportServerInformation<WithAsyncMethod_ResetServer<Service > > > > > > > > > > > > > > > > > AsyncService;
+  typedef WithAsyncMethod_InitTreeOram<WithAsyncMethod_InitFlatOram<WithAsyncMethod_InitSqrtOram<WithAsyncMethod_LoadSqrtOram<WithAsyncMethod_PrintOramTree<WithAsyncMethod_ReadPath<WithAsyncMethod_WritePath<WithAsyncMethod_ReadFullPath<WithAsyncMethod_WriteFullPath<WithAsyncMethod_ReadFlatMemory<WithAsyncMethod_WriteFlatMemory<WithAsyncMethod_ReadFlatStream<WithAsyncMethod_WriteFlatStream<WithAsyncMethod_ReadSqrtMemory<WithAsyncMethod_ReadShelter<WithAsyncMethod_WriteSqrtMemory<WithAsyncMethod_SqrtShuffleControl<WithAsyncMethod_ReadSqrtRange<WithAsyncMethod_WriteSqrtRange<WithAsyncMethod_InitLayeredOram<WithAsyncMethod_ReadLayeredBlocks<WithAsyncMethod_WriteLayeredLevel<WithAsyncMethod_WriteLayeredRange<WithAsyncMethod_LayeredLevelControl<WithAsyncMethod_CloseConnection<WithAsyncMethod_KeyExchange<WithAsyncMethod_SendHello<WithAsyncMethod_ReportServerInformation<WithAsyncMethod_ResetServer<Service > > > > > > > > > > > > > > > > > > > > > > > > > > > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_InitTreeOram : public BaseClass {
    private:
@@ -1025,26 +1579,80 @@ class oram_server final {
       ::grpc::CallbackServerContext* /*context*/, const ::oram_impl::WritePathRequest* /*request*/, ::oram_impl::WritePathResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithCallbackMethod_ReadFlatMemory : public BaseClass {
+  class WithCallbackMethod_ReadFullPath : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_ReadFlatMemory() {
+    WithCallbackMethod_ReadFullPath() {
       ::grpc::Service::MarkMethodCallback(7,
-          new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::ReadFlatRequest, ::oram_impl::FlatVectorMessage>(
+          new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::ReadPathRequest, ::oram_impl::ReadPathResponse>(
             [this](
-                   ::grpc::CallbackServerContext* context, const ::oram_impl::ReadFlatRequest* request, ::oram_impl::FlatVectorMessage* response) { return this->ReadFlatMemory(context, request, response); }));}
-    void SetMessageAllocatorFor_ReadFlatMemory(
-        ::grpc::MessageAllocator< ::oram_impl::ReadFlatRequest, ::oram_impl::FlatVectorMessage>* allocator) {
+                   ::grpc::CallbackServerContext* context, const ::oram_impl::ReadPathRequest* request, ::oram_impl::ReadPathResponse* response) { return this->ReadFullPath(context, request, response); }));}
+    void SetMessageAllocatorFor_ReadFullPath(
+        ::grpc::MessageAllocator< ::oram_impl::ReadPathRequest, ::oram_impl::ReadPathResponse>* allocator) {
       ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(7);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::ReadFlatRequest, ::oram_impl::FlatVectorMessage>*>(handler)
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::ReadPathRequest, ::oram_impl::ReadPathResponse>*>(handler)
               ->SetMessageAllocator(allocator);
     }
-    ~WithCallbackMethod_ReadFlatMemory() override {
+    ~WithCallbackMethod_ReadFullPath() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ReadFlatMemory(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadFlatRequest* /*request*/, ::oram_impl::FlatVectorMessage* /*response*/) override {
+    ::grpc::Status ReadFullPath(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadPathRequest* /*request*/, ::oram_impl::ReadPathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ReadFullPath(
+      ::grpc::CallbackServerContext* /*context*/, const ::oram_impl::ReadPathRequest* /*request*/, ::oram_impl::ReadPathResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_WriteFullPath : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_WriteFullPath() {
+      ::grpc::Service::MarkMethodCallback(8,
+          new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::WriteFullPathRequest, ::oram_impl::WritePathResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::oram_impl::WriteFullPathRequest* request, ::oram_impl::WritePathResponse* response) { return this->WriteFullPath(context, request, response); }));}
+    void SetMessageAllocatorFor_WriteFullPath(
+        ::grpc::MessageAllocator< ::oram_impl::WriteFullPathRequest, ::oram_impl::WritePathResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(8);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::WriteFullPathRequest, ::oram_impl::WritePathResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_WriteFullPath() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteFullPath(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteFullPathRequest* /*request*/, ::oram_impl::WritePathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* WriteFullPath(
+      ::grpc::CallbackServerContext* /*context*/, const ::oram_impl::WriteFullPathRequest* /*request*/, ::oram_impl::WritePathResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_ReadFlatMemory : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_ReadFlatMemory() {
+      ::grpc::Service::MarkMethodCallback(9,
+          new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::ReadFlatRequest, ::oram_impl::FlatVectorMessage>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::oram_impl::ReadFlatRequest* request, ::oram_impl::FlatVectorMessage* response) { return this->ReadFlatMemory(context, request, response); }));}
+    void SetMessageAllocatorFor_ReadFlatMemory(
+        ::grpc::MessageAllocator< ::oram_impl::ReadFlatRequest, ::oram_impl::FlatVectorMessage>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(9);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::ReadFlatRequest, ::oram_impl::FlatVectorMessage>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_ReadFlatMemory() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadFlatMemory(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadFlatRequest* /*request*/, ::oram_impl::FlatVectorMessage* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1057,13 +1665,13 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_WriteFlatMemory() {
-      ::grpc::Service::MarkMethodCallback(8,
+      ::grpc::Service::MarkMethodCallback(10,
           new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::FlatVectorMessage, ::google::protobuf::Empty>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::oram_impl::FlatVectorMessage* request, ::google::protobuf::Empty* response) { return this->WriteFlatMemory(context, request, response); }));}
     void SetMessageAllocatorFor_WriteFlatMemory(
         ::grpc::MessageAllocator< ::oram_impl::FlatVectorMessage, ::google::protobuf::Empty>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(8);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(10);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::FlatVectorMessage, ::google::protobuf::Empty>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1079,18 +1687,62 @@ class oram_server final {
       ::grpc::CallbackServerContext* /*context*/, const ::oram_impl::FlatVectorMessage* /*request*/, ::google::protobuf::Empty* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithCallbackMethod_ReadFlatStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_ReadFlatStream() {
+      ::grpc::Service::MarkMethodCallback(11,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::oram_impl::ReadFlatStreamRequest, ::oram_impl::FlatChunkMessage>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::oram_impl::ReadFlatStreamRequest* request) { return this->ReadFlatStream(context, request); }));
+    }
+    ~WithCallbackMethod_ReadFlatStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadFlatStream(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadFlatStreamRequest* /*request*/, ::grpc::ServerWriter< ::oram_impl::FlatChunkMessage>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::oram_impl::FlatChunkMessage>* ReadFlatStream(
+      ::grpc::CallbackServerContext* /*context*/, const ::oram_impl::ReadFlatStreamRequest* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_WriteFlatStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_WriteFlatStream() {
+      ::grpc::Service::MarkMethodCallback(12,
+          new ::grpc::internal::CallbackClientStreamingHandler< ::oram_impl::FlatChunkMessage, ::google::protobuf::Empty>(
+            [this](
+                   ::grpc::CallbackServerContext* context, ::google::protobuf::Empty* response) { return this->WriteFlatStream(context, response); }));
+    }
+    ~WithCallbackMethod_WriteFlatStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteFlatStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::oram_impl::FlatChunkMessage>* /*reader*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerReadReactor< ::oram_impl::FlatChunkMessage>* WriteFlatStream(
+      ::grpc::CallbackServerContext* /*context*/, ::google::protobuf::Empty* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithCallbackMethod_ReadSqrtMemory : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_ReadSqrtMemory() {
-      ::grpc::Service::MarkMethodCallback(9,
+      ::grpc::Service::MarkMethodCallback(13,
           new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::ReadSqrtRequest, ::oram_impl::SqrtMessage>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::oram_impl::ReadSqrtRequest* request, ::oram_impl::SqrtMessage* response) { return this->ReadSqrtMemory(context, request, response); }));}
     void SetMessageAllocatorFor_ReadSqrtMemory(
         ::grpc::MessageAllocator< ::oram_impl::ReadSqrtRequest, ::oram_impl::SqrtMessage>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(9);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(13);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::ReadSqrtRequest, ::oram_impl::SqrtMessage>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1106,18 +1758,45 @@ class oram_server final {
       ::grpc::CallbackServerContext* /*context*/, const ::oram_impl::ReadSqrtRequest* /*request*/, ::oram_impl::SqrtMessage* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithCallbackMethod_ReadShelter : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_ReadShelter() {
+      ::grpc::Service::MarkMethodCallback(14,
+          new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::ReadShelterRequest, ::oram_impl::ShelterMessage>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::oram_impl::ReadShelterRequest* request, ::oram_impl::ShelterMessage* response) { return this->ReadShelter(context, request, response); }));}
+    void SetMessageAllocatorFor_ReadShelter(
+        ::grpc::MessageAllocator< ::oram_impl::ReadShelterRequest, ::oram_impl::ShelterMessage>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(14);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::ReadShelterRequest, ::oram_impl::ShelterMessage>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_ReadShelter() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadShelter(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadShelterRequest* /*request*/, ::oram_impl::ShelterMessage* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ReadShelter(
+      ::grpc::CallbackServerContext* /*context*/, const ::oram_impl::ReadShelterRequest* /*request*/, ::oram_impl::ShelterMessage* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithCallbackMethod_WriteSqrtMemory : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_WriteSqrtMemory() {
-      ::grpc::Service::MarkMethodCallback(10,
+      ::grpc::Service::MarkMethodCallback(15,
           new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::WriteSqrtMessage, ::google::protobuf::Empty>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::oram_impl::WriteSqrtMessage* request, ::google::protobuf::Empty* response) { return this->WriteSqrtMemory(context, request, response); }));}
     void SetMessageAllocatorFor_WriteSqrtMemory(
         ::grpc::MessageAllocator< ::oram_impl::WriteSqrtMessage, ::google::protobuf::Empty>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(10);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(15);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::WriteSqrtMessage, ::google::protobuf::Empty>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1133,31 +1812,220 @@ class oram_server final {
       ::grpc::CallbackServerContext* /*context*/, const ::oram_impl::WriteSqrtMessage* /*request*/, ::google::protobuf::Empty* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithCallbackMethod_SqrtPermute : public BaseClass {
+  class WithCallbackMethod_SqrtShuffleControl : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_SqrtPermute() {
-      ::grpc::Service::MarkMethodCallback(11,
-          new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::SqrtPermMessage, ::google::protobuf::Empty>(
+    WithCallbackMethod_SqrtShuffleControl() {
+      ::grpc::Service::MarkMethodCallback(16,
+          new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::SqrtShuffleRequest, ::google::protobuf::Empty>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::oram_impl::SqrtShuffleRequest* request, ::google::protobuf::Empty* response) { return this->SqrtShuffleControl(context, request, response); }));}
+    void SetMessageAllocatorFor_SqrtShuffleControl(
+        ::grpc::MessageAllocator< ::oram_impl::SqrtShuffleRequest, ::google::protobuf::Empty>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(16);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::SqrtShuffleRequest, ::google::protobuf::Empty>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_SqrtShuffleControl() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SqrtShuffleControl(::grpc::ServerContext* /*context*/, const ::oram_impl::SqrtShuffleRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SqrtShuffleControl(
+      ::grpc::CallbackServerContext* /*context*/, const ::oram_impl::SqrtShuffleRequest* /*request*/, ::google::protobuf::Empty* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_ReadSqrtRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_ReadSqrtRange() {
+      ::grpc::Service::MarkMethodCallback(17,
+          new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::ReadSqrtRangeRequest, ::oram_impl::SqrtRangeMessage>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::oram_impl::ReadSqrtRangeRequest* request, ::oram_impl::SqrtRangeMessage* response) { return this->ReadSqrtRange(context, request, response); }));}
+    void SetMessageAllocatorFor_ReadSqrtRange(
+        ::grpc::MessageAllocator< ::oram_impl::ReadSqrtRangeRequest, ::oram_impl::SqrtRangeMessage>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(17);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::ReadSqrtRangeRequest, ::oram_impl::SqrtRangeMessage>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_ReadSqrtRange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadSqrtRange(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadSqrtRangeRequest* /*request*/, ::oram_impl::SqrtRangeMessage* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ReadSqrtRange(
+      ::grpc::CallbackServerContext* /*context*/, const ::oram_impl::ReadSqrtRangeRequest* /*request*/, ::oram_impl::SqrtRangeMessage* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_WriteSqrtRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_WriteSqrtRange() {
+      ::grpc::Service::MarkMethodCallback(18,
+          new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::WriteSqrtRangeRequest, ::google::protobuf::Empty>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::oram_impl::WriteSqrtRangeRequest* request, ::google::protobuf::Empty* response) { return this->WriteSqrtRange(context, request, response); }));}
+    void SetMessageAllocatorFor_WriteSqrtRange(
+        ::grpc::MessageAllocator< ::oram_impl::WriteSqrtRangeRequest, ::google::protobuf::Empty>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(18);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::WriteSqrtRangeRequest, ::google::protobuf::Empty>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_WriteSqrtRange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteSqrtRange(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteSqrtRangeRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* WriteSqrtRange(
+      ::grpc::CallbackServerContext* /*context*/, const ::oram_impl::WriteSqrtRangeRequest* /*request*/, ::google::protobuf::Empty* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_InitLayeredOram : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_InitLayeredOram() {
+      ::grpc::Service::MarkMethodCallback(19,
+          new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::InitLayeredOramRequest, ::google::protobuf::Empty>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::oram_impl::InitLayeredOramRequest* request, ::google::protobuf::Empty* response) { return this->InitLayeredOram(context, request, response); }));}
+    void SetMessageAllocatorFor_InitLayeredOram(
+        ::grpc::MessageAllocator< ::oram_impl::InitLayeredOramRequest, ::google::protobuf::Empty>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(19);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::InitLayeredOramRequest, ::google::protobuf::Empty>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_InitLayeredOram() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status InitLayeredOram(::grpc::ServerContext* /*context*/, const ::oram_impl::InitLayeredOramRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* InitLayeredOram(
+      ::grpc::CallbackServerContext* /*context*/, const ::oram_impl::InitLayeredOramRequest* /*request*/, ::google::protobuf::Empty* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_ReadLayeredBlocks : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_ReadLayeredBlocks() {
+      ::grpc::Service::MarkMethodCallback(20,
+          new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::ReadLayeredRequest, ::oram_impl::LayeredBlocksMessage>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::oram_impl::ReadLayeredRequest* request, ::oram_impl::LayeredBlocksMessage* response) { return this->ReadLayeredBlocks(context, request, response); }));}
+    void SetMessageAllocatorFor_ReadLayeredBlocks(
+        ::grpc::MessageAllocator< ::oram_impl::ReadLayeredRequest, ::oram_impl::LayeredBlocksMessage>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(20);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::ReadLayeredRequest, ::oram_impl::LayeredBlocksMessage>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_ReadLayeredBlocks() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadLayeredBlocks(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadLayeredRequest* /*request*/, ::oram_impl::LayeredBlocksMessage* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ReadLayeredBlocks(
+      ::grpc::CallbackServerContext* /*context*/, const ::oram_impl::ReadLayeredRequest* /*request*/, ::oram_impl::LayeredBlocksMessage* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_WriteLayeredLevel : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_WriteLayeredLevel() {
+      ::grpc::Service::MarkMethodCallback(21,
+          new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::WriteLayeredRequest, ::google::protobuf::Empty>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::oram_impl::WriteLayeredRequest* request, ::google::protobuf::Empty* response) { return this->WriteLayeredLevel(context, request, response); }));}
+    void SetMessageAllocatorFor_WriteLayeredLevel(
+        ::grpc::MessageAllocator< ::oram_impl::WriteLayeredRequest, ::google::protobuf::Empty>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(21);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::WriteLayeredRequest, ::google::protobuf::Empty>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_WriteLayeredLevel() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteLayeredLevel(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteLayeredRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* WriteLayeredLevel(
+      ::grpc::CallbackServerContext* /*context*/, const ::oram_impl::WriteLayeredRequest* /*request*/, ::google::protobuf::Empty* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_WriteLayeredRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_WriteLayeredRange() {
+      ::grpc::Service::MarkMethodCallback(22,
+          new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::WriteLayeredRangeRequest, ::google::protobuf::Empty>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::oram_impl::WriteLayeredRangeRequest* request, ::google::protobuf::Empty* response) { return this->WriteLayeredRange(context, request, response); }));}
+    void SetMessageAllocatorFor_WriteLayeredRange(
+        ::grpc::MessageAllocator< ::oram_impl::WriteLayeredRangeRequest, ::google::protobuf::Empty>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(22);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::WriteLayeredRangeRequest, ::google::protobuf::Empty>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_WriteLayeredRange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteLayeredRange(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteLayeredRangeRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* WriteLayeredRange(
+      ::grpc::CallbackServerContext* /*context*/, const ::oram_impl::WriteLayeredRangeRequest* /*request*/, ::google::protobuf::Empty* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_LayeredLevelControl : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_LayeredLevelControl() {
+      ::grpc::Service::MarkMethodCallback(23,
+          new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::LayeredControlRequest, ::google::protobuf::Empty>(
             [this](
-                   ::grpc::CallbackServerContext* context, const ::oram_impl::SqrtPermMessage* request, ::google::protobuf::Empty* response) { return this->SqrtPermute(context, request, response); }));}
-    void SetMessageAllocatorFor_SqrtPermute(
-        ::grpc::MessageAllocator< ::oram_impl::SqrtPermMessage, ::google::protobuf::Empty>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(11);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::SqrtPermMessage, ::google::protobuf::Empty>*>(handler)
+                   ::grpc::CallbackServerContext* context, const ::oram_impl::LayeredControlRequest* request, ::google::protobuf::Empty* response) { return this->LayeredLevelControl(context, request, response); }));}
+    void SetMessageAllocatorFor_LayeredLevelControl(
+        ::grpc::MessageAllocator< ::oram_impl::LayeredControlRequest, ::google::protobuf::Empty>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(23);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::LayeredControlRequest, ::google::protobuf::Empty>*>(handler)
               ->SetMessageAllocator(allocator);
     }
-    ~WithCallbackMethod_SqrtPermute() override {
+    ~WithCallbackMethod_LayeredLevelControl() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SqrtPermute(::grpc::ServerContext* /*context*/, const ::oram_impl::SqrtPermMessage* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+    ::grpc::Status LayeredLevelControl(::grpc::ServerContext* /*context*/, const ::oram_impl::LayeredControlRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* SqrtPermute(
-      ::grpc::CallbackServerContext* /*context*/, const ::oram_impl::SqrtPermMessage* /*request*/, ::google::protobuf::Empty* /*response*/)  { return nullptr; }
+    virtual ::grpc::ServerUnaryReactor* LayeredLevelControl(
+      ::grpc::CallbackServerContext* /*context*/, const ::oram_impl::LayeredControlRequest* /*request*/, ::google::protobuf::Empty* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
   class WithCallbackMethod_CloseConnection : public BaseClass {
@@ -1165,13 +2033,13 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_CloseConnection() {
-      ::grpc::Service::MarkMethodCallback(12,
+      ::grpc::Service::MarkMethodCallback(24,
           new ::grpc::internal::CallbackUnaryHandler< ::google::protobuf::Empty, ::google::protobuf::Empty>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::google::protobuf::Empty* request, ::google::protobuf::Empty* response) { return this->CloseConnection(context, request, response); }));}
     void SetMessageAllocatorFor_CloseConnection(
         ::grpc::MessageAllocator< ::google::protobuf::Empty, ::google::protobuf::Empty>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(12);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(24);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::google::protobuf::Empty, ::google::protobuf::Empty>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1192,13 +2060,13 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_KeyExchange() {
-      ::grpc::Service::MarkMethodCallback(13,
+      ::grpc::Service::MarkMethodCallback(25,
           new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::KeyExchangeRequest, ::oram_impl::KeyExchangeResponse>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::oram_impl::KeyExchangeRequest* request, ::oram_impl::KeyExchangeResponse* response) { return this->KeyExchange(context, request, response); }));}
     void SetMessageAllocatorFor_KeyExchange(
         ::grpc::MessageAllocator< ::oram_impl::KeyExchangeRequest, ::oram_impl::KeyExchangeResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(13);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(25);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::KeyExchangeRequest, ::oram_impl::KeyExchangeResponse>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1219,13 +2087,13 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_SendHello() {
-      ::grpc::Service::MarkMethodCallback(14,
+      ::grpc::Service::MarkMethodCallback(26,
           new ::grpc::internal::CallbackUnaryHandler< ::oram_impl::HelloMessage, ::google::protobuf::Empty>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::oram_impl::HelloMessage* request, ::google::protobuf::Empty* response) { return this->SendHello(context, request, response); }));}
     void SetMessageAllocatorFor_SendHello(
         ::grpc::MessageAllocator< ::oram_impl::HelloMessage, ::google::protobuf::Empty>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(14);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(26);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::oram_impl::HelloMessage, ::google::protobuf::Empty>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1246,13 +2114,13 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_ReportServerInformation() {
-      ::grpc::Service::MarkMethodCallback(15,
+      ::grpc::Service::MarkMethodCallback(27,
           new ::grpc::internal::CallbackUnaryHandler< ::google::protobuf::Empty, ::google::protobuf::Empty>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::google::protobuf::Empty* request, ::google::protobuf::Empty* response) { return this->ReportServerInformation(context, request, response); }));}
     void SetMessageAllocatorFor_ReportServerInformation(
         ::grpc::MessageAllocator< ::google::protobuf::Empty, ::google::protobuf::Empty>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(15);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(27);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::google::protobuf::Empty, ::google::protobuf::Empty>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1273,13 +2141,13 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_ResetServer() {
-      ::grpc::Service::MarkMethodCallback(16,
+      ::grpc::Service::MarkMethodCallback(28,
           new ::grpc::internal::CallbackUnaryHandler< ::google::protobuf::Empty, ::google::protobuf::Empty>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::google::protobuf::Empty* request, ::google::protobuf::Empty* response) { return this->ResetServer(context, request, response); }));}
     void SetMessageAllocatorFor_ResetServer(
         ::grpc::MessageAllocator< ::google::protobuf::Empty, ::google::protobuf::Empty>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(16);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(28);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::google::protobuf::Empty, ::google::protobuf::Empty>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1294,7 +2162,7 @@ class oram_server final {
     virtual ::grpc::ServerUnaryReactor* ResetServer(
       ::grpc::CallbackServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::google::protobuf::Empty* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_InitTreeOram<WithCallbackMethod_InitFlatOram<WithCallbackMethod_InitSqrtOram<WithCallbackMethod_LoadSqrtOram<WithCallbackMethod_PrintOramTree<WithCallbackMethod_ReadPath<WithCallbackMethod_WritePath<WithCallbackMethod_ReadFlatMemory<WithCallbackMethod_WriteFlatMemory<WithCallbackMethod_ReadSqrtMemory<WithCallbackMethod_WriteSqrtMemory<WithCallbackMethod_SqrtPermute<WithCallbackMethod_CloseConnection<WithCallbackMethod_KeyExchange<WithCallbackMethod_SendHello<WithCallbackMethod_ReportServerInformation<WithCallbackMethod_ResetServer<Service > > > > > > > > > > > > > > > > > CallbackService;
+  typedef WithCallbackMethod_InitTreeOram<WithCallbackMethod_InitFlatOram<WithCallbackMethod_InitSqrtOram<WithCallbackMethod_LoadSqrtOram<WithCallbackMethod_PrintOramTree<WithCallbackMethod_ReadPath<WithCallbackMethod_WritePath<WithCallbackMethod_ReadFullPath<WithCallbackMethod_WriteFullPath<WithCallbackMethod_ReadFlatMemory<WithCallbackMethod_WriteFlatMemory<WithCallbackMethod_ReadFlatStream<WithCallbackMethod_WriteFlatStream<WithCallbackMethod_ReadSqrtMemory<WithCallbackMethod_ReadShelter<WithCallbackMethod_WriteSqrtMemory<WithCallbackMethod_SqrtShuffleControl<WithCallbackMethod_ReadSqrtRange<WithCallbackMethod_WriteSqrtRange<WithCallbackMethod_InitLayeredOram<WithCallbackMethod_ReadLayeredBlocks<WithCallbackMethod_WriteLayeredLevel<WithCallbackMethod_WriteLayeredRange<WithCallbackMethod_LayeredLevelControl<WithCallbackMethod_CloseConnection<WithCallbackMethod_KeyExchange<WithCallbackMethod_SendHello<WithCallbackMethod_ReportServerInformation<WithCallbackMethod_ResetServer<Service > > > > > > > > > > > > > > > > > > > > > > > > > > > > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_InitTreeOram : public BaseClass {
@@ -1416,154 +2284,358 @@ class oram_server final {
     }
   };
   template <class BaseClass>
-  class WithGenericMethod_ReadFlatMemory : public BaseClass {
+  class WithGenericMethod_ReadFullPath : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_ReadFlatMemory() {
+    WithGenericMethod_ReadFullPath() {
       ::grpc::Service::MarkMethodGeneric(7);
     }
-    ~WithGenericMethod_ReadFlatMemory() override {
+    ~WithGenericMethod_ReadFullPath() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ReadFlatMemory(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadFlatRequest* /*request*/, ::oram_impl::FlatVectorMessage* /*response*/) override {
+    ::grpc::Status ReadFullPath(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadPathRequest* /*request*/, ::oram_impl::ReadPathResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
   };
   template <class BaseClass>
-  class WithGenericMethod_WriteFlatMemory : public BaseClass {
+  class WithGenericMethod_WriteFullPath : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_WriteFlatMemory() {
+    WithGenericMethod_WriteFullPath() {
       ::grpc::Service::MarkMethodGeneric(8);
     }
-    ~WithGenericMethod_WriteFlatMemory() override {
+    ~WithGenericMethod_WriteFullPath() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status WriteFlatMemory(::grpc::ServerContext* /*context*/, const ::oram_impl::FlatVectorMessage* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+    ::grpc::Status WriteFullPath(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteFullPathRequest* /*request*/, ::oram_impl::WritePathResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
   };
   template <class BaseClass>
-  class WithGenericMethod_ReadSqrtMemory : public BaseClass {
+  class WithGenericMethod_ReadFlatMemory : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_ReadSqrtMemory() {
+    WithGenericMethod_ReadFlatMemory() {
       ::grpc::Service::MarkMethodGeneric(9);
     }
-    ~WithGenericMethod_ReadSqrtMemory() override {
+    ~WithGenericMethod_ReadFlatMemory() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ReadSqrtMemory(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadSqrtRequest* /*request*/, ::oram_impl::SqrtMessage* /*response*/) override {
+    ::grpc::Status ReadFlatMemory(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadFlatRequest* /*request*/, ::oram_impl::FlatVectorMessage* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
   };
   template <class BaseClass>
-  class WithGenericMethod_WriteSqrtMemory : public BaseClass {
+  class WithGenericMethod_WriteFlatMemory : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_WriteSqrtMemory() {
+    WithGenericMethod_WriteFlatMemory() {
       ::grpc::Service::MarkMethodGeneric(10);
     }
-    ~WithGenericMethod_WriteSqrtMemory() override {
+    ~WithGenericMethod_WriteFlatMemory() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status WriteSqrtMemory(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteSqrtMessage* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+    ::grpc::Status WriteFlatMemory(::grpc::ServerContext* /*context*/, const ::oram_impl::FlatVectorMessage* /*request*/, ::google::protobuf::Empty* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
   };
   template <class BaseClass>
-  class WithGenericMethod_SqrtPermute : public BaseClass {
+  class WithGenericMethod_ReadFlatStream : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_SqrtPermute() {
+    WithGenericMethod_ReadFlatStream() {
       ::grpc::Service::MarkMethodGeneric(11);
     }
-    ~WithGenericMethod_SqrtPermute() override {
+    ~WithGenericMethod_ReadFlatStream() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SqrtPermute(::grpc::ServerContext* /*context*/, const ::oram_impl::SqrtPermMessage* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+    ::grpc::Status ReadFlatStream(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadFlatStreamRequest* /*request*/, ::grpc::ServerWriter< ::oram_impl::FlatChunkMessage>* /*writer*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
   };
   template <class BaseClass>
-  class WithGenericMethod_CloseConnection : public BaseClass {
+  class WithGenericMethod_WriteFlatStream : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_CloseConnection() {
+    WithGenericMethod_WriteFlatStream() {
       ::grpc::Service::MarkMethodGeneric(12);
     }
-    ~WithGenericMethod_CloseConnection() override {
+    ~WithGenericMethod_WriteFlatStream() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status CloseConnection(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+    ::grpc::Status WriteFlatStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::oram_impl::FlatChunkMessage>* /*reader*/, ::google::protobuf::Empty* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
   };
   template <class BaseClass>
-  class WithGenericMethod_KeyExchange : public BaseClass {
+  class WithGenericMethod_ReadSqrtMemory : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_KeyExchange() {
+    WithGenericMethod_ReadSqrtMemory() {
       ::grpc::Service::MarkMethodGeneric(13);
     }
-    ~WithGenericMethod_KeyExchange() override {
+    ~WithGenericMethod_ReadSqrtMemory() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status KeyExchange(::grpc::ServerContext* /*context*/, const ::oram_impl::KeyExchangeRequest* /*request*/, ::oram_impl::KeyExchangeResponse* /*response*/) override {
+    ::grpc::Status ReadSqrtMemory(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadSqrtRequest* /*request*/, ::oram_impl::SqrtMessage* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
   };
   template <class BaseClass>
-  class WithGenericMethod_SendHello : public BaseClass {
+  class WithGenericMethod_ReadShelter : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_SendHello() {
+    WithGenericMethod_ReadShelter() {
       ::grpc::Service::MarkMethodGeneric(14);
     }
-    ~WithGenericMethod_SendHello() override {
+    ~WithGenericMethod_ReadShelter() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SendHello(::grpc::ServerContext* /*context*/, const ::oram_impl::HelloMessage* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+    ::grpc::Status ReadShelter(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadShelterRequest* /*request*/, ::oram_impl::ShelterMessage* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
   };
   template <class BaseClass>
-  class WithGenericMethod_ReportServerInformation : public BaseClass {
+  class WithGenericMethod_WriteSqrtMemory : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_ReportServerInformation() {
+    WithGenericMethod_WriteSqrtMemory() {
       ::grpc::Service::MarkMethodGeneric(15);
     }
-    ~WithGenericMethod_ReportServerInformation() override {
+    ~WithGenericMethod_WriteSqrtMemory() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ReportServerInformation(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+    ::grpc::Status WriteSqrtMemory(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteSqrtMessage* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SqrtShuffleControl : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SqrtShuffleControl() {
+      ::grpc::Service::MarkMethodGeneric(16);
+    }
+    ~WithGenericMethod_SqrtShuffleControl() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SqrtShuffleControl(::grpc::ServerContext* /*context*/, const ::oram_impl::SqrtShuffleRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_ReadSqrtRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ReadSqrtRange() {
+      ::grpc::Service::MarkMethodGeneric(17);
+    }
+    ~WithGenericMethod_ReadSqrtRange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadSqrtRange(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadSqrtRangeRequest* /*request*/, ::oram_impl::SqrtRangeMessage* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_WriteSqrtRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_WriteSqrtRange() {
+      ::grpc::Service::MarkMethodGeneric(18);
+    }
+    ~WithGenericMethod_WriteSqrtRange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteSqrtRange(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteSqrtRangeRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_InitLayeredOram : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_InitLayeredOram() {
+      ::grpc::Service::MarkMethodGeneric(19);
+    }
+    ~WithGenericMethod_InitLayeredOram() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status InitLayeredOram(::grpc::ServerContext* /*context*/, const ::oram_impl::InitLayeredOramRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_ReadLayeredBlocks : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ReadLayeredBlocks() {
+      ::grpc::Service::MarkMethodGeneric(20);
+    }
+    ~WithGenericMethod_ReadLayeredBlocks() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadLayeredBlocks(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadLayeredRequest* /*request*/, ::oram_impl::LayeredBlocksMessage* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_WriteLayeredLevel : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_WriteLayeredLevel() {
+      ::grpc::Service::MarkMethodGeneric(21);
+    }
+    ~WithGenericMethod_WriteLayeredLevel() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteLayeredLevel(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteLayeredRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_WriteLayeredRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_WriteLayeredRange() {
+      ::grpc::Service::MarkMethodGeneric(22);
+    }
+    ~WithGenericMethod_WriteLayeredRange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteLayeredRange(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteLayeredRangeRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_LayeredLevelControl : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_LayeredLevelControl() {
+      ::grpc::Service::MarkMethodGeneric(23);
+    }
+    ~WithGenericMethod_LayeredLevelControl() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status LayeredLevelControl(::grpc::ServerContext* /*context*/, const ::oram_impl::LayeredControlRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_CloseConnection : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_CloseConnection() {
+      ::grpc::Service::MarkMethodGeneric(24);
+    }
+    ~WithGenericMethod_CloseConnection() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CloseConnection(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_KeyExchange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_KeyExchange() {
+      ::grpc::Service::MarkMethodGeneric(25);
+    }
+    ~WithGenericMethod_KeyExchange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status KeyExchange(::grpc::ServerContext* /*context*/, const ::oram_impl::KeyExchangeRequest* /*request*/, ::oram_impl::KeyExchangeResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SendHello : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SendHello() {
+      ::grpc::Service::MarkMethodGeneric(26);
+    }
+    ~WithGenericMethod_SendHello() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SendHello(::grpc::ServerContext* /*context*/, const ::oram_impl::HelloMessage* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_ReportServerInformation : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ReportServerInformation() {
+      ::grpc::Service::MarkMethodGeneric(27);
+    }
+    ~WithGenericMethod_ReportServerInformation() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReportServerInformation(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::google::protobuf::Empty* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1574,7 +2646,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_ResetServer() {
-      ::grpc::Service::MarkMethodGeneric(16);
+      ::grpc::Service::MarkMethodGeneric(28);
     }
     ~WithGenericMethod_ResetServer() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1726,261 +2798,501 @@ class oram_server final {
     }
   };
   template <class BaseClass>
-  class WithRawMethod_ReadFlatMemory : public BaseClass {
+  class WithRawMethod_ReadFullPath : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_ReadFlatMemory() {
+    WithRawMethod_ReadFullPath() {
       ::grpc::Service::MarkMethodRaw(7);
     }
-    ~WithRawMethod_ReadFlatMemory() override {
+    ~WithRawMethod_ReadFullPath() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ReadFlatMemory(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadFlatRequest* /*request*/, ::oram_impl::FlatVectorMessage* /*response*/) override {
+    ::grpc::Status ReadFullPath(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadPathRequest* /*request*/, ::oram_impl::ReadPathResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestReadFlatMemory(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestReadFullPath(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_WriteFlatMemory : public BaseClass {
+  class WithRawMethod_WriteFullPath : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_WriteFlatMemory() {
+    WithRawMethod_WriteFullPath() {
       ::grpc::Service::MarkMethodRaw(8);
     }
-    ~WithRawMethod_WriteFlatMemory() override {
+    ~WithRawMethod_WriteFullPath() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status WriteFlatMemory(::grpc::ServerContext* /*context*/, const ::oram_impl::FlatVectorMessage* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+    ::grpc::Status WriteFullPath(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteFullPathRequest* /*request*/, ::oram_impl::WritePathResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestWriteFlatMemory(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestWriteFullPath(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_ReadSqrtMemory : public BaseClass {
+  class WithRawMethod_ReadFlatMemory : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_ReadSqrtMemory() {
+    WithRawMethod_ReadFlatMemory() {
       ::grpc::Service::MarkMethodRaw(9);
     }
-    ~WithRawMethod_ReadSqrtMemory() override {
+    ~WithRawMethod_ReadFlatMemory() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ReadSqrtMemory(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadSqrtRequest* /*request*/, ::oram_impl::SqrtMessage* /*response*/) override {
+    ::grpc::Status ReadFlatMemory(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadFlatRequest* /*request*/, ::oram_impl::FlatVectorMessage* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestReadSqrtMemory(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestReadFlatMemory(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_WriteSqrtMemory : public BaseClass {
+  class WithRawMethod_WriteFlatMemory : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_WriteSqrtMemory() {
+    WithRawMethod_WriteFlatMemory() {
       ::grpc::Service::MarkMethodRaw(10);
     }
-    ~WithRawMethod_WriteSqrtMemory() override {
+    ~WithRawMethod_WriteFlatMemory() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status WriteSqrtMemory(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteSqrtMessage* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+    ::grpc::Status WriteFlatMemory(::grpc::ServerContext* /*context*/, const ::oram_impl::FlatVectorMessage* /*request*/, ::google::protobuf::Empty* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestWriteSqrtMemory(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestWriteFlatMemory(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_SqrtPermute : public BaseClass {
+  class WithRawMethod_ReadFlatStream : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_SqrtPermute() {
+    WithRawMethod_ReadFlatStream() {
       ::grpc::Service::MarkMethodRaw(11);
     }
-    ~WithRawMethod_SqrtPermute() override {
+    ~WithRawMethod_ReadFlatStream() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SqrtPermute(::grpc::ServerContext* /*context*/, const ::oram_impl::SqrtPermMessage* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+    ::grpc::Status ReadFlatStream(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadFlatStreamRequest* /*request*/, ::grpc::ServerWriter< ::oram_impl::FlatChunkMessage>* /*writer*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestSqrtPermute(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
+    void RequestReadFlatStream(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(11, context, request, writer, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_CloseConnection : public BaseClass {
+  class WithRawMethod_WriteFlatStream : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_CloseConnection() {
+    WithRawMethod_WriteFlatStream() {
       ::grpc::Service::MarkMethodRaw(12);
     }
-    ~WithRawMethod_CloseConnection() override {
+    ~WithRawMethod_WriteFlatStream() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status CloseConnection(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+    ::grpc::Status WriteFlatStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::oram_impl::FlatChunkMessage>* /*reader*/, ::google::protobuf::Empty* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestCloseConnection(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
+    void RequestWriteFlatStream(::grpc::ServerContext* context, ::grpc::ServerAsyncReader< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* reader, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncClientStreaming(12, context, reader, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_KeyExchange : public BaseClass {
+  class WithRawMethod_ReadSqrtMemory : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_KeyExchange() {
+    WithRawMethod_ReadSqrtMemory() {
       ::grpc::Service::MarkMethodRaw(13);
     }
-    ~WithRawMethod_KeyExchange() override {
+    ~WithRawMethod_ReadSqrtMemory() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status KeyExchange(::grpc::ServerContext* /*context*/, const ::oram_impl::KeyExchangeRequest* /*request*/, ::oram_impl::KeyExchangeResponse* /*response*/) override {
+    ::grpc::Status ReadSqrtMemory(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadSqrtRequest* /*request*/, ::oram_impl::SqrtMessage* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestKeyExchange(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestReadSqrtMemory(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncUnary(13, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_SendHello : public BaseClass {
+  class WithRawMethod_ReadShelter : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_SendHello() {
+    WithRawMethod_ReadShelter() {
       ::grpc::Service::MarkMethodRaw(14);
     }
-    ~WithRawMethod_SendHello() override {
+    ~WithRawMethod_ReadShelter() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SendHello(::grpc::ServerContext* /*context*/, const ::oram_impl::HelloMessage* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+    ::grpc::Status ReadShelter(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadShelterRequest* /*request*/, ::oram_impl::ShelterMessage* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestSendHello(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestReadShelter(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncUnary(14, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_ReportServerInformation : public BaseClass {
+  class WithRawMethod_WriteSqrtMemory : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_ReportServerInformation() {
+    WithRawMethod_WriteSqrtMemory() {
       ::grpc::Service::MarkMethodRaw(15);
     }
-    ~WithRawMethod_ReportServerInformation() override {
+    ~WithRawMethod_WriteSqrtMemory() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ReportServerInformation(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+    ::grpc::Status WriteSqrtMemory(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteSqrtMessage* /*request*/, ::google::protobuf::Empty* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestReportServerInformation(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestWriteSqrtMemory(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncUnary(15, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_ResetServer : public BaseClass {
+  class WithRawMethod_SqrtShuffleControl : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_ResetServer() {
+    WithRawMethod_SqrtShuffleControl() {
       ::grpc::Service::MarkMethodRaw(16);
     }
-    ~WithRawMethod_ResetServer() override {
+    ~WithRawMethod_SqrtShuffleControl() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ResetServer(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+    ::grpc::Status SqrtShuffleControl(::grpc::ServerContext* /*context*/, const ::oram_impl::SqrtShuffleRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestResetServer(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestSqrtShuffleControl(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncUnary(16, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_InitTreeOram : public BaseClass {
+  class WithRawMethod_ReadSqrtRange : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_InitTreeOram() {
-      ::grpc::Service::MarkMethodRawCallback(0,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->InitTreeOram(context, request, response); }));
+    WithRawMethod_ReadSqrtRange() {
+      ::grpc::Service::MarkMethodRaw(17);
     }
-    ~WithRawCallbackMethod_InitTreeOram() override {
+    ~WithRawMethod_ReadSqrtRange() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status InitTreeOram(::grpc::ServerContext* /*context*/, const ::oram_impl::InitTreeOramRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+    ::grpc::Status ReadSqrtRange(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadSqrtRangeRequest* /*request*/, ::oram_impl::SqrtRangeMessage* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* InitTreeOram(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+    void RequestReadSqrtRange(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(17, context, request, response, new_call_cq, notification_cq, tag);
+    }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_InitFlatOram : public BaseClass {
+  class WithRawMethod_WriteSqrtRange : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_InitFlatOram() {
-      ::grpc::Service::MarkMethodRawCallback(1,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->InitFlatOram(context, request, response); }));
+    WithRawMethod_WriteSqrtRange() {
+      ::grpc::Service::MarkMethodRaw(18);
     }
-    ~WithRawCallbackMethod_InitFlatOram() override {
+    ~WithRawMethod_WriteSqrtRange() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status InitFlatOram(::grpc::ServerContext* /*context*/, const ::oram_impl::InitFlatOramRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+    ::grpc::Status WriteSqrtRange(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteSqrtRangeRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* InitFlatOram(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+    void RequestWriteSqrtRange(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(18, context, request, response, new_call_cq, notification_cq, tag);
+    }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_InitSqrtOram : public BaseClass {
+  class WithRawMethod_InitLayeredOram : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_InitSqrtOram() {
-      ::grpc::Service::MarkMethodRawCallback(2,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->InitSqrtOram(context, request, response); }));
+    WithRawMethod_InitLayeredOram() {
+      ::grpc::Service::MarkMethodRaw(19);
     }
-    ~WithRawCallbackMethod_InitSqrtOram() override {
+    ~WithRawMethod_InitLayeredOram() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status InitLayeredOram(::grpc::ServerContext* /*context*/, const ::oram_impl::InitLayeredOramRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestInitLayeredOram(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(19, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_ReadLayeredBlocks : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ReadLayeredBlocks() {
+      ::grpc::Service::MarkMethodRaw(20);
+    }
+    ~WithRawMethod_ReadLayeredBlocks() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadLayeredBlocks(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadLayeredRequest* /*request*/, ::oram_impl::LayeredBlocksMessage* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestReadLayeredBlocks(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(20, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_WriteLayeredLevel : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_WriteLayeredLevel() {
+      ::grpc::Service::MarkMethodRaw(21);
+    }
+    ~WithRawMethod_WriteLayeredLevel() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteLayeredLevel(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteLayeredRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestWriteLayeredLevel(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(21, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_WriteLayeredRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_WriteLayeredRange() {
+      ::grpc::Service::MarkMethodRaw(22);
+    }
+    ~WithRawMethod_WriteLayeredRange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteLayeredRange(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteLayeredRangeRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestWriteLayeredRange(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(22, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_LayeredLevelControl : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_LayeredLevelControl() {
+      ::grpc::Service::MarkMethodRaw(23);
+    }
+    ~WithRawMethod_LayeredLevelControl() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status LayeredLevelControl(::grpc::ServerContext* /*context*/, const ::oram_impl::LayeredControlRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestLayeredLevelControl(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(23, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_CloseConnection : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_CloseConnection() {
+      ::grpc::Service::MarkMethodRaw(24);
+    }
+    ~WithRawMethod_CloseConnection() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CloseConnection(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestCloseConnection(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(24, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_KeyExchange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_KeyExchange() {
+      ::grpc::Service::MarkMethodRaw(25);
+    }
+    ~WithRawMethod_KeyExchange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status KeyExchange(::grpc::ServerContext* /*context*/, const ::oram_impl::KeyExchangeRequest* /*request*/, ::oram_impl::KeyExchangeResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestKeyExchange(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(25, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SendHello : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SendHello() {
+      ::grpc::Service::MarkMethodRaw(26);
+    }
+    ~WithRawMethod_SendHello() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SendHello(::grpc::ServerContext* /*context*/, const ::oram_impl::HelloMessage* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSendHello(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(26, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_ReportServerInformation : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ReportServerInformation() {
+      ::grpc::Service::MarkMethodRaw(27);
+    }
+    ~WithRawMethod_ReportServerInformation() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReportServerInformation(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestReportServerInformation(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(27, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_ResetServer : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ResetServer() {
+      ::grpc::Service::MarkMethodRaw(28);
+    }
+    ~WithRawMethod_ResetServer() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ResetServer(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestResetServer(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(28, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_InitTreeOram : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_InitTreeOram() {
+      ::grpc::Service::MarkMethodRawCallback(0,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->InitTreeOram(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_InitTreeOram() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status InitTreeOram(::grpc::ServerContext* /*context*/, const ::oram_impl::InitTreeOramRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* InitTreeOram(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_InitFlatOram : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_InitFlatOram() {
+      ::grpc::Service::MarkMethodRawCallback(1,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->InitFlatOram(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_InitFlatOram() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status InitFlatOram(::grpc::ServerContext* /*context*/, const ::oram_impl::InitFlatOramRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* InitFlatOram(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_InitSqrtOram : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_InitSqrtOram() {
+      ::grpc::Service::MarkMethodRawCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->InitSqrtOram(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_InitSqrtOram() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -2058,135 +3370,399 @@ class oram_server final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_WritePath : public BaseClass {
+  class WithRawCallbackMethod_WritePath : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_WritePath() {
+      ::grpc::Service::MarkMethodRawCallback(6,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->WritePath(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_WritePath() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WritePath(::grpc::ServerContext* /*context*/, const ::oram_impl::WritePathRequest* /*request*/, ::oram_impl::WritePathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* WritePath(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_ReadFullPath : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ReadFullPath() {
+      ::grpc::Service::MarkMethodRawCallback(7,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ReadFullPath(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_ReadFullPath() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadFullPath(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadPathRequest* /*request*/, ::oram_impl::ReadPathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ReadFullPath(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_WriteFullPath : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_WriteFullPath() {
+      ::grpc::Service::MarkMethodRawCallback(8,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->WriteFullPath(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_WriteFullPath() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteFullPath(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteFullPathRequest* /*request*/, ::oram_impl::WritePathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* WriteFullPath(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_ReadFlatMemory : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ReadFlatMemory() {
+      ::grpc::Service::MarkMethodRawCallback(9,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ReadFlatMemory(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_ReadFlatMemory() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadFlatMemory(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadFlatRequest* /*request*/, ::oram_impl::FlatVectorMessage* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ReadFlatMemory(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_WriteFlatMemory : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_WriteFlatMemory() {
+      ::grpc::Service::MarkMethodRawCallback(10,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->WriteFlatMemory(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_WriteFlatMemory() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteFlatMemory(::grpc::ServerContext* /*context*/, const ::oram_impl::FlatVectorMessage* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* WriteFlatMemory(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_ReadFlatStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ReadFlatStream() {
+      ::grpc::Service::MarkMethodRawCallback(11,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->ReadFlatStream(context, request); }));
+    }
+    ~WithRawCallbackMethod_ReadFlatStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadFlatStream(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadFlatStreamRequest* /*request*/, ::grpc::ServerWriter< ::oram_impl::FlatChunkMessage>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* ReadFlatStream(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_WriteFlatStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_WriteFlatStream() {
+      ::grpc::Service::MarkMethodRawCallback(12,
+          new ::grpc::internal::CallbackClientStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, ::grpc::ByteBuffer* response) { return this->WriteFlatStream(context, response); }));
+    }
+    ~WithRawCallbackMethod_WriteFlatStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteFlatStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::oram_impl::FlatChunkMessage>* /*reader*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerReadReactor< ::grpc::ByteBuffer>* WriteFlatStream(
+      ::grpc::CallbackServerContext* /*context*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_ReadSqrtMemory : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ReadSqrtMemory() {
+      ::grpc::Service::MarkMethodRawCallback(13,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ReadSqrtMemory(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_ReadSqrtMemory() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadSqrtMemory(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadSqrtRequest* /*request*/, ::oram_impl::SqrtMessage* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ReadSqrtMemory(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_ReadShelter : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ReadShelter() {
+      ::grpc::Service::MarkMethodRawCallback(14,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ReadShelter(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_ReadShelter() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadShelter(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadShelterRequest* /*request*/, ::oram_impl::ShelterMessage* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ReadShelter(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_WriteSqrtMemory : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_WriteSqrtMemory() {
+      ::grpc::Service::MarkMethodRawCallback(15,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->WriteSqrtMemory(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_WriteSqrtMemory() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteSqrtMemory(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteSqrtMessage* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* WriteSqrtMemory(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SqrtShuffleControl : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SqrtShuffleControl() {
+      ::grpc::Service::MarkMethodRawCallback(16,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SqrtShuffleControl(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_SqrtShuffleControl() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SqrtShuffleControl(::grpc::ServerContext* /*context*/, const ::oram_impl::SqrtShuffleRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SqrtShuffleControl(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_ReadSqrtRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ReadSqrtRange() {
+      ::grpc::Service::MarkMethodRawCallback(17,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ReadSqrtRange(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_ReadSqrtRange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadSqrtRange(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadSqrtRangeRequest* /*request*/, ::oram_impl::SqrtRangeMessage* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ReadSqrtRange(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_WriteSqrtRange : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_WritePath() {
-      ::grpc::Service::MarkMethodRawCallback(6,
+    WithRawCallbackMethod_WriteSqrtRange() {
+      ::grpc::Service::MarkMethodRawCallback(18,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->WritePath(context, request, response); }));
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->WriteSqrtRange(context, request, response); }));
     }
-    ~WithRawCallbackMethod_WritePath() override {
+    ~WithRawCallbackMethod_WriteSqrtRange() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status WritePath(::grpc::ServerContext* /*context*/, const ::oram_impl::WritePathRequest* /*request*/, ::oram_impl::WritePathResponse* /*response*/) override {
+    ::grpc::Status WriteSqrtRange(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteSqrtRangeRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* WritePath(
+    virtual ::grpc::ServerUnaryReactor* WriteSqrtRange(
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_ReadFlatMemory : public BaseClass {
+  class WithRawCallbackMethod_InitLayeredOram : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_ReadFlatMemory() {
-      ::grpc::Service::MarkMethodRawCallback(7,
+    WithRawCallbackMethod_InitLayeredOram() {
+      ::grpc::Service::MarkMethodRawCallback(19,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ReadFlatMemory(context, request, response); }));
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->InitLayeredOram(context, request, response); }));
     }
-    ~WithRawCallbackMethod_ReadFlatMemory() override {
+    ~WithRawCallbackMethod_InitLayeredOram() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ReadFlatMemory(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadFlatRequest* /*request*/, ::oram_impl::FlatVectorMessage* /*response*/) override {
+    ::grpc::Status InitLayeredOram(::grpc::ServerContext* /*context*/, const ::oram_impl::InitLayeredOramRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* ReadFlatMemory(
+    virtual ::grpc::ServerUnaryReactor* InitLayeredOram(
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_WriteFlatMemory : public BaseClass {
+  class WithRawCallbackMethod_ReadLayeredBlocks : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_WriteFlatMemory() {
-      ::grpc::Service::MarkMethodRawCallback(8,
+    WithRawCallbackMethod_ReadLayeredBlocks() {
+      ::grpc::Service::MarkMethodRawCallback(20,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->WriteFlatMemory(context, request, response); }));
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ReadLayeredBlocks(context, request, response); }));
     }
-    ~WithRawCallbackMethod_WriteFlatMemory() override {
+    ~WithRawCallbackMethod_ReadLayeredBlocks() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status WriteFlatMemory(::grpc::ServerContext* /*context*/, const ::oram_impl::FlatVectorMessage* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+    ::grpc::Status ReadLayeredBlocks(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadLayeredRequest* /*request*/, ::oram_impl::LayeredBlocksMessage* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* WriteFlatMemory(
+    virtual ::grpc::ServerUnaryReactor* ReadLayeredBlocks(
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_ReadSqrtMemory : public BaseClass {
+  class WithRawCallbackMethod_WriteLayeredLevel : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_ReadSqrtMemory() {
-      ::grpc::Service::MarkMethodRawCallback(9,
+    WithRawCallbackMethod_WriteLayeredLevel() {
+      ::grpc::Service::MarkMethodRawCallback(21,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ReadSqrtMemory(context, request, response); }));
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->WriteLayeredLevel(context, request, response); }));
     }
-    ~WithRawCallbackMethod_ReadSqrtMemory() override {
+    ~WithRawCallbackMethod_WriteLayeredLevel() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ReadSqrtMemory(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadSqrtRequest* /*request*/, ::oram_impl::SqrtMessage* /*response*/) override {
+    ::grpc::Status WriteLayeredLevel(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteLayeredRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* ReadSqrtMemory(
+    virtual ::grpc::ServerUnaryReactor* WriteLayeredLevel(
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_WriteSqrtMemory : public BaseClass {
+  class WithRawCallbackMethod_WriteLayeredRange : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_WriteSqrtMemory() {
-      ::grpc::Service::MarkMethodRawCallback(10,
+    WithRawCallbackMethod_WriteLayeredRange() {
+      ::grpc::Service::MarkMethodRawCallback(22,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->WriteSqrtMemory(context, request, response); }));
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->WriteLayeredRange(context, request, response); }));
     }
-    ~WithRawCallbackMethod_WriteSqrtMemory() override {
+    ~WithRawCallbackMethod_WriteLayeredRange() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status WriteSqrtMemory(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteSqrtMessage* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+    ::grpc::Status WriteLayeredRange(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteLayeredRangeRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* WriteSqrtMemory(
+    virtual ::grpc::ServerUnaryReactor* WriteLayeredRange(
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_SqrtPermute : public BaseClass {
+  class WithRawCallbackMethod_LayeredLevelControl : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_SqrtPermute() {
-      ::grpc::Service::MarkMethodRawCallback(11,
+    WithRawCallbackMethod_LayeredLevelControl() {
+      ::grpc::Service::MarkMethodRawCallback(23,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SqrtPermute(context, request, response); }));
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->LayeredLevelControl(context, request, response); }));
     }
-    ~WithRawCallbackMethod_SqrtPermute() override {
+    ~WithRawCallbackMethod_LayeredLevelControl() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SqrtPermute(::grpc::ServerContext* /*context*/, const ::oram_impl::SqrtPermMessage* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+    ::grpc::Status LayeredLevelControl(::grpc::ServerContext* /*context*/, const ::oram_impl::LayeredControlRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* SqrtPermute(
+    virtual ::grpc::ServerUnaryReactor* LayeredLevelControl(
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
@@ -2195,7 +3771,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_CloseConnection() {
-      ::grpc::Service::MarkMethodRawCallback(12,
+      ::grpc::Service::MarkMethodRawCallback(24,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->CloseConnection(context, request, response); }));
@@ -2217,7 +3793,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_KeyExchange() {
-      ::grpc::Service::MarkMethodRawCallback(13,
+      ::grpc::Service::MarkMethodRawCallback(25,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->KeyExchange(context, request, response); }));
@@ -2239,7 +3815,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_SendHello() {
-      ::grpc::Service::MarkMethodRawCallback(14,
+      ::grpc::Service::MarkMethodRawCallback(26,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SendHello(context, request, response); }));
@@ -2261,7 +3837,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_ReportServerInformation() {
-      ::grpc::Service::MarkMethodRawCallback(15,
+      ::grpc::Service::MarkMethodRawCallback(27,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ReportServerInformation(context, request, response); }));
@@ -2283,7 +3859,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_ResetServer() {
-      ::grpc::Service::MarkMethodRawCallback(16,
+      ::grpc::Service::MarkMethodRawCallback(28,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ResetServer(context, request, response); }));
@@ -2489,12 +4065,66 @@ class oram_server final {
     virtual ::grpc::Status StreamedWritePath(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::oram_impl::WritePathRequest,::oram_impl::WritePathResponse>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
+  class WithStreamedUnaryMethod_ReadFullPath : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_ReadFullPath() {
+      ::grpc::Service::MarkMethodStreamed(7,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::oram_impl::ReadPathRequest, ::oram_impl::ReadPathResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::oram_impl::ReadPathRequest, ::oram_impl::ReadPathResponse>* streamer) {
+                       return this->StreamedReadFullPath(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_ReadFullPath() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status ReadFullPath(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadPathRequest* /*request*/, ::oram_impl::ReadPathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedReadFullPath(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::oram_impl::ReadPathRequest,::oram_impl::ReadPathResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_WriteFullPath : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_WriteFullPath() {
+      ::grpc::Service::MarkMethodStreamed(8,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::oram_impl::WriteFullPathRequest, ::oram_impl::WritePathResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::oram_impl::WriteFullPathRequest, ::oram_impl::WritePathResponse>* streamer) {
+                       return this->StreamedWriteFullPath(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_WriteFullPath() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status WriteFullPath(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteFullPathRequest* /*request*/, ::oram_impl::WritePathResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedWriteFullPath(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::oram_impl::WriteFullPathRequest,::oram_impl::WritePathResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_ReadFlatMemory : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_ReadFlatMemory() {
-      ::grpc::Service::MarkMethodStreamed(7,
+      ::grpc::Service::MarkMethodStreamed(9,
         new ::grpc::internal::StreamedUnaryHandler<
           ::oram_impl::ReadFlatRequest, ::oram_impl::FlatVectorMessage>(
             [this](::grpc::ServerContext* context,
@@ -2521,7 +4151,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_WriteFlatMemory() {
-      ::grpc::Service::MarkMethodStreamed(8,
+      ::grpc::Service::MarkMethodStreamed(10,
         new ::grpc::internal::StreamedUnaryHandler<
           ::oram_impl::FlatVectorMessage, ::google::protobuf::Empty>(
             [this](::grpc::ServerContext* context,
@@ -2548,7 +4178,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_ReadSqrtMemory() {
-      ::grpc::Service::MarkMethodStreamed(9,
+      ::grpc::Service::MarkMethodStreamed(13,
         new ::grpc::internal::StreamedUnaryHandler<
           ::oram_impl::ReadSqrtRequest, ::oram_impl::SqrtMessage>(
             [this](::grpc::ServerContext* context,
@@ -2570,12 +4200,39 @@ class oram_server final {
     virtual ::grpc::Status StreamedReadSqrtMemory(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::oram_impl::ReadSqrtRequest,::oram_impl::SqrtMessage>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
+  class WithStreamedUnaryMethod_ReadShelter : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_ReadShelter() {
+      ::grpc::Service::MarkMethodStreamed(14,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::oram_impl::ReadShelterRequest, ::oram_impl::ShelterMessage>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::oram_impl::ReadShelterRequest, ::oram_impl::ShelterMessage>* streamer) {
+                       return this->StreamedReadShelter(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_ReadShelter() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status ReadShelter(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadShelterRequest* /*request*/, ::oram_impl::ShelterMessage* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedReadShelter(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::oram_impl::ReadShelterRequest,::oram_impl::ShelterMessage>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_WriteSqrtMemory : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_WriteSqrtMemory() {
-      ::grpc::Service::MarkMethodStreamed(10,
+      ::grpc::Service::MarkMethodStreamed(15,
         new ::grpc::internal::StreamedUnaryHandler<
           ::oram_impl::WriteSqrtMessage, ::google::protobuf::Empty>(
             [this](::grpc::ServerContext* context,
@@ -2597,31 +4254,220 @@ class oram_server final {
     virtual ::grpc::Status StreamedWriteSqrtMemory(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::oram_impl::WriteSqrtMessage,::google::protobuf::Empty>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
-  class WithStreamedUnaryMethod_SqrtPermute : public BaseClass {
+  class WithStreamedUnaryMethod_SqrtShuffleControl : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithStreamedUnaryMethod_SqrtPermute() {
-      ::grpc::Service::MarkMethodStreamed(11,
+    WithStreamedUnaryMethod_SqrtShuffleControl() {
+      ::grpc::Service::MarkMethodStreamed(16,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::oram_impl::SqrtShuffleRequest, ::google::protobuf::Empty>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::oram_impl::SqrtShuffleRequest, ::google::protobuf::Empty>* streamer) {
+                       return this->StreamedSqrtShuffleControl(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_SqrtShuffleControl() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status SqrtShuffleControl(::grpc::ServerContext* /*context*/, const ::oram_impl::SqrtShuffleRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedSqrtShuffleControl(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::oram_impl::SqrtShuffleRequest,::google::protobuf::Empty>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_ReadSqrtRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_ReadSqrtRange() {
+      ::grpc::Service::MarkMethodStreamed(17,
         new ::grpc::internal::StreamedUnaryHandler<
-          ::oram_impl::SqrtPermMessage, ::google::protobuf::Empty>(
+          ::oram_impl::ReadSqrtRangeRequest, ::oram_impl::SqrtRangeMessage>(
             [this](::grpc::ServerContext* context,
                    ::grpc::ServerUnaryStreamer<
-                     ::oram_impl::SqrtPermMessage, ::google::protobuf::Empty>* streamer) {
-                       return this->StreamedSqrtPermute(context,
+                     ::oram_impl::ReadSqrtRangeRequest, ::oram_impl::SqrtRangeMessage>* streamer) {
+                       return this->StreamedReadSqrtRange(context,
                          streamer);
                   }));
     }
-    ~WithStreamedUnaryMethod_SqrtPermute() override {
+    ~WithStreamedUnaryMethod_ReadSqrtRange() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status SqrtPermute(::grpc::ServerContext* /*context*/, const ::oram_impl::SqrtPermMessage* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+    ::grpc::Status ReadSqrtRange(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadSqrtRangeRequest* /*request*/, ::oram_impl::SqrtRangeMessage* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedSqrtPermute(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::oram_impl::SqrtPermMessage,::google::protobuf::Empty>* server_unary_streamer) = 0;
+    virtual ::grpc::Status StreamedReadSqrtRange(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::oram_impl::ReadSqrtRangeRequest,::oram_impl::SqrtRangeMessage>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_WriteSqrtRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_WriteSqrtRange() {
+      ::grpc::Service::MarkMethodStreamed(18,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::oram_impl::WriteSqrtRangeRequest, ::google::protobuf::Empty>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::oram_impl::WriteSqrtRangeRequest, ::google::protobuf::Empty>* streamer) {
+                       return this->StreamedWriteSqrtRange(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_WriteSqrtRange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status WriteSqrtRange(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteSqrtRangeRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedWriteSqrtRange(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::oram_impl::WriteSqrtRangeRequest,::google::protobuf::Empty>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_InitLayeredOram : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_InitLayeredOram() {
+      ::grpc::Service::MarkMethodStreamed(19,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::oram_impl::InitLayeredOramRequest, ::google::protobuf::Empty>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::oram_impl::InitLayeredOramRequest, ::google::protobuf::Empty>* streamer) {
+                       return this->StreamedInitLayeredOram(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_InitLayeredOram() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status InitLayeredOram(::grpc::ServerContext* /*context*/, const ::oram_impl::InitLayeredOramRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedInitLayeredOram(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::oram_impl::InitLayeredOramRequest,::google::protobuf::Empty>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_ReadLayeredBlocks : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_ReadLayeredBlocks() {
+      ::grpc::Service::MarkMethodStreamed(20,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::oram_impl::ReadLayeredRequest, ::oram_impl::LayeredBlocksMessage>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::oram_impl::ReadLayeredRequest, ::oram_impl::LayeredBlocksMessage>* streamer) {
+                       return this->StreamedReadLayeredBlocks(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_ReadLayeredBlocks() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status ReadLayeredBlocks(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadLayeredRequest* /*request*/, ::oram_impl::LayeredBlocksMessage* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedReadLayeredBlocks(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::oram_impl::ReadLayeredRequest,::oram_impl::LayeredBlocksMessage>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_WriteLayeredLevel : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_WriteLayeredLevel() {
+      ::grpc::Service::MarkMethodStreamed(21,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::oram_impl::WriteLayeredRequest, ::google::protobuf::Empty>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::oram_impl::WriteLayeredRequest, ::google::protobuf::Empty>* streamer) {
+                       return this->StreamedWriteLayeredLevel(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_WriteLayeredLevel() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status WriteLayeredLevel(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteLayeredRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedWriteLayeredLevel(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::oram_impl::WriteLayeredRequest,::google::protobuf::Empty>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_WriteLayeredRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_WriteLayeredRange() {
+      ::grpc::Service::MarkMethodStreamed(22,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::oram_impl::WriteLayeredRangeRequest, ::google::protobuf::Empty>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::oram_impl::WriteLayeredRangeRequest, ::google::protobuf::Empty>* streamer) {
+                       return this->StreamedWriteLayeredRange(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_WriteLayeredRange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status WriteLayeredRange(::grpc::ServerContext* /*context*/, const ::oram_impl::WriteLayeredRangeRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedWriteLayeredRange(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::oram_impl::WriteLayeredRangeRequest,::google::protobuf::Empty>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_LayeredLevelControl : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_LayeredLevelControl() {
+      ::grpc::Service::MarkMethodStreamed(23,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::oram_impl::LayeredControlRequest, ::google::protobuf::Empty>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::oram_impl::LayeredControlRequest, ::google::protobuf::Empty>* streamer) {
+                       return this->StreamedLayeredLevelControl(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_LayeredLevelControl() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status LayeredLevelControl(::grpc::ServerContext* /*context*/, const ::oram_impl::LayeredControlRequest* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedLayeredLevelControl(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::oram_impl::LayeredControlRequest,::google::protobuf::Empty>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
   class WithStreamedUnaryMethod_CloseConnection : public BaseClass {
@@ -2629,7 +4475,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_CloseConnection() {
-      ::grpc::Service::MarkMethodStreamed(12,
+      ::grpc::Service::MarkMethodStreamed(24,
         new ::grpc::internal::StreamedUnaryHandler<
           ::google::protobuf::Empty, ::google::protobuf::Empty>(
             [this](::grpc::ServerContext* context,
@@ -2656,7 +4502,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_KeyExchange() {
-      ::grpc::Service::MarkMethodStreamed(13,
+      ::grpc::Service::MarkMethodStreamed(25,
         new ::grpc::internal::StreamedUnaryHandler<
           ::oram_impl::KeyExchangeRequest, ::oram_impl::KeyExchangeResponse>(
             [this](::grpc::ServerContext* context,
@@ -2683,7 +4529,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_SendHello() {
-      ::grpc::Service::MarkMethodStreamed(14,
+      ::grpc::Service::MarkMethodStreamed(26,
         new ::grpc::internal::StreamedUnaryHandler<
           ::oram_impl::HelloMessage, ::google::protobuf::Empty>(
             [this](::grpc::ServerContext* context,
@@ -2710,7 +4556,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_ReportServerInformation() {
-      ::grpc::Service::MarkMethodStreamed(15,
+      ::grpc::Service::MarkMethodStreamed(27,
         new ::grpc::internal::StreamedUnaryHandler<
           ::google::protobuf::Empty, ::google::protobuf::Empty>(
             [this](::grpc::ServerContext* context,
@@ -2737,7 +4583,7 @@ class oram_server final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_ResetServer() {
-      ::grpc::Service::MarkMethodStreamed(16,
+      ::grpc::Service::MarkMethodStreamed(28,
         new ::grpc::internal::StreamedUnaryHandler<
           ::google::protobuf::Empty, ::google::protobuf::Empty>(
             [this](::grpc::ServerContext* context,
@@ -2758,9 +4604,36 @@ class oram_server final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedResetServer(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::google::protobuf::Empty,::google::protobuf::Empty>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_InitTreeOram<WithStreamedUnaryMethod_InitFlatOram<WithStreamedUnaryMethod_InitSqrtOram<WithStreamedUnaryMethod_LoadSqrtOram<WithStreamedUnaryMethod_PrintOramTree<WithStreamedUnaryMethod_ReadPath<WithStreamedUnaryMethod_WritePath<WithStreamedUnaryMethod_ReadFlatMemory<WithStreamedUnaryMethod_WriteFlatMemory<WithStreamedUnaryMethod_ReadSqrtMemory<WithStreamedUnaryMethod_WriteSqrtMemory<WithStreamedUnaryMethod_SqrtPermute<WithStreamedUnaryMethod_CloseConnection<WithStreamedUnaryMethod_KeyExchange<WithStreamedUnaryMethod_SendHello<WithStreamedUnaryMethod_ReportServerInformation<WithStreamedUnaryMethod_ResetServer<Service > > > > > > > > > > > > > > > > > StreamedUnaryService;
-  typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_InitTreeOram<WithStreamedUnaryMethod_InitFlatOram<WithStreamedUnaryMethod_InitSqrtOram<WithStreamedUnaryMethod_LoadSqrtOram<WithStreamedUnaryMethod_PrintOramTree<WithStreamedUnaryMethod_ReadPath<WithStreamedUnaryMethod_WritePath<WithStreamedUnaryMethod_ReadFlatMemory<WithStreamedUnaryMethod_WriteFlatMemory<WithStreamedUnaryMethod_ReadSqrtMemory<WithStreamedUnaryMethod_WriteSqrtMemory<WithStreamedUnaryMethod_SqrtPermute<WithStreamedUnaryMethod_CloseConnection<WithStreamedUnaryMethod_KeyExchange<WithStreamedUnaryMethod_SendHello<WithStreamedUnaryMethod_ReportServerInformation<WithStreamedUnaryMethod_ResetServer<Service > > > > > > > > > > > > > > > > > StreamedService;
+  typedef WithStreamedUnaryMethod_InitTreeOram<WithStreamedUnaryMethod_InitFlatOram<WithStreamedUnaryMethod_InitSqrtOram<WithStreamedUnaryMethod_LoadSqrtOram<WithStreamedUnaryMethod_PrintOramTree<WithStreamedUnaryMethod_ReadPath<WithStreamedUnaryMethod_WritePath<WithStreamedUnaryMethod_ReadFullPath<WithStreamedUnaryMethod_WriteFullPath<WithStreamedUnaryMethod_ReadFlatMemory<WithStreamedUnaryMethod_WriteFlatMemory<WithStreamedUnaryMethod_ReadSqrtMemory<WithStreamedUnaryMethod_ReadShelter<WithStreamedUnaryMethod_WriteSqrtMemory<WithStreamedUnaryMethod_SqrtShuffleControl<WithStreamedUnaryMethod_ReadSqrtRange<WithStreamedUnaryMethod_WriteSqrtRange<WithStreamedUnaryMethod_InitLayeredOram<WithStreamedUnaryMethod_ReadLayeredBlocks<WithStreamedUnaryMethod_WriteLayeredLevel<WithStreamedUnaryMethod_WriteLayeredRange<WithStreamedUnaryMethod_LayeredLevelControl<WithStreamedUnaryMethod_CloseConnection<WithStreamedUnaryMethod_KeyExchange<WithStreamedUnaryMethod_SendHello<WithStreamedUnaryMethod_ReportServerInformation<WithStreamedUnaryMethod_ResetServer<Service > > > > > > > > > > > > > > > > > > > > > > > > > > > StreamedUnaryService;
+  template <class BaseClass>
+  class WithSplitStreamingMethod_ReadFlatStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_ReadFlatStream() {
+      ::grpc::Service::MarkMethodStreamed(11,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::oram_impl::ReadFlatStreamRequest, ::oram_impl::FlatChunkMessage>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::oram_impl::ReadFlatStreamRequest, ::oram_impl::FlatChunkMessage>* streamer) {
+                       return this->StreamedReadFlatStream(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_ReadFlatStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status ReadFlatStream(::grpc::ServerContext* /*context*/, const ::oram_impl::ReadFlatStreamRequest* /*request*/, ::grpc::ServerWriter< ::oram_impl::FlatChunkMessage>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedReadFlatStream(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::oram_impl::ReadFlatStreamRequest,::oram_impl::FlatChunkMessage>* server_split_streamer) = 0;
+  };
+  typedef WithSplitStreamingMethod_ReadFlatStream<Service > SplitStreamedService;
+  typedef WithStreamedUnaryMethod_InitTreeOram<WithStreamedUnaryMethod_InitFlatOram<WithStreamedUnaryMethod_InitSqrtOram<WithStreamedUnaryMethod_LoadSqrtOram<WithStreamedUnaryMethod_PrintOramTree<WithStreamedUnaryMethod_ReadPath<WithStreamedUnaryMethod_WritePath<WithStreamedUnaryMethod_ReadFullPath<WithStreamedUnaryMethod_WriteFullPath<WithStreamedUnaryMethod_ReadFlatMemory<WithStreamedUnaryMethod_WriteFlatMemory<WithSplitStreamingMethod_ReadFlatStream<WithStreamedUnaryMethod_ReadSqrtMemory<WithStreamedUnaryMethod_ReadShelter<WithStreamedUnaryMethod_WriteSqrtMemory<WithStreamedUnaryMethod_SqrtShuffleControl<WithStreamedUnaryMethod_ReadSqrtRange<WithStreamedUnaryMethod_WriteSqrtRange<WithStreamedUnaryMethod_InitLayeredOram<WithStreamedUnaryMethod_ReadLayeredBlocks<WithStreamedUnaryMethod_WriteLayeredLevel<WithStreamedUnaryMethod_WriteLayeredRange<WithStreamedUnaryMethod_LayeredLevelControl<WithStreamedUnaryMethod_CloseConnection<WithStreamedUnaryMethod_KeyExchange<WithStreamedUnaryMethod_SendHello<WithStreamedUnaryMethod_ReportServerInformation<WithStreamedUnaryMethod_ResetServer<Service > > > > > > > > > > > > > > > > > > > > > > > > > > > > StreamedService;
 };
 
 }  // namespace oram_impl
@@ -178,21 +178,191 @@ struct WriteSqrtMessageDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteSqrtMessageDefaultTypeInternal _WriteSqrtMessage_default_instance_;
-PROTOBUF_CONSTEXPR SqrtPermMessage::SqrtPermMessage(
+PROTOBUF_CONSTEXPR ReadShelterRequest::ReadShelterRequest(
     ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.perms_)*/{}
-  , /*decltype(_impl_._perms_cached_byte_size_)*/{0}
+    /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReadShelterRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReadShelterRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReadShelterRequestDefaultTypeInternal() {}
+  union {
+    ReadShelterRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReadShelterRequestDefaultTypeInternal _ReadShelterRequest_default_instance_;
+PROTOBUF_CONSTEXPR ShelterMessage::ShelterMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.contents_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ShelterMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ShelterMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ShelterMessageDefaultTypeInternal() {}
+  union {
+    ShelterMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ShelterMessageDefaultTypeInternal _ShelterMessage_default_instance_;
+PROTOBUF_CONSTEXPR SqrtShuffleRequest::SqrtShuffleRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.type_)*/0u
+  , /*decltype(_impl_.temp_size_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SqrtShuffleRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SqrtShuffleRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SqrtShuffleRequestDefaultTypeInternal() {}
+  union {
+    SqrtShuffleRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SqrtShuffleRequestDefaultTypeInternal _SqrtShuffleRequest_default_instance_;
+PROTOBUF_CONSTEXPR ReadSqrtRangeRequest::ReadSqrtRangeRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.offsets_)*/{}
+  , /*decltype(_impl_._offsets_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.lengths_)*/{}
+  , /*decltype(_impl_._lengths_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.area_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReadSqrtRangeRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReadSqrtRangeRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReadSqrtRangeRequestDefaultTypeInternal() {}
+  union {
+    ReadSqrtRangeRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReadSqrtRangeRequestDefaultTypeInternal _ReadSqrtRangeRequest_default_instance_;
+PROTOBUF_CONSTEXPR SqrtRangeMessage::SqrtRangeMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.contents_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SqrtRangeMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SqrtRangeMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SqrtRangeMessageDefaultTypeInternal() {}
+  union {
+    SqrtRangeMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SqrtRangeMessageDefaultTypeInternal _SqrtRangeMessage_default_instance_;
+PROTOBUF_CONSTEXPR WriteSqrtRangeRequest::WriteSqrtRangeRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.contents_)*/{}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.area_)*/0u
+  , /*decltype(_impl_.offset_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WriteSqrtRangeRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WriteSqrtRangeRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WriteSqrtRangeRequestDefaultTypeInternal() {}
+  union {
+    WriteSqrtRangeRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteSqrtRangeRequestDefaultTypeInternal _WriteSqrtRangeRequest_default_instance_;
+PROTOBUF_CONSTEXPR InitLayeredOramRequest::InitLayeredOramRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.level_num_)*/0u
+  , /*decltype(_impl_.block_size_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct InitLayeredOramRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InitLayeredOramRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InitLayeredOramRequestDefaultTypeInternal() {}
+  union {
+    InitLayeredOramRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InitLayeredOramRequestDefaultTypeInternal _InitLayeredOramRequest_default_instance_;
+PROTOBUF_CONSTEXPR ReadLayeredRequest::ReadLayeredRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.levels_)*/{}
+  , /*decltype(_impl_._levels_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.offsets_)*/{}
+  , /*decltype(_impl_._offsets_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReadLayeredRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReadLayeredRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReadLayeredRequestDefaultTypeInternal() {}
+  union {
+    ReadLayeredRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReadLayeredRequestDefaultTypeInternal _ReadLayeredRequest_default_instance_;
+PROTOBUF_CONSTEXPR LayeredBlocksMessage::LayeredBlocksMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.contents_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LayeredBlocksMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LayeredBlocksMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LayeredBlocksMessageDefaultTypeInternal() {}
+  union {
+    LayeredBlocksMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LayeredBlocksMessageDefaultTypeInternal _LayeredBlocksMessage_default_instance_;
+PROTOBUF_CONSTEXPR WriteLayeredRequest::WriteLayeredRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.contents_)*/{}
+  , /*decltype(_impl_.cleared_levels_)*/{}
+  , /*decltype(_impl_._cleared_levels_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.level_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WriteLayeredRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WriteLayeredRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WriteLayeredRequestDefaultTypeInternal() {}
+  union {
+    WriteLayeredRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteLayeredRequestDefaultTypeInternal _WriteLayeredRequest_default_instance_;
+PROTOBUF_CONSTEXPR WriteLayeredRangeRequest::WriteLayeredRangeRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.contents_)*/{}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.level_)*/0u
+  , /*decltype(_impl_.offset_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WriteLayeredRangeRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WriteLayeredRangeRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WriteLayeredRangeRequestDefaultTypeInternal() {}
+  union {
+    WriteLayeredRangeRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteLayeredRangeRequestDefaultTypeInternal _WriteLayeredRangeRequest_default_instance_;
+PROTOBUF_CONSTEXPR LayeredControlRequest::LayeredControlRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.cleared_levels_)*/{}
+  , /*decltype(_impl_._cleared_levels_cached_byte_size_)*/{0}
   , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.type_)*/0u
+  , /*decltype(_impl_.level_)*/0u
+  , /*decltype(_impl_.size_)*/0u
+  , /*decltype(_impl_.target_)*/0u
   , /*decltype(_impl_._cached_size_)*/{}} {}
-struct SqrtPermMessageDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR SqrtPermMessageDefaultTypeInternal()
+struct LayeredControlRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LayeredControlRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
-  ~SqrtPermMessageDefaultTypeInternal() {}
+  ~LayeredControlRequestDefaultTypeInternal() {}
   union {
-    SqrtPermMessage _instance;
+    LayeredControlRequest _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SqrtPermMessageDefaultTypeInternal _SqrtPermMessage_default_instance_;
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LayeredControlRequestDefaultTypeInternal _LayeredControlRequest_default_instance_;
 PROTOBUF_CONSTEXPR InitTreeOramRequest::InitTreeOramRequest(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.header_)*/nullptr
@@ -222,6 +392,36 @@ struct ReadFlatRequestDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReadFlatRequestDefaultTypeInternal _ReadFlatRequest_default_instance_;
+PROTOBUF_CONSTEXPR ReadFlatStreamRequest::ReadFlatStreamRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.chunk_blocks_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReadFlatStreamRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReadFlatStreamRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReadFlatStreamRequestDefaultTypeInternal() {}
+  union {
+    ReadFlatStreamRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReadFlatStreamRequestDefaultTypeInternal _ReadFlatStreamRequest_default_instance_;
+PROTOBUF_CONSTEXPR FlatChunkMessage::FlatChunkMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.content_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.offset_)*/uint64_t{0u}
+  , /*decltype(_impl_.last_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FlatChunkMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FlatChunkMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FlatChunkMessageDefaultTypeInternal() {}
+  union {
+    FlatChunkMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FlatChunkMessageDefaultTypeInternal _FlatChunkMessage_default_instance_;
 PROTOBUF_CONSTEXPR ReadSqrtRequest::ReadSqrtRequest(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.header_)*/nullptr
@@ -284,6 +484,34 @@ struct WritePathRequestDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WritePathRequestDefaultTypeInternal _WritePathRequest_default_instance_;
+PROTOBUF_CONSTEXPR BucketMessage::BucketMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.bucket_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BucketMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BucketMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BucketMessageDefaultTypeInternal() {}
+  union {
+    BucketMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BucketMessageDefaultTypeInternal _BucketMessage_default_instance_;
+PROTOBUF_CONSTEXPR WriteFullPathRequest::WriteFullPathRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.buckets_)*/{}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.path_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WriteFullPathRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WriteFullPathRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WriteFullPathRequestDefaultTypeInternal() {}
+  union {
+    WriteFullPathRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteFullPathRequestDefaultTypeInternal _WriteFullPathRequest_default_instance_;
 PROTOBUF_CONSTEXPR WritePathResponse::WritePathResponse(
     ::_pbi::ConstantInitialized) {}
 struct WritePathResponseDefaultTypeInternal {
@@ -296,7 +524,7 @@ struct WritePathResponseDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WritePathResponseDefaultTypeInternal _WritePathResponse_default_instance_;
 }  // namespace oram_impl
-static ::_pb::Metadata file_level_metadata_messages_2eproto[19];
+static ::_pb::Metadata file_level_metadata_messages_2eproto[34];
 static const ::_pb::EnumDescriptor* file_level_enum_descriptors_messages_2eproto[1];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_messages_2eproto = nullptr;
 
@@ -393,13 +621,112 @@ const uint32_t TableStruct_messages_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE
   PROTOBUF_FIELD_OFFSET(::oram_impl::WriteSqrtMessage, _impl_.write_to_cache_),
   PROTOBUF_FIELD_OFFSET(::oram_impl::WriteSqrtMessage, _impl_.pos_),
   ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::oram_impl::SqrtPermMessage, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::ReadShelterRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::ReadShelterRequest, _impl_.header_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::ShelterMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::ShelterMessage, _impl_.contents_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::SqrtShuffleRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::SqrtShuffleRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::SqrtShuffleRequest, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::SqrtShuffleRequest, _impl_.temp_size_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::ReadSqrtRangeRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::ReadSqrtRangeRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::ReadSqrtRangeRequest, _impl_.area_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::ReadSqrtRangeRequest, _impl_.offsets_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::ReadSqrtRangeRequest, _impl_.lengths_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::SqrtRangeMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::SqrtRangeMessage, _impl_.contents_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::WriteSqrtRangeRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::WriteSqrtRangeRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::WriteSqrtRangeRequest, _impl_.area_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::WriteSqrtRangeRequest, _impl_.offset_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::WriteSqrtRangeRequest, _impl_.contents_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::InitLayeredOramRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::InitLayeredOramRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::InitLayeredOramRequest, _impl_.level_num_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::InitLayeredOramRequest, _impl_.block_size_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::ReadLayeredRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::ReadLayeredRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::ReadLayeredRequest, _impl_.levels_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::ReadLayeredRequest, _impl_.offsets_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::LayeredBlocksMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::LayeredBlocksMessage, _impl_.contents_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::WriteLayeredRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::WriteLayeredRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::WriteLayeredRequest, _impl_.level_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::WriteLayeredRequest, _impl_.contents_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::WriteLayeredRequest, _impl_.cleared_levels_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::WriteLayeredRangeRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::WriteLayeredRangeRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::WriteLayeredRangeRequest, _impl_.level_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::WriteLayeredRangeRequest, _impl_.offset_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::WriteLayeredRangeRequest, _impl_.contents_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::LayeredControlRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::oram_impl::SqrtPermMessage, _impl_.header_),
-  PROTOBUF_FIELD_OFFSET(::oram_impl::SqrtPermMessage, _impl_.perms_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::LayeredControlRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::LayeredControlRequest, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::LayeredControlRequest, _impl_.level_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::LayeredControlRequest, _impl_.size_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::LayeredControlRequest, _impl_.target_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::LayeredControlRequest, _impl_.cleared_levels_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::oram_impl::InitTreeOramRequest, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -418,6 +745,24 @@ const uint32_t TableStruct_messages_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::oram_impl::ReadFlatRequest, _impl_.header_),
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::ReadFlatStreamRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::ReadFlatStreamRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::ReadFlatStreamRequest, _impl_.chunk_blocks_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::FlatChunkMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::FlatChunkMessage, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::FlatChunkMessage, _impl_.offset_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::FlatChunkMessage, _impl_.content_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::FlatChunkMessage, _impl_.last_),
+  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::oram_impl::ReadSqrtRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -461,6 +806,22 @@ const uint32_t TableStruct_messages_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE
   0,
   1,
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::BucketMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::BucketMessage, _impl_.bucket_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::WriteFullPathRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::oram_impl::WriteFullPathRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::WriteFullPathRequest, _impl_.path_),
+  PROTOBUF_FIELD_OFFSET(::oram_impl::WriteFullPathRequest, _impl_.buckets_),
+  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::oram_impl::WritePathResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -479,14 +840,29 @@ static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protode
   { 65, -1, -1, sizeof(::oram_impl::FlatVectorMessage)},
   { 73, -1, -1, sizeof(::oram_impl::SqrtMessage)},
   { 81, -1, -1, sizeof(::oram_impl::WriteSqrtMessage)},
-  { 91, -1, -1, sizeof(::oram_impl::SqrtPermMessage)},
-  { 99, -1, -1, sizeof(::oram_impl::InitTreeOramRequest)},
-  { 109, -1, -1, sizeof(::oram_impl::ReadFlatRequest)},
-  { 116, -1, -1, sizeof(::oram_impl::ReadSqrtRequest)},
-  { 125, -1, -1, sizeof(::oram_impl::ReadPathRequest)},
-  { 134, -1, -1, sizeof(::oram_impl::ReadPathResponse)},
-  { 141, 153, -1, sizeof(::oram_impl::WritePathRequest)},
-  { 159, -1, -1, sizeof(::oram_impl::WritePathResponse)},
+  { 91, -1, -1, sizeof(::oram_impl::ReadShelterRequest)},
+  { 98, -1, -1, sizeof(::oram_impl::ShelterMessage)},
+  { 105, -1, -1, sizeof(::oram_impl::SqrtShuffleRequest)},
+  { 114, -1, -1, sizeof(::oram_impl::ReadSqrtRangeRequest)},
+  { 124, -1, -1, sizeof(::oram_impl::SqrtRangeMessage)},
+  { 131, -1, -1, sizeof(::oram_impl::WriteSqrtRangeRequest)},
+  { 141, -1, -1, sizeof(::oram_impl::InitLayeredOramRequest)},
+  { 150, -1, -1, sizeof(::oram_impl::ReadLayeredRequest)},
+  { 159, -1, -1, sizeof(::oram_impl::LayeredBlocksMessage)},
+  { 166, -1, -1, sizeof(::oram_impl::WriteLayeredRequest)},
+  { 176, -1, -1, sizeof(::oram_impl::WriteLayeredRangeRequest)},
+  { 186, -1, -1, sizeof(::oram_impl::LayeredControlRequest)},
+  { 198, -1, -1, sizeof(::oram_impl::InitTreeOramRequest)},
+  { 208, -1, -1, sizeof(::oram_impl::ReadFlatRequest)},
+  { 215, -1, -1, sizeof(::oram_impl::ReadFlatStreamRequest)},
+  { 223, -1, -1, sizeof(::oram_impl::FlatChunkMessage)},
+  { 233, -1, -1, sizeof(::oram_impl::ReadSqrtRequest)},
+  { 242, -1, -1, sizeof(::oram_impl::ReadPathRequest)},
+  { 251, -1, -1, sizeof(::oram_impl::ReadPathResponse)},
+  { 258, 270, -1, sizeof(::oram_impl::WritePathRequest)},
+  { 276, -1, -1, sizeof(::oram_impl::BucketMessage)},
+  { 283, -1, -1, sizeof(::oram_impl::WriteFullPathRequest)},
+  { 292, -1, -1, sizeof(::oram_impl::WritePathResponse)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -501,13 +877,28 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::oram_impl::_FlatVectorMessage_default_instance_._instance,
   &::oram_impl::_SqrtMessage_default_instance_._instance,
   &::oram_impl::_WriteSqrtMessage_default_instance_._instance,
-  &::oram_impl::_SqrtPermMessage_default_instance_._instance,
+  &::oram_impl::_ReadShelterRequest_default_instance_._instance,
+  &::oram_impl::_ShelterMessage_default_instance_._instance,
+  &::oram_impl::_SqrtShuffleRequest_default_instance_._instance,
+  &::oram_impl::_ReadSqrtRangeRequest_default_instance_._instance,
+  &::oram_impl::_SqrtRangeMessage_default_instance_._instance,
+  &::oram_impl::_WriteSqrtRangeRequest_default_instance_._instance,
+  &::oram_impl::_InitLayeredOramRequest_default_instance_._instance,
+  &::oram_impl::_ReadLayeredRequest_default_instance_._instance,
+  &::oram_impl::_LayeredBlocksMessage_default_instance_._instance,
+  &::oram_impl::_WriteLayeredRequest_default_instance_._instance,
+  &::oram_impl::_WriteLayeredRangeRequest_default_instance_._instance,
+  &::oram_impl::_LayeredControlRequest_default_instance_._instance,
   &::oram_impl::_InitTreeOramRequest_default_instance_._instance,
   &::oram_impl::_ReadFlatRequest_default_instance_._instance,
+  &::oram_impl::_ReadFlatStreamRequest_default_instance_._instance,
+  &::oram_impl::_FlatChunkMessage_default_instance_._instance,
   &::oram_impl::_ReadSqrtRequest_default_instance_._instance,
   &::oram_impl::_ReadPathRequest_default_instance_._instance,
   &::oram_impl::_ReadPathResponse_default_instance_._instance,
   &::oram_impl::_WritePathRequest_default_instance_._instance,
+  &::oram_impl::_BucketMessage_default_instance_._instance,
+  &::oram_impl::_WriteFullPathRequest_default_instance_._instance,
   &::oram_impl::_WritePathResponse_default_instance_._instance,
 };
 
@@ -534,66 +925,125 @@ const char descriptor_table_protodef_messages_2eproto[] PROTOBUF_SECTION_VARIABL
   "t\030\002 \001(\014\"r\n\020WriteSqrtMessage\022(\n\006header\030\001 "
   "\001(\0132\030.oram_impl.RequestHeader\022\017\n\007content"
   "\030\002 \001(\014\022\026\n\016write_to_cache\030\003 \001(\010\022\013\n\003pos\030\004 "
-  "\001(\r\"J\n\017SqrtPermMessage\022(\n\006header\030\001 \001(\0132\030"
-  ".oram_impl.RequestHeader\022\r\n\005perms\030\002 \003(\r\""
-  "|\n\023InitTreeOramRequest\022(\n\006header\030\001 \001(\0132\030"
-  ".oram_impl.RequestHeader\022\023\n\013bucket_size\030"
-  "\002 \001(\r\022\022\n\nbucket_num\030\003 \001(\r\022\022\n\nblock_size\030"
-  "\004 \001(\r\";\n\017ReadFlatRequest\022(\n\006header\030\001 \001(\013"
-  "2\030.oram_impl.RequestHeader\"[\n\017ReadSqrtRe"
+  "\001(\r\">\n\022ReadShelterRequest\022(\n\006header\030\001 \001("
+  "\0132\030.oram_impl.RequestHeader\"\"\n\016ShelterMe"
+  "ssage\022\020\n\010contents\030\001 \003(\014\"_\n\022SqrtShuffleRe"
   "quest\022(\n\006header\030\001 \001(\0132\030.oram_impl.Reques"
-  "tHeader\022\013\n\003tag\030\002 \001(\r\022\021\n\tread_from\030\003 \001(\r\""
-  "X\n\017ReadPathRequest\022(\n\006header\030\001 \001(\0132\030.ora"
-  "m_impl.RequestHeader\022\014\n\004path\030\002 \001(\r\022\r\n\005le"
-  "vel\030\003 \001(\r\"\"\n\020ReadPathResponse\022\016\n\006bucket\030"
-  "\001 \003(\014\"\266\001\n\020WritePathRequest\022(\n\006header\030\001 \001"
-  "(\0132\030.oram_impl.RequestHeader\022\014\n\004path\030\002 \001"
-  "(\r\022\r\n\005level\030\003 \001(\r\022\016\n\006bucket\030\004 \003(\014\022\"\n\004typ"
-  "e\030\005 \001(\0162\017.oram_impl.TypeH\000\210\001\001\022\023\n\006offset\030"
-  "\006 \001(\rH\001\210\001\001B\007\n\005_typeB\t\n\007_offset\"\023\n\021WriteP"
-  "athResponse*<\n\004Type\022\017\n\013kSequential\020\000\022\013\n\007"
-  "kRandom\020\001\022\t\n\005kInit\020\002\022\013\n\007kNormal\020\0032\345\t\n\013or"
-  "am_server\022H\n\014InitTreeOram\022\036.oram_impl.In"
-  "itTreeOramRequest\032\026.google.protobuf.Empt"
-  "y\"\000\022H\n\014InitFlatOram\022\036.oram_impl.InitFlat"
-  "OramRequest\032\026.google.protobuf.Empty\"\000\022H\n"
-  "\014InitSqrtOram\022\036.oram_impl.InitSqrtOramRe"
-  "quest\032\026.google.protobuf.Empty\"\000\022H\n\014LoadS"
-  "qrtOram\022\036.oram_impl.LoadSqrtOramRequest\032"
-  "\026.google.protobuf.Empty\"\000\022J\n\rPrintOramTr"
-  "ee\022\037.oram_impl.PrintOramTreeRequest\032\026.go"
-  "ogle.protobuf.Empty\"\000\022E\n\010ReadPath\022\032.oram"
-  "_impl.ReadPathRequest\032\033.oram_impl.ReadPa"
-  "thResponse\"\000\022H\n\tWritePath\022\033.oram_impl.Wr"
-  "itePathRequest\032\034.oram_impl.WritePathResp"
-  "onse\"\000\022L\n\016ReadFlatMemory\022\032.oram_impl.Rea"
-  "dFlatRequest\032\034.oram_impl.FlatVectorMessa"
-  "ge\"\000\022I\n\017WriteFlatMemory\022\034.oram_impl.Flat"
-  "VectorMessage\032\026.google.protobuf.Empty\"\000\022"
-  "F\n\016ReadSqrtMemory\022\032.oram_impl.ReadSqrtRe"
-  "quest\032\026.oram_impl.SqrtMessage\"\000\022H\n\017Write"
-  "SqrtMemory\022\033.oram_impl.WriteSqrtMessage\032"
-  "\026.google.protobuf.Empty\"\000\022C\n\013SqrtPermute"
-  "\022\032.oram_impl.SqrtPermMessage\032\026.google.pr"
-  "otobuf.Empty\"\000\022C\n\017CloseConnection\022\026.goog"
-  "le.protobuf.Empty\032\026.google.protobuf.Empt"
-  "y\"\000\022N\n\013KeyExchange\022\035.oram_impl.KeyExchan"
-  "geRequest\032\036.oram_impl.KeyExchangeRespons"
-  "e\"\000\022>\n\tSendHello\022\027.oram_impl.HelloMessag"
-  "e\032\026.google.protobuf.Empty\"\000\022K\n\027ReportSer"
-  "verInformation\022\026.google.protobuf.Empty\032\026"
-  ".google.protobuf.Empty\"\000\022\?\n\013ResetServer\022"
-  "\026.google.protobuf.Empty\032\026.google.protobu"
-  "f.Empty\"\000b\006proto3"
+  "tHeader\022\014\n\004type\030\002 \001(\r\022\021\n\ttemp_size\030\003 \001(\r"
+  "\"p\n\024ReadSqrtRangeRequest\022(\n\006header\030\001 \001(\013"
+  "2\030.oram_impl.RequestHeader\022\014\n\004area\030\002 \001(\r"
+  "\022\017\n\007offsets\030\003 \003(\r\022\017\n\007lengths\030\004 \003(\r\"$\n\020Sq"
+  "rtRangeMessage\022\020\n\010contents\030\001 \003(\014\"q\n\025Writ"
+  "eSqrtRangeRequest\022(\n\006header\030\001 \001(\0132\030.oram"
+  "_impl.RequestHeader\022\014\n\004area\030\002 \001(\r\022\016\n\006off"
+  "set\030\003 \001(\r\022\020\n\010contents\030\004 \003(\014\"i\n\026InitLayer"
+  "edOramRequest\022(\n\006header\030\001 \001(\0132\030.oram_imp"
+  "l.RequestHeader\022\021\n\tlevel_num\030\002 \001(\r\022\022\n\nbl"
+  "ock_size\030\003 \001(\r\"_\n\022ReadLayeredRequest\022(\n\006"
+  "header\030\001 \001(\0132\030.oram_impl.RequestHeader\022\016"
+  "\n\006levels\030\002 \003(\r\022\017\n\007offsets\030\003 \003(\r\"(\n\024Layer"
+  "edBlocksMessage\022\020\n\010contents\030\001 \003(\014\"x\n\023Wri"
+  "teLayeredRequest\022(\n\006header\030\001 \001(\0132\030.oram_"
+  "impl.RequestHeader\022\r\n\005level\030\002 \001(\r\022\020\n\010con"
+  "tents\030\003 \003(\014\022\026\n\016cleared_levels\030\004 \003(\r\"u\n\030W"
+  "riteLayeredRangeRequest\022(\n\006header\030\001 \001(\0132"
+  "\030.oram_impl.RequestHeader\022\r\n\005level\030\002 \001(\r"
+  "\022\016\n\006offset\030\003 \001(\r\022\020\n\010contents\030\004 \003(\014\"\224\001\n\025L"
+  "ayeredControlRequest\022(\n\006header\030\001 \001(\0132\030.o"
+  "ram_impl.RequestHeader\022\014\n\004type\030\002 \001(\r\022\r\n\005"
+  "level\030\003 \001(\r\022\014\n\004size\030\004 \001(\r\022\016\n\006target\030\005 \001("
+  "\r\022\026\n\016cleared_levels\030\006 \003(\r\"|\n\023InitTreeOra"
+  "mRequest\022(\n\006header\030\001 \001(\0132\030.oram_impl.Req"
+  "uestHeader\022\023\n\013bucket_size\030\002 \001(\r\022\022\n\nbucke"
+  "t_num\030\003 \001(\r\022\022\n\nblock_size\030\004 \001(\r\";\n\017ReadF"
+  "latRequest\022(\n\006header\030\001 \001(\0132\030.oram_impl.R"
+  "equestHeader\"W\n\025ReadFlatStreamRequest\022(\n"
+  "\006header\030\001 \001(\0132\030.oram_impl.RequestHeader\022"
+  "\024\n\014chunk_blocks\030\002 \001(\r\"k\n\020FlatChunkMessag"
+  "e\022(\n\006header\030\001 \001(\0132\030.oram_impl.RequestHea"
+  "der\022\016\n\006offset\030\002 \001(\004\022\017\n\007content\030\003 \001(\014\022\014\n\004"
+  "last\030\004 \001(\010\"[\n\017ReadSqrtRequest\022(\n\006header\030"
+  "\001 \001(\0132\030.oram_impl.RequestHeader\022\013\n\003tag\030\002"
+  " \001(\r\022\021\n\tread_from\030\003 \001(\r\"X\n\017ReadPathReque"
+  "st\022(\n\006header\030\001 \001(\0132\030.oram_impl.RequestHe"
+  "ader\022\014\n\004path\030\002 \001(\r\022\r\n\005level\030\003 \001(\r\"\"\n\020Rea"
+  "dPathResponse\022\016\n\006bucket\030\001 \003(\014\"\266\001\n\020WriteP"
+  "athRequest\022(\n\006header\030\001 \001(\0132\030.oram_impl.R"
+  "equestHeader\022\014\n\004path\030\002 \001(\r\022\r\n\005level\030\003 \001("
+  "\r\022\016\n\006bucket\030\004 \003(\014\022\"\n\004type\030\005 \001(\0162\017.oram_i"
+  "mpl.TypeH\000\210\001\001\022\023\n\006offset\030\006 \001(\rH\001\210\001\001B\007\n\005_t"
+  "ypeB\t\n\007_offset\"\037\n\rBucketMessage\022\016\n\006bucke"
+  "t\030\001 \003(\014\"y\n\024WriteFullPathRequest\022(\n\006heade"
+  "r\030\001 \001(\0132\030.oram_impl.RequestHeader\022\014\n\004pat"
+  "h\030\002 \001(\r\022)\n\007buckets\030\003 \003(\0132\030.oram_impl.Buc"
+  "ketMessage\"\023\n\021WritePathResponse*<\n\004Type\022"
+  "\017\n\013kSequential\020\000\022\013\n\007kRandom\020\001\022\t\n\005kInit\020\002"
+  "\022\013\n\007kNormal\020\0032\264\021\n\013oram_server\022H\n\014InitTre"
+  "eOram\022\036.oram_impl.InitTreeOramRequest\032\026."
+  "google.protobuf.Empty\"\000\022H\n\014InitFlatOram\022"
+  "\036.oram_impl.InitFlatOramRequest\032\026.google"
+  ".protobuf.Empty\"\000\022H\n\014InitSqrtOram\022\036.oram"
+  "_impl.InitSqrtOramRequest\032\026.google.proto"
+  "buf.Empty\"\000\022H\n\014LoadSqrtOram\022\036.oram_impl."
+  "LoadSqrtOramRequest\032\026.google.protobuf.Em"
+  "pty\"\000\022J\n\rPrintOramTree\022\037.oram_impl.Print"
+  "OramTreeRequest\032\026.google.protobuf.Empty\""
+  "\000\022E\n\010ReadPath\022\032.oram_impl.ReadPathReques"
+  "t\032\033.oram_impl.ReadPathResponse\"\000\022H\n\tWrit"
+  "ePath\022\033.oram_impl.WritePathRequest\032\034.ora"
+  "m_impl.WritePathResponse\"\000\022I\n\014ReadFullPa"
+  "th\022\032.oram_impl.ReadPathRequest\032\033.oram_im"
+  "pl.ReadPathResponse\"\000\022P\n\rWriteFullPath\022\037"
+  ".oram_impl.WriteFullPathRequest\032\034.oram_i"
+  "mpl.WritePathResponse\"\000\022L\n\016ReadFlatMemor"
+  "y\022\032.oram_impl.ReadFlatRequest\032\034.oram_imp"
+  "l.FlatVectorMessage\"\000\022I\n\017WriteFlatMemory"
+  "\022\034.oram_impl.FlatVectorMessage\032\026.google."
+  "protobuf.Empty\"\000\022S\n\016ReadFlatStream\022 .ora"
+  "m_impl.ReadFlatStreamRequest\032\033.oram_impl"
+  ".FlatChunkMessage\"\0000\001\022J\n\017WriteFlatStream"
+  "\022\033.oram_impl.FlatChunkMessage\032\026.google.p"
+  "rotobuf.Empty\"\000(\001\022F\n\016ReadSqrtMemory\022\032.or"
+  "am_impl.ReadSqrtRequest\032\026.oram_impl.Sqrt"
+  "Message\"\000\022I\n\013ReadShelter\022\035.oram_impl.Rea"
+  "dShelterRequest\032\031.oram_impl.ShelterMessa"
+  "ge\"\000\022H\n\017WriteSqrtMemory\022\033.oram_impl.Writ"
+  "eSqrtMessage\032\026.google.protobuf.Empty\"\000\022M"
+  "\n\022SqrtShuffleControl\022\035.oram_impl.SqrtShu"
+  "ffleRequest\032\026.google.protobuf.Empty\"\000\022O\n"
+  "\rReadSqrtRange\022\037.oram_impl.ReadSqrtRange"
+  "Request\032\033.oram_impl.SqrtRangeMessage\"\000\022L"
+  "\n\016WriteSqrtRange\022 .oram_impl.WriteSqrtRa"
+  "ngeRequest\032\026.google.protobuf.Empty\"\000\022N\n\017"
+  "InitLayeredOram\022!.oram_impl.InitLayeredO"
+  "ramRequest\032\026.google.protobuf.Empty\"\000\022U\n\021"
+  "ReadLayeredBlocks\022\035.oram_impl.ReadLayere"
+  "dRequest\032\037.oram_impl.LayeredBlocksMessag"
+  "e\"\000\022M\n\021WriteLayeredLevel\022\036.oram_impl.Wri"
+  "teLayeredRequest\032\026.google.protobuf.Empty"
+  "\"\000\022R\n\021WriteLayeredRange\022#.oram_impl.Writ"
+  "eLayeredRangeRequest\032\026.google.protobuf.E"
+  "mpty\"\000\022Q\n\023LayeredLevelControl\022 .oram_imp"
+  "l.LayeredControlRequest\032\026.google.protobu"
+  "f.Empty\"\000\022C\n\017CloseConnection\022\026.google.pr"
+  "otobuf.Empty\032\026.google.protobuf.Empty\"\000\022N"
+  "\n\013KeyExchange\022\035.oram_impl.KeyExchangeReq"
+  "uest\032\036.oram_impl.KeyExchangeResponse\"\000\022>"
+  "\n\tSendHello\022\027.oram_impl.HelloMessage\032\026.g"
+  "oogle.protobuf.Empty\"\000\022K\n\027ReportServerIn"
+  "formation\022\026.google.protobuf.Empty\032\026.goog"
+  "le.protobuf.Empty\"\000\022\?\n\013ResetServer\022\026.goo"
+  "gle.protobuf.Empty\032\026.google.protobuf.Emp"
+  "ty\"\000b\006proto3"
   ;
 static const ::_pbi::DescriptorTable* const descriptor_table_messages_2eproto_deps[1] = {
   &::descriptor_table_google_2fprotobuf_2fempty_2eproto,
 };
 static ::_pbi::once_flag descriptor_table_messages_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_messages_2eproto = {
-    false, false, 2897, descriptor_table_protodef_messages_2eproto,
+    false, false, 5252, descriptor_table_protodef_messages_2eproto,
     "messages.proto",
-    &descriptor_table_messages_2eproto_once, descriptor_table_messages_2eproto_deps, 1, 19,
+    &descriptor_table_messages_2eproto_once, descriptor_table_messages_2eproto_deps, 1, 34,
     schemas, file_default_instances, TableStruct_messages_2eproto::offsets,
     file_level_metadata_messages_2eproto, file_level_enum_descriptors_messages_2eproto,
     file_level_service_descriptors_messages_2eproto,
@@ -3245,51 +3695,47 @@ void WriteSqrtMessage::InternalSwap(WriteSqrtMessage* other) {
 
 // ===================================================================
 
-class SqrtPermMessage::_Internal {
+class ReadShelterRequest::_Internal {
  public:
-  static const ::oram_impl::RequestHeader& header(const SqrtPermMessage* msg);
+  static const ::oram_impl::RequestHeader& header(const ReadShelterRequest* msg);
 };
 
 const ::oram_impl::RequestHeader&
-SqrtPermMessage::_Internal::header(const SqrtPermMessage* msg) {
+ReadShelterRequest::_Internal::header(const ReadShelterRequest* msg) {
   return *msg->_impl_.header_;
 }
-SqrtPermMessage::SqrtPermMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+ReadShelterRequest::ReadShelterRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:oram_impl.SqrtPermMessage)
+  // @@protoc_insertion_point(arena_constructor:oram_impl.ReadShelterRequest)
 }
-SqrtPermMessage::SqrtPermMessage(const SqrtPermMessage& from)
+ReadShelterRequest::ReadShelterRequest(const ReadShelterRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SqrtPermMessage* const _this = this; (void)_this;
+  ReadShelterRequest* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.perms_){from._impl_.perms_}
-    , /*decltype(_impl_._perms_cached_byte_size_)*/{0}
-    , decltype(_impl_.header_){nullptr}
+      decltype(_impl_.header_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_header()) {
     _this->_impl_.header_ = new ::oram_impl::RequestHeader(*from._impl_.header_);
   }
-  // @@protoc_insertion_point(copy_constructor:oram_impl.SqrtPermMessage)
+  // @@protoc_insertion_point(copy_constructor:oram_impl.ReadShelterRequest)
 }
 
-inline void SqrtPermMessage::SharedCtor(
+inline void ReadShelterRequest::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.perms_){arena}
-    , /*decltype(_impl_._perms_cached_byte_size_)*/{0}
-    , decltype(_impl_.header_){nullptr}
+      decltype(_impl_.header_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-SqrtPermMessage::~SqrtPermMessage() {
-  // @@protoc_insertion_point(destructor:oram_impl.SqrtPermMessage)
+ReadShelterRequest::~ReadShelterRequest() {
+  // @@protoc_insertion_point(destructor:oram_impl.ReadShelterRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -3297,23 +3743,21 @@ SqrtPermMessage::~SqrtPermMessage() {
   SharedDtor();
 }
 
-inline void SqrtPermMessage::SharedDtor() {
+inline void ReadShelterRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.perms_.~RepeatedField();
   if (this != internal_default_instance()) delete _impl_.header_;
 }
 
-void SqrtPermMessage::SetCachedSize(int size) const {
+void ReadShelterRequest::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SqrtPermMessage::Clear() {
-// @@protoc_insertion_point(message_clear_start:oram_impl.SqrtPermMessage)
+void ReadShelterRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.ReadShelterRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.perms_.Clear();
   if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
     delete _impl_.header_;
   }
@@ -3321,7 +3765,7 @@ void SqrtPermMessage::Clear() {
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SqrtPermMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* ReadShelterRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -3335,17 +3779,6 @@ const char* SqrtPermMessage::_InternalParse(const char* ptr, ::_pbi::ParseContex
         } else
           goto handle_unusual;
         continue;
-      // repeated uint32 perms = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_perms(), ptr, ctx);
-          CHK_(ptr);
-        } else if (static_cast<uint8_t>(tag) == 16) {
-          _internal_add_perms(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -3369,9 +3802,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SqrtPermMessage::_InternalSerialize(
+uint8_t* ReadShelterRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.SqrtPermMessage)
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.ReadShelterRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -3382,45 +3815,22 @@ uint8_t* SqrtPermMessage::_InternalSerialize(
         _Internal::header(this).GetCachedSize(), target, stream);
   }
 
-  // repeated uint32 perms = 2;
-  {
-    int byte_size = _impl_._perms_cached_byte_size_.load(std::memory_order_relaxed);
-    if (byte_size > 0) {
-      target = stream->WriteUInt32Packed(
-          2, _internal_perms(), byte_size, target);
-    }
-  }
-
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.SqrtPermMessage)
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.ReadShelterRequest)
   return target;
 }
 
-size_t SqrtPermMessage::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:oram_impl.SqrtPermMessage)
+size_t ReadShelterRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.ReadShelterRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated uint32 perms = 2;
-  {
-    size_t data_size = ::_pbi::WireFormatLite::
-      UInt32Size(this->_impl_.perms_);
-    if (data_size > 0) {
-      total_size += 1 +
-        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
-    }
-    int cached_size = ::_pbi::ToCachedSize(data_size);
-    _impl_._perms_cached_byte_size_.store(cached_size,
-                                    std::memory_order_relaxed);
-    total_size += data_size;
-  }
-
   // .oram_impl.RequestHeader header = 1;
   if (this->_internal_has_header()) {
     total_size += 1 +
@@ -3431,22 +3841,21 @@ size_t SqrtPermMessage::ByteSizeLong() const {
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SqrtPermMessage::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReadShelterRequest::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SqrtPermMessage::MergeImpl
+    ReadShelterRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SqrtPermMessage::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReadShelterRequest::GetClassData() const { return &_class_data_; }
 
 
-void SqrtPermMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SqrtPermMessage*>(&to_msg);
-  auto& from = static_cast<const SqrtPermMessage&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.SqrtPermMessage)
+void ReadShelterRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReadShelterRequest*>(&to_msg);
+  auto& from = static_cast<const ReadShelterRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.ReadShelterRequest)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.perms_.MergeFrom(from._impl_.perms_);
   if (from._internal_has_header()) {
     _this->_internal_mutable_header()->::oram_impl::RequestHeader::MergeFrom(
         from._internal_header());
@@ -3454,25 +3863,24 @@ void SqrtPermMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SqrtPermMessage::CopyFrom(const SqrtPermMessage& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.SqrtPermMessage)
+void ReadShelterRequest::CopyFrom(const ReadShelterRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.ReadShelterRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SqrtPermMessage::IsInitialized() const {
+bool ReadShelterRequest::IsInitialized() const {
   return true;
 }
 
-void SqrtPermMessage::InternalSwap(SqrtPermMessage* other) {
+void ReadShelterRequest::InternalSwap(ReadShelterRequest* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.perms_.InternalSwap(&other->_impl_.perms_);
   swap(_impl_.header_, other->_impl_.header_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SqrtPermMessage::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ReadShelterRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
       file_level_metadata_messages_2eproto[11]);
@@ -3480,56 +3888,39 @@ void SqrtPermMessage::InternalSwap(SqrtPermMessage* other) {
 
 // ===================================================================
 
-class InitTreeOramRequest::_Internal {
+class ShelterMessage::_Internal {
  public:
-  static const ::oram_impl::RequestHeader& header(const InitTreeOramRequest* msg);
 };
 
-const ::oram_impl::RequestHeader&
-InitTreeOramRequest::_Internal::header(const InitTreeOramRequest* msg) {
-  return *msg->_impl_.header_;
-}
-InitTreeOramRequest::InitTreeOramRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+ShelterMessage::ShelterMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:oram_impl.InitTreeOramRequest)
+  // @@protoc_insertion_point(arena_constructor:oram_impl.ShelterMessage)
 }
-InitTreeOramRequest::InitTreeOramRequest(const InitTreeOramRequest& from)
+ShelterMessage::ShelterMessage(const ShelterMessage& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  InitTreeOramRequest* const _this = this; (void)_this;
+  ShelterMessage* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.header_){nullptr}
-    , decltype(_impl_.bucket_size_){}
-    , decltype(_impl_.bucket_num_){}
-    , decltype(_impl_.block_size_){}
+      decltype(_impl_.contents_){from._impl_.contents_}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_header()) {
-    _this->_impl_.header_ = new ::oram_impl::RequestHeader(*from._impl_.header_);
-  }
-  ::memcpy(&_impl_.bucket_size_, &from._impl_.bucket_size_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.block_size_) -
-    reinterpret_cast<char*>(&_impl_.bucket_size_)) + sizeof(_impl_.block_size_));
-  // @@protoc_insertion_point(copy_constructor:oram_impl.InitTreeOramRequest)
+  // @@protoc_insertion_point(copy_constructor:oram_impl.ShelterMessage)
 }
 
-inline void InitTreeOramRequest::SharedCtor(
+inline void ShelterMessage::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.header_){nullptr}
-    , decltype(_impl_.bucket_size_){0u}
-    , decltype(_impl_.bucket_num_){0u}
-    , decltype(_impl_.block_size_){0u}
+      decltype(_impl_.contents_){arena}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-InitTreeOramRequest::~InitTreeOramRequest() {
-  // @@protoc_insertion_point(destructor:oram_impl.InitTreeOramRequest)
+ShelterMessage::~ShelterMessage() {
+  // @@protoc_insertion_point(destructor:oram_impl.ShelterMessage)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -3537,66 +3928,42 @@ InitTreeOramRequest::~InitTreeOramRequest() {
   SharedDtor();
 }
 
-inline void InitTreeOramRequest::SharedDtor() {
+inline void ShelterMessage::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (this != internal_default_instance()) delete _impl_.header_;
+  _impl_.contents_.~RepeatedPtrField();
 }
 
-void InitTreeOramRequest::SetCachedSize(int size) const {
+void ShelterMessage::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void InitTreeOramRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:oram_impl.InitTreeOramRequest)
+void ShelterMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.ShelterMessage)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
-    delete _impl_.header_;
-  }
-  _impl_.header_ = nullptr;
-  ::memset(&_impl_.bucket_size_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.block_size_) -
-      reinterpret_cast<char*>(&_impl_.bucket_size_)) + sizeof(_impl_.block_size_));
+  _impl_.contents_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* InitTreeOramRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* ShelterMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .oram_impl.RequestHeader header = 1;
+      // repeated bytes contents = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // uint32 bucket_size = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
-          _impl_.bucket_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // uint32 bucket_num = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          _impl_.bucket_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // uint32 block_size = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
-          _impl_.block_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_contents();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else
           goto handle_unusual;
         continue;
@@ -3623,132 +3990,82 @@ failure:
 #undef CHK_
 }
 
-uint8_t* InitTreeOramRequest::_InternalSerialize(
+uint8_t* ShelterMessage::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.InitTreeOramRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.ShelterMessage)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .oram_impl.RequestHeader header = 1;
-  if (this->_internal_has_header()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, _Internal::header(this),
-        _Internal::header(this).GetCachedSize(), target, stream);
-  }
-
-  // uint32 bucket_size = 2;
-  if (this->_internal_bucket_size() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_bucket_size(), target);
-  }
-
-  // uint32 bucket_num = 3;
-  if (this->_internal_bucket_num() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_bucket_num(), target);
-  }
-
-  // uint32 block_size = 4;
-  if (this->_internal_block_size() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_block_size(), target);
+  // repeated bytes contents = 1;
+  for (int i = 0, n = this->_internal_contents_size(); i < n; i++) {
+    const auto& s = this->_internal_contents(i);
+    target = stream->WriteBytes(1, s, target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.InitTreeOramRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.ShelterMessage)
   return target;
 }
 
-size_t InitTreeOramRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:oram_impl.InitTreeOramRequest)
+size_t ShelterMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.ShelterMessage)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .oram_impl.RequestHeader header = 1;
-  if (this->_internal_has_header()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.header_);
-  }
-
-  // uint32 bucket_size = 2;
-  if (this->_internal_bucket_size() != 0) {
-    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_bucket_size());
-  }
-
-  // uint32 bucket_num = 3;
-  if (this->_internal_bucket_num() != 0) {
-    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_bucket_num());
-  }
-
-  // uint32 block_size = 4;
-  if (this->_internal_block_size() != 0) {
-    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_block_size());
+  // repeated bytes contents = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.contents_.size());
+  for (int i = 0, n = _impl_.contents_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.contents_.Get(i));
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InitTreeOramRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ShelterMessage::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    InitTreeOramRequest::MergeImpl
+    ShelterMessage::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InitTreeOramRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ShelterMessage::GetClassData() const { return &_class_data_; }
 
 
-void InitTreeOramRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<InitTreeOramRequest*>(&to_msg);
-  auto& from = static_cast<const InitTreeOramRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.InitTreeOramRequest)
+void ShelterMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ShelterMessage*>(&to_msg);
+  auto& from = static_cast<const ShelterMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.ShelterMessage)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_header()) {
-    _this->_internal_mutable_header()->::oram_impl::RequestHeader::MergeFrom(
-        from._internal_header());
-  }
-  if (from._internal_bucket_size() != 0) {
-    _this->_internal_set_bucket_size(from._internal_bucket_size());
-  }
-  if (from._internal_bucket_num() != 0) {
-    _this->_internal_set_bucket_num(from._internal_bucket_num());
-  }
-  if (from._internal_block_size() != 0) {
-    _this->_internal_set_block_size(from._internal_block_size());
-  }
+  _this->_impl_.contents_.MergeFrom(from._impl_.contents_);
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void InitTreeOramRequest::CopyFrom(const InitTreeOramRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.InitTreeOramRequest)
+void ShelterMessage::CopyFrom(const ShelterMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.ShelterMessage)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool InitTreeOramRequest::IsInitialized() const {
+bool ShelterMessage::IsInitialized() const {
   return true;
 }
 
-void InitTreeOramRequest::InternalSwap(InitTreeOramRequest* other) {
+void ShelterMessage::InternalSwap(ShelterMessage* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(InitTreeOramRequest, _impl_.block_size_)
-      + sizeof(InitTreeOramRequest::_impl_.block_size_)
-      - PROTOBUF_FIELD_OFFSET(InitTreeOramRequest, _impl_.header_)>(
-          reinterpret_cast<char*>(&_impl_.header_),
-          reinterpret_cast<char*>(&other->_impl_.header_));
+  _impl_.contents_.InternalSwap(&other->_impl_.contents_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata InitTreeOramRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ShelterMessage::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
       file_level_metadata_messages_2eproto[12]);
@@ -3756,47 +4073,54 @@ void InitTreeOramRequest::InternalSwap(InitTreeOramRequest* other) {
 
 // ===================================================================
 
-class ReadFlatRequest::_Internal {
+class SqrtShuffleRequest::_Internal {
  public:
-  static const ::oram_impl::RequestHeader& header(const ReadFlatRequest* msg);
+  static const ::oram_impl::RequestHeader& header(const SqrtShuffleRequest* msg);
 };
 
 const ::oram_impl::RequestHeader&
-ReadFlatRequest::_Internal::header(const ReadFlatRequest* msg) {
+SqrtShuffleRequest::_Internal::header(const SqrtShuffleRequest* msg) {
   return *msg->_impl_.header_;
 }
-ReadFlatRequest::ReadFlatRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+SqrtShuffleRequest::SqrtShuffleRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:oram_impl.ReadFlatRequest)
+  // @@protoc_insertion_point(arena_constructor:oram_impl.SqrtShuffleRequest)
 }
-ReadFlatRequest::ReadFlatRequest(const ReadFlatRequest& from)
+SqrtShuffleRequest::SqrtShuffleRequest(const SqrtShuffleRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  ReadFlatRequest* const _this = this; (void)_this;
+  SqrtShuffleRequest* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.temp_size_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_header()) {
     _this->_impl_.header_ = new ::oram_impl::RequestHeader(*from._impl_.header_);
   }
-  // @@protoc_insertion_point(copy_constructor:oram_impl.ReadFlatRequest)
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.temp_size_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.temp_size_));
+  // @@protoc_insertion_point(copy_constructor:oram_impl.SqrtShuffleRequest)
 }
 
-inline void ReadFlatRequest::SharedCtor(
+inline void SqrtShuffleRequest::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.type_){0u}
+    , decltype(_impl_.temp_size_){0u}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-ReadFlatRequest::~ReadFlatRequest() {
-  // @@protoc_insertion_point(destructor:oram_impl.ReadFlatRequest)
+SqrtShuffleRequest::~SqrtShuffleRequest() {
+  // @@protoc_insertion_point(destructor:oram_impl.SqrtShuffleRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -3804,17 +4128,17 @@ ReadFlatRequest::~ReadFlatRequest() {
   SharedDtor();
 }
 
-inline void ReadFlatRequest::SharedDtor() {
+inline void SqrtShuffleRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   if (this != internal_default_instance()) delete _impl_.header_;
 }
 
-void ReadFlatRequest::SetCachedSize(int size) const {
+void SqrtShuffleRequest::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void ReadFlatRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:oram_impl.ReadFlatRequest)
+void SqrtShuffleRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.SqrtShuffleRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
@@ -3823,10 +4147,13 @@ void ReadFlatRequest::Clear() {
     delete _impl_.header_;
   }
   _impl_.header_ = nullptr;
+  ::memset(&_impl_.type_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.temp_size_) -
+      reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.temp_size_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ReadFlatRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* SqrtShuffleRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -3840,6 +4167,22 @@ const char* ReadFlatRequest::_InternalParse(const char* ptr, ::_pbi::ParseContex
         } else
           goto handle_unusual;
         continue;
+      // uint32 type = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 temp_size = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.temp_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -3863,9 +4206,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ReadFlatRequest::_InternalSerialize(
+uint8_t* SqrtShuffleRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.ReadFlatRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.SqrtShuffleRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -3876,16 +4219,28 @@ uint8_t* ReadFlatRequest::_InternalSerialize(
         _Internal::header(this).GetCachedSize(), target, stream);
   }
 
+  // uint32 type = 2;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_type(), target);
+  }
+
+  // uint32 temp_size = 3;
+  if (this->_internal_temp_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_temp_size(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.ReadFlatRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.SqrtShuffleRequest)
   return target;
 }
 
-size_t ReadFlatRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:oram_impl.ReadFlatRequest)
+size_t SqrtShuffleRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.SqrtShuffleRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
@@ -3899,20 +4254,30 @@ size_t ReadFlatRequest::ByteSizeLong() const {
         *_impl_.header_);
   }
 
+  // uint32 type = 2;
+  if (this->_internal_type() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_type());
+  }
+
+  // uint32 temp_size = 3;
+  if (this->_internal_temp_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_temp_size());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReadFlatRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SqrtShuffleRequest::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ReadFlatRequest::MergeImpl
+    SqrtShuffleRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReadFlatRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SqrtShuffleRequest::GetClassData() const { return &_class_data_; }
 
 
-void ReadFlatRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ReadFlatRequest*>(&to_msg);
-  auto& from = static_cast<const ReadFlatRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.ReadFlatRequest)
+void SqrtShuffleRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SqrtShuffleRequest*>(&to_msg);
+  auto& from = static_cast<const SqrtShuffleRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.SqrtShuffleRequest)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -3921,27 +4286,38 @@ void ReadFlatRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
     _this->_internal_mutable_header()->::oram_impl::RequestHeader::MergeFrom(
         from._internal_header());
   }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  if (from._internal_temp_size() != 0) {
+    _this->_internal_set_temp_size(from._internal_temp_size());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ReadFlatRequest::CopyFrom(const ReadFlatRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.ReadFlatRequest)
+void SqrtShuffleRequest::CopyFrom(const SqrtShuffleRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.SqrtShuffleRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ReadFlatRequest::IsInitialized() const {
+bool SqrtShuffleRequest::IsInitialized() const {
   return true;
 }
 
-void ReadFlatRequest::InternalSwap(ReadFlatRequest* other) {
+void SqrtShuffleRequest::InternalSwap(SqrtShuffleRequest* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.header_, other->_impl_.header_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SqrtShuffleRequest, _impl_.temp_size_)
+      + sizeof(SqrtShuffleRequest::_impl_.temp_size_)
+      - PROTOBUF_FIELD_OFFSET(SqrtShuffleRequest, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ReadFlatRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata SqrtShuffleRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
       file_level_metadata_messages_2eproto[13]);
@@ -3949,54 +4325,58 @@ void ReadFlatRequest::InternalSwap(ReadFlatRequest* other) {
 
 // ===================================================================
 
-class ReadSqrtRequest::_Internal {
+class ReadSqrtRangeRequest::_Internal {
  public:
-  static const ::oram_impl::RequestHeader& header(const ReadSqrtRequest* msg);
+  static const ::oram_impl::RequestHeader& header(const ReadSqrtRangeRequest* msg);
 };
 
 const ::oram_impl::RequestHeader&
-ReadSqrtRequest::_Internal::header(const ReadSqrtRequest* msg) {
+ReadSqrtRangeRequest::_Internal::header(const ReadSqrtRangeRequest* msg) {
   return *msg->_impl_.header_;
 }
-ReadSqrtRequest::ReadSqrtRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+ReadSqrtRangeRequest::ReadSqrtRangeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:oram_impl.ReadSqrtRequest)
+  // @@protoc_insertion_point(arena_constructor:oram_impl.ReadSqrtRangeRequest)
 }
-ReadSqrtRequest::ReadSqrtRequest(const ReadSqrtRequest& from)
+ReadSqrtRangeRequest::ReadSqrtRangeRequest(const ReadSqrtRangeRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  ReadSqrtRequest* const _this = this; (void)_this;
+  ReadSqrtRangeRequest* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.header_){nullptr}
-    , decltype(_impl_.tag_){}
-    , decltype(_impl_.read_from_){}
+      decltype(_impl_.offsets_){from._impl_.offsets_}
+    , /*decltype(_impl_._offsets_cached_byte_size_)*/{0}
+    , decltype(_impl_.lengths_){from._impl_.lengths_}
+    , /*decltype(_impl_._lengths_cached_byte_size_)*/{0}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.area_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_header()) {
     _this->_impl_.header_ = new ::oram_impl::RequestHeader(*from._impl_.header_);
   }
-  ::memcpy(&_impl_.tag_, &from._impl_.tag_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.read_from_) -
-    reinterpret_cast<char*>(&_impl_.tag_)) + sizeof(_impl_.read_from_));
-  // @@protoc_insertion_point(copy_constructor:oram_impl.ReadSqrtRequest)
+  _this->_impl_.area_ = from._impl_.area_;
+  // @@protoc_insertion_point(copy_constructor:oram_impl.ReadSqrtRangeRequest)
 }
 
-inline void ReadSqrtRequest::SharedCtor(
+inline void ReadSqrtRangeRequest::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.header_){nullptr}
-    , decltype(_impl_.tag_){0u}
-    , decltype(_impl_.read_from_){0u}
+      decltype(_impl_.offsets_){arena}
+    , /*decltype(_impl_._offsets_cached_byte_size_)*/{0}
+    , decltype(_impl_.lengths_){arena}
+    , /*decltype(_impl_._lengths_cached_byte_size_)*/{0}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.area_){0u}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-ReadSqrtRequest::~ReadSqrtRequest() {
-  // @@protoc_insertion_point(destructor:oram_impl.ReadSqrtRequest)
+ReadSqrtRangeRequest::~ReadSqrtRangeRequest() {
+  // @@protoc_insertion_point(destructor:oram_impl.ReadSqrtRangeRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -4004,32 +4384,34 @@ ReadSqrtRequest::~ReadSqrtRequest() {
   SharedDtor();
 }
 
-inline void ReadSqrtRequest::SharedDtor() {
+inline void ReadSqrtRangeRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.offsets_.~RepeatedField();
+  _impl_.lengths_.~RepeatedField();
   if (this != internal_default_instance()) delete _impl_.header_;
 }
 
-void ReadSqrtRequest::SetCachedSize(int size) const {
+void ReadSqrtRangeRequest::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void ReadSqrtRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:oram_impl.ReadSqrtRequest)
+void ReadSqrtRangeRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.ReadSqrtRangeRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  _impl_.offsets_.Clear();
+  _impl_.lengths_.Clear();
   if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
     delete _impl_.header_;
   }
   _impl_.header_ = nullptr;
-  ::memset(&_impl_.tag_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.read_from_) -
-      reinterpret_cast<char*>(&_impl_.tag_)) + sizeof(_impl_.read_from_));
+  _impl_.area_ = 0u;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ReadSqrtRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* ReadSqrtRangeRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -4043,18 +4425,32 @@ const char* ReadSqrtRequest::_InternalParse(const char* ptr, ::_pbi::ParseContex
         } else
           goto handle_unusual;
         continue;
-      // uint32 tag = 2;
+      // uint32 area = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
-          _impl_.tag_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.area_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // uint32 read_from = 3;
+      // repeated uint32 offsets = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          _impl_.read_from_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_offsets(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 24) {
+          _internal_add_offsets(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 lengths = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_lengths(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_lengths(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -4082,9 +4478,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ReadSqrtRequest::_InternalSerialize(
+uint8_t* ReadSqrtRangeRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.ReadSqrtRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.ReadSqrtRangeRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -4095,16 +4491,3409 @@ uint8_t* ReadSqrtRequest::_InternalSerialize(
         _Internal::header(this).GetCachedSize(), target, stream);
   }
 
-  // uint32 tag = 2;
-  if (this->_internal_tag() != 0) {
+  // uint32 area = 2;
+  if (this->_internal_area() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_tag(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_area(), target);
   }
 
-  // uint32 read_from = 3;
-  if (this->_internal_read_from() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_read_from(), target);
+  // repeated uint32 offsets = 3;
+  {
+    int byte_size = _impl_._offsets_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          3, _internal_offsets(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 lengths = 4;
+  {
+    int byte_size = _impl_._lengths_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          4, _internal_lengths(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.ReadSqrtRangeRequest)
+  return target;
+}
+
+size_t ReadSqrtRangeRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.ReadSqrtRangeRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 offsets = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.offsets_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._offsets_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 lengths = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.lengths_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._lengths_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  // uint32 area = 2;
+  if (this->_internal_area() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_area());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReadSqrtRangeRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReadSqrtRangeRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReadSqrtRangeRequest::GetClassData() const { return &_class_data_; }
+
+
+void ReadSqrtRangeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReadSqrtRangeRequest*>(&to_msg);
+  auto& from = static_cast<const ReadSqrtRangeRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.ReadSqrtRangeRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.offsets_.MergeFrom(from._impl_.offsets_);
+  _this->_impl_.lengths_.MergeFrom(from._impl_.lengths_);
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::oram_impl::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_area() != 0) {
+    _this->_internal_set_area(from._internal_area());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReadSqrtRangeRequest::CopyFrom(const ReadSqrtRangeRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.ReadSqrtRangeRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReadSqrtRangeRequest::IsInitialized() const {
+  return true;
+}
+
+void ReadSqrtRangeRequest::InternalSwap(ReadSqrtRangeRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.offsets_.InternalSwap(&other->_impl_.offsets_);
+  _impl_.lengths_.InternalSwap(&other->_impl_.lengths_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReadSqrtRangeRequest, _impl_.area_)
+      + sizeof(ReadSqrtRangeRequest::_impl_.area_)
+      - PROTOBUF_FIELD_OFFSET(ReadSqrtRangeRequest, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReadSqrtRangeRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[14]);
+}
+
+// ===================================================================
+
+class SqrtRangeMessage::_Internal {
+ public:
+};
+
+SqrtRangeMessage::SqrtRangeMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:oram_impl.SqrtRangeMessage)
+}
+SqrtRangeMessage::SqrtRangeMessage(const SqrtRangeMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SqrtRangeMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.contents_){from._impl_.contents_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:oram_impl.SqrtRangeMessage)
+}
+
+inline void SqrtRangeMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.contents_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SqrtRangeMessage::~SqrtRangeMessage() {
+  // @@protoc_insertion_point(destructor:oram_impl.SqrtRangeMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SqrtRangeMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.contents_.~RepeatedPtrField();
+}
+
+void SqrtRangeMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SqrtRangeMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.SqrtRangeMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.contents_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SqrtRangeMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated bytes contents = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_contents();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SqrtRangeMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.SqrtRangeMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated bytes contents = 1;
+  for (int i = 0, n = this->_internal_contents_size(); i < n; i++) {
+    const auto& s = this->_internal_contents(i);
+    target = stream->WriteBytes(1, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.SqrtRangeMessage)
+  return target;
+}
+
+size_t SqrtRangeMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.SqrtRangeMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes contents = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.contents_.size());
+  for (int i = 0, n = _impl_.contents_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.contents_.Get(i));
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SqrtRangeMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SqrtRangeMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SqrtRangeMessage::GetClassData() const { return &_class_data_; }
+
+
+void SqrtRangeMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SqrtRangeMessage*>(&to_msg);
+  auto& from = static_cast<const SqrtRangeMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.SqrtRangeMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.contents_.MergeFrom(from._impl_.contents_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SqrtRangeMessage::CopyFrom(const SqrtRangeMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.SqrtRangeMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SqrtRangeMessage::IsInitialized() const {
+  return true;
+}
+
+void SqrtRangeMessage::InternalSwap(SqrtRangeMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.contents_.InternalSwap(&other->_impl_.contents_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SqrtRangeMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[15]);
+}
+
+// ===================================================================
+
+class WriteSqrtRangeRequest::_Internal {
+ public:
+  static const ::oram_impl::RequestHeader& header(const WriteSqrtRangeRequest* msg);
+};
+
+const ::oram_impl::RequestHeader&
+WriteSqrtRangeRequest::_Internal::header(const WriteSqrtRangeRequest* msg) {
+  return *msg->_impl_.header_;
+}
+WriteSqrtRangeRequest::WriteSqrtRangeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:oram_impl.WriteSqrtRangeRequest)
+}
+WriteSqrtRangeRequest::WriteSqrtRangeRequest(const WriteSqrtRangeRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WriteSqrtRangeRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.contents_){from._impl_.contents_}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.area_){}
+    , decltype(_impl_.offset_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::oram_impl::RequestHeader(*from._impl_.header_);
+  }
+  ::memcpy(&_impl_.area_, &from._impl_.area_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.offset_) -
+    reinterpret_cast<char*>(&_impl_.area_)) + sizeof(_impl_.offset_));
+  // @@protoc_insertion_point(copy_constructor:oram_impl.WriteSqrtRangeRequest)
+}
+
+inline void WriteSqrtRangeRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.contents_){arena}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.area_){0u}
+    , decltype(_impl_.offset_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+WriteSqrtRangeRequest::~WriteSqrtRangeRequest() {
+  // @@protoc_insertion_point(destructor:oram_impl.WriteSqrtRangeRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WriteSqrtRangeRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.contents_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void WriteSqrtRangeRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WriteSqrtRangeRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.WriteSqrtRangeRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.contents_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  ::memset(&_impl_.area_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.offset_) -
+      reinterpret_cast<char*>(&_impl_.area_)) + sizeof(_impl_.offset_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WriteSqrtRangeRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .oram_impl.RequestHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 area = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.area_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 offset = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes contents = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_contents();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WriteSqrtRangeRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.WriteSqrtRangeRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 area = 2;
+  if (this->_internal_area() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_area(), target);
+  }
+
+  // uint32 offset = 3;
+  if (this->_internal_offset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_offset(), target);
+  }
+
+  // repeated bytes contents = 4;
+  for (int i = 0, n = this->_internal_contents_size(); i < n; i++) {
+    const auto& s = this->_internal_contents(i);
+    target = stream->WriteBytes(4, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.WriteSqrtRangeRequest)
+  return target;
+}
+
+size_t WriteSqrtRangeRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.WriteSqrtRangeRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes contents = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.contents_.size());
+  for (int i = 0, n = _impl_.contents_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.contents_.Get(i));
+  }
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  // uint32 area = 2;
+  if (this->_internal_area() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_area());
+  }
+
+  // uint32 offset = 3;
+  if (this->_internal_offset() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_offset());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WriteSqrtRangeRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WriteSqrtRangeRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WriteSqrtRangeRequest::GetClassData() const { return &_class_data_; }
+
+
+void WriteSqrtRangeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WriteSqrtRangeRequest*>(&to_msg);
+  auto& from = static_cast<const WriteSqrtRangeRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.WriteSqrtRangeRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.contents_.MergeFrom(from._impl_.contents_);
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::oram_impl::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_area() != 0) {
+    _this->_internal_set_area(from._internal_area());
+  }
+  if (from._internal_offset() != 0) {
+    _this->_internal_set_offset(from._internal_offset());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WriteSqrtRangeRequest::CopyFrom(const WriteSqrtRangeRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.WriteSqrtRangeRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WriteSqrtRangeRequest::IsInitialized() const {
+  return true;
+}
+
+void WriteSqrtRangeRequest::InternalSwap(WriteSqrtRangeRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.contents_.InternalSwap(&other->_impl_.contents_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WriteSqrtRangeRequest, _impl_.offset_)
+      + sizeof(WriteSqrtRangeRequest::_impl_.offset_)
+      - PROTOBUF_FIELD_OFFSET(WriteSqrtRangeRequest, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WriteSqrtRangeRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[16]);
+}
+
+// ===================================================================
+
+class InitLayeredOramRequest::_Internal {
+ public:
+  static const ::oram_impl::RequestHeader& header(const InitLayeredOramRequest* msg);
+};
+
+const ::oram_impl::RequestHeader&
+InitLayeredOramRequest::_Internal::header(const InitLayeredOramRequest* msg) {
+  return *msg->_impl_.header_;
+}
+InitLayeredOramRequest::InitLayeredOramRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:oram_impl.InitLayeredOramRequest)
+}
+InitLayeredOramRequest::InitLayeredOramRequest(const InitLayeredOramRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  InitLayeredOramRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.level_num_){}
+    , decltype(_impl_.block_size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::oram_impl::RequestHeader(*from._impl_.header_);
+  }
+  ::memcpy(&_impl_.level_num_, &from._impl_.level_num_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.block_size_) -
+    reinterpret_cast<char*>(&_impl_.level_num_)) + sizeof(_impl_.block_size_));
+  // @@protoc_insertion_point(copy_constructor:oram_impl.InitLayeredOramRequest)
+}
+
+inline void InitLayeredOramRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.level_num_){0u}
+    , decltype(_impl_.block_size_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+InitLayeredOramRequest::~InitLayeredOramRequest() {
+  // @@protoc_insertion_point(destructor:oram_impl.InitLayeredOramRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void InitLayeredOramRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void InitLayeredOramRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void InitLayeredOramRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.InitLayeredOramRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  ::memset(&_impl_.level_num_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.block_size_) -
+      reinterpret_cast<char*>(&_impl_.level_num_)) + sizeof(_impl_.block_size_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* InitLayeredOramRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .oram_impl.RequestHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 level_num = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.level_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 block_size = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.block_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* InitLayeredOramRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.InitLayeredOramRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 level_num = 2;
+  if (this->_internal_level_num() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_level_num(), target);
+  }
+
+  // uint32 block_size = 3;
+  if (this->_internal_block_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_block_size(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.InitLayeredOramRequest)
+  return target;
+}
+
+size_t InitLayeredOramRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.InitLayeredOramRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  // uint32 level_num = 2;
+  if (this->_internal_level_num() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_level_num());
+  }
+
+  // uint32 block_size = 3;
+  if (this->_internal_block_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_block_size());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InitLayeredOramRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    InitLayeredOramRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InitLayeredOramRequest::GetClassData() const { return &_class_data_; }
+
+
+void InitLayeredOramRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<InitLayeredOramRequest*>(&to_msg);
+  auto& from = static_cast<const InitLayeredOramRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.InitLayeredOramRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::oram_impl::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_level_num() != 0) {
+    _this->_internal_set_level_num(from._internal_level_num());
+  }
+  if (from._internal_block_size() != 0) {
+    _this->_internal_set_block_size(from._internal_block_size());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void InitLayeredOramRequest::CopyFrom(const InitLayeredOramRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.InitLayeredOramRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool InitLayeredOramRequest::IsInitialized() const {
+  return true;
+}
+
+void InitLayeredOramRequest::InternalSwap(InitLayeredOramRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(InitLayeredOramRequest, _impl_.block_size_)
+      + sizeof(InitLayeredOramRequest::_impl_.block_size_)
+      - PROTOBUF_FIELD_OFFSET(InitLayeredOramRequest, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata InitLayeredOramRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[17]);
+}
+
+// ===================================================================
+
+class ReadLayeredRequest::_Internal {
+ public:
+  static const ::oram_impl::RequestHeader& header(const ReadLayeredRequest* msg);
+};
+
+const ::oram_impl::RequestHeader&
+ReadLayeredRequest::_Internal::header(const ReadLayeredRequest* msg) {
+  return *msg->_impl_.header_;
+}
+ReadLayeredRequest::ReadLayeredRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:oram_impl.ReadLayeredRequest)
+}
+ReadLayeredRequest::ReadLayeredRequest(const ReadLayeredRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReadLayeredRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.levels_){from._impl_.levels_}
+    , /*decltype(_impl_._levels_cached_byte_size_)*/{0}
+    , decltype(_impl_.offsets_){from._impl_.offsets_}
+    , /*decltype(_impl_._offsets_cached_byte_size_)*/{0}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::oram_impl::RequestHeader(*from._impl_.header_);
+  }
+  // @@protoc_insertion_point(copy_constructor:oram_impl.ReadLayeredRequest)
+}
+
+inline void ReadLayeredRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.levels_){arena}
+    , /*decltype(_impl_._levels_cached_byte_size_)*/{0}
+    , decltype(_impl_.offsets_){arena}
+    , /*decltype(_impl_._offsets_cached_byte_size_)*/{0}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ReadLayeredRequest::~ReadLayeredRequest() {
+  // @@protoc_insertion_point(destructor:oram_impl.ReadLayeredRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReadLayeredRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.levels_.~RepeatedField();
+  _impl_.offsets_.~RepeatedField();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void ReadLayeredRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReadLayeredRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.ReadLayeredRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.levels_.Clear();
+  _impl_.offsets_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReadLayeredRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .oram_impl.RequestHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 levels = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_levels(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_levels(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 offsets = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_offsets(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 24) {
+          _internal_add_offsets(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReadLayeredRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.ReadLayeredRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated uint32 levels = 2;
+  {
+    int byte_size = _impl_._levels_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          2, _internal_levels(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 offsets = 3;
+  {
+    int byte_size = _impl_._offsets_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          3, _internal_offsets(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.ReadLayeredRequest)
+  return target;
+}
+
+size_t ReadLayeredRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.ReadLayeredRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 levels = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.levels_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._levels_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 offsets = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.offsets_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._offsets_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReadLayeredRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReadLayeredRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReadLayeredRequest::GetClassData() const { return &_class_data_; }
+
+
+void ReadLayeredRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReadLayeredRequest*>(&to_msg);
+  auto& from = static_cast<const ReadLayeredRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.ReadLayeredRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.levels_.MergeFrom(from._impl_.levels_);
+  _this->_impl_.offsets_.MergeFrom(from._impl_.offsets_);
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::oram_impl::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReadLayeredRequest::CopyFrom(const ReadLayeredRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.ReadLayeredRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReadLayeredRequest::IsInitialized() const {
+  return true;
+}
+
+void ReadLayeredRequest::InternalSwap(ReadLayeredRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.levels_.InternalSwap(&other->_impl_.levels_);
+  _impl_.offsets_.InternalSwap(&other->_impl_.offsets_);
+  swap(_impl_.header_, other->_impl_.header_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReadLayeredRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[18]);
+}
+
+// ===================================================================
+
+class LayeredBlocksMessage::_Internal {
+ public:
+};
+
+LayeredBlocksMessage::LayeredBlocksMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:oram_impl.LayeredBlocksMessage)
+}
+LayeredBlocksMessage::LayeredBlocksMessage(const LayeredBlocksMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LayeredBlocksMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.contents_){from._impl_.contents_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:oram_impl.LayeredBlocksMessage)
+}
+
+inline void LayeredBlocksMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.contents_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+LayeredBlocksMessage::~LayeredBlocksMessage() {
+  // @@protoc_insertion_point(destructor:oram_impl.LayeredBlocksMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LayeredBlocksMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.contents_.~RepeatedPtrField();
+}
+
+void LayeredBlocksMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LayeredBlocksMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.LayeredBlocksMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.contents_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LayeredBlocksMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated bytes contents = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_contents();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LayeredBlocksMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.LayeredBlocksMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated bytes contents = 1;
+  for (int i = 0, n = this->_internal_contents_size(); i < n; i++) {
+    const auto& s = this->_internal_contents(i);
+    target = stream->WriteBytes(1, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.LayeredBlocksMessage)
+  return target;
+}
+
+size_t LayeredBlocksMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.LayeredBlocksMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes contents = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.contents_.size());
+  for (int i = 0, n = _impl_.contents_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.contents_.Get(i));
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LayeredBlocksMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LayeredBlocksMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LayeredBlocksMessage::GetClassData() const { return &_class_data_; }
+
+
+void LayeredBlocksMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LayeredBlocksMessage*>(&to_msg);
+  auto& from = static_cast<const LayeredBlocksMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.LayeredBlocksMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.contents_.MergeFrom(from._impl_.contents_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LayeredBlocksMessage::CopyFrom(const LayeredBlocksMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.LayeredBlocksMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LayeredBlocksMessage::IsInitialized() const {
+  return true;
+}
+
+void LayeredBlocksMessage::InternalSwap(LayeredBlocksMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.contents_.InternalSwap(&other->_impl_.contents_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LayeredBlocksMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[19]);
+}
+
+// ===================================================================
+
+class WriteLayeredRequest::_Internal {
+ public:
+  static const ::oram_impl::RequestHeader& header(const WriteLayeredRequest* msg);
+};
+
+const ::oram_impl::RequestHeader&
+WriteLayeredRequest::_Internal::header(const WriteLayeredRequest* msg) {
+  return *msg->_impl_.header_;
+}
+WriteLayeredRequest::WriteLayeredRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:oram_impl.WriteLayeredRequest)
+}
+WriteLayeredRequest::WriteLayeredRequest(const WriteLayeredRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WriteLayeredRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.contents_){from._impl_.contents_}
+    , decltype(_impl_.cleared_levels_){from._impl_.cleared_levels_}
+    , /*decltype(_impl_._cleared_levels_cached_byte_size_)*/{0}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.level_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::oram_impl::RequestHeader(*from._impl_.header_);
+  }
+  _this->_impl_.level_ = from._impl_.level_;
+  // @@protoc_insertion_point(copy_constructor:oram_impl.WriteLayeredRequest)
+}
+
+inline void WriteLayeredRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.contents_){arena}
+    , decltype(_impl_.cleared_levels_){arena}
+    , /*decltype(_impl_._cleared_levels_cached_byte_size_)*/{0}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.level_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+WriteLayeredRequest::~WriteLayeredRequest() {
+  // @@protoc_insertion_point(destructor:oram_impl.WriteLayeredRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WriteLayeredRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.contents_.~RepeatedPtrField();
+  _impl_.cleared_levels_.~RepeatedField();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void WriteLayeredRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WriteLayeredRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.WriteLayeredRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.contents_.Clear();
+  _impl_.cleared_levels_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  _impl_.level_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WriteLayeredRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .oram_impl.RequestHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 level = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.level_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes contents = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_contents();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 cleared_levels = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_cleared_levels(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_cleared_levels(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WriteLayeredRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.WriteLayeredRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 level = 2;
+  if (this->_internal_level() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_level(), target);
+  }
+
+  // repeated bytes contents = 3;
+  for (int i = 0, n = this->_internal_contents_size(); i < n; i++) {
+    const auto& s = this->_internal_contents(i);
+    target = stream->WriteBytes(3, s, target);
+  }
+
+  // repeated uint32 cleared_levels = 4;
+  {
+    int byte_size = _impl_._cleared_levels_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          4, _internal_cleared_levels(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.WriteLayeredRequest)
+  return target;
+}
+
+size_t WriteLayeredRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.WriteLayeredRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes contents = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.contents_.size());
+  for (int i = 0, n = _impl_.contents_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.contents_.Get(i));
+  }
+
+  // repeated uint32 cleared_levels = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.cleared_levels_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._cleared_levels_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  // uint32 level = 2;
+  if (this->_internal_level() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_level());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WriteLayeredRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WriteLayeredRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WriteLayeredRequest::GetClassData() const { return &_class_data_; }
+
+
+void WriteLayeredRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WriteLayeredRequest*>(&to_msg);
+  auto& from = static_cast<const WriteLayeredRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.WriteLayeredRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.contents_.MergeFrom(from._impl_.contents_);
+  _this->_impl_.cleared_levels_.MergeFrom(from._impl_.cleared_levels_);
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::oram_impl::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_level() != 0) {
+    _this->_internal_set_level(from._internal_level());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WriteLayeredRequest::CopyFrom(const WriteLayeredRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.WriteLayeredRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WriteLayeredRequest::IsInitialized() const {
+  return true;
+}
+
+void WriteLayeredRequest::InternalSwap(WriteLayeredRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.contents_.InternalSwap(&other->_impl_.contents_);
+  _impl_.cleared_levels_.InternalSwap(&other->_impl_.cleared_levels_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WriteLayeredRequest, _impl_.level_)
+      + sizeof(WriteLayeredRequest::_impl_.level_)
+      - PROTOBUF_FIELD_OFFSET(WriteLayeredRequest, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WriteLayeredRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[20]);
+}
+
+// ===================================================================
+
+class WriteLayeredRangeRequest::_Internal {
+ public:
+  static const ::oram_impl::RequestHeader& header(const WriteLayeredRangeRequest* msg);
+};
+
+const ::oram_impl::RequestHeader&
+WriteLayeredRangeRequest::_Internal::header(const WriteLayeredRangeRequest* msg) {
+  return *msg->_impl_.header_;
+}
+WriteLayeredRangeRequest::WriteLayeredRangeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:oram_impl.WriteLayeredRangeRequest)
+}
+WriteLayeredRangeRequest::WriteLayeredRangeRequest(const WriteLayeredRangeRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WriteLayeredRangeRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.contents_){from._impl_.contents_}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.level_){}
+    , decltype(_impl_.offset_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::oram_impl::RequestHeader(*from._impl_.header_);
+  }
+  ::memcpy(&_impl_.level_, &from._impl_.level_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.offset_) -
+    reinterpret_cast<char*>(&_impl_.level_)) + sizeof(_impl_.offset_));
+  // @@protoc_insertion_point(copy_constructor:oram_impl.WriteLayeredRangeRequest)
+}
+
+inline void WriteLayeredRangeRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.contents_){arena}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.level_){0u}
+    , decltype(_impl_.offset_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+WriteLayeredRangeRequest::~WriteLayeredRangeRequest() {
+  // @@protoc_insertion_point(destructor:oram_impl.WriteLayeredRangeRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WriteLayeredRangeRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.contents_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void WriteLayeredRangeRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WriteLayeredRangeRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.WriteLayeredRangeRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.contents_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  ::memset(&_impl_.level_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.offset_) -
+      reinterpret_cast<char*>(&_impl_.level_)) + sizeof(_impl_.offset_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WriteLayeredRangeRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .oram_impl.RequestHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 level = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.level_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 offset = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes contents = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_contents();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WriteLayeredRangeRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.WriteLayeredRangeRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 level = 2;
+  if (this->_internal_level() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_level(), target);
+  }
+
+  // uint32 offset = 3;
+  if (this->_internal_offset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_offset(), target);
+  }
+
+  // repeated bytes contents = 4;
+  for (int i = 0, n = this->_internal_contents_size(); i < n; i++) {
+    const auto& s = this->_internal_contents(i);
+    target = stream->WriteBytes(4, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.WriteLayeredRangeRequest)
+  return target;
+}
+
+size_t WriteLayeredRangeRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.WriteLayeredRangeRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes contents = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.contents_.size());
+  for (int i = 0, n = _impl_.contents_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.contents_.Get(i));
+  }
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  // uint32 level = 2;
+  if (this->_internal_level() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_level());
+  }
+
+  // uint32 offset = 3;
+  if (this->_internal_offset() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_offset());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WriteLayeredRangeRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WriteLayeredRangeRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WriteLayeredRangeRequest::GetClassData() const { return &_class_data_; }
+
+
+void WriteLayeredRangeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WriteLayeredRangeRequest*>(&to_msg);
+  auto& from = static_cast<const WriteLayeredRangeRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.WriteLayeredRangeRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.contents_.MergeFrom(from._impl_.contents_);
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::oram_impl::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_level() != 0) {
+    _this->_internal_set_level(from._internal_level());
+  }
+  if (from._internal_offset() != 0) {
+    _this->_internal_set_offset(from._internal_offset());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WriteLayeredRangeRequest::CopyFrom(const WriteLayeredRangeRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.WriteLayeredRangeRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WriteLayeredRangeRequest::IsInitialized() const {
+  return true;
+}
+
+void WriteLayeredRangeRequest::InternalSwap(WriteLayeredRangeRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.contents_.InternalSwap(&other->_impl_.contents_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WriteLayeredRangeRequest, _impl_.offset_)
+      + sizeof(WriteLayeredRangeRequest::_impl_.offset_)
+      - PROTOBUF_FIELD_OFFSET(WriteLayeredRangeRequest, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WriteLayeredRangeRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[21]);
+}
+
+// ===================================================================
+
+class LayeredControlRequest::_Internal {
+ public:
+  static const ::oram_impl::RequestHeader& header(const LayeredControlRequest* msg);
+};
+
+const ::oram_impl::RequestHeader&
+LayeredControlRequest::_Internal::header(const LayeredControlRequest* msg) {
+  return *msg->_impl_.header_;
+}
+LayeredControlRequest::LayeredControlRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:oram_impl.LayeredControlRequest)
+}
+LayeredControlRequest::LayeredControlRequest(const LayeredControlRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LayeredControlRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cleared_levels_){from._impl_.cleared_levels_}
+    , /*decltype(_impl_._cleared_levels_cached_byte_size_)*/{0}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.level_){}
+    , decltype(_impl_.size_){}
+    , decltype(_impl_.target_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::oram_impl::RequestHeader(*from._impl_.header_);
+  }
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.target_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.target_));
+  // @@protoc_insertion_point(copy_constructor:oram_impl.LayeredControlRequest)
+}
+
+inline void LayeredControlRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cleared_levels_){arena}
+    , /*decltype(_impl_._cleared_levels_cached_byte_size_)*/{0}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.type_){0u}
+    , decltype(_impl_.level_){0u}
+    , decltype(_impl_.size_){0u}
+    , decltype(_impl_.target_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+LayeredControlRequest::~LayeredControlRequest() {
+  // @@protoc_insertion_point(destructor:oram_impl.LayeredControlRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LayeredControlRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.cleared_levels_.~RepeatedField();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void LayeredControlRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LayeredControlRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.LayeredControlRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.cleared_levels_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  ::memset(&_impl_.type_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.target_) -
+      reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.target_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LayeredControlRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .oram_impl.RequestHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 type = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 level = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.level_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 size = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 target = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.target_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 cleared_levels = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_cleared_levels(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 48) {
+          _internal_add_cleared_levels(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LayeredControlRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.LayeredControlRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 type = 2;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_type(), target);
+  }
+
+  // uint32 level = 3;
+  if (this->_internal_level() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_level(), target);
+  }
+
+  // uint32 size = 4;
+  if (this->_internal_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_size(), target);
+  }
+
+  // uint32 target = 5;
+  if (this->_internal_target() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_target(), target);
+  }
+
+  // repeated uint32 cleared_levels = 6;
+  {
+    int byte_size = _impl_._cleared_levels_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          6, _internal_cleared_levels(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.LayeredControlRequest)
+  return target;
+}
+
+size_t LayeredControlRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.LayeredControlRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 cleared_levels = 6;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.cleared_levels_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._cleared_levels_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  // uint32 type = 2;
+  if (this->_internal_type() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_type());
+  }
+
+  // uint32 level = 3;
+  if (this->_internal_level() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_level());
+  }
+
+  // uint32 size = 4;
+  if (this->_internal_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_size());
+  }
+
+  // uint32 target = 5;
+  if (this->_internal_target() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_target());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LayeredControlRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LayeredControlRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LayeredControlRequest::GetClassData() const { return &_class_data_; }
+
+
+void LayeredControlRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LayeredControlRequest*>(&to_msg);
+  auto& from = static_cast<const LayeredControlRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.LayeredControlRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.cleared_levels_.MergeFrom(from._impl_.cleared_levels_);
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::oram_impl::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  if (from._internal_level() != 0) {
+    _this->_internal_set_level(from._internal_level());
+  }
+  if (from._internal_size() != 0) {
+    _this->_internal_set_size(from._internal_size());
+  }
+  if (from._internal_target() != 0) {
+    _this->_internal_set_target(from._internal_target());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LayeredControlRequest::CopyFrom(const LayeredControlRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.LayeredControlRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LayeredControlRequest::IsInitialized() const {
+  return true;
+}
+
+void LayeredControlRequest::InternalSwap(LayeredControlRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.cleared_levels_.InternalSwap(&other->_impl_.cleared_levels_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LayeredControlRequest, _impl_.target_)
+      + sizeof(LayeredControlRequest::_impl_.target_)
+      - PROTOBUF_FIELD_OFFSET(LayeredControlRequest, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LayeredControlRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[22]);
+}
+
+// ===================================================================
+
+class InitTreeOramRequest::_Internal {
+ public:
+  static const ::oram_impl::RequestHeader& header(const InitTreeOramRequest* msg);
+};
+
+const ::oram_impl::RequestHeader&
+InitTreeOramRequest::_Internal::header(const InitTreeOramRequest* msg) {
+  return *msg->_impl_.header_;
+}
+InitTreeOramRequest::InitTreeOramRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:oram_impl.InitTreeOramRequest)
+}
+InitTreeOramRequest::InitTreeOramRequest(const InitTreeOramRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  InitTreeOramRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.bucket_size_){}
+    , decltype(_impl_.bucket_num_){}
+    , decltype(_impl_.block_size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::oram_impl::RequestHeader(*from._impl_.header_);
+  }
+  ::memcpy(&_impl_.bucket_size_, &from._impl_.bucket_size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.block_size_) -
+    reinterpret_cast<char*>(&_impl_.bucket_size_)) + sizeof(_impl_.block_size_));
+  // @@protoc_insertion_point(copy_constructor:oram_impl.InitTreeOramRequest)
+}
+
+inline void InitTreeOramRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.bucket_size_){0u}
+    , decltype(_impl_.bucket_num_){0u}
+    , decltype(_impl_.block_size_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+InitTreeOramRequest::~InitTreeOramRequest() {
+  // @@protoc_insertion_point(destructor:oram_impl.InitTreeOramRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void InitTreeOramRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void InitTreeOramRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void InitTreeOramRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.InitTreeOramRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  ::memset(&_impl_.bucket_size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.block_size_) -
+      reinterpret_cast<char*>(&_impl_.bucket_size_)) + sizeof(_impl_.block_size_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* InitTreeOramRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .oram_impl.RequestHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 bucket_size = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.bucket_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 bucket_num = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.bucket_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 block_size = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.block_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* InitTreeOramRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.InitTreeOramRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 bucket_size = 2;
+  if (this->_internal_bucket_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_bucket_size(), target);
+  }
+
+  // uint32 bucket_num = 3;
+  if (this->_internal_bucket_num() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_bucket_num(), target);
+  }
+
+  // uint32 block_size = 4;
+  if (this->_internal_block_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_block_size(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.InitTreeOramRequest)
+  return target;
+}
+
+size_t InitTreeOramRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.InitTreeOramRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  // uint32 bucket_size = 2;
+  if (this->_internal_bucket_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_bucket_size());
+  }
+
+  // uint32 bucket_num = 3;
+  if (this->_internal_bucket_num() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_bucket_num());
+  }
+
+  // uint32 block_size = 4;
+  if (this->_internal_block_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_block_size());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InitTreeOramRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    InitTreeOramRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InitTreeOramRequest::GetClassData() const { return &_class_data_; }
+
+
+void InitTreeOramRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<InitTreeOramRequest*>(&to_msg);
+  auto& from = static_cast<const InitTreeOramRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.InitTreeOramRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::oram_impl::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_bucket_size() != 0) {
+    _this->_internal_set_bucket_size(from._internal_bucket_size());
+  }
+  if (from._internal_bucket_num() != 0) {
+    _this->_internal_set_bucket_num(from._internal_bucket_num());
+  }
+  if (from._internal_block_size() != 0) {
+    _this->_internal_set_block_size(from._internal_block_size());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void InitTreeOramRequest::CopyFrom(const InitTreeOramRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.InitTreeOramRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool InitTreeOramRequest::IsInitialized() const {
+  return true;
+}
+
+void InitTreeOramRequest::InternalSwap(InitTreeOramRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(InitTreeOramRequest, _impl_.block_size_)
+      + sizeof(InitTreeOramRequest::_impl_.block_size_)
+      - PROTOBUF_FIELD_OFFSET(InitTreeOramRequest, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata InitTreeOramRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[23]);
+}
+
+// ===================================================================
+
+class ReadFlatRequest::_Internal {
+ public:
+  static const ::oram_impl::RequestHeader& header(const ReadFlatRequest* msg);
+};
+
+const ::oram_impl::RequestHeader&
+ReadFlatRequest::_Internal::header(const ReadFlatRequest* msg) {
+  return *msg->_impl_.header_;
+}
+ReadFlatRequest::ReadFlatRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:oram_impl.ReadFlatRequest)
+}
+ReadFlatRequest::ReadFlatRequest(const ReadFlatRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReadFlatRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::oram_impl::RequestHeader(*from._impl_.header_);
+  }
+  // @@protoc_insertion_point(copy_constructor:oram_impl.ReadFlatRequest)
+}
+
+inline void ReadFlatRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ReadFlatRequest::~ReadFlatRequest() {
+  // @@protoc_insertion_point(destructor:oram_impl.ReadFlatRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReadFlatRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void ReadFlatRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReadFlatRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.ReadFlatRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReadFlatRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .oram_impl.RequestHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReadFlatRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.ReadFlatRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.ReadFlatRequest)
+  return target;
+}
+
+size_t ReadFlatRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.ReadFlatRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReadFlatRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReadFlatRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReadFlatRequest::GetClassData() const { return &_class_data_; }
+
+
+void ReadFlatRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReadFlatRequest*>(&to_msg);
+  auto& from = static_cast<const ReadFlatRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.ReadFlatRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::oram_impl::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReadFlatRequest::CopyFrom(const ReadFlatRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.ReadFlatRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReadFlatRequest::IsInitialized() const {
+  return true;
+}
+
+void ReadFlatRequest::InternalSwap(ReadFlatRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.header_, other->_impl_.header_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReadFlatRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[24]);
+}
+
+// ===================================================================
+
+class ReadFlatStreamRequest::_Internal {
+ public:
+  static const ::oram_impl::RequestHeader& header(const ReadFlatStreamRequest* msg);
+};
+
+const ::oram_impl::RequestHeader&
+ReadFlatStreamRequest::_Internal::header(const ReadFlatStreamRequest* msg) {
+  return *msg->_impl_.header_;
+}
+ReadFlatStreamRequest::ReadFlatStreamRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:oram_impl.ReadFlatStreamRequest)
+}
+ReadFlatStreamRequest::ReadFlatStreamRequest(const ReadFlatStreamRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReadFlatStreamRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.chunk_blocks_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::oram_impl::RequestHeader(*from._impl_.header_);
+  }
+  _this->_impl_.chunk_blocks_ = from._impl_.chunk_blocks_;
+  // @@protoc_insertion_point(copy_constructor:oram_impl.ReadFlatStreamRequest)
+}
+
+inline void ReadFlatStreamRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.chunk_blocks_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ReadFlatStreamRequest::~ReadFlatStreamRequest() {
+  // @@protoc_insertion_point(destructor:oram_impl.ReadFlatStreamRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReadFlatStreamRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void ReadFlatStreamRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReadFlatStreamRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.ReadFlatStreamRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  _impl_.chunk_blocks_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReadFlatStreamRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .oram_impl.RequestHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 chunk_blocks = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.chunk_blocks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReadFlatStreamRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.ReadFlatStreamRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 chunk_blocks = 2;
+  if (this->_internal_chunk_blocks() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_chunk_blocks(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.ReadFlatStreamRequest)
+  return target;
+}
+
+size_t ReadFlatStreamRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.ReadFlatStreamRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  // uint32 chunk_blocks = 2;
+  if (this->_internal_chunk_blocks() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_chunk_blocks());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReadFlatStreamRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReadFlatStreamRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReadFlatStreamRequest::GetClassData() const { return &_class_data_; }
+
+
+void ReadFlatStreamRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReadFlatStreamRequest*>(&to_msg);
+  auto& from = static_cast<const ReadFlatStreamRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.ReadFlatStreamRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::oram_impl::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_chunk_blocks() != 0) {
+    _this->_internal_set_chunk_blocks(from._internal_chunk_blocks());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReadFlatStreamRequest::CopyFrom(const ReadFlatStreamRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.ReadFlatStreamRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReadFlatStreamRequest::IsInitialized() const {
+  return true;
+}
+
+void ReadFlatStreamRequest::InternalSwap(ReadFlatStreamRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReadFlatStreamRequest, _impl_.chunk_blocks_)
+      + sizeof(ReadFlatStreamRequest::_impl_.chunk_blocks_)
+      - PROTOBUF_FIELD_OFFSET(ReadFlatStreamRequest, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReadFlatStreamRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[25]);
+}
+
+// ===================================================================
+
+class FlatChunkMessage::_Internal {
+ public:
+  static const ::oram_impl::RequestHeader& header(const FlatChunkMessage* msg);
+};
+
+const ::oram_impl::RequestHeader&
+FlatChunkMessage::_Internal::header(const FlatChunkMessage* msg) {
+  return *msg->_impl_.header_;
+}
+FlatChunkMessage::FlatChunkMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:oram_impl.FlatChunkMessage)
+}
+FlatChunkMessage::FlatChunkMessage(const FlatChunkMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FlatChunkMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.content_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.offset_){}
+    , decltype(_impl_.last_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_content().empty()) {
+    _this->_impl_.content_.Set(from._internal_content(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::oram_impl::RequestHeader(*from._impl_.header_);
+  }
+  ::memcpy(&_impl_.offset_, &from._impl_.offset_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.last_) -
+    reinterpret_cast<char*>(&_impl_.offset_)) + sizeof(_impl_.last_));
+  // @@protoc_insertion_point(copy_constructor:oram_impl.FlatChunkMessage)
+}
+
+inline void FlatChunkMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.content_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.offset_){uint64_t{0u}}
+    , decltype(_impl_.last_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+FlatChunkMessage::~FlatChunkMessage() {
+  // @@protoc_insertion_point(destructor:oram_impl.FlatChunkMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FlatChunkMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.content_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void FlatChunkMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FlatChunkMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.FlatChunkMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.content_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  ::memset(&_impl_.offset_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.last_) -
+      reinterpret_cast<char*>(&_impl_.offset_)) + sizeof(_impl_.last_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FlatChunkMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .oram_impl.RequestHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 offset = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes content = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_content();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool last = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.last_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FlatChunkMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.FlatChunkMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // uint64 offset = 2;
+  if (this->_internal_offset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_offset(), target);
+  }
+
+  // bytes content = 3;
+  if (!this->_internal_content().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_content(), target);
+  }
+
+  // bool last = 4;
+  if (this->_internal_last() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_last(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.FlatChunkMessage)
+  return target;
+}
+
+size_t FlatChunkMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.FlatChunkMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes content = 3;
+  if (!this->_internal_content().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_content());
+  }
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  // uint64 offset = 2;
+  if (this->_internal_offset() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_offset());
+  }
+
+  // bool last = 4;
+  if (this->_internal_last() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FlatChunkMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FlatChunkMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FlatChunkMessage::GetClassData() const { return &_class_data_; }
+
+
+void FlatChunkMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FlatChunkMessage*>(&to_msg);
+  auto& from = static_cast<const FlatChunkMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.FlatChunkMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_content().empty()) {
+    _this->_internal_set_content(from._internal_content());
+  }
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::oram_impl::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_offset() != 0) {
+    _this->_internal_set_offset(from._internal_offset());
+  }
+  if (from._internal_last() != 0) {
+    _this->_internal_set_last(from._internal_last());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FlatChunkMessage::CopyFrom(const FlatChunkMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.FlatChunkMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FlatChunkMessage::IsInitialized() const {
+  return true;
+}
+
+void FlatChunkMessage::InternalSwap(FlatChunkMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.content_, lhs_arena,
+      &other->_impl_.content_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FlatChunkMessage, _impl_.last_)
+      + sizeof(FlatChunkMessage::_impl_.last_)
+      - PROTOBUF_FIELD_OFFSET(FlatChunkMessage, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FlatChunkMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[26]);
+}
+
+// ===================================================================
+
+class ReadSqrtRequest::_Internal {
+ public:
+  static const ::oram_impl::RequestHeader& header(const ReadSqrtRequest* msg);
+};
+
+const ::oram_impl::RequestHeader&
+ReadSqrtRequest::_Internal::header(const ReadSqrtRequest* msg) {
+  return *msg->_impl_.header_;
+}
+ReadSqrtRequest::ReadSqrtRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:oram_impl.ReadSqrtRequest)
+}
+ReadSqrtRequest::ReadSqrtRequest(const ReadSqrtRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReadSqrtRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.tag_){}
+    , decltype(_impl_.read_from_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::oram_impl::RequestHeader(*from._impl_.header_);
+  }
+  ::memcpy(&_impl_.tag_, &from._impl_.tag_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.read_from_) -
+    reinterpret_cast<char*>(&_impl_.tag_)) + sizeof(_impl_.read_from_));
+  // @@protoc_insertion_point(copy_constructor:oram_impl.ReadSqrtRequest)
+}
+
+inline void ReadSqrtRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.tag_){0u}
+    , decltype(_impl_.read_from_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ReadSqrtRequest::~ReadSqrtRequest() {
+  // @@protoc_insertion_point(destructor:oram_impl.ReadSqrtRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReadSqrtRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void ReadSqrtRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReadSqrtRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.ReadSqrtRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  ::memset(&_impl_.tag_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.read_from_) -
+      reinterpret_cast<char*>(&_impl_.tag_)) + sizeof(_impl_.read_from_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReadSqrtRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .oram_impl.RequestHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 tag = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.tag_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 read_from = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.read_from_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReadSqrtRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.ReadSqrtRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 tag = 2;
+  if (this->_internal_tag() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_tag(), target);
+  }
+
+  // uint32 read_from = 3;
+  if (this->_internal_read_from() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_read_from(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -4115,140 +7904,592 @@ uint8_t* ReadSqrtRequest::_InternalSerialize(
   return target;
 }
 
-size_t ReadSqrtRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:oram_impl.ReadSqrtRequest)
-  size_t total_size = 0;
-
+size_t ReadSqrtRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.ReadSqrtRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  // uint32 tag = 2;
+  if (this->_internal_tag() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_tag());
+  }
+
+  // uint32 read_from = 3;
+  if (this->_internal_read_from() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_read_from());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReadSqrtRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReadSqrtRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReadSqrtRequest::GetClassData() const { return &_class_data_; }
+
+
+void ReadSqrtRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReadSqrtRequest*>(&to_msg);
+  auto& from = static_cast<const ReadSqrtRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.ReadSqrtRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::oram_impl::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_tag() != 0) {
+    _this->_internal_set_tag(from._internal_tag());
+  }
+  if (from._internal_read_from() != 0) {
+    _this->_internal_set_read_from(from._internal_read_from());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReadSqrtRequest::CopyFrom(const ReadSqrtRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.ReadSqrtRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReadSqrtRequest::IsInitialized() const {
+  return true;
+}
+
+void ReadSqrtRequest::InternalSwap(ReadSqrtRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReadSqrtRequest, _impl_.read_from_)
+      + sizeof(ReadSqrtRequest::_impl_.read_from_)
+      - PROTOBUF_FIELD_OFFSET(ReadSqrtRequest, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReadSqrtRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[27]);
+}
+
+// ===================================================================
+
+class ReadPathRequest::_Internal {
+ public:
+  static const ::oram_impl::RequestHeader& header(const ReadPathRequest* msg);
+};
+
+const ::oram_impl::RequestHeader&
+ReadPathRequest::_Internal::header(const ReadPathRequest* msg) {
+  return *msg->_impl_.header_;
+}
+ReadPathRequest::ReadPathRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:oram_impl.ReadPathRequest)
+}
+ReadPathRequest::ReadPathRequest(const ReadPathRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReadPathRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.path_){}
+    , decltype(_impl_.level_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::oram_impl::RequestHeader(*from._impl_.header_);
+  }
+  ::memcpy(&_impl_.path_, &from._impl_.path_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.level_) -
+    reinterpret_cast<char*>(&_impl_.path_)) + sizeof(_impl_.level_));
+  // @@protoc_insertion_point(copy_constructor:oram_impl.ReadPathRequest)
+}
+
+inline void ReadPathRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.path_){0u}
+    , decltype(_impl_.level_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ReadPathRequest::~ReadPathRequest() {
+  // @@protoc_insertion_point(destructor:oram_impl.ReadPathRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReadPathRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void ReadPathRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReadPathRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.ReadPathRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  ::memset(&_impl_.path_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.level_) -
+      reinterpret_cast<char*>(&_impl_.path_)) + sizeof(_impl_.level_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReadPathRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .oram_impl.RequestHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 path = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.path_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 level = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.level_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReadPathRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.ReadPathRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 path = 2;
+  if (this->_internal_path() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_path(), target);
+  }
+
+  // uint32 level = 3;
+  if (this->_internal_level() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_level(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.ReadPathRequest)
+  return target;
+}
+
+size_t ReadPathRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.ReadPathRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .oram_impl.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  // uint32 path = 2;
+  if (this->_internal_path() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_path());
+  }
+
+  // uint32 level = 3;
+  if (this->_internal_level() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_level());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReadPathRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReadPathRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReadPathRequest::GetClassData() const { return &_class_data_; }
+
+
+void ReadPathRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReadPathRequest*>(&to_msg);
+  auto& from = static_cast<const ReadPathRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.ReadPathRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::oram_impl::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_path() != 0) {
+    _this->_internal_set_path(from._internal_path());
+  }
+  if (from._internal_level() != 0) {
+    _this->_internal_set_level(from._internal_level());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReadPathRequest::CopyFrom(const ReadPathRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.ReadPathRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReadPathRequest::IsInitialized() const {
+  return true;
+}
+
+void ReadPathRequest::InternalSwap(ReadPathRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReadPathRequest, _impl_.level_)
+      + sizeof(ReadPathRequest::_impl_.level_)
+      - PROTOBUF_FIELD_OFFSET(ReadPathRequest, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReadPathRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[28]);
+}
+
+// ===================================================================
+
+class ReadPathResponse::_Internal {
+ public:
+};
+
+ReadPathResponse::ReadPathResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:oram_impl.ReadPathResponse)
+}
+ReadPathResponse::ReadPathResponse(const ReadPathResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReadPathResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bucket_){from._impl_.bucket_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:oram_impl.ReadPathResponse)
+}
+
+inline void ReadPathResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bucket_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ReadPathResponse::~ReadPathResponse() {
+  // @@protoc_insertion_point(destructor:oram_impl.ReadPathResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReadPathResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.bucket_.~RepeatedPtrField();
+}
+
+void ReadPathResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReadPathResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.ReadPathResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.bucket_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReadPathResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated bytes bucket = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_bucket();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReadPathResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.ReadPathResponse)
   uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .oram_impl.RequestHeader header = 1;
-  if (this->_internal_has_header()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.header_);
+  // repeated bytes bucket = 1;
+  for (int i = 0, n = this->_internal_bucket_size(); i < n; i++) {
+    const auto& s = this->_internal_bucket(i);
+    target = stream->WriteBytes(1, s, target);
   }
 
-  // uint32 tag = 2;
-  if (this->_internal_tag() != 0) {
-    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_tag());
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.ReadPathResponse)
+  return target;
+}
 
-  // uint32 read_from = 3;
-  if (this->_internal_read_from() != 0) {
-    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_read_from());
+size_t ReadPathResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.ReadPathResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes bucket = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.bucket_.size());
+  for (int i = 0, n = _impl_.bucket_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.bucket_.Get(i));
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReadSqrtRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReadPathResponse::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ReadSqrtRequest::MergeImpl
+    ReadPathResponse::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReadSqrtRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReadPathResponse::GetClassData() const { return &_class_data_; }
 
 
-void ReadSqrtRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ReadSqrtRequest*>(&to_msg);
-  auto& from = static_cast<const ReadSqrtRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.ReadSqrtRequest)
+void ReadPathResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReadPathResponse*>(&to_msg);
+  auto& from = static_cast<const ReadPathResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.ReadPathResponse)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_header()) {
-    _this->_internal_mutable_header()->::oram_impl::RequestHeader::MergeFrom(
-        from._internal_header());
-  }
-  if (from._internal_tag() != 0) {
-    _this->_internal_set_tag(from._internal_tag());
-  }
-  if (from._internal_read_from() != 0) {
-    _this->_internal_set_read_from(from._internal_read_from());
-  }
+  _this->_impl_.bucket_.MergeFrom(from._impl_.bucket_);
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ReadSqrtRequest::CopyFrom(const ReadSqrtRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.ReadSqrtRequest)
+void ReadPathResponse::CopyFrom(const ReadPathResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.ReadPathResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ReadSqrtRequest::IsInitialized() const {
+bool ReadPathResponse::IsInitialized() const {
   return true;
 }
 
-void ReadSqrtRequest::InternalSwap(ReadSqrtRequest* other) {
+void ReadPathResponse::InternalSwap(ReadPathResponse* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ReadSqrtRequest, _impl_.read_from_)
-      + sizeof(ReadSqrtRequest::_impl_.read_from_)
-      - PROTOBUF_FIELD_OFFSET(ReadSqrtRequest, _impl_.header_)>(
-          reinterpret_cast<char*>(&_impl_.header_),
-          reinterpret_cast<char*>(&other->_impl_.header_));
+  _impl_.bucket_.InternalSwap(&other->_impl_.bucket_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ReadSqrtRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ReadPathResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
-      file_level_metadata_messages_2eproto[14]);
+      file_level_metadata_messages_2eproto[29]);
 }
 
 // ===================================================================
 
-class ReadPathRequest::_Internal {
+class WritePathRequest::_Internal {
  public:
-  static const ::oram_impl::RequestHeader& header(const ReadPathRequest* msg);
+  using HasBits = decltype(std::declval<WritePathRequest>()._impl_._has_bits_);
+  static const ::oram_impl::RequestHeader& header(const WritePathRequest* msg);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_offset(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
 };
 
 const ::oram_impl::RequestHeader&
-ReadPathRequest::_Internal::header(const ReadPathRequest* msg) {
+WritePathRequest::_Internal::header(const WritePathRequest* msg) {
   return *msg->_impl_.header_;
 }
-ReadPathRequest::ReadPathRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+WritePathRequest::WritePathRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:oram_impl.ReadPathRequest)
+  // @@protoc_insertion_point(arena_constructor:oram_impl.WritePathRequest)
 }
-ReadPathRequest::ReadPathRequest(const ReadPathRequest& from)
+WritePathRequest::WritePathRequest(const WritePathRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  ReadPathRequest* const _this = this; (void)_this;
+  WritePathRequest* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.header_){nullptr}
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.bucket_){from._impl_.bucket_}
+    , decltype(_impl_.header_){nullptr}
     , decltype(_impl_.path_){}
     , decltype(_impl_.level_){}
-    , /*decltype(_impl_._cached_size_)*/{}};
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.offset_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_header()) {
     _this->_impl_.header_ = new ::oram_impl::RequestHeader(*from._impl_.header_);
   }
   ::memcpy(&_impl_.path_, &from._impl_.path_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.level_) -
-    reinterpret_cast<char*>(&_impl_.path_)) + sizeof(_impl_.level_));
-  // @@protoc_insertion_point(copy_constructor:oram_impl.ReadPathRequest)
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.offset_) -
+    reinterpret_cast<char*>(&_impl_.path_)) + sizeof(_impl_.offset_));
+  // @@protoc_insertion_point(copy_constructor:oram_impl.WritePathRequest)
 }
 
-inline void ReadPathRequest::SharedCtor(
+inline void WritePathRequest::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.header_){nullptr}
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.bucket_){arena}
+    , decltype(_impl_.header_){nullptr}
     , decltype(_impl_.path_){0u}
     , decltype(_impl_.level_){0u}
-    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.offset_){0u}
   };
 }
 
-ReadPathRequest::~ReadPathRequest() {
-  // @@protoc_insertion_point(destructor:oram_impl.ReadPathRequest)
+WritePathRequest::~WritePathRequest() {
+  // @@protoc_insertion_point(destructor:oram_impl.WritePathRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -4256,21 +8497,23 @@ ReadPathRequest::~ReadPathRequest() {
   SharedDtor();
 }
 
-inline void ReadPathRequest::SharedDtor() {
+inline void WritePathRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.bucket_.~RepeatedPtrField();
   if (this != internal_default_instance()) delete _impl_.header_;
 }
 
-void ReadPathRequest::SetCachedSize(int size) const {
+void WritePathRequest::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void ReadPathRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:oram_impl.ReadPathRequest)
+void WritePathRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.WritePathRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  _impl_.bucket_.Clear();
   if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
     delete _impl_.header_;
   }
@@ -4278,11 +8521,19 @@ void ReadPathRequest::Clear() {
   ::memset(&_impl_.path_, 0, static_cast<size_t>(
       reinterpret_cast<char*>(&_impl_.level_) -
       reinterpret_cast<char*>(&_impl_.path_)) + sizeof(_impl_.level_));
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.type_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.offset_) -
+        reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.offset_));
+  }
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ReadPathRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* WritePathRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
@@ -4311,6 +8562,38 @@ const char* ReadPathRequest::_InternalParse(const char* ptr, ::_pbi::ParseContex
         } else
           goto handle_unusual;
         continue;
+      // repeated bytes bucket = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_bucket();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .oram_impl.Type type = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::oram_impl::Type>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 offset = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_offset(&has_bits);
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -4327,6 +8610,7 @@ const char* ReadPathRequest::_InternalParse(const char* ptr, ::_pbi::ParseContex
     CHK_(ptr != nullptr);
   }  // while
 message_done:
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -4334,9 +8618,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ReadPathRequest::_InternalSerialize(
+uint8_t* WritePathRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.ReadPathRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.WritePathRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -4359,22 +8643,49 @@ uint8_t* ReadPathRequest::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_level(), target);
   }
 
+  // repeated bytes bucket = 4;
+  for (int i = 0, n = this->_internal_bucket_size(); i < n; i++) {
+    const auto& s = this->_internal_bucket(i);
+    target = stream->WriteBytes(4, s, target);
+  }
+
+  // optional .oram_impl.Type type = 5;
+  if (_internal_has_type()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      5, this->_internal_type(), target);
+  }
+
+  // optional uint32 offset = 6;
+  if (_internal_has_offset()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_offset(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.ReadPathRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.WritePathRequest)
   return target;
 }
 
-size_t ReadPathRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:oram_impl.ReadPathRequest)
+size_t WritePathRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.WritePathRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // repeated bytes bucket = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.bucket_.size());
+  for (int i = 0, n = _impl_.bucket_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.bucket_.Get(i));
+  }
+
   // .oram_impl.RequestHeader header = 1;
   if (this->_internal_has_header()) {
     total_size += 1 +
@@ -4392,24 +8703,39 @@ size_t ReadPathRequest::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_level());
   }
 
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional .oram_impl.Type type = 5;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+    }
+
+    // optional uint32 offset = 6;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_offset());
+    }
+
+  }
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReadPathRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WritePathRequest::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ReadPathRequest::MergeImpl
+    WritePathRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReadPathRequest::GetClassData() const { return &_class_data_; }
-
-
-void ReadPathRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ReadPathRequest*>(&to_msg);
-  auto& from = static_cast<const ReadPathRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.ReadPathRequest)
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WritePathRequest::GetClassData() const { return &_class_data_; }
+
+
+void WritePathRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WritePathRequest*>(&to_msg);
+  auto& from = static_cast<const WritePathRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.WritePathRequest)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
+  _this->_impl_.bucket_.MergeFrom(from._impl_.bucket_);
   if (from._internal_has_header()) {
     _this->_internal_mutable_header()->::oram_impl::RequestHeader::MergeFrom(
         from._internal_header());
@@ -4420,61 +8746,73 @@ void ReadPathRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
   if (from._internal_level() != 0) {
     _this->_internal_set_level(from._internal_level());
   }
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.offset_ = from._impl_.offset_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ReadPathRequest::CopyFrom(const ReadPathRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.ReadPathRequest)
+void WritePathRequest::CopyFrom(const WritePathRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.WritePathRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ReadPathRequest::IsInitialized() const {
+bool WritePathRequest::IsInitialized() const {
   return true;
 }
 
-void ReadPathRequest::InternalSwap(ReadPathRequest* other) {
+void WritePathRequest::InternalSwap(WritePathRequest* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.bucket_.InternalSwap(&other->_impl_.bucket_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ReadPathRequest, _impl_.level_)
-      + sizeof(ReadPathRequest::_impl_.level_)
-      - PROTOBUF_FIELD_OFFSET(ReadPathRequest, _impl_.header_)>(
+      PROTOBUF_FIELD_OFFSET(WritePathRequest, _impl_.offset_)
+      + sizeof(WritePathRequest::_impl_.offset_)
+      - PROTOBUF_FIELD_OFFSET(WritePathRequest, _impl_.header_)>(
           reinterpret_cast<char*>(&_impl_.header_),
           reinterpret_cast<char*>(&other->_impl_.header_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ReadPathRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata WritePathRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
-      file_level_metadata_messages_2eproto[15]);
+      file_level_metadata_messages_2eproto[30]);
 }
 
 // ===================================================================
 
-class ReadPathResponse::_Internal {
+class BucketMessage::_Internal {
  public:
 };
 
-ReadPathResponse::ReadPathResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+BucketMessage::BucketMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:oram_impl.ReadPathResponse)
+  // @@protoc_insertion_point(arena_constructor:oram_impl.BucketMessage)
 }
-ReadPathResponse::ReadPathResponse(const ReadPathResponse& from)
+BucketMessage::BucketMessage(const BucketMessage& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  ReadPathResponse* const _this = this; (void)_this;
+  BucketMessage* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.bucket_){from._impl_.bucket_}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:oram_impl.ReadPathResponse)
+  // @@protoc_insertion_point(copy_constructor:oram_impl.BucketMessage)
 }
 
-inline void ReadPathResponse::SharedCtor(
+inline void BucketMessage::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
@@ -4484,8 +8822,8 @@ inline void ReadPathResponse::SharedCtor(
   };
 }
 
-ReadPathResponse::~ReadPathResponse() {
-  // @@protoc_insertion_point(destructor:oram_impl.ReadPathResponse)
+BucketMessage::~BucketMessage() {
+  // @@protoc_insertion_point(destructor:oram_impl.BucketMessage)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -4493,17 +8831,17 @@ ReadPathResponse::~ReadPathResponse() {
   SharedDtor();
 }
 
-inline void ReadPathResponse::SharedDtor() {
+inline void BucketMessage::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.bucket_.~RepeatedPtrField();
 }
 
-void ReadPathResponse::SetCachedSize(int size) const {
+void BucketMessage::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void ReadPathResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:oram_impl.ReadPathResponse)
+void BucketMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.BucketMessage)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
@@ -4512,7 +8850,7 @@ void ReadPathResponse::Clear() {
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ReadPathResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* BucketMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -4555,9 +8893,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ReadPathResponse::_InternalSerialize(
+uint8_t* BucketMessage::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.ReadPathResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.BucketMessage)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -4571,12 +8909,12 @@ uint8_t* ReadPathResponse::_InternalSerialize(
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.ReadPathResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.BucketMessage)
   return target;
 }
 
-size_t ReadPathResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:oram_impl.ReadPathResponse)
+size_t BucketMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.BucketMessage)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
@@ -4594,17 +8932,17 @@ size_t ReadPathResponse::ByteSizeLong() const {
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReadPathResponse::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BucketMessage::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ReadPathResponse::MergeImpl
+    BucketMessage::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReadPathResponse::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BucketMessage::GetClassData() const { return &_class_data_; }
 
 
-void ReadPathResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ReadPathResponse*>(&to_msg);
-  auto& from = static_cast<const ReadPathResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.ReadPathResponse)
+void BucketMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BucketMessage*>(&to_msg);
+  auto& from = static_cast<const BucketMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.BucketMessage)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -4613,94 +8951,77 @@ void ReadPathResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ReadPathResponse::CopyFrom(const ReadPathResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.ReadPathResponse)
+void BucketMessage::CopyFrom(const BucketMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.BucketMessage)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ReadPathResponse::IsInitialized() const {
+bool BucketMessage::IsInitialized() const {
   return true;
 }
 
-void ReadPathResponse::InternalSwap(ReadPathResponse* other) {
+void BucketMessage::InternalSwap(BucketMessage* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   _impl_.bucket_.InternalSwap(&other->_impl_.bucket_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ReadPathResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata BucketMessage::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
-      file_level_metadata_messages_2eproto[16]);
+      file_level_metadata_messages_2eproto[31]);
 }
 
 // ===================================================================
 
-class WritePathRequest::_Internal {
+class WriteFullPathRequest::_Internal {
  public:
-  using HasBits = decltype(std::declval<WritePathRequest>()._impl_._has_bits_);
-  static const ::oram_impl::RequestHeader& header(const WritePathRequest* msg);
-  static void set_has_type(HasBits* has_bits) {
-    (*has_bits)[0] |= 1u;
-  }
-  static void set_has_offset(HasBits* has_bits) {
-    (*has_bits)[0] |= 2u;
-  }
+  static const ::oram_impl::RequestHeader& header(const WriteFullPathRequest* msg);
 };
 
 const ::oram_impl::RequestHeader&
-WritePathRequest::_Internal::header(const WritePathRequest* msg) {
+WriteFullPathRequest::_Internal::header(const WriteFullPathRequest* msg) {
   return *msg->_impl_.header_;
 }
-WritePathRequest::WritePathRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+WriteFullPathRequest::WriteFullPathRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:oram_impl.WritePathRequest)
+  // @@protoc_insertion_point(arena_constructor:oram_impl.WriteFullPathRequest)
 }
-WritePathRequest::WritePathRequest(const WritePathRequest& from)
+WriteFullPathRequest::WriteFullPathRequest(const WriteFullPathRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  WritePathRequest* const _this = this; (void)_this;
+  WriteFullPathRequest* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_._has_bits_){from._impl_._has_bits_}
-    , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.bucket_){from._impl_.bucket_}
+      decltype(_impl_.buckets_){from._impl_.buckets_}
     , decltype(_impl_.header_){nullptr}
     , decltype(_impl_.path_){}
-    , decltype(_impl_.level_){}
-    , decltype(_impl_.type_){}
-    , decltype(_impl_.offset_){}};
+    , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_header()) {
     _this->_impl_.header_ = new ::oram_impl::RequestHeader(*from._impl_.header_);
   }
-  ::memcpy(&_impl_.path_, &from._impl_.path_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.offset_) -
-    reinterpret_cast<char*>(&_impl_.path_)) + sizeof(_impl_.offset_));
-  // @@protoc_insertion_point(copy_constructor:oram_impl.WritePathRequest)
+  _this->_impl_.path_ = from._impl_.path_;
+  // @@protoc_insertion_point(copy_constructor:oram_impl.WriteFullPathRequest)
 }
 
-inline void WritePathRequest::SharedCtor(
+inline void WriteFullPathRequest::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_._has_bits_){}
-    , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.bucket_){arena}
+      decltype(_impl_.buckets_){arena}
     , decltype(_impl_.header_){nullptr}
     , decltype(_impl_.path_){0u}
-    , decltype(_impl_.level_){0u}
-    , decltype(_impl_.type_){0}
-    , decltype(_impl_.offset_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-WritePathRequest::~WritePathRequest() {
-  // @@protoc_insertion_point(destructor:oram_impl.WritePathRequest)
+WriteFullPathRequest::~WriteFullPathRequest() {
+  // @@protoc_insertion_point(destructor:oram_impl.WriteFullPathRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -4708,43 +9029,33 @@ WritePathRequest::~WritePathRequest() {
   SharedDtor();
 }
 
-inline void WritePathRequest::SharedDtor() {
+inline void WriteFullPathRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.bucket_.~RepeatedPtrField();
+  _impl_.buckets_.~RepeatedPtrField();
   if (this != internal_default_instance()) delete _impl_.header_;
 }
 
-void WritePathRequest::SetCachedSize(int size) const {
+void WriteFullPathRequest::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void WritePathRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:oram_impl.WritePathRequest)
+void WriteFullPathRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:oram_impl.WriteFullPathRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.bucket_.Clear();
+  _impl_.buckets_.Clear();
   if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
     delete _impl_.header_;
   }
   _impl_.header_ = nullptr;
-  ::memset(&_impl_.path_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.level_) -
-      reinterpret_cast<char*>(&_impl_.path_)) + sizeof(_impl_.level_));
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    ::memset(&_impl_.type_, 0, static_cast<size_t>(
-        reinterpret_cast<char*>(&_impl_.offset_) -
-        reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.offset_));
-  }
-  _impl_._has_bits_.Clear();
+  _impl_.path_ = 0u;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* WritePathRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* WriteFullPathRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
@@ -4765,43 +9076,16 @@ const char* WritePathRequest::_InternalParse(const char* ptr, ::_pbi::ParseConte
         } else
           goto handle_unusual;
         continue;
-      // uint32 level = 3;
+      // repeated .oram_impl.BucketMessage buckets = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          _impl_.level_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // repeated bytes bucket = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           ptr -= 1;
           do {
             ptr += 1;
-            auto str = _internal_add_bucket();
-            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            ptr = ctx->ParseMessage(_internal_add_buckets(), ptr);
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
-        } else
-          goto handle_unusual;
-        continue;
-      // optional .oram_impl.Type type = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
-          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-          _internal_set_type(static_cast<::oram_impl::Type>(val));
-        } else
-          goto handle_unusual;
-        continue;
-      // optional uint32 offset = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
-          _Internal::set_has_offset(&has_bits);
-          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
         } else
           goto handle_unusual;
         continue;
@@ -4821,7 +9105,6 @@ const char* WritePathRequest::_InternalParse(const char* ptr, ::_pbi::ParseConte
     CHK_(ptr != nullptr);
   }  // while
 message_done:
-  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -4829,9 +9112,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* WritePathRequest::_InternalSerialize(
+uint8_t* WriteFullPathRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.WritePathRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:oram_impl.WriteFullPathRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -4848,53 +9131,35 @@ uint8_t* WritePathRequest::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_path(), target);
   }
 
-  // uint32 level = 3;
-  if (this->_internal_level() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_level(), target);
-  }
-
-  // repeated bytes bucket = 4;
-  for (int i = 0, n = this->_internal_bucket_size(); i < n; i++) {
-    const auto& s = this->_internal_bucket(i);
-    target = stream->WriteBytes(4, s, target);
-  }
-
-  // optional .oram_impl.Type type = 5;
-  if (_internal_has_type()) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteEnumToArray(
-      5, this->_internal_type(), target);
-  }
-
-  // optional uint32 offset = 6;
-  if (_internal_has_offset()) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_offset(), target);
+  // repeated .oram_impl.BucketMessage buckets = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_buckets_size()); i < n; i++) {
+    const auto& repfield = this->_internal_buckets(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.WritePathRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:oram_impl.WriteFullPathRequest)
   return target;
 }
 
-size_t WritePathRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:oram_impl.WritePathRequest)
+size_t WriteFullPathRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:oram_impl.WriteFullPathRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated bytes bucket = 4;
-  total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.bucket_.size());
-  for (int i = 0, n = _impl_.bucket_.size(); i < n; i++) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
-      _impl_.bucket_.Get(i));
+  // repeated .oram_impl.BucketMessage buckets = 3;
+  total_size += 1UL * this->_internal_buckets_size();
+  for (const auto& msg : this->_impl_.buckets_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // .oram_impl.RequestHeader header = 1;
@@ -4909,44 +9174,25 @@ size_t WritePathRequest::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_path());
   }
 
-  // uint32 level = 3;
-  if (this->_internal_level() != 0) {
-    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_level());
-  }
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    // optional .oram_impl.Type type = 5;
-    if (cached_has_bits & 0x00000001u) {
-      total_size += 1 +
-        ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
-    }
-
-    // optional uint32 offset = 6;
-    if (cached_has_bits & 0x00000002u) {
-      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_offset());
-    }
-
-  }
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WritePathRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WriteFullPathRequest::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    WritePathRequest::MergeImpl
+    WriteFullPathRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WritePathRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WriteFullPathRequest::GetClassData() const { return &_class_data_; }
 
 
-void WritePathRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<WritePathRequest*>(&to_msg);
-  auto& from = static_cast<const WritePathRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.WritePathRequest)
+void WriteFullPathRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WriteFullPathRequest*>(&to_msg);
+  auto& from = static_cast<const WriteFullPathRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:oram_impl.WriteFullPathRequest)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.bucket_.MergeFrom(from._impl_.bucket_);
+  _this->_impl_.buckets_.MergeFrom(from._impl_.buckets_);
   if (from._internal_has_header()) {
     _this->_internal_mutable_header()->::oram_impl::RequestHeader::MergeFrom(
         from._internal_header());
@@ -4954,50 +9200,36 @@ void WritePathRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
   if (from._internal_path() != 0) {
     _this->_internal_set_path(from._internal_path());
   }
-  if (from._internal_level() != 0) {
-    _this->_internal_set_level(from._internal_level());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      _this->_impl_.type_ = from._impl_.type_;
-    }
-    if (cached_has_bits & 0x00000002u) {
-      _this->_impl_.offset_ = from._impl_.offset_;
-    }
-    _this->_impl_._has_bits_[0] |= cached_has_bits;
-  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void WritePathRequest::CopyFrom(const WritePathRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.WritePathRequest)
+void WriteFullPathRequest::CopyFrom(const WriteFullPathRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:oram_impl.WriteFullPathRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool WritePathRequest::IsInitialized() const {
+bool WriteFullPathRequest::IsInitialized() const {
   return true;
 }
 
-void WritePathRequest::InternalSwap(WritePathRequest* other) {
+void WriteFullPathRequest::InternalSwap(WriteFullPathRequest* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  _impl_.bucket_.InternalSwap(&other->_impl_.bucket_);
+  _impl_.buckets_.InternalSwap(&other->_impl_.buckets_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(WritePathRequest, _impl_.offset_)
-      + sizeof(WritePathRequest::_impl_.offset_)
-      - PROTOBUF_FIELD_OFFSET(WritePathRequest, _impl_.header_)>(
+      PROTOBUF_FIELD_OFFSET(WriteFullPathRequest, _impl_.path_)
+      + sizeof(WriteFullPathRequest::_impl_.path_)
+      - PROTOBUF_FIELD_OFFSET(WriteFullPathRequest, _impl_.header_)>(
           reinterpret_cast<char*>(&_impl_.header_),
           reinterpret_cast<char*>(&other->_impl_.header_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata WritePathRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata WriteFullPathRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
-      file_level_metadata_messages_2eproto[17]);
+      file_level_metadata_messages_2eproto[32]);
 }
 
 // ===================================================================
@@ -5037,7 +9269,7 @@ const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WritePathResponse::GetClassDat
 ::PROTOBUF_NAMESPACE_ID::Metadata WritePathResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
-      file_level_metadata_messages_2eproto[18]);
+      file_level_metadata_messages_2eproto[33]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -5087,9 +9319,53 @@ template<> PROTOBUF_NOINLINE ::oram_impl::WriteSqrtMessage*
 Arena::CreateMaybeMessage< ::oram_impl::WriteSqrtMessage >(Arena* arena) {
   return Arena::CreateMessageInternal< ::oram_impl::WriteSqrtMessage >(arena);
 }
-template<> PROTOBUF_NOINLINE ::oram_impl::SqrtPermMessage*
-Arena::CreateMaybeMessage< ::oram_impl::SqrtPermMessage >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::oram_impl::SqrtPermMessage >(arena);
+template<> PROTOBUF_NOINLINE ::oram_impl::ReadShelterRequest*
+Arena::CreateMaybeMessage< ::oram_impl::ReadShelterRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::oram_impl::ReadShelterRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::oram_impl::ShelterMessage*
+Arena::CreateMaybeMessage< ::oram_impl::ShelterMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::oram_impl::ShelterMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::oram_impl::SqrtShuffleRequest*
+Arena::CreateMaybeMessage< ::oram_impl::SqrtShuffleRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::oram_impl::SqrtShuffleRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::oram_impl::ReadSqrtRangeRequest*
+Arena::CreateMaybeMessage< ::oram_impl::ReadSqrtRangeRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::oram_impl::ReadSqrtRangeRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::oram_impl::SqrtRangeMessage*
+Arena::CreateMaybeMessage< ::oram_impl::SqrtRangeMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::oram_impl::SqrtRangeMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::oram_impl::WriteSqrtRangeRequest*
+Arena::CreateMaybeMessage< ::oram_impl::WriteSqrtRangeRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::oram_impl::WriteSqrtRangeRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::oram_impl::InitLayeredOramRequest*
+Arena::CreateMaybeMessage< ::oram_impl::InitLayeredOramRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::oram_impl::InitLayeredOramRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::oram_impl::ReadLayeredRequest*
+Arena::CreateMaybeMessage< ::oram_impl::ReadLayeredRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::oram_impl::ReadLayeredRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::oram_impl::LayeredBlocksMessage*
+Arena::CreateMaybeMessage< ::oram_impl::LayeredBlocksMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::oram_impl::LayeredBlocksMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::oram_impl::WriteLayeredRequest*
+Arena::CreateMaybeMessage< ::oram_impl::WriteLayeredRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::oram_impl::WriteLayeredRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::oram_impl::WriteLayeredRangeRequest*
+Arena::CreateMaybeMessage< ::oram_impl::WriteLayeredRangeRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::oram_impl::WriteLayeredRangeRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::oram_impl::LayeredControlRequest*
+Arena::CreateMaybeMessage< ::oram_impl::LayeredControlRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::oram_impl::LayeredControlRequest >(arena);
 }
 template<> PROTOBUF_NOINLINE ::oram_impl::InitTreeOramRequest*
 Arena::CreateMaybeMessage< ::oram_impl::InitTreeOramRequest >(Arena* arena) {
@@ -5099,6 +9375,14 @@ template<> PROTOBUF_NOINLINE ::oram_impl::ReadFlatRequest*
 Arena::CreateMaybeMessage< ::oram_impl::ReadFlatRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::oram_impl::ReadFlatRequest >(arena);
 }
+template<> PROTOBUF_NOINLINE ::oram_impl::ReadFlatStreamRequest*
+Arena::CreateMaybeMessage< ::oram_impl::ReadFlatStreamRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::oram_impl::ReadFlatStreamRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::oram_impl::FlatChunkMessage*
+Arena::CreateMaybeMessage< ::oram_impl::FlatChunkMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::oram_impl::FlatChunkMessage >(arena);
+}
 template<> PROTOBUF_NOINLINE ::oram_impl::ReadSqrtRequest*
 Arena::CreateMaybeMessage< ::oram_impl::ReadSqrtRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::oram_impl::ReadSqrtRequest >(arena);
@@ -5115,6 +9399,14 @@ template<> PROTOBUF_NOINLINE ::oram_impl::WritePathRequest*
 Arena::CreateMaybeMessage< ::oram_impl::WritePathRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::oram_impl::WritePathRequest >(arena);
 }
+template<> PROTOBUF_NOINLINE ::oram_impl::BucketMessage*
+Arena::CreateMaybeMessage< ::oram_impl::BucketMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::oram_impl::BucketMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::oram_impl::WriteFullPathRequest*
+Arena::CreateMaybeMessage< ::oram_impl::WriteFullPathRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::oram_impl::WriteFullPathRequest >(arena);
+}
 template<> PROTOBUF_NOINLINE ::oram_impl::WritePathResponse*
 Arena::CreateMaybeMessage< ::oram_impl::WritePathResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::oram_impl::WritePathResponse >(arena);
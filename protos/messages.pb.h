@@ -13,7 +13,7 @@
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3021005 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -48,6 +48,12 @@ struct TableStruct_messages_2eproto {
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_messages_2eproto;
 namespace oram_impl {
+class BucketMessage;
+struct BucketMessageDefaultTypeInternal;
+extern BucketMessageDefaultTypeInternal _BucketMessage_default_instance_;
+class FlatChunkMessage;
+struct FlatChunkMessageDefaultTypeInternal;
+extern FlatChunkMessageDefaultTypeInternal _FlatChunkMessage_default_instance_;
 class FlatVectorMessage;
 struct FlatVectorMessageDefaultTypeInternal;
 extern FlatVectorMessageDefaultTypeInternal _FlatVectorMessage_default_instance_;
@@ -57,6 +63,9 @@ extern HelloMessageDefaultTypeInternal _HelloMessage_default_instance_;
 class InitFlatOramRequest;
 struct InitFlatOramRequestDefaultTypeInternal;
 extern InitFlatOramRequestDefaultTypeInternal _InitFlatOramRequest_default_instance_;
+class InitLayeredOramRequest;
+struct InitLayeredOramRequestDefaultTypeInternal;
+extern InitLayeredOramRequestDefaultTypeInternal _InitLayeredOramRequest_default_instance_;
 class InitSqrtOramRequest;
 struct InitSqrtOramRequestDefaultTypeInternal;
 extern InitSqrtOramRequestDefaultTypeInternal _InitSqrtOramRequest_default_instance_;
@@ -69,6 +78,12 @@ extern KeyExchangeRequestDefaultTypeInternal _KeyExchangeRequest_default_instanc
 class KeyExchangeResponse;
 struct KeyExchangeResponseDefaultTypeInternal;
 extern KeyExchangeResponseDefaultTypeInternal _KeyExchangeResponse_default_instance_;
+class LayeredBlocksMessage;
+struct LayeredBlocksMessageDefaultTypeInternal;
+extern LayeredBlocksMessageDefaultTypeInternal _LayeredBlocksMessage_default_instance_;
+class LayeredControlRequest;
+struct LayeredControlRequestDefaultTypeInternal;
+extern LayeredControlRequestDefaultTypeInternal _LayeredControlRequest_default_instance_;
 class LoadSqrtOramRequest;
 struct LoadSqrtOramRequestDefaultTypeInternal;
 extern LoadSqrtOramRequestDefaultTypeInternal _LoadSqrtOramRequest_default_instance_;
@@ -78,24 +93,51 @@ extern PrintOramTreeRequestDefaultTypeInternal _PrintOramTreeRequest_default_ins
 class ReadFlatRequest;
 struct ReadFlatRequestDefaultTypeInternal;
 extern ReadFlatRequestDefaultTypeInternal _ReadFlatRequest_default_instance_;
+class ReadFlatStreamRequest;
+struct ReadFlatStreamRequestDefaultTypeInternal;
+extern ReadFlatStreamRequestDefaultTypeInternal _ReadFlatStreamRequest_default_instance_;
+class ReadLayeredRequest;
+struct ReadLayeredRequestDefaultTypeInternal;
+extern ReadLayeredRequestDefaultTypeInternal _ReadLayeredRequest_default_instance_;
 class ReadPathRequest;
 struct ReadPathRequestDefaultTypeInternal;
 extern ReadPathRequestDefaultTypeInternal _ReadPathRequest_default_instance_;
 class ReadPathResponse;
 struct ReadPathResponseDefaultTypeInternal;
 extern ReadPathResponseDefaultTypeInternal _ReadPathResponse_default_instance_;
+class ReadShelterRequest;
+struct ReadShelterRequestDefaultTypeInternal;
+extern ReadShelterRequestDefaultTypeInternal _ReadShelterRequest_default_instance_;
+class ReadSqrtRangeRequest;
+struct ReadSqrtRangeRequestDefaultTypeInternal;
+extern ReadSqrtRangeRequestDefaultTypeInternal _ReadSqrtRangeRequest_default_instance_;
 class ReadSqrtRequest;
 struct ReadSqrtRequestDefaultTypeInternal;
 extern ReadSqrtRequestDefaultTypeInternal _ReadSqrtRequest_default_instance_;
 class RequestHeader;
 struct RequestHeaderDefaultTypeInternal;
 extern RequestHeaderDefaultTypeInternal _RequestHeader_default_instance_;
+class ShelterMessage;
+struct ShelterMessageDefaultTypeInternal;
+extern ShelterMessageDefaultTypeInternal _ShelterMessage_default_instance_;
 class SqrtMessage;
 struct SqrtMessageDefaultTypeInternal;
 extern SqrtMessageDefaultTypeInternal _SqrtMessage_default_instance_;
-class SqrtPermMessage;
-struct SqrtPermMessageDefaultTypeInternal;
-extern SqrtPermMessageDefaultTypeInternal _SqrtPermMessage_default_instance_;
+class SqrtRangeMessage;
+struct SqrtRangeMessageDefaultTypeInternal;
+extern SqrtRangeMessageDefaultTypeInternal _SqrtRangeMessage_default_instance_;
+class SqrtShuffleRequest;
+struct SqrtShuffleRequestDefaultTypeInternal;
+extern SqrtShuffleRequestDefaultTypeInternal _SqrtShuffleRequest_default_instance_;
+class WriteFullPathRequest;
+struct WriteFullPathRequestDefaultTypeInternal;
+extern WriteFullPathRequestDefaultTypeInternal _WriteFullPathRequest_default_instance_;
+class WriteLayeredRangeRequest;
+struct WriteLayeredRangeRequestDefaultTypeInternal;
+extern WriteLayeredRangeRequestDefaultTypeInternal _WriteLayeredRangeRequest_default_instance_;
+class WriteLayeredRequest;
+struct WriteLayeredRequestDefaultTypeInternal;
+extern WriteLayeredRequestDefaultTypeInternal _WriteLayeredRequest_default_instance_;
 class WritePathRequest;
 struct WritePathRequestDefaultTypeInternal;
 extern WritePathRequestDefaultTypeInternal _WritePathRequest_default_instance_;
@@ -105,27 +147,45 @@ extern WritePathResponseDefaultTypeInternal _WritePathResponse_default_instance_
 class WriteSqrtMessage;
 struct WriteSqrtMessageDefaultTypeInternal;
 extern WriteSqrtMessageDefaultTypeInternal _WriteSqrtMessage_default_instance_;
+class WriteSqrtRangeRequest;
+struct WriteSqrtRangeRequestDefaultTypeInternal;
+extern WriteSqrtRangeRequestDefaultTypeInternal _WriteSqrtRangeRequest_default_instance_;
 }  // namespace oram_impl
 PROTOBUF_NAMESPACE_OPEN
+template<> ::oram_impl::BucketMessage* Arena::CreateMaybeMessage<::oram_impl::BucketMessage>(Arena*);
+template<> ::oram_impl::FlatChunkMessage* Arena::CreateMaybeMessage<::oram_impl::FlatChunkMessage>(Arena*);
 template<> ::oram_impl::FlatVectorMessage* Arena::CreateMaybeMessage<::oram_impl::FlatVectorMessage>(Arena*);
 template<> ::oram_impl::HelloMessage* Arena::CreateMaybeMessage<::oram_impl::HelloMessage>(Arena*);
 template<> ::oram_impl::InitFlatOramRequest* Arena::CreateMaybeMessage<::oram_impl::InitFlatOramRequest>(Arena*);
+template<> ::oram_impl::InitLayeredOramRequest* Arena::CreateMaybeMessage<::oram_impl::InitLayeredOramRequest>(Arena*);
 template<> ::oram_impl::InitSqrtOramRequest* Arena::CreateMaybeMessage<::oram_impl::InitSqrtOramRequest>(Arena*);
 template<> ::oram_impl::InitTreeOramRequest* Arena::CreateMaybeMessage<::oram_impl::InitTreeOramRequest>(Arena*);
 template<> ::oram_impl::KeyExchangeRequest* Arena::CreateMaybeMessage<::oram_impl::KeyExchangeRequest>(Arena*);
 template<> ::oram_impl::KeyExchangeResponse* Arena::CreateMaybeMessage<::oram_impl::KeyExchangeResponse>(Arena*);
+template<> ::oram_impl::LayeredBlocksMessage* Arena::CreateMaybeMessage<::oram_impl::LayeredBlocksMessage>(Arena*);
+template<> ::oram_impl::LayeredControlRequest* Arena::CreateMaybeMessage<::oram_impl::LayeredControlRequest>(Arena*);
 template<> ::oram_impl::LoadSqrtOramRequest* Arena::CreateMaybeMessage<::oram_impl::LoadSqrtOramRequest>(Arena*);
 template<> ::oram_impl::PrintOramTreeRequest* Arena::CreateMaybeMessage<::oram_impl::PrintOramTreeRequest>(Arena*);
 template<> ::oram_impl::ReadFlatRequest* Arena::CreateMaybeMessage<::oram_impl::ReadFlatRequest>(Arena*);
+template<> ::oram_impl::ReadFlatStreamRequest* Arena::CreateMaybeMessage<::oram_impl::ReadFlatStreamRequest>(Arena*);
+template<> ::oram_impl::ReadLayeredRequest* Arena::CreateMaybeMessage<::oram_impl::ReadLayeredRequest>(Arena*);
 template<> ::oram_impl::ReadPathRequest* Arena::CreateMaybeMessage<::oram_impl::ReadPathRequest>(Arena*);
 template<> ::oram_impl::ReadPathResponse* Arena::CreateMaybeMessage<::oram_impl::ReadPathResponse>(Arena*);
+template<> ::oram_impl::ReadShelterRequest* Arena::CreateMaybeMessage<::oram_impl::ReadShelterRequest>(Arena*);
+template<> ::oram_impl::ReadSqrtRangeRequest* Arena::CreateMaybeMessage<::oram_impl::ReadSqrtRangeRequest>(Arena*);
 template<> ::oram_impl::ReadSqrtRequest* Arena::CreateMaybeMessage<::oram_impl::ReadSqrtRequest>(Arena*);
 template<> ::oram_impl::RequestHeader* Arena::CreateMaybeMessage<::oram_impl::RequestHeader>(Arena*);
+template<> ::oram_impl::ShelterMessage* Arena::CreateMaybeMessage<::oram_impl::ShelterMessage>(Arena*);
 template<> ::oram_impl::SqrtMessage* Arena::CreateMaybeMessage<::oram_impl::SqrtMessage>(Arena*);
-template<> ::oram_impl::SqrtPermMessage* Arena::CreateMaybeMessage<::oram_impl::SqrtPermMessage>(Arena*);
+template<> ::oram_impl::SqrtRangeMessage* Arena::CreateMaybeMessage<::oram_impl::SqrtRangeMessage>(Arena*);
+template<> ::oram_impl::SqrtShuffleRequest* Arena::CreateMaybeMessage<::oram_impl::SqrtShuffleRequest>(Arena*);
+template<> ::oram_impl::WriteFullPathRequest* Arena::CreateMaybeMessage<::oram_impl::WriteFullPathRequest>(Arena*);
+template<> ::oram_impl::WriteLayeredRangeRequest* Arena::CreateMaybeMessage<::oram_impl::WriteLayeredRangeRequest>(Arena*);
+template<> ::oram_impl::WriteLayeredRequest* Arena::CreateMaybeMessage<::oram_impl::WriteLayeredRequest>(Arena*);
 template<> ::oram_impl::WritePathRequest* Arena::CreateMaybeMessage<::oram_impl::WritePathRequest>(Arena*);
 template<> ::oram_impl::WritePathResponse* Arena::CreateMaybeMessage<::oram_impl::WritePathResponse>(Arena*);
 template<> ::oram_impl::WriteSqrtMessage* Arena::CreateMaybeMessage<::oram_impl::WriteSqrtMessage>(Arena*);
+template<> ::oram_impl::WriteSqrtRangeRequest* Arena::CreateMaybeMessage<::oram_impl::WriteSqrtRangeRequest>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace oram_impl {
 
@@ -2054,24 +2114,24 @@ class WriteSqrtMessage final :
 };
 // -------------------------------------------------------------------
 
-class SqrtPermMessage final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.SqrtPermMessage) */ {
+class ReadShelterRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.ReadShelterRequest) */ {
  public:
-  inline SqrtPermMessage() : SqrtPermMessage(nullptr) {}
-  ~SqrtPermMessage() override;
-  explicit PROTOBUF_CONSTEXPR SqrtPermMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ReadShelterRequest() : ReadShelterRequest(nullptr) {}
+  ~ReadShelterRequest() override;
+  explicit PROTOBUF_CONSTEXPR ReadShelterRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  SqrtPermMessage(const SqrtPermMessage& from);
-  SqrtPermMessage(SqrtPermMessage&& from) noexcept
-    : SqrtPermMessage() {
+  ReadShelterRequest(const ReadShelterRequest& from);
+  ReadShelterRequest(ReadShelterRequest&& from) noexcept
+    : ReadShelterRequest() {
     *this = ::std::move(from);
   }
 
-  inline SqrtPermMessage& operator=(const SqrtPermMessage& from) {
+  inline ReadShelterRequest& operator=(const ReadShelterRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline SqrtPermMessage& operator=(SqrtPermMessage&& from) noexcept {
+  inline ReadShelterRequest& operator=(ReadShelterRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2094,20 +2154,20 @@ class SqrtPermMessage final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const SqrtPermMessage& default_instance() {
+  static const ReadShelterRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const SqrtPermMessage* internal_default_instance() {
-    return reinterpret_cast<const SqrtPermMessage*>(
-               &_SqrtPermMessage_default_instance_);
+  static inline const ReadShelterRequest* internal_default_instance() {
+    return reinterpret_cast<const ReadShelterRequest*>(
+               &_ReadShelterRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     11;
 
-  friend void swap(SqrtPermMessage& a, SqrtPermMessage& b) {
+  friend void swap(ReadShelterRequest& a, ReadShelterRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(SqrtPermMessage* other) {
+  inline void Swap(ReadShelterRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2120,7 +2180,7 @@ class SqrtPermMessage final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(SqrtPermMessage* other) {
+  void UnsafeArenaSwap(ReadShelterRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2128,14 +2188,14 @@ class SqrtPermMessage final :
 
   // implements Message ----------------------------------------------
 
-  SqrtPermMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SqrtPermMessage>(arena);
+  ReadShelterRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadShelterRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const SqrtPermMessage& from);
+  void CopyFrom(const ReadShelterRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const SqrtPermMessage& from) {
-    SqrtPermMessage::MergeImpl(*this, from);
+  void MergeFrom( const ReadShelterRequest& from) {
+    ReadShelterRequest::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2153,15 +2213,15 @@ class SqrtPermMessage final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(SqrtPermMessage* other);
+  void InternalSwap(ReadShelterRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "oram_impl.SqrtPermMessage";
+    return "oram_impl.ReadShelterRequest";
   }
   protected:
-  explicit SqrtPermMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ReadShelterRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2175,31 +2235,8 @@ class SqrtPermMessage final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kPermsFieldNumber = 2,
     kHeaderFieldNumber = 1,
   };
-  // repeated uint32 perms = 2;
-  int perms_size() const;
-  private:
-  int _internal_perms_size() const;
-  public:
-  void clear_perms();
-  private:
-  uint32_t _internal_perms(int index) const;
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
-      _internal_perms() const;
-  void _internal_add_perms(uint32_t value);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
-      _internal_mutable_perms();
-  public:
-  uint32_t perms(int index) const;
-  void set_perms(int index, uint32_t value);
-  void add_perms(uint32_t value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
-      perms() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
-      mutable_perms();
-
   // .oram_impl.RequestHeader header = 1;
   bool has_header() const;
   private:
@@ -2218,7 +2255,7 @@ class SqrtPermMessage final :
       ::oram_impl::RequestHeader* header);
   ::oram_impl::RequestHeader* unsafe_arena_release_header();
 
-  // @@protoc_insertion_point(class_scope:oram_impl.SqrtPermMessage)
+  // @@protoc_insertion_point(class_scope:oram_impl.ReadShelterRequest)
  private:
   class _Internal;
 
@@ -2226,8 +2263,6 @@ class SqrtPermMessage final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > perms_;
-    mutable std::atomic<int> _perms_cached_byte_size_;
     ::oram_impl::RequestHeader* header_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
@@ -2236,24 +2271,24 @@ class SqrtPermMessage final :
 };
 // -------------------------------------------------------------------
 
-class InitTreeOramRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.InitTreeOramRequest) */ {
+class ShelterMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.ShelterMessage) */ {
  public:
-  inline InitTreeOramRequest() : InitTreeOramRequest(nullptr) {}
-  ~InitTreeOramRequest() override;
-  explicit PROTOBUF_CONSTEXPR InitTreeOramRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ShelterMessage() : ShelterMessage(nullptr) {}
+  ~ShelterMessage() override;
+  explicit PROTOBUF_CONSTEXPR ShelterMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  InitTreeOramRequest(const InitTreeOramRequest& from);
-  InitTreeOramRequest(InitTreeOramRequest&& from) noexcept
-    : InitTreeOramRequest() {
+  ShelterMessage(const ShelterMessage& from);
+  ShelterMessage(ShelterMessage&& from) noexcept
+    : ShelterMessage() {
     *this = ::std::move(from);
   }
 
-  inline InitTreeOramRequest& operator=(const InitTreeOramRequest& from) {
+  inline ShelterMessage& operator=(const ShelterMessage& from) {
     CopyFrom(from);
     return *this;
   }
-  inline InitTreeOramRequest& operator=(InitTreeOramRequest&& from) noexcept {
+  inline ShelterMessage& operator=(ShelterMessage&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2276,20 +2311,20 @@ class InitTreeOramRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const InitTreeOramRequest& default_instance() {
+  static const ShelterMessage& default_instance() {
     return *internal_default_instance();
   }
-  static inline const InitTreeOramRequest* internal_default_instance() {
-    return reinterpret_cast<const InitTreeOramRequest*>(
-               &_InitTreeOramRequest_default_instance_);
+  static inline const ShelterMessage* internal_default_instance() {
+    return reinterpret_cast<const ShelterMessage*>(
+               &_ShelterMessage_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     12;
 
-  friend void swap(InitTreeOramRequest& a, InitTreeOramRequest& b) {
+  friend void swap(ShelterMessage& a, ShelterMessage& b) {
     a.Swap(&b);
   }
-  inline void Swap(InitTreeOramRequest* other) {
+  inline void Swap(ShelterMessage* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2302,7 +2337,7 @@ class InitTreeOramRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(InitTreeOramRequest* other) {
+  void UnsafeArenaSwap(ShelterMessage* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2310,14 +2345,14 @@ class InitTreeOramRequest final :
 
   // implements Message ----------------------------------------------
 
-  InitTreeOramRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<InitTreeOramRequest>(arena);
+  ShelterMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ShelterMessage>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const InitTreeOramRequest& from);
+  void CopyFrom(const ShelterMessage& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const InitTreeOramRequest& from) {
-    InitTreeOramRequest::MergeImpl(*this, from);
+  void MergeFrom( const ShelterMessage& from) {
+    ShelterMessage::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2335,15 +2370,15 @@ class InitTreeOramRequest final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(InitTreeOramRequest* other);
+  void InternalSwap(ShelterMessage* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "oram_impl.InitTreeOramRequest";
+    return "oram_impl.ShelterMessage";
   }
   protected:
-  explicit InitTreeOramRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ShelterMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2357,57 +2392,33 @@ class InitTreeOramRequest final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kHeaderFieldNumber = 1,
-    kBucketSizeFieldNumber = 2,
-    kBucketNumFieldNumber = 3,
-    kBlockSizeFieldNumber = 4,
+    kContentsFieldNumber = 1,
   };
-  // .oram_impl.RequestHeader header = 1;
-  bool has_header() const;
-  private:
-  bool _internal_has_header() const;
-  public:
-  void clear_header();
-  const ::oram_impl::RequestHeader& header() const;
-  PROTOBUF_NODISCARD ::oram_impl::RequestHeader* release_header();
-  ::oram_impl::RequestHeader* mutable_header();
-  void set_allocated_header(::oram_impl::RequestHeader* header);
-  private:
-  const ::oram_impl::RequestHeader& _internal_header() const;
-  ::oram_impl::RequestHeader* _internal_mutable_header();
-  public:
-  void unsafe_arena_set_allocated_header(
-      ::oram_impl::RequestHeader* header);
-  ::oram_impl::RequestHeader* unsafe_arena_release_header();
-
-  // uint32 bucket_size = 2;
-  void clear_bucket_size();
-  uint32_t bucket_size() const;
-  void set_bucket_size(uint32_t value);
-  private:
-  uint32_t _internal_bucket_size() const;
-  void _internal_set_bucket_size(uint32_t value);
-  public:
-
-  // uint32 bucket_num = 3;
-  void clear_bucket_num();
-  uint32_t bucket_num() const;
-  void set_bucket_num(uint32_t value);
+  // repeated bytes contents = 1;
+  int contents_size() const;
   private:
-  uint32_t _internal_bucket_num() const;
-  void _internal_set_bucket_num(uint32_t value);
+  int _internal_contents_size() const;
   public:
-
-  // uint32 block_size = 4;
-  void clear_block_size();
-  uint32_t block_size() const;
-  void set_block_size(uint32_t value);
+  void clear_contents();
+  const std::string& contents(int index) const;
+  std::string* mutable_contents(int index);
+  void set_contents(int index, const std::string& value);
+  void set_contents(int index, std::string&& value);
+  void set_contents(int index, const char* value);
+  void set_contents(int index, const void* value, size_t size);
+  std::string* add_contents();
+  void add_contents(const std::string& value);
+  void add_contents(std::string&& value);
+  void add_contents(const char* value);
+  void add_contents(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& contents() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_contents();
   private:
-  uint32_t _internal_block_size() const;
-  void _internal_set_block_size(uint32_t value);
+  const std::string& _internal_contents(int index) const;
+  std::string* _internal_add_contents();
   public:
 
-  // @@protoc_insertion_point(class_scope:oram_impl.InitTreeOramRequest)
+  // @@protoc_insertion_point(class_scope:oram_impl.ShelterMessage)
  private:
   class _Internal;
 
@@ -2415,10 +2426,7 @@ class InitTreeOramRequest final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::oram_impl::RequestHeader* header_;
-    uint32_t bucket_size_;
-    uint32_t bucket_num_;
-    uint32_t block_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> contents_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -2426,24 +2434,24 @@ class InitTreeOramRequest final :
 };
 // -------------------------------------------------------------------
 
-class ReadFlatRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.ReadFlatRequest) */ {
+class SqrtShuffleRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.SqrtShuffleRequest) */ {
  public:
-  inline ReadFlatRequest() : ReadFlatRequest(nullptr) {}
-  ~ReadFlatRequest() override;
-  explicit PROTOBUF_CONSTEXPR ReadFlatRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline SqrtShuffleRequest() : SqrtShuffleRequest(nullptr) {}
+  ~SqrtShuffleRequest() override;
+  explicit PROTOBUF_CONSTEXPR SqrtShuffleRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ReadFlatRequest(const ReadFlatRequest& from);
-  ReadFlatRequest(ReadFlatRequest&& from) noexcept
-    : ReadFlatRequest() {
+  SqrtShuffleRequest(const SqrtShuffleRequest& from);
+  SqrtShuffleRequest(SqrtShuffleRequest&& from) noexcept
+    : SqrtShuffleRequest() {
     *this = ::std::move(from);
   }
 
-  inline ReadFlatRequest& operator=(const ReadFlatRequest& from) {
+  inline SqrtShuffleRequest& operator=(const SqrtShuffleRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ReadFlatRequest& operator=(ReadFlatRequest&& from) noexcept {
+  inline SqrtShuffleRequest& operator=(SqrtShuffleRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2466,20 +2474,20 @@ class ReadFlatRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ReadFlatRequest& default_instance() {
+  static const SqrtShuffleRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ReadFlatRequest* internal_default_instance() {
-    return reinterpret_cast<const ReadFlatRequest*>(
-               &_ReadFlatRequest_default_instance_);
+  static inline const SqrtShuffleRequest* internal_default_instance() {
+    return reinterpret_cast<const SqrtShuffleRequest*>(
+               &_SqrtShuffleRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     13;
 
-  friend void swap(ReadFlatRequest& a, ReadFlatRequest& b) {
+  friend void swap(SqrtShuffleRequest& a, SqrtShuffleRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(ReadFlatRequest* other) {
+  inline void Swap(SqrtShuffleRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2492,7 +2500,7 @@ class ReadFlatRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ReadFlatRequest* other) {
+  void UnsafeArenaSwap(SqrtShuffleRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2500,14 +2508,14 @@ class ReadFlatRequest final :
 
   // implements Message ----------------------------------------------
 
-  ReadFlatRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ReadFlatRequest>(arena);
+  SqrtShuffleRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SqrtShuffleRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ReadFlatRequest& from);
+  void CopyFrom(const SqrtShuffleRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ReadFlatRequest& from) {
-    ReadFlatRequest::MergeImpl(*this, from);
+  void MergeFrom( const SqrtShuffleRequest& from) {
+    SqrtShuffleRequest::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2525,15 +2533,15 @@ class ReadFlatRequest final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ReadFlatRequest* other);
+  void InternalSwap(SqrtShuffleRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "oram_impl.ReadFlatRequest";
+    return "oram_impl.SqrtShuffleRequest";
   }
   protected:
-  explicit ReadFlatRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit SqrtShuffleRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2548,6 +2556,8 @@ class ReadFlatRequest final :
 
   enum : int {
     kHeaderFieldNumber = 1,
+    kTypeFieldNumber = 2,
+    kTempSizeFieldNumber = 3,
   };
   // .oram_impl.RequestHeader header = 1;
   bool has_header() const;
@@ -2567,7 +2577,25 @@ class ReadFlatRequest final :
       ::oram_impl::RequestHeader* header);
   ::oram_impl::RequestHeader* unsafe_arena_release_header();
 
-  // @@protoc_insertion_point(class_scope:oram_impl.ReadFlatRequest)
+  // uint32 type = 2;
+  void clear_type();
+  uint32_t type() const;
+  void set_type(uint32_t value);
+  private:
+  uint32_t _internal_type() const;
+  void _internal_set_type(uint32_t value);
+  public:
+
+  // uint32 temp_size = 3;
+  void clear_temp_size();
+  uint32_t temp_size() const;
+  void set_temp_size(uint32_t value);
+  private:
+  uint32_t _internal_temp_size() const;
+  void _internal_set_temp_size(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:oram_impl.SqrtShuffleRequest)
  private:
   class _Internal;
 
@@ -2576,6 +2604,8 @@ class ReadFlatRequest final :
   typedef void DestructorSkippable_;
   struct Impl_ {
     ::oram_impl::RequestHeader* header_;
+    uint32_t type_;
+    uint32_t temp_size_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -2583,24 +2613,24 @@ class ReadFlatRequest final :
 };
 // -------------------------------------------------------------------
 
-class ReadSqrtRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.ReadSqrtRequest) */ {
+class ReadSqrtRangeRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.ReadSqrtRangeRequest) */ {
  public:
-  inline ReadSqrtRequest() : ReadSqrtRequest(nullptr) {}
-  ~ReadSqrtRequest() override;
-  explicit PROTOBUF_CONSTEXPR ReadSqrtRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ReadSqrtRangeRequest() : ReadSqrtRangeRequest(nullptr) {}
+  ~ReadSqrtRangeRequest() override;
+  explicit PROTOBUF_CONSTEXPR ReadSqrtRangeRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ReadSqrtRequest(const ReadSqrtRequest& from);
-  ReadSqrtRequest(ReadSqrtRequest&& from) noexcept
-    : ReadSqrtRequest() {
+  ReadSqrtRangeRequest(const ReadSqrtRangeRequest& from);
+  ReadSqrtRangeRequest(ReadSqrtRangeRequest&& from) noexcept
+    : ReadSqrtRangeRequest() {
     *this = ::std::move(from);
   }
 
-  inline ReadSqrtRequest& operator=(const ReadSqrtRequest& from) {
+  inline ReadSqrtRangeRequest& operator=(const ReadSqrtRangeRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ReadSqrtRequest& operator=(ReadSqrtRequest&& from) noexcept {
+  inline ReadSqrtRangeRequest& operator=(ReadSqrtRangeRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2623,20 +2653,20 @@ class ReadSqrtRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ReadSqrtRequest& default_instance() {
+  static const ReadSqrtRangeRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ReadSqrtRequest* internal_default_instance() {
-    return reinterpret_cast<const ReadSqrtRequest*>(
-               &_ReadSqrtRequest_default_instance_);
+  static inline const ReadSqrtRangeRequest* internal_default_instance() {
+    return reinterpret_cast<const ReadSqrtRangeRequest*>(
+               &_ReadSqrtRangeRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     14;
 
-  friend void swap(ReadSqrtRequest& a, ReadSqrtRequest& b) {
+  friend void swap(ReadSqrtRangeRequest& a, ReadSqrtRangeRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(ReadSqrtRequest* other) {
+  inline void Swap(ReadSqrtRangeRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2649,7 +2679,7 @@ class ReadSqrtRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ReadSqrtRequest* other) {
+  void UnsafeArenaSwap(ReadSqrtRangeRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2657,14 +2687,14 @@ class ReadSqrtRequest final :
 
   // implements Message ----------------------------------------------
 
-  ReadSqrtRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ReadSqrtRequest>(arena);
+  ReadSqrtRangeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadSqrtRangeRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ReadSqrtRequest& from);
+  void CopyFrom(const ReadSqrtRangeRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ReadSqrtRequest& from) {
-    ReadSqrtRequest::MergeImpl(*this, from);
+  void MergeFrom( const ReadSqrtRangeRequest& from) {
+    ReadSqrtRangeRequest::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2682,15 +2712,15 @@ class ReadSqrtRequest final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ReadSqrtRequest* other);
+  void InternalSwap(ReadSqrtRangeRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "oram_impl.ReadSqrtRequest";
+    return "oram_impl.ReadSqrtRangeRequest";
   }
   protected:
-  explicit ReadSqrtRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ReadSqrtRangeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2704,10 +2734,55 @@ class ReadSqrtRequest final :
   // accessors -------------------------------------------------------
 
   enum : int {
+    kOffsetsFieldNumber = 3,
+    kLengthsFieldNumber = 4,
     kHeaderFieldNumber = 1,
-    kTagFieldNumber = 2,
-    kReadFromFieldNumber = 3,
+    kAreaFieldNumber = 2,
   };
+  // repeated uint32 offsets = 3;
+  int offsets_size() const;
+  private:
+  int _internal_offsets_size() const;
+  public:
+  void clear_offsets();
+  private:
+  uint32_t _internal_offsets(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_offsets() const;
+  void _internal_add_offsets(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_offsets();
+  public:
+  uint32_t offsets(int index) const;
+  void set_offsets(int index, uint32_t value);
+  void add_offsets(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      offsets() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_offsets();
+
+  // repeated uint32 lengths = 4;
+  int lengths_size() const;
+  private:
+  int _internal_lengths_size() const;
+  public:
+  void clear_lengths();
+  private:
+  uint32_t _internal_lengths(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_lengths() const;
+  void _internal_add_lengths(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_lengths();
+  public:
+  uint32_t lengths(int index) const;
+  void set_lengths(int index, uint32_t value);
+  void add_lengths(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      lengths() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_lengths();
+
   // .oram_impl.RequestHeader header = 1;
   bool has_header() const;
   private:
@@ -2726,25 +2801,16 @@ class ReadSqrtRequest final :
       ::oram_impl::RequestHeader* header);
   ::oram_impl::RequestHeader* unsafe_arena_release_header();
 
-  // uint32 tag = 2;
-  void clear_tag();
-  uint32_t tag() const;
-  void set_tag(uint32_t value);
-  private:
-  uint32_t _internal_tag() const;
-  void _internal_set_tag(uint32_t value);
-  public:
-
-  // uint32 read_from = 3;
-  void clear_read_from();
-  uint32_t read_from() const;
-  void set_read_from(uint32_t value);
+  // uint32 area = 2;
+  void clear_area();
+  uint32_t area() const;
+  void set_area(uint32_t value);
   private:
-  uint32_t _internal_read_from() const;
-  void _internal_set_read_from(uint32_t value);
+  uint32_t _internal_area() const;
+  void _internal_set_area(uint32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:oram_impl.ReadSqrtRequest)
+  // @@protoc_insertion_point(class_scope:oram_impl.ReadSqrtRangeRequest)
  private:
   class _Internal;
 
@@ -2752,9 +2818,12 @@ class ReadSqrtRequest final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > offsets_;
+    mutable std::atomic<int> _offsets_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > lengths_;
+    mutable std::atomic<int> _lengths_cached_byte_size_;
     ::oram_impl::RequestHeader* header_;
-    uint32_t tag_;
-    uint32_t read_from_;
+    uint32_t area_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -2762,24 +2831,24 @@ class ReadSqrtRequest final :
 };
 // -------------------------------------------------------------------
 
-class ReadPathRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.ReadPathRequest) */ {
+class SqrtRangeMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.SqrtRangeMessage) */ {
  public:
-  inline ReadPathRequest() : ReadPathRequest(nullptr) {}
-  ~ReadPathRequest() override;
-  explicit PROTOBUF_CONSTEXPR ReadPathRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline SqrtRangeMessage() : SqrtRangeMessage(nullptr) {}
+  ~SqrtRangeMessage() override;
+  explicit PROTOBUF_CONSTEXPR SqrtRangeMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ReadPathRequest(const ReadPathRequest& from);
-  ReadPathRequest(ReadPathRequest&& from) noexcept
-    : ReadPathRequest() {
+  SqrtRangeMessage(const SqrtRangeMessage& from);
+  SqrtRangeMessage(SqrtRangeMessage&& from) noexcept
+    : SqrtRangeMessage() {
     *this = ::std::move(from);
   }
 
-  inline ReadPathRequest& operator=(const ReadPathRequest& from) {
+  inline SqrtRangeMessage& operator=(const SqrtRangeMessage& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ReadPathRequest& operator=(ReadPathRequest&& from) noexcept {
+  inline SqrtRangeMessage& operator=(SqrtRangeMessage&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2802,20 +2871,20 @@ class ReadPathRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ReadPathRequest& default_instance() {
+  static const SqrtRangeMessage& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ReadPathRequest* internal_default_instance() {
-    return reinterpret_cast<const ReadPathRequest*>(
-               &_ReadPathRequest_default_instance_);
+  static inline const SqrtRangeMessage* internal_default_instance() {
+    return reinterpret_cast<const SqrtRangeMessage*>(
+               &_SqrtRangeMessage_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     15;
 
-  friend void swap(ReadPathRequest& a, ReadPathRequest& b) {
+  friend void swap(SqrtRangeMessage& a, SqrtRangeMessage& b) {
     a.Swap(&b);
   }
-  inline void Swap(ReadPathRequest* other) {
+  inline void Swap(SqrtRangeMessage* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2828,7 +2897,7 @@ class ReadPathRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ReadPathRequest* other) {
+  void UnsafeArenaSwap(SqrtRangeMessage* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2836,14 +2905,14 @@ class ReadPathRequest final :
 
   // implements Message ----------------------------------------------
 
-  ReadPathRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ReadPathRequest>(arena);
+  SqrtRangeMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SqrtRangeMessage>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ReadPathRequest& from);
+  void CopyFrom(const SqrtRangeMessage& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ReadPathRequest& from) {
-    ReadPathRequest::MergeImpl(*this, from);
+  void MergeFrom( const SqrtRangeMessage& from) {
+    SqrtRangeMessage::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2861,15 +2930,15 @@ class ReadPathRequest final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ReadPathRequest* other);
+  void InternalSwap(SqrtRangeMessage* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "oram_impl.ReadPathRequest";
+    return "oram_impl.SqrtRangeMessage";
   }
   protected:
-  explicit ReadPathRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit SqrtRangeMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2883,47 +2952,33 @@ class ReadPathRequest final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kHeaderFieldNumber = 1,
-    kPathFieldNumber = 2,
-    kLevelFieldNumber = 3,
+    kContentsFieldNumber = 1,
   };
-  // .oram_impl.RequestHeader header = 1;
-  bool has_header() const;
+  // repeated bytes contents = 1;
+  int contents_size() const;
   private:
-  bool _internal_has_header() const;
+  int _internal_contents_size() const;
   public:
-  void clear_header();
-  const ::oram_impl::RequestHeader& header() const;
-  PROTOBUF_NODISCARD ::oram_impl::RequestHeader* release_header();
-  ::oram_impl::RequestHeader* mutable_header();
-  void set_allocated_header(::oram_impl::RequestHeader* header);
+  void clear_contents();
+  const std::string& contents(int index) const;
+  std::string* mutable_contents(int index);
+  void set_contents(int index, const std::string& value);
+  void set_contents(int index, std::string&& value);
+  void set_contents(int index, const char* value);
+  void set_contents(int index, const void* value, size_t size);
+  std::string* add_contents();
+  void add_contents(const std::string& value);
+  void add_contents(std::string&& value);
+  void add_contents(const char* value);
+  void add_contents(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& contents() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_contents();
   private:
-  const ::oram_impl::RequestHeader& _internal_header() const;
-  ::oram_impl::RequestHeader* _internal_mutable_header();
-  public:
-  void unsafe_arena_set_allocated_header(
-      ::oram_impl::RequestHeader* header);
-  ::oram_impl::RequestHeader* unsafe_arena_release_header();
-
-  // uint32 path = 2;
-  void clear_path();
-  uint32_t path() const;
-  void set_path(uint32_t value);
-  private:
-  uint32_t _internal_path() const;
-  void _internal_set_path(uint32_t value);
-  public:
-
-  // uint32 level = 3;
-  void clear_level();
-  uint32_t level() const;
-  void set_level(uint32_t value);
-  private:
-  uint32_t _internal_level() const;
-  void _internal_set_level(uint32_t value);
+  const std::string& _internal_contents(int index) const;
+  std::string* _internal_add_contents();
   public:
 
-  // @@protoc_insertion_point(class_scope:oram_impl.ReadPathRequest)
+  // @@protoc_insertion_point(class_scope:oram_impl.SqrtRangeMessage)
  private:
   class _Internal;
 
@@ -2931,9 +2986,7 @@ class ReadPathRequest final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::oram_impl::RequestHeader* header_;
-    uint32_t path_;
-    uint32_t level_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> contents_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -2941,24 +2994,24 @@ class ReadPathRequest final :
 };
 // -------------------------------------------------------------------
 
-class ReadPathResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.ReadPathResponse) */ {
+class WriteSqrtRangeRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.WriteSqrtRangeRequest) */ {
  public:
-  inline ReadPathResponse() : ReadPathResponse(nullptr) {}
-  ~ReadPathResponse() override;
-  explicit PROTOBUF_CONSTEXPR ReadPathResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline WriteSqrtRangeRequest() : WriteSqrtRangeRequest(nullptr) {}
+  ~WriteSqrtRangeRequest() override;
+  explicit PROTOBUF_CONSTEXPR WriteSqrtRangeRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ReadPathResponse(const ReadPathResponse& from);
-  ReadPathResponse(ReadPathResponse&& from) noexcept
-    : ReadPathResponse() {
+  WriteSqrtRangeRequest(const WriteSqrtRangeRequest& from);
+  WriteSqrtRangeRequest(WriteSqrtRangeRequest&& from) noexcept
+    : WriteSqrtRangeRequest() {
     *this = ::std::move(from);
   }
 
-  inline ReadPathResponse& operator=(const ReadPathResponse& from) {
+  inline WriteSqrtRangeRequest& operator=(const WriteSqrtRangeRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ReadPathResponse& operator=(ReadPathResponse&& from) noexcept {
+  inline WriteSqrtRangeRequest& operator=(WriteSqrtRangeRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2981,20 +3034,20 @@ class ReadPathResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ReadPathResponse& default_instance() {
+  static const WriteSqrtRangeRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ReadPathResponse* internal_default_instance() {
-    return reinterpret_cast<const ReadPathResponse*>(
-               &_ReadPathResponse_default_instance_);
+  static inline const WriteSqrtRangeRequest* internal_default_instance() {
+    return reinterpret_cast<const WriteSqrtRangeRequest*>(
+               &_WriteSqrtRangeRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     16;
 
-  friend void swap(ReadPathResponse& a, ReadPathResponse& b) {
+  friend void swap(WriteSqrtRangeRequest& a, WriteSqrtRangeRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(ReadPathResponse* other) {
+  inline void Swap(WriteSqrtRangeRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -3007,7 +3060,7 @@ class ReadPathResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ReadPathResponse* other) {
+  void UnsafeArenaSwap(WriteSqrtRangeRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -3015,14 +3068,14 @@ class ReadPathResponse final :
 
   // implements Message ----------------------------------------------
 
-  ReadPathResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ReadPathResponse>(arena);
+  WriteSqrtRangeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WriteSqrtRangeRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ReadPathResponse& from);
+  void CopyFrom(const WriteSqrtRangeRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ReadPathResponse& from) {
-    ReadPathResponse::MergeImpl(*this, from);
+  void MergeFrom( const WriteSqrtRangeRequest& from) {
+    WriteSqrtRangeRequest::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -3040,15 +3093,15 @@ class ReadPathResponse final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ReadPathResponse* other);
+  void InternalSwap(WriteSqrtRangeRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "oram_impl.ReadPathResponse";
+    return "oram_impl.WriteSqrtRangeRequest";
   }
   protected:
-  explicit ReadPathResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit WriteSqrtRangeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -3062,33 +3115,72 @@ class ReadPathResponse final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kBucketFieldNumber = 1,
+    kContentsFieldNumber = 4,
+    kHeaderFieldNumber = 1,
+    kAreaFieldNumber = 2,
+    kOffsetFieldNumber = 3,
   };
-  // repeated bytes bucket = 1;
-  int bucket_size() const;
+  // repeated bytes contents = 4;
+  int contents_size() const;
   private:
-  int _internal_bucket_size() const;
+  int _internal_contents_size() const;
   public:
-  void clear_bucket();
-  const std::string& bucket(int index) const;
-  std::string* mutable_bucket(int index);
-  void set_bucket(int index, const std::string& value);
-  void set_bucket(int index, std::string&& value);
-  void set_bucket(int index, const char* value);
-  void set_bucket(int index, const void* value, size_t size);
-  std::string* add_bucket();
-  void add_bucket(const std::string& value);
-  void add_bucket(std::string&& value);
-  void add_bucket(const char* value);
-  void add_bucket(const void* value, size_t size);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& bucket() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_bucket();
+  void clear_contents();
+  const std::string& contents(int index) const;
+  std::string* mutable_contents(int index);
+  void set_contents(int index, const std::string& value);
+  void set_contents(int index, std::string&& value);
+  void set_contents(int index, const char* value);
+  void set_contents(int index, const void* value, size_t size);
+  std::string* add_contents();
+  void add_contents(const std::string& value);
+  void add_contents(std::string&& value);
+  void add_contents(const char* value);
+  void add_contents(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& contents() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_contents();
   private:
-  const std::string& _internal_bucket(int index) const;
-  std::string* _internal_add_bucket();
+  const std::string& _internal_contents(int index) const;
+  std::string* _internal_add_contents();
   public:
 
-  // @@protoc_insertion_point(class_scope:oram_impl.ReadPathResponse)
+  // .oram_impl.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::oram_impl::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::oram_impl::RequestHeader* release_header();
+  ::oram_impl::RequestHeader* mutable_header();
+  void set_allocated_header(::oram_impl::RequestHeader* header);
+  private:
+  const ::oram_impl::RequestHeader& _internal_header() const;
+  ::oram_impl::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::oram_impl::RequestHeader* header);
+  ::oram_impl::RequestHeader* unsafe_arena_release_header();
+
+  // uint32 area = 2;
+  void clear_area();
+  uint32_t area() const;
+  void set_area(uint32_t value);
+  private:
+  uint32_t _internal_area() const;
+  void _internal_set_area(uint32_t value);
+  public:
+
+  // uint32 offset = 3;
+  void clear_offset();
+  uint32_t offset() const;
+  void set_offset(uint32_t value);
+  private:
+  uint32_t _internal_offset() const;
+  void _internal_set_offset(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:oram_impl.WriteSqrtRangeRequest)
  private:
   class _Internal;
 
@@ -3096,7 +3188,10 @@ class ReadPathResponse final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> bucket_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> contents_;
+    ::oram_impl::RequestHeader* header_;
+    uint32_t area_;
+    uint32_t offset_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -3104,24 +3199,24 @@ class ReadPathResponse final :
 };
 // -------------------------------------------------------------------
 
-class WritePathRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.WritePathRequest) */ {
+class InitLayeredOramRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.InitLayeredOramRequest) */ {
  public:
-  inline WritePathRequest() : WritePathRequest(nullptr) {}
-  ~WritePathRequest() override;
-  explicit PROTOBUF_CONSTEXPR WritePathRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline InitLayeredOramRequest() : InitLayeredOramRequest(nullptr) {}
+  ~InitLayeredOramRequest() override;
+  explicit PROTOBUF_CONSTEXPR InitLayeredOramRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  WritePathRequest(const WritePathRequest& from);
-  WritePathRequest(WritePathRequest&& from) noexcept
-    : WritePathRequest() {
+  InitLayeredOramRequest(const InitLayeredOramRequest& from);
+  InitLayeredOramRequest(InitLayeredOramRequest&& from) noexcept
+    : InitLayeredOramRequest() {
     *this = ::std::move(from);
   }
 
-  inline WritePathRequest& operator=(const WritePathRequest& from) {
+  inline InitLayeredOramRequest& operator=(const InitLayeredOramRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline WritePathRequest& operator=(WritePathRequest&& from) noexcept {
+  inline InitLayeredOramRequest& operator=(InitLayeredOramRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -3144,20 +3239,20 @@ class WritePathRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const WritePathRequest& default_instance() {
+  static const InitLayeredOramRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const WritePathRequest* internal_default_instance() {
-    return reinterpret_cast<const WritePathRequest*>(
-               &_WritePathRequest_default_instance_);
+  static inline const InitLayeredOramRequest* internal_default_instance() {
+    return reinterpret_cast<const InitLayeredOramRequest*>(
+               &_InitLayeredOramRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     17;
 
-  friend void swap(WritePathRequest& a, WritePathRequest& b) {
+  friend void swap(InitLayeredOramRequest& a, InitLayeredOramRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(WritePathRequest* other) {
+  inline void Swap(InitLayeredOramRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -3170,7 +3265,7 @@ class WritePathRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(WritePathRequest* other) {
+  void UnsafeArenaSwap(InitLayeredOramRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -3178,14 +3273,14 @@ class WritePathRequest final :
 
   // implements Message ----------------------------------------------
 
-  WritePathRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<WritePathRequest>(arena);
+  InitLayeredOramRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InitLayeredOramRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const WritePathRequest& from);
+  void CopyFrom(const InitLayeredOramRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const WritePathRequest& from) {
-    WritePathRequest::MergeImpl(*this, from);
+  void MergeFrom( const InitLayeredOramRequest& from) {
+    InitLayeredOramRequest::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -3203,15 +3298,15 @@ class WritePathRequest final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(WritePathRequest* other);
+  void InternalSwap(InitLayeredOramRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "oram_impl.WritePathRequest";
+    return "oram_impl.InitLayeredOramRequest";
   }
   protected:
-  explicit WritePathRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit InitLayeredOramRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -3225,37 +3320,10 @@ class WritePathRequest final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kBucketFieldNumber = 4,
     kHeaderFieldNumber = 1,
-    kPathFieldNumber = 2,
-    kLevelFieldNumber = 3,
-    kTypeFieldNumber = 5,
-    kOffsetFieldNumber = 6,
+    kLevelNumFieldNumber = 2,
+    kBlockSizeFieldNumber = 3,
   };
-  // repeated bytes bucket = 4;
-  int bucket_size() const;
-  private:
-  int _internal_bucket_size() const;
-  public:
-  void clear_bucket();
-  const std::string& bucket(int index) const;
-  std::string* mutable_bucket(int index);
-  void set_bucket(int index, const std::string& value);
-  void set_bucket(int index, std::string&& value);
-  void set_bucket(int index, const char* value);
-  void set_bucket(int index, const void* value, size_t size);
-  std::string* add_bucket();
-  void add_bucket(const std::string& value);
-  void add_bucket(std::string&& value);
-  void add_bucket(const char* value);
-  void add_bucket(const void* value, size_t size);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& bucket() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_bucket();
-  private:
-  const std::string& _internal_bucket(int index) const;
-  std::string* _internal_add_bucket();
-  public:
-
   // .oram_impl.RequestHeader header = 1;
   bool has_header() const;
   private:
@@ -3274,51 +3342,25 @@ class WritePathRequest final :
       ::oram_impl::RequestHeader* header);
   ::oram_impl::RequestHeader* unsafe_arena_release_header();
 
-  // uint32 path = 2;
-  void clear_path();
-  uint32_t path() const;
-  void set_path(uint32_t value);
-  private:
-  uint32_t _internal_path() const;
-  void _internal_set_path(uint32_t value);
-  public:
-
-  // uint32 level = 3;
-  void clear_level();
-  uint32_t level() const;
-  void set_level(uint32_t value);
-  private:
-  uint32_t _internal_level() const;
-  void _internal_set_level(uint32_t value);
-  public:
-
-  // optional .oram_impl.Type type = 5;
-  bool has_type() const;
-  private:
-  bool _internal_has_type() const;
-  public:
-  void clear_type();
-  ::oram_impl::Type type() const;
-  void set_type(::oram_impl::Type value);
+  // uint32 level_num = 2;
+  void clear_level_num();
+  uint32_t level_num() const;
+  void set_level_num(uint32_t value);
   private:
-  ::oram_impl::Type _internal_type() const;
-  void _internal_set_type(::oram_impl::Type value);
+  uint32_t _internal_level_num() const;
+  void _internal_set_level_num(uint32_t value);
   public:
 
-  // optional uint32 offset = 6;
-  bool has_offset() const;
-  private:
-  bool _internal_has_offset() const;
-  public:
-  void clear_offset();
-  uint32_t offset() const;
-  void set_offset(uint32_t value);
+  // uint32 block_size = 3;
+  void clear_block_size();
+  uint32_t block_size() const;
+  void set_block_size(uint32_t value);
   private:
-  uint32_t _internal_offset() const;
-  void _internal_set_offset(uint32_t value);
+  uint32_t _internal_block_size() const;
+  void _internal_set_block_size(uint32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:oram_impl.WritePathRequest)
+  // @@protoc_insertion_point(class_scope:oram_impl.InitLayeredOramRequest)
  private:
   class _Internal;
 
@@ -3326,37 +3368,34 @@ class WritePathRequest final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> bucket_;
     ::oram_impl::RequestHeader* header_;
-    uint32_t path_;
-    uint32_t level_;
-    int type_;
-    uint32_t offset_;
+    uint32_t level_num_;
+    uint32_t block_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
 
-class WritePathResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:oram_impl.WritePathResponse) */ {
+class ReadLayeredRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.ReadLayeredRequest) */ {
  public:
-  inline WritePathResponse() : WritePathResponse(nullptr) {}
-  explicit PROTOBUF_CONSTEXPR WritePathResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ReadLayeredRequest() : ReadLayeredRequest(nullptr) {}
+  ~ReadLayeredRequest() override;
+  explicit PROTOBUF_CONSTEXPR ReadLayeredRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  WritePathResponse(const WritePathResponse& from);
-  WritePathResponse(WritePathResponse&& from) noexcept
-    : WritePathResponse() {
+  ReadLayeredRequest(const ReadLayeredRequest& from);
+  ReadLayeredRequest(ReadLayeredRequest&& from) noexcept
+    : ReadLayeredRequest() {
     *this = ::std::move(from);
   }
 
-  inline WritePathResponse& operator=(const WritePathResponse& from) {
+  inline ReadLayeredRequest& operator=(const ReadLayeredRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline WritePathResponse& operator=(WritePathResponse&& from) noexcept {
+  inline ReadLayeredRequest& operator=(ReadLayeredRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -3379,20 +3418,20 @@ class WritePathResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const WritePathResponse& default_instance() {
+  static const ReadLayeredRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const WritePathResponse* internal_default_instance() {
-    return reinterpret_cast<const WritePathResponse*>(
-               &_WritePathResponse_default_instance_);
+  static inline const ReadLayeredRequest* internal_default_instance() {
+    return reinterpret_cast<const ReadLayeredRequest*>(
+               &_ReadLayeredRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     18;
 
-  friend void swap(WritePathResponse& a, WritePathResponse& b) {
+  friend void swap(ReadLayeredRequest& a, ReadLayeredRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(WritePathResponse* other) {
+  inline void Swap(ReadLayeredRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -3405,7 +3444,7 @@ class WritePathResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(WritePathResponse* other) {
+  void UnsafeArenaSwap(ReadLayeredRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -3413,26 +3452,40 @@ class WritePathResponse final :
 
   // implements Message ----------------------------------------------
 
-  WritePathResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<WritePathResponse>(arena);
+  ReadLayeredRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadLayeredRequest>(arena);
   }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
-  inline void CopyFrom(const WritePathResponse& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
-  void MergeFrom(const WritePathResponse& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReadLayeredRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadLayeredRequest& from) {
+    ReadLayeredRequest::MergeImpl(*this, from);
   }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReadLayeredRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "oram_impl.WritePathResponse";
+    return "oram_impl.ReadLayeredRequest";
   }
   protected:
-  explicit WritePathResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ReadLayeredRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -3445,7 +3498,74 @@ class WritePathResponse final :
 
   // accessors -------------------------------------------------------
 
-  // @@protoc_insertion_point(class_scope:oram_impl.WritePathResponse)
+  enum : int {
+    kLevelsFieldNumber = 2,
+    kOffsetsFieldNumber = 3,
+    kHeaderFieldNumber = 1,
+  };
+  // repeated uint32 levels = 2;
+  int levels_size() const;
+  private:
+  int _internal_levels_size() const;
+  public:
+  void clear_levels();
+  private:
+  uint32_t _internal_levels(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_levels() const;
+  void _internal_add_levels(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_levels();
+  public:
+  uint32_t levels(int index) const;
+  void set_levels(int index, uint32_t value);
+  void add_levels(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      levels() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_levels();
+
+  // repeated uint32 offsets = 3;
+  int offsets_size() const;
+  private:
+  int _internal_offsets_size() const;
+  public:
+  void clear_offsets();
+  private:
+  uint32_t _internal_offsets(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_offsets() const;
+  void _internal_add_offsets(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_offsets();
+  public:
+  uint32_t offsets(int index) const;
+  void set_offsets(int index, uint32_t value);
+  void add_offsets(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      offsets() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_offsets();
+
+  // .oram_impl.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::oram_impl::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::oram_impl::RequestHeader* release_header();
+  ::oram_impl::RequestHeader* mutable_header();
+  void set_allocated_header(::oram_impl::RequestHeader* header);
+  private:
+  const ::oram_impl::RequestHeader& _internal_header() const;
+  ::oram_impl::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::oram_impl::RequestHeader* header);
+  ::oram_impl::RequestHeader* unsafe_arena_release_header();
+
+  // @@protoc_insertion_point(class_scope:oram_impl.ReadLayeredRequest)
  private:
   class _Internal;
 
@@ -3453,403 +3573,4891 @@ class WritePathResponse final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > levels_;
+    mutable std::atomic<int> _levels_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > offsets_;
+    mutable std::atomic<int> _offsets_cached_byte_size_;
+    ::oram_impl::RequestHeader* header_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class LayeredBlocksMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.LayeredBlocksMessage) */ {
+ public:
+  inline LayeredBlocksMessage() : LayeredBlocksMessage(nullptr) {}
+  ~LayeredBlocksMessage() override;
+  explicit PROTOBUF_CONSTEXPR LayeredBlocksMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  LayeredBlocksMessage(const LayeredBlocksMessage& from);
+  LayeredBlocksMessage(LayeredBlocksMessage&& from) noexcept
+    : LayeredBlocksMessage() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// RequestHeader
+  inline LayeredBlocksMessage& operator=(const LayeredBlocksMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LayeredBlocksMessage& operator=(LayeredBlocksMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// bytes instance_hash = 1;
-inline void RequestHeader::clear_instance_hash() {
-  _impl_.instance_hash_.ClearToEmpty();
-}
-inline const std::string& RequestHeader::instance_hash() const {
-  // @@protoc_insertion_point(field_get:oram_impl.RequestHeader.instance_hash)
-  return _internal_instance_hash();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void RequestHeader::set_instance_hash(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.instance_hash_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:oram_impl.RequestHeader.instance_hash)
-}
-inline std::string* RequestHeader::mutable_instance_hash() {
-  std::string* _s = _internal_mutable_instance_hash();
-  // @@protoc_insertion_point(field_mutable:oram_impl.RequestHeader.instance_hash)
-  return _s;
-}
-inline const std::string& RequestHeader::_internal_instance_hash() const {
-  return _impl_.instance_hash_.Get();
-}
-inline void RequestHeader::_internal_set_instance_hash(const std::string& value) {
-  
-  _impl_.instance_hash_.Set(value, GetArenaForAllocation());
-}
-inline std::string* RequestHeader::_internal_mutable_instance_hash() {
-  
-  return _impl_.instance_hash_.Mutable(GetArenaForAllocation());
-}
-inline std::string* RequestHeader::release_instance_hash() {
-  // @@protoc_insertion_point(field_release:oram_impl.RequestHeader.instance_hash)
-  return _impl_.instance_hash_.Release();
-}
-inline void RequestHeader::set_allocated_instance_hash(std::string* instance_hash) {
-  if (instance_hash != nullptr) {
-    
-  } else {
-    
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
   }
-  _impl_.instance_hash_.SetAllocated(instance_hash, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.instance_hash_.IsDefault()) {
-    _impl_.instance_hash_.Set("", GetArenaForAllocation());
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.RequestHeader.instance_hash)
-}
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LayeredBlocksMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LayeredBlocksMessage* internal_default_instance() {
+    return reinterpret_cast<const LayeredBlocksMessage*>(
+               &_LayeredBlocksMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
 
-// bytes version = 2;
-inline void RequestHeader::clear_version() {
-  _impl_.version_.ClearToEmpty();
-}
-inline const std::string& RequestHeader::version() const {
-  // @@protoc_insertion_point(field_get:oram_impl.RequestHeader.version)
-  return _internal_version();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void RequestHeader::set_version(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.version_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:oram_impl.RequestHeader.version)
-}
-inline std::string* RequestHeader::mutable_version() {
-  std::string* _s = _internal_mutable_version();
-  // @@protoc_insertion_point(field_mutable:oram_impl.RequestHeader.version)
-  return _s;
-}
-inline const std::string& RequestHeader::_internal_version() const {
-  return _impl_.version_.Get();
-}
-inline void RequestHeader::_internal_set_version(const std::string& value) {
-  
-  _impl_.version_.Set(value, GetArenaForAllocation());
-}
-inline std::string* RequestHeader::_internal_mutable_version() {
-  
-  return _impl_.version_.Mutable(GetArenaForAllocation());
+  friend void swap(LayeredBlocksMessage& a, LayeredBlocksMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LayeredBlocksMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LayeredBlocksMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LayeredBlocksMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LayeredBlocksMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LayeredBlocksMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LayeredBlocksMessage& from) {
+    LayeredBlocksMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LayeredBlocksMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "oram_impl.LayeredBlocksMessage";
+  }
+  protected:
+  explicit LayeredBlocksMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kContentsFieldNumber = 1,
+  };
+  // repeated bytes contents = 1;
+  int contents_size() const;
+  private:
+  int _internal_contents_size() const;
+  public:
+  void clear_contents();
+  const std::string& contents(int index) const;
+  std::string* mutable_contents(int index);
+  void set_contents(int index, const std::string& value);
+  void set_contents(int index, std::string&& value);
+  void set_contents(int index, const char* value);
+  void set_contents(int index, const void* value, size_t size);
+  std::string* add_contents();
+  void add_contents(const std::string& value);
+  void add_contents(std::string&& value);
+  void add_contents(const char* value);
+  void add_contents(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& contents() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_contents();
+  private:
+  const std::string& _internal_contents(int index) const;
+  std::string* _internal_add_contents();
+  public:
+
+  // @@protoc_insertion_point(class_scope:oram_impl.LayeredBlocksMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> contents_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WriteLayeredRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.WriteLayeredRequest) */ {
+ public:
+  inline WriteLayeredRequest() : WriteLayeredRequest(nullptr) {}
+  ~WriteLayeredRequest() override;
+  explicit PROTOBUF_CONSTEXPR WriteLayeredRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WriteLayeredRequest(const WriteLayeredRequest& from);
+  WriteLayeredRequest(WriteLayeredRequest&& from) noexcept
+    : WriteLayeredRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline WriteLayeredRequest& operator=(const WriteLayeredRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WriteLayeredRequest& operator=(WriteLayeredRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteLayeredRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WriteLayeredRequest* internal_default_instance() {
+    return reinterpret_cast<const WriteLayeredRequest*>(
+               &_WriteLayeredRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(WriteLayeredRequest& a, WriteLayeredRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WriteLayeredRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteLayeredRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WriteLayeredRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WriteLayeredRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WriteLayeredRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteLayeredRequest& from) {
+    WriteLayeredRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WriteLayeredRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "oram_impl.WriteLayeredRequest";
+  }
+  protected:
+  explicit WriteLayeredRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kContentsFieldNumber = 3,
+    kClearedLevelsFieldNumber = 4,
+    kHeaderFieldNumber = 1,
+    kLevelFieldNumber = 2,
+  };
+  // repeated bytes contents = 3;
+  int contents_size() const;
+  private:
+  int _internal_contents_size() const;
+  public:
+  void clear_contents();
+  const std::string& contents(int index) const;
+  std::string* mutable_contents(int index);
+  void set_contents(int index, const std::string& value);
+  void set_contents(int index, std::string&& value);
+  void set_contents(int index, const char* value);
+  void set_contents(int index, const void* value, size_t size);
+  std::string* add_contents();
+  void add_contents(const std::string& value);
+  void add_contents(std::string&& value);
+  void add_contents(const char* value);
+  void add_contents(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& contents() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_contents();
+  private:
+  const std::string& _internal_contents(int index) const;
+  std::string* _internal_add_contents();
+  public:
+
+  // repeated uint32 cleared_levels = 4;
+  int cleared_levels_size() const;
+  private:
+  int _internal_cleared_levels_size() const;
+  public:
+  void clear_cleared_levels();
+  private:
+  uint32_t _internal_cleared_levels(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_cleared_levels() const;
+  void _internal_add_cleared_levels(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_cleared_levels();
+  public:
+  uint32_t cleared_levels(int index) const;
+  void set_cleared_levels(int index, uint32_t value);
+  void add_cleared_levels(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      cleared_levels() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_cleared_levels();
+
+  // .oram_impl.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::oram_impl::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::oram_impl::RequestHeader* release_header();
+  ::oram_impl::RequestHeader* mutable_header();
+  void set_allocated_header(::oram_impl::RequestHeader* header);
+  private:
+  const ::oram_impl::RequestHeader& _internal_header() const;
+  ::oram_impl::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::oram_impl::RequestHeader* header);
+  ::oram_impl::RequestHeader* unsafe_arena_release_header();
+
+  // uint32 level = 2;
+  void clear_level();
+  uint32_t level() const;
+  void set_level(uint32_t value);
+  private:
+  uint32_t _internal_level() const;
+  void _internal_set_level(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:oram_impl.WriteLayeredRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> contents_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > cleared_levels_;
+    mutable std::atomic<int> _cleared_levels_cached_byte_size_;
+    ::oram_impl::RequestHeader* header_;
+    uint32_t level_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WriteLayeredRangeRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.WriteLayeredRangeRequest) */ {
+ public:
+  inline WriteLayeredRangeRequest() : WriteLayeredRangeRequest(nullptr) {}
+  ~WriteLayeredRangeRequest() override;
+  explicit PROTOBUF_CONSTEXPR WriteLayeredRangeRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WriteLayeredRangeRequest(const WriteLayeredRangeRequest& from);
+  WriteLayeredRangeRequest(WriteLayeredRangeRequest&& from) noexcept
+    : WriteLayeredRangeRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline WriteLayeredRangeRequest& operator=(const WriteLayeredRangeRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WriteLayeredRangeRequest& operator=(WriteLayeredRangeRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteLayeredRangeRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WriteLayeredRangeRequest* internal_default_instance() {
+    return reinterpret_cast<const WriteLayeredRangeRequest*>(
+               &_WriteLayeredRangeRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(WriteLayeredRangeRequest& a, WriteLayeredRangeRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WriteLayeredRangeRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteLayeredRangeRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WriteLayeredRangeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WriteLayeredRangeRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WriteLayeredRangeRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteLayeredRangeRequest& from) {
+    WriteLayeredRangeRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WriteLayeredRangeRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "oram_impl.WriteLayeredRangeRequest";
+  }
+  protected:
+  explicit WriteLayeredRangeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kContentsFieldNumber = 4,
+    kHeaderFieldNumber = 1,
+    kLevelFieldNumber = 2,
+    kOffsetFieldNumber = 3,
+  };
+  // repeated bytes contents = 4;
+  int contents_size() const;
+  private:
+  int _internal_contents_size() const;
+  public:
+  void clear_contents();
+  const std::string& contents(int index) const;
+  std::string* mutable_contents(int index);
+  void set_contents(int index, const std::string& value);
+  void set_contents(int index, std::string&& value);
+  void set_contents(int index, const char* value);
+  void set_contents(int index, const void* value, size_t size);
+  std::string* add_contents();
+  void add_contents(const std::string& value);
+  void add_contents(std::string&& value);
+  void add_contents(const char* value);
+  void add_contents(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& contents() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_contents();
+  private:
+  const std::string& _internal_contents(int index) const;
+  std::string* _internal_add_contents();
+  public:
+
+  // .oram_impl.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::oram_impl::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::oram_impl::RequestHeader* release_header();
+  ::oram_impl::RequestHeader* mutable_header();
+  void set_allocated_header(::oram_impl::RequestHeader* header);
+  private:
+  const ::oram_impl::RequestHeader& _internal_header() const;
+  ::oram_impl::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::oram_impl::RequestHeader* header);
+  ::oram_impl::RequestHeader* unsafe_arena_release_header();
+
+  // uint32 level = 2;
+  void clear_level();
+  uint32_t level() const;
+  void set_level(uint32_t value);
+  private:
+  uint32_t _internal_level() const;
+  void _internal_set_level(uint32_t value);
+  public:
+
+  // uint32 offset = 3;
+  void clear_offset();
+  uint32_t offset() const;
+  void set_offset(uint32_t value);
+  private:
+  uint32_t _internal_offset() const;
+  void _internal_set_offset(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:oram_impl.WriteLayeredRangeRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> contents_;
+    ::oram_impl::RequestHeader* header_;
+    uint32_t level_;
+    uint32_t offset_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LayeredControlRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.LayeredControlRequest) */ {
+ public:
+  inline LayeredControlRequest() : LayeredControlRequest(nullptr) {}
+  ~LayeredControlRequest() override;
+  explicit PROTOBUF_CONSTEXPR LayeredControlRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LayeredControlRequest(const LayeredControlRequest& from);
+  LayeredControlRequest(LayeredControlRequest&& from) noexcept
+    : LayeredControlRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline LayeredControlRequest& operator=(const LayeredControlRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LayeredControlRequest& operator=(LayeredControlRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LayeredControlRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LayeredControlRequest* internal_default_instance() {
+    return reinterpret_cast<const LayeredControlRequest*>(
+               &_LayeredControlRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(LayeredControlRequest& a, LayeredControlRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LayeredControlRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LayeredControlRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LayeredControlRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LayeredControlRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LayeredControlRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LayeredControlRequest& from) {
+    LayeredControlRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LayeredControlRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "oram_impl.LayeredControlRequest";
+  }
+  protected:
+  explicit LayeredControlRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kClearedLevelsFieldNumber = 6,
+    kHeaderFieldNumber = 1,
+    kTypeFieldNumber = 2,
+    kLevelFieldNumber = 3,
+    kSizeFieldNumber = 4,
+    kTargetFieldNumber = 5,
+  };
+  // repeated uint32 cleared_levels = 6;
+  int cleared_levels_size() const;
+  private:
+  int _internal_cleared_levels_size() const;
+  public:
+  void clear_cleared_levels();
+  private:
+  uint32_t _internal_cleared_levels(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_cleared_levels() const;
+  void _internal_add_cleared_levels(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_cleared_levels();
+  public:
+  uint32_t cleared_levels(int index) const;
+  void set_cleared_levels(int index, uint32_t value);
+  void add_cleared_levels(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      cleared_levels() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_cleared_levels();
+
+  // .oram_impl.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::oram_impl::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::oram_impl::RequestHeader* release_header();
+  ::oram_impl::RequestHeader* mutable_header();
+  void set_allocated_header(::oram_impl::RequestHeader* header);
+  private:
+  const ::oram_impl::RequestHeader& _internal_header() const;
+  ::oram_impl::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::oram_impl::RequestHeader* header);
+  ::oram_impl::RequestHeader* unsafe_arena_release_header();
+
+  // uint32 type = 2;
+  void clear_type();
+  uint32_t type() const;
+  void set_type(uint32_t value);
+  private:
+  uint32_t _internal_type() const;
+  void _internal_set_type(uint32_t value);
+  public:
+
+  // uint32 level = 3;
+  void clear_level();
+  uint32_t level() const;
+  void set_level(uint32_t value);
+  private:
+  uint32_t _internal_level() const;
+  void _internal_set_level(uint32_t value);
+  public:
+
+  // uint32 size = 4;
+  void clear_size();
+  uint32_t size() const;
+  void set_size(uint32_t value);
+  private:
+  uint32_t _internal_size() const;
+  void _internal_set_size(uint32_t value);
+  public:
+
+  // uint32 target = 5;
+  void clear_target();
+  uint32_t target() const;
+  void set_target(uint32_t value);
+  private:
+  uint32_t _internal_target() const;
+  void _internal_set_target(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:oram_impl.LayeredControlRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > cleared_levels_;
+    mutable std::atomic<int> _cleared_levels_cached_byte_size_;
+    ::oram_impl::RequestHeader* header_;
+    uint32_t type_;
+    uint32_t level_;
+    uint32_t size_;
+    uint32_t target_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class InitTreeOramRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.InitTreeOramRequest) */ {
+ public:
+  inline InitTreeOramRequest() : InitTreeOramRequest(nullptr) {}
+  ~InitTreeOramRequest() override;
+  explicit PROTOBUF_CONSTEXPR InitTreeOramRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  InitTreeOramRequest(const InitTreeOramRequest& from);
+  InitTreeOramRequest(InitTreeOramRequest&& from) noexcept
+    : InitTreeOramRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline InitTreeOramRequest& operator=(const InitTreeOramRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline InitTreeOramRequest& operator=(InitTreeOramRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const InitTreeOramRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const InitTreeOramRequest* internal_default_instance() {
+    return reinterpret_cast<const InitTreeOramRequest*>(
+               &_InitTreeOramRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(InitTreeOramRequest& a, InitTreeOramRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(InitTreeOramRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(InitTreeOramRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  InitTreeOramRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InitTreeOramRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const InitTreeOramRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const InitTreeOramRequest& from) {
+    InitTreeOramRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(InitTreeOramRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "oram_impl.InitTreeOramRequest";
+  }
+  protected:
+  explicit InitTreeOramRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHeaderFieldNumber = 1,
+    kBucketSizeFieldNumber = 2,
+    kBucketNumFieldNumber = 3,
+    kBlockSizeFieldNumber = 4,
+  };
+  // .oram_impl.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::oram_impl::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::oram_impl::RequestHeader* release_header();
+  ::oram_impl::RequestHeader* mutable_header();
+  void set_allocated_header(::oram_impl::RequestHeader* header);
+  private:
+  const ::oram_impl::RequestHeader& _internal_header() const;
+  ::oram_impl::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::oram_impl::RequestHeader* header);
+  ::oram_impl::RequestHeader* unsafe_arena_release_header();
+
+  // uint32 bucket_size = 2;
+  void clear_bucket_size();
+  uint32_t bucket_size() const;
+  void set_bucket_size(uint32_t value);
+  private:
+  uint32_t _internal_bucket_size() const;
+  void _internal_set_bucket_size(uint32_t value);
+  public:
+
+  // uint32 bucket_num = 3;
+  void clear_bucket_num();
+  uint32_t bucket_num() const;
+  void set_bucket_num(uint32_t value);
+  private:
+  uint32_t _internal_bucket_num() const;
+  void _internal_set_bucket_num(uint32_t value);
+  public:
+
+  // uint32 block_size = 4;
+  void clear_block_size();
+  uint32_t block_size() const;
+  void set_block_size(uint32_t value);
+  private:
+  uint32_t _internal_block_size() const;
+  void _internal_set_block_size(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:oram_impl.InitTreeOramRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::oram_impl::RequestHeader* header_;
+    uint32_t bucket_size_;
+    uint32_t bucket_num_;
+    uint32_t block_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReadFlatRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.ReadFlatRequest) */ {
+ public:
+  inline ReadFlatRequest() : ReadFlatRequest(nullptr) {}
+  ~ReadFlatRequest() override;
+  explicit PROTOBUF_CONSTEXPR ReadFlatRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReadFlatRequest(const ReadFlatRequest& from);
+  ReadFlatRequest(ReadFlatRequest&& from) noexcept
+    : ReadFlatRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ReadFlatRequest& operator=(const ReadFlatRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReadFlatRequest& operator=(ReadFlatRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadFlatRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReadFlatRequest* internal_default_instance() {
+    return reinterpret_cast<const ReadFlatRequest*>(
+               &_ReadFlatRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(ReadFlatRequest& a, ReadFlatRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReadFlatRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadFlatRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReadFlatRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadFlatRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReadFlatRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadFlatRequest& from) {
+    ReadFlatRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReadFlatRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "oram_impl.ReadFlatRequest";
+  }
+  protected:
+  explicit ReadFlatRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHeaderFieldNumber = 1,
+  };
+  // .oram_impl.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::oram_impl::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::oram_impl::RequestHeader* release_header();
+  ::oram_impl::RequestHeader* mutable_header();
+  void set_allocated_header(::oram_impl::RequestHeader* header);
+  private:
+  const ::oram_impl::RequestHeader& _internal_header() const;
+  ::oram_impl::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::oram_impl::RequestHeader* header);
+  ::oram_impl::RequestHeader* unsafe_arena_release_header();
+
+  // @@protoc_insertion_point(class_scope:oram_impl.ReadFlatRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::oram_impl::RequestHeader* header_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReadFlatStreamRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.ReadFlatStreamRequest) */ {
+ public:
+  inline ReadFlatStreamRequest() : ReadFlatStreamRequest(nullptr) {}
+  ~ReadFlatStreamRequest() override;
+  explicit PROTOBUF_CONSTEXPR ReadFlatStreamRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReadFlatStreamRequest(const ReadFlatStreamRequest& from);
+  ReadFlatStreamRequest(ReadFlatStreamRequest&& from) noexcept
+    : ReadFlatStreamRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ReadFlatStreamRequest& operator=(const ReadFlatStreamRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReadFlatStreamRequest& operator=(ReadFlatStreamRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadFlatStreamRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReadFlatStreamRequest* internal_default_instance() {
+    return reinterpret_cast<const ReadFlatStreamRequest*>(
+               &_ReadFlatStreamRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(ReadFlatStreamRequest& a, ReadFlatStreamRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReadFlatStreamRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadFlatStreamRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReadFlatStreamRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadFlatStreamRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReadFlatStreamRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadFlatStreamRequest& from) {
+    ReadFlatStreamRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReadFlatStreamRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "oram_impl.ReadFlatStreamRequest";
+  }
+  protected:
+  explicit ReadFlatStreamRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHeaderFieldNumber = 1,
+    kChunkBlocksFieldNumber = 2,
+  };
+  // .oram_impl.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::oram_impl::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::oram_impl::RequestHeader* release_header();
+  ::oram_impl::RequestHeader* mutable_header();
+  void set_allocated_header(::oram_impl::RequestHeader* header);
+  private:
+  const ::oram_impl::RequestHeader& _internal_header() const;
+  ::oram_impl::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::oram_impl::RequestHeader* header);
+  ::oram_impl::RequestHeader* unsafe_arena_release_header();
+
+  // uint32 chunk_blocks = 2;
+  void clear_chunk_blocks();
+  uint32_t chunk_blocks() const;
+  void set_chunk_blocks(uint32_t value);
+  private:
+  uint32_t _internal_chunk_blocks() const;
+  void _internal_set_chunk_blocks(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:oram_impl.ReadFlatStreamRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::oram_impl::RequestHeader* header_;
+    uint32_t chunk_blocks_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FlatChunkMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.FlatChunkMessage) */ {
+ public:
+  inline FlatChunkMessage() : FlatChunkMessage(nullptr) {}
+  ~FlatChunkMessage() override;
+  explicit PROTOBUF_CONSTEXPR FlatChunkMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FlatChunkMessage(const FlatChunkMessage& from);
+  FlatChunkMessage(FlatChunkMessage&& from) noexcept
+    : FlatChunkMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline FlatChunkMessage& operator=(const FlatChunkMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FlatChunkMessage& operator=(FlatChunkMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FlatChunkMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FlatChunkMessage* internal_default_instance() {
+    return reinterpret_cast<const FlatChunkMessage*>(
+               &_FlatChunkMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(FlatChunkMessage& a, FlatChunkMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FlatChunkMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FlatChunkMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FlatChunkMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FlatChunkMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FlatChunkMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FlatChunkMessage& from) {
+    FlatChunkMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FlatChunkMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "oram_impl.FlatChunkMessage";
+  }
+  protected:
+  explicit FlatChunkMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kContentFieldNumber = 3,
+    kHeaderFieldNumber = 1,
+    kOffsetFieldNumber = 2,
+    kLastFieldNumber = 4,
+  };
+  // bytes content = 3;
+  void clear_content();
+  const std::string& content() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_content();
+  PROTOBUF_NODISCARD std::string* release_content();
+  void set_allocated_content(std::string* content);
+  private:
+  const std::string& _internal_content() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
+  std::string* _internal_mutable_content();
+  public:
+
+  // .oram_impl.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::oram_impl::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::oram_impl::RequestHeader* release_header();
+  ::oram_impl::RequestHeader* mutable_header();
+  void set_allocated_header(::oram_impl::RequestHeader* header);
+  private:
+  const ::oram_impl::RequestHeader& _internal_header() const;
+  ::oram_impl::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::oram_impl::RequestHeader* header);
+  ::oram_impl::RequestHeader* unsafe_arena_release_header();
+
+  // uint64 offset = 2;
+  void clear_offset();
+  uint64_t offset() const;
+  void set_offset(uint64_t value);
+  private:
+  uint64_t _internal_offset() const;
+  void _internal_set_offset(uint64_t value);
+  public:
+
+  // bool last = 4;
+  void clear_last();
+  bool last() const;
+  void set_last(bool value);
+  private:
+  bool _internal_last() const;
+  void _internal_set_last(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:oram_impl.FlatChunkMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+    ::oram_impl::RequestHeader* header_;
+    uint64_t offset_;
+    bool last_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReadSqrtRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.ReadSqrtRequest) */ {
+ public:
+  inline ReadSqrtRequest() : ReadSqrtRequest(nullptr) {}
+  ~ReadSqrtRequest() override;
+  explicit PROTOBUF_CONSTEXPR ReadSqrtRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReadSqrtRequest(const ReadSqrtRequest& from);
+  ReadSqrtRequest(ReadSqrtRequest&& from) noexcept
+    : ReadSqrtRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ReadSqrtRequest& operator=(const ReadSqrtRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReadSqrtRequest& operator=(ReadSqrtRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadSqrtRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReadSqrtRequest* internal_default_instance() {
+    return reinterpret_cast<const ReadSqrtRequest*>(
+               &_ReadSqrtRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(ReadSqrtRequest& a, ReadSqrtRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReadSqrtRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadSqrtRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReadSqrtRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadSqrtRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReadSqrtRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadSqrtRequest& from) {
+    ReadSqrtRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReadSqrtRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "oram_impl.ReadSqrtRequest";
+  }
+  protected:
+  explicit ReadSqrtRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHeaderFieldNumber = 1,
+    kTagFieldNumber = 2,
+    kReadFromFieldNumber = 3,
+  };
+  // .oram_impl.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::oram_impl::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::oram_impl::RequestHeader* release_header();
+  ::oram_impl::RequestHeader* mutable_header();
+  void set_allocated_header(::oram_impl::RequestHeader* header);
+  private:
+  const ::oram_impl::RequestHeader& _internal_header() const;
+  ::oram_impl::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::oram_impl::RequestHeader* header);
+  ::oram_impl::RequestHeader* unsafe_arena_release_header();
+
+  // uint32 tag = 2;
+  void clear_tag();
+  uint32_t tag() const;
+  void set_tag(uint32_t value);
+  private:
+  uint32_t _internal_tag() const;
+  void _internal_set_tag(uint32_t value);
+  public:
+
+  // uint32 read_from = 3;
+  void clear_read_from();
+  uint32_t read_from() const;
+  void set_read_from(uint32_t value);
+  private:
+  uint32_t _internal_read_from() const;
+  void _internal_set_read_from(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:oram_impl.ReadSqrtRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::oram_impl::RequestHeader* header_;
+    uint32_t tag_;
+    uint32_t read_from_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReadPathRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.ReadPathRequest) */ {
+ public:
+  inline ReadPathRequest() : ReadPathRequest(nullptr) {}
+  ~ReadPathRequest() override;
+  explicit PROTOBUF_CONSTEXPR ReadPathRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReadPathRequest(const ReadPathRequest& from);
+  ReadPathRequest(ReadPathRequest&& from) noexcept
+    : ReadPathRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ReadPathRequest& operator=(const ReadPathRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReadPathRequest& operator=(ReadPathRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadPathRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReadPathRequest* internal_default_instance() {
+    return reinterpret_cast<const ReadPathRequest*>(
+               &_ReadPathRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    28;
+
+  friend void swap(ReadPathRequest& a, ReadPathRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReadPathRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadPathRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReadPathRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadPathRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReadPathRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadPathRequest& from) {
+    ReadPathRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReadPathRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "oram_impl.ReadPathRequest";
+  }
+  protected:
+  explicit ReadPathRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHeaderFieldNumber = 1,
+    kPathFieldNumber = 2,
+    kLevelFieldNumber = 3,
+  };
+  // .oram_impl.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::oram_impl::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::oram_impl::RequestHeader* release_header();
+  ::oram_impl::RequestHeader* mutable_header();
+  void set_allocated_header(::oram_impl::RequestHeader* header);
+  private:
+  const ::oram_impl::RequestHeader& _internal_header() const;
+  ::oram_impl::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::oram_impl::RequestHeader* header);
+  ::oram_impl::RequestHeader* unsafe_arena_release_header();
+
+  // uint32 path = 2;
+  void clear_path();
+  uint32_t path() const;
+  void set_path(uint32_t value);
+  private:
+  uint32_t _internal_path() const;
+  void _internal_set_path(uint32_t value);
+  public:
+
+  // uint32 level = 3;
+  void clear_level();
+  uint32_t level() const;
+  void set_level(uint32_t value);
+  private:
+  uint32_t _internal_level() const;
+  void _internal_set_level(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:oram_impl.ReadPathRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::oram_impl::RequestHeader* header_;
+    uint32_t path_;
+    uint32_t level_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReadPathResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.ReadPathResponse) */ {
+ public:
+  inline ReadPathResponse() : ReadPathResponse(nullptr) {}
+  ~ReadPathResponse() override;
+  explicit PROTOBUF_CONSTEXPR ReadPathResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReadPathResponse(const ReadPathResponse& from);
+  ReadPathResponse(ReadPathResponse&& from) noexcept
+    : ReadPathResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ReadPathResponse& operator=(const ReadPathResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReadPathResponse& operator=(ReadPathResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadPathResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReadPathResponse* internal_default_instance() {
+    return reinterpret_cast<const ReadPathResponse*>(
+               &_ReadPathResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
+
+  friend void swap(ReadPathResponse& a, ReadPathResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReadPathResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadPathResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReadPathResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadPathResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReadPathResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadPathResponse& from) {
+    ReadPathResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReadPathResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "oram_impl.ReadPathResponse";
+  }
+  protected:
+  explicit ReadPathResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBucketFieldNumber = 1,
+  };
+  // repeated bytes bucket = 1;
+  int bucket_size() const;
+  private:
+  int _internal_bucket_size() const;
+  public:
+  void clear_bucket();
+  const std::string& bucket(int index) const;
+  std::string* mutable_bucket(int index);
+  void set_bucket(int index, const std::string& value);
+  void set_bucket(int index, std::string&& value);
+  void set_bucket(int index, const char* value);
+  void set_bucket(int index, const void* value, size_t size);
+  std::string* add_bucket();
+  void add_bucket(const std::string& value);
+  void add_bucket(std::string&& value);
+  void add_bucket(const char* value);
+  void add_bucket(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& bucket() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_bucket();
+  private:
+  const std::string& _internal_bucket(int index) const;
+  std::string* _internal_add_bucket();
+  public:
+
+  // @@protoc_insertion_point(class_scope:oram_impl.ReadPathResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> bucket_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WritePathRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.WritePathRequest) */ {
+ public:
+  inline WritePathRequest() : WritePathRequest(nullptr) {}
+  ~WritePathRequest() override;
+  explicit PROTOBUF_CONSTEXPR WritePathRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WritePathRequest(const WritePathRequest& from);
+  WritePathRequest(WritePathRequest&& from) noexcept
+    : WritePathRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline WritePathRequest& operator=(const WritePathRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WritePathRequest& operator=(WritePathRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WritePathRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WritePathRequest* internal_default_instance() {
+    return reinterpret_cast<const WritePathRequest*>(
+               &_WritePathRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    30;
+
+  friend void swap(WritePathRequest& a, WritePathRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WritePathRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WritePathRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WritePathRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WritePathRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WritePathRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WritePathRequest& from) {
+    WritePathRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WritePathRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "oram_impl.WritePathRequest";
+  }
+  protected:
+  explicit WritePathRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBucketFieldNumber = 4,
+    kHeaderFieldNumber = 1,
+    kPathFieldNumber = 2,
+    kLevelFieldNumber = 3,
+    kTypeFieldNumber = 5,
+    kOffsetFieldNumber = 6,
+  };
+  // repeated bytes bucket = 4;
+  int bucket_size() const;
+  private:
+  int _internal_bucket_size() const;
+  public:
+  void clear_bucket();
+  const std::string& bucket(int index) const;
+  std::string* mutable_bucket(int index);
+  void set_bucket(int index, const std::string& value);
+  void set_bucket(int index, std::string&& value);
+  void set_bucket(int index, const char* value);
+  void set_bucket(int index, const void* value, size_t size);
+  std::string* add_bucket();
+  void add_bucket(const std::string& value);
+  void add_bucket(std::string&& value);
+  void add_bucket(const char* value);
+  void add_bucket(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& bucket() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_bucket();
+  private:
+  const std::string& _internal_bucket(int index) const;
+  std::string* _internal_add_bucket();
+  public:
+
+  // .oram_impl.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::oram_impl::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::oram_impl::RequestHeader* release_header();
+  ::oram_impl::RequestHeader* mutable_header();
+  void set_allocated_header(::oram_impl::RequestHeader* header);
+  private:
+  const ::oram_impl::RequestHeader& _internal_header() const;
+  ::oram_impl::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::oram_impl::RequestHeader* header);
+  ::oram_impl::RequestHeader* unsafe_arena_release_header();
+
+  // uint32 path = 2;
+  void clear_path();
+  uint32_t path() const;
+  void set_path(uint32_t value);
+  private:
+  uint32_t _internal_path() const;
+  void _internal_set_path(uint32_t value);
+  public:
+
+  // uint32 level = 3;
+  void clear_level();
+  uint32_t level() const;
+  void set_level(uint32_t value);
+  private:
+  uint32_t _internal_level() const;
+  void _internal_set_level(uint32_t value);
+  public:
+
+  // optional .oram_impl.Type type = 5;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::oram_impl::Type type() const;
+  void set_type(::oram_impl::Type value);
+  private:
+  ::oram_impl::Type _internal_type() const;
+  void _internal_set_type(::oram_impl::Type value);
+  public:
+
+  // optional uint32 offset = 6;
+  bool has_offset() const;
+  private:
+  bool _internal_has_offset() const;
+  public:
+  void clear_offset();
+  uint32_t offset() const;
+  void set_offset(uint32_t value);
+  private:
+  uint32_t _internal_offset() const;
+  void _internal_set_offset(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:oram_impl.WritePathRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> bucket_;
+    ::oram_impl::RequestHeader* header_;
+    uint32_t path_;
+    uint32_t level_;
+    int type_;
+    uint32_t offset_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BucketMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.BucketMessage) */ {
+ public:
+  inline BucketMessage() : BucketMessage(nullptr) {}
+  ~BucketMessage() override;
+  explicit PROTOBUF_CONSTEXPR BucketMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BucketMessage(const BucketMessage& from);
+  BucketMessage(BucketMessage&& from) noexcept
+    : BucketMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline BucketMessage& operator=(const BucketMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BucketMessage& operator=(BucketMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BucketMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BucketMessage* internal_default_instance() {
+    return reinterpret_cast<const BucketMessage*>(
+               &_BucketMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    31;
+
+  friend void swap(BucketMessage& a, BucketMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BucketMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BucketMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BucketMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BucketMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BucketMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BucketMessage& from) {
+    BucketMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BucketMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "oram_impl.BucketMessage";
+  }
+  protected:
+  explicit BucketMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBucketFieldNumber = 1,
+  };
+  // repeated bytes bucket = 1;
+  int bucket_size() const;
+  private:
+  int _internal_bucket_size() const;
+  public:
+  void clear_bucket();
+  const std::string& bucket(int index) const;
+  std::string* mutable_bucket(int index);
+  void set_bucket(int index, const std::string& value);
+  void set_bucket(int index, std::string&& value);
+  void set_bucket(int index, const char* value);
+  void set_bucket(int index, const void* value, size_t size);
+  std::string* add_bucket();
+  void add_bucket(const std::string& value);
+  void add_bucket(std::string&& value);
+  void add_bucket(const char* value);
+  void add_bucket(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& bucket() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_bucket();
+  private:
+  const std::string& _internal_bucket(int index) const;
+  std::string* _internal_add_bucket();
+  public:
+
+  // @@protoc_insertion_point(class_scope:oram_impl.BucketMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> bucket_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WriteFullPathRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:oram_impl.WriteFullPathRequest) */ {
+ public:
+  inline WriteFullPathRequest() : WriteFullPathRequest(nullptr) {}
+  ~WriteFullPathRequest() override;
+  explicit PROTOBUF_CONSTEXPR WriteFullPathRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WriteFullPathRequest(const WriteFullPathRequest& from);
+  WriteFullPathRequest(WriteFullPathRequest&& from) noexcept
+    : WriteFullPathRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline WriteFullPathRequest& operator=(const WriteFullPathRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WriteFullPathRequest& operator=(WriteFullPathRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteFullPathRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WriteFullPathRequest* internal_default_instance() {
+    return reinterpret_cast<const WriteFullPathRequest*>(
+               &_WriteFullPathRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    32;
+
+  friend void swap(WriteFullPathRequest& a, WriteFullPathRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WriteFullPathRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteFullPathRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WriteFullPathRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WriteFullPathRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WriteFullPathRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteFullPathRequest& from) {
+    WriteFullPathRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WriteFullPathRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "oram_impl.WriteFullPathRequest";
+  }
+  protected:
+  explicit WriteFullPathRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBucketsFieldNumber = 3,
+    kHeaderFieldNumber = 1,
+    kPathFieldNumber = 2,
+  };
+  // repeated .oram_impl.BucketMessage buckets = 3;
+  int buckets_size() const;
+  private:
+  int _internal_buckets_size() const;
+  public:
+  void clear_buckets();
+  ::oram_impl::BucketMessage* mutable_buckets(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::BucketMessage >*
+      mutable_buckets();
+  private:
+  const ::oram_impl::BucketMessage& _internal_buckets(int index) const;
+  ::oram_impl::BucketMessage* _internal_add_buckets();
+  public:
+  const ::oram_impl::BucketMessage& buckets(int index) const;
+  ::oram_impl::BucketMessage* add_buckets();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::BucketMessage >&
+      buckets() const;
+
+  // .oram_impl.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::oram_impl::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::oram_impl::RequestHeader* release_header();
+  ::oram_impl::RequestHeader* mutable_header();
+  void set_allocated_header(::oram_impl::RequestHeader* header);
+  private:
+  const ::oram_impl::RequestHeader& _internal_header() const;
+  ::oram_impl::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::oram_impl::RequestHeader* header);
+  ::oram_impl::RequestHeader* unsafe_arena_release_header();
+
+  // uint32 path = 2;
+  void clear_path();
+  uint32_t path() const;
+  void set_path(uint32_t value);
+  private:
+  uint32_t _internal_path() const;
+  void _internal_set_path(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:oram_impl.WriteFullPathRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::BucketMessage > buckets_;
+    ::oram_impl::RequestHeader* header_;
+    uint32_t path_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WritePathResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:oram_impl.WritePathResponse) */ {
+ public:
+  inline WritePathResponse() : WritePathResponse(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR WritePathResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WritePathResponse(const WritePathResponse& from);
+  WritePathResponse(WritePathResponse&& from) noexcept
+    : WritePathResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline WritePathResponse& operator=(const WritePathResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WritePathResponse& operator=(WritePathResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WritePathResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WritePathResponse* internal_default_instance() {
+    return reinterpret_cast<const WritePathResponse*>(
+               &_WritePathResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    33;
+
+  friend void swap(WritePathResponse& a, WritePathResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WritePathResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WritePathResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WritePathResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WritePathResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const WritePathResponse& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const WritePathResponse& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "oram_impl.WritePathResponse";
+  }
+  protected:
+  explicit WritePathResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:oram_impl.WritePathResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// RequestHeader
+
+// bytes instance_hash = 1;
+inline void RequestHeader::clear_instance_hash() {
+  _impl_.instance_hash_.ClearToEmpty();
+}
+inline const std::string& RequestHeader::instance_hash() const {
+  // @@protoc_insertion_point(field_get:oram_impl.RequestHeader.instance_hash)
+  return _internal_instance_hash();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RequestHeader::set_instance_hash(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.instance_hash_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:oram_impl.RequestHeader.instance_hash)
+}
+inline std::string* RequestHeader::mutable_instance_hash() {
+  std::string* _s = _internal_mutable_instance_hash();
+  // @@protoc_insertion_point(field_mutable:oram_impl.RequestHeader.instance_hash)
+  return _s;
+}
+inline const std::string& RequestHeader::_internal_instance_hash() const {
+  return _impl_.instance_hash_.Get();
+}
+inline void RequestHeader::_internal_set_instance_hash(const std::string& value) {
+  
+  _impl_.instance_hash_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RequestHeader::_internal_mutable_instance_hash() {
+  
+  return _impl_.instance_hash_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RequestHeader::release_instance_hash() {
+  // @@protoc_insertion_point(field_release:oram_impl.RequestHeader.instance_hash)
+  return _impl_.instance_hash_.Release();
+}
+inline void RequestHeader::set_allocated_instance_hash(std::string* instance_hash) {
+  if (instance_hash != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.instance_hash_.SetAllocated(instance_hash, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.instance_hash_.IsDefault()) {
+    _impl_.instance_hash_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.RequestHeader.instance_hash)
+}
+
+// bytes version = 2;
+inline void RequestHeader::clear_version() {
+  _impl_.version_.ClearToEmpty();
+}
+inline const std::string& RequestHeader::version() const {
+  // @@protoc_insertion_point(field_get:oram_impl.RequestHeader.version)
+  return _internal_version();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RequestHeader::set_version(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.version_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:oram_impl.RequestHeader.version)
+}
+inline std::string* RequestHeader::mutable_version() {
+  std::string* _s = _internal_mutable_version();
+  // @@protoc_insertion_point(field_mutable:oram_impl.RequestHeader.version)
+  return _s;
+}
+inline const std::string& RequestHeader::_internal_version() const {
+  return _impl_.version_.Get();
+}
+inline void RequestHeader::_internal_set_version(const std::string& value) {
+  
+  _impl_.version_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RequestHeader::_internal_mutable_version() {
+  
+  return _impl_.version_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RequestHeader::release_version() {
+  // @@protoc_insertion_point(field_release:oram_impl.RequestHeader.version)
+  return _impl_.version_.Release();
+}
+inline void RequestHeader::set_allocated_version(std::string* version) {
+  if (version != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.version_.SetAllocated(version, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.version_.IsDefault()) {
+    _impl_.version_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.RequestHeader.version)
+}
+
+// uint32 id = 3;
+inline void RequestHeader::clear_id() {
+  _impl_.id_ = 0u;
+}
+inline uint32_t RequestHeader::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t RequestHeader::id() const {
+  // @@protoc_insertion_point(field_get:oram_impl.RequestHeader.id)
+  return _internal_id();
+}
+inline void RequestHeader::_internal_set_id(uint32_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void RequestHeader::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:oram_impl.RequestHeader.id)
+}
+
+// -------------------------------------------------------------------
+
+// PrintOramTreeRequest
+
+// uint32 id = 1;
+inline void PrintOramTreeRequest::clear_id() {
+  _impl_.id_ = 0u;
+}
+inline uint32_t PrintOramTreeRequest::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t PrintOramTreeRequest::id() const {
+  // @@protoc_insertion_point(field_get:oram_impl.PrintOramTreeRequest.id)
+  return _internal_id();
+}
+inline void PrintOramTreeRequest::_internal_set_id(uint32_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void PrintOramTreeRequest::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:oram_impl.PrintOramTreeRequest.id)
+}
+
+// -------------------------------------------------------------------
+
+// HelloMessage
+
+// bytes content = 1;
+inline void HelloMessage::clear_content() {
+  _impl_.content_.ClearToEmpty();
+}
+inline const std::string& HelloMessage::content() const {
+  // @@protoc_insertion_point(field_get:oram_impl.HelloMessage.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HelloMessage::set_content(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.content_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:oram_impl.HelloMessage.content)
+}
+inline std::string* HelloMessage::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:oram_impl.HelloMessage.content)
+  return _s;
+}
+inline const std::string& HelloMessage::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void HelloMessage::_internal_set_content(const std::string& value) {
+  
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* HelloMessage::_internal_mutable_content() {
+  
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HelloMessage::release_content() {
+  // @@protoc_insertion_point(field_release:oram_impl.HelloMessage.content)
+  return _impl_.content_.Release();
+}
+inline void HelloMessage::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.HelloMessage.content)
+}
+
+// bytes iv = 2;
+inline void HelloMessage::clear_iv() {
+  _impl_.iv_.ClearToEmpty();
+}
+inline const std::string& HelloMessage::iv() const {
+  // @@protoc_insertion_point(field_get:oram_impl.HelloMessage.iv)
+  return _internal_iv();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HelloMessage::set_iv(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.iv_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:oram_impl.HelloMessage.iv)
+}
+inline std::string* HelloMessage::mutable_iv() {
+  std::string* _s = _internal_mutable_iv();
+  // @@protoc_insertion_point(field_mutable:oram_impl.HelloMessage.iv)
+  return _s;
+}
+inline const std::string& HelloMessage::_internal_iv() const {
+  return _impl_.iv_.Get();
+}
+inline void HelloMessage::_internal_set_iv(const std::string& value) {
+  
+  _impl_.iv_.Set(value, GetArenaForAllocation());
+}
+inline std::string* HelloMessage::_internal_mutable_iv() {
+  
+  return _impl_.iv_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HelloMessage::release_iv() {
+  // @@protoc_insertion_point(field_release:oram_impl.HelloMessage.iv)
+  return _impl_.iv_.Release();
+}
+inline void HelloMessage::set_allocated_iv(std::string* iv) {
+  if (iv != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.iv_.SetAllocated(iv, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.iv_.IsDefault()) {
+    _impl_.iv_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.HelloMessage.iv)
+}
+
+// -------------------------------------------------------------------
+
+// KeyExchangeRequest
+
+// bytes public_key_client = 1;
+inline void KeyExchangeRequest::clear_public_key_client() {
+  _impl_.public_key_client_.ClearToEmpty();
+}
+inline const std::string& KeyExchangeRequest::public_key_client() const {
+  // @@protoc_insertion_point(field_get:oram_impl.KeyExchangeRequest.public_key_client)
+  return _internal_public_key_client();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeyExchangeRequest::set_public_key_client(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.public_key_client_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:oram_impl.KeyExchangeRequest.public_key_client)
+}
+inline std::string* KeyExchangeRequest::mutable_public_key_client() {
+  std::string* _s = _internal_mutable_public_key_client();
+  // @@protoc_insertion_point(field_mutable:oram_impl.KeyExchangeRequest.public_key_client)
+  return _s;
+}
+inline const std::string& KeyExchangeRequest::_internal_public_key_client() const {
+  return _impl_.public_key_client_.Get();
+}
+inline void KeyExchangeRequest::_internal_set_public_key_client(const std::string& value) {
+  
+  _impl_.public_key_client_.Set(value, GetArenaForAllocation());
+}
+inline std::string* KeyExchangeRequest::_internal_mutable_public_key_client() {
+  
+  return _impl_.public_key_client_.Mutable(GetArenaForAllocation());
+}
+inline std::string* KeyExchangeRequest::release_public_key_client() {
+  // @@protoc_insertion_point(field_release:oram_impl.KeyExchangeRequest.public_key_client)
+  return _impl_.public_key_client_.Release();
+}
+inline void KeyExchangeRequest::set_allocated_public_key_client(std::string* public_key_client) {
+  if (public_key_client != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.public_key_client_.SetAllocated(public_key_client, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.public_key_client_.IsDefault()) {
+    _impl_.public_key_client_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.KeyExchangeRequest.public_key_client)
+}
+
+// -------------------------------------------------------------------
+
+// KeyExchangeResponse
+
+// bytes public_key_server = 1;
+inline void KeyExchangeResponse::clear_public_key_server() {
+  _impl_.public_key_server_.ClearToEmpty();
+}
+inline const std::string& KeyExchangeResponse::public_key_server() const {
+  // @@protoc_insertion_point(field_get:oram_impl.KeyExchangeResponse.public_key_server)
+  return _internal_public_key_server();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeyExchangeResponse::set_public_key_server(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.public_key_server_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:oram_impl.KeyExchangeResponse.public_key_server)
+}
+inline std::string* KeyExchangeResponse::mutable_public_key_server() {
+  std::string* _s = _internal_mutable_public_key_server();
+  // @@protoc_insertion_point(field_mutable:oram_impl.KeyExchangeResponse.public_key_server)
+  return _s;
+}
+inline const std::string& KeyExchangeResponse::_internal_public_key_server() const {
+  return _impl_.public_key_server_.Get();
+}
+inline void KeyExchangeResponse::_internal_set_public_key_server(const std::string& value) {
+  
+  _impl_.public_key_server_.Set(value, GetArenaForAllocation());
+}
+inline std::string* KeyExchangeResponse::_internal_mutable_public_key_server() {
+  
+  return _impl_.public_key_server_.Mutable(GetArenaForAllocation());
+}
+inline std::string* KeyExchangeResponse::release_public_key_server() {
+  // @@protoc_insertion_point(field_release:oram_impl.KeyExchangeResponse.public_key_server)
+  return _impl_.public_key_server_.Release();
+}
+inline void KeyExchangeResponse::set_allocated_public_key_server(std::string* public_key_server) {
+  if (public_key_server != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.public_key_server_.SetAllocated(public_key_server, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.public_key_server_.IsDefault()) {
+    _impl_.public_key_server_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.KeyExchangeResponse.public_key_server)
+}
+
+// -------------------------------------------------------------------
+
+// InitFlatOramRequest
+
+// .oram_impl.RequestHeader header = 1;
+inline bool InitFlatOramRequest::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool InitFlatOramRequest::has_header() const {
+  return _internal_has_header();
+}
+inline void InitFlatOramRequest::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::oram_impl::RequestHeader& InitFlatOramRequest::_internal_header() const {
+  const ::oram_impl::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
+      ::oram_impl::_RequestHeader_default_instance_);
+}
+inline const ::oram_impl::RequestHeader& InitFlatOramRequest::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.InitFlatOramRequest.header)
+  return _internal_header();
+}
+inline void InitFlatOramRequest::unsafe_arena_set_allocated_header(
+    ::oram_impl::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.InitFlatOramRequest.header)
+}
+inline ::oram_impl::RequestHeader* InitFlatOramRequest::release_header() {
+  
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::oram_impl::RequestHeader* InitFlatOramRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.InitFlatOramRequest.header)
+  
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::oram_impl::RequestHeader* InitFlatOramRequest::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::oram_impl::RequestHeader* InitFlatOramRequest::mutable_header() {
+  ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:oram_impl.InitFlatOramRequest.header)
+  return _msg;
+}
+inline void InitFlatOramRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.InitFlatOramRequest.header)
+}
+
+// uint32 capacity = 2;
+inline void InitFlatOramRequest::clear_capacity() {
+  _impl_.capacity_ = 0u;
+}
+inline uint32_t InitFlatOramRequest::_internal_capacity() const {
+  return _impl_.capacity_;
+}
+inline uint32_t InitFlatOramRequest::capacity() const {
+  // @@protoc_insertion_point(field_get:oram_impl.InitFlatOramRequest.capacity)
+  return _internal_capacity();
+}
+inline void InitFlatOramRequest::_internal_set_capacity(uint32_t value) {
+  
+  _impl_.capacity_ = value;
+}
+inline void InitFlatOramRequest::set_capacity(uint32_t value) {
+  _internal_set_capacity(value);
+  // @@protoc_insertion_point(field_set:oram_impl.InitFlatOramRequest.capacity)
+}
+
+// uint32 block_size = 3;
+inline void InitFlatOramRequest::clear_block_size() {
+  _impl_.block_size_ = 0u;
+}
+inline uint32_t InitFlatOramRequest::_internal_block_size() const {
+  return _impl_.block_size_;
+}
+inline uint32_t InitFlatOramRequest::block_size() const {
+  // @@protoc_insertion_point(field_get:oram_impl.InitFlatOramRequest.block_size)
+  return _internal_block_size();
+}
+inline void InitFlatOramRequest::_internal_set_block_size(uint32_t value) {
+  
+  _impl_.block_size_ = value;
+}
+inline void InitFlatOramRequest::set_block_size(uint32_t value) {
+  _internal_set_block_size(value);
+  // @@protoc_insertion_point(field_set:oram_impl.InitFlatOramRequest.block_size)
+}
+
+// -------------------------------------------------------------------
+
+// InitSqrtOramRequest
+
+// .oram_impl.RequestHeader header = 1;
+inline bool InitSqrtOramRequest::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool InitSqrtOramRequest::has_header() const {
+  return _internal_has_header();
+}
+inline void InitSqrtOramRequest::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::oram_impl::RequestHeader& InitSqrtOramRequest::_internal_header() const {
+  const ::oram_impl::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
+      ::oram_impl::_RequestHeader_default_instance_);
+}
+inline const ::oram_impl::RequestHeader& InitSqrtOramRequest::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.InitSqrtOramRequest.header)
+  return _internal_header();
+}
+inline void InitSqrtOramRequest::unsafe_arena_set_allocated_header(
+    ::oram_impl::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.InitSqrtOramRequest.header)
+}
+inline ::oram_impl::RequestHeader* InitSqrtOramRequest::release_header() {
+  
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::oram_impl::RequestHeader* InitSqrtOramRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.InitSqrtOramRequest.header)
+  
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::oram_impl::RequestHeader* InitSqrtOramRequest::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::oram_impl::RequestHeader* InitSqrtOramRequest::mutable_header() {
+  ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:oram_impl.InitSqrtOramRequest.header)
+  return _msg;
+}
+inline void InitSqrtOramRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.InitSqrtOramRequest.header)
+}
+
+// uint32 capacity = 2;
+inline void InitSqrtOramRequest::clear_capacity() {
+  _impl_.capacity_ = 0u;
+}
+inline uint32_t InitSqrtOramRequest::_internal_capacity() const {
+  return _impl_.capacity_;
+}
+inline uint32_t InitSqrtOramRequest::capacity() const {
+  // @@protoc_insertion_point(field_get:oram_impl.InitSqrtOramRequest.capacity)
+  return _internal_capacity();
+}
+inline void InitSqrtOramRequest::_internal_set_capacity(uint32_t value) {
+  
+  _impl_.capacity_ = value;
+}
+inline void InitSqrtOramRequest::set_capacity(uint32_t value) {
+  _internal_set_capacity(value);
+  // @@protoc_insertion_point(field_set:oram_impl.InitSqrtOramRequest.capacity)
+}
+
+// uint32 squared_m = 3;
+inline void InitSqrtOramRequest::clear_squared_m() {
+  _impl_.squared_m_ = 0u;
+}
+inline uint32_t InitSqrtOramRequest::_internal_squared_m() const {
+  return _impl_.squared_m_;
+}
+inline uint32_t InitSqrtOramRequest::squared_m() const {
+  // @@protoc_insertion_point(field_get:oram_impl.InitSqrtOramRequest.squared_m)
+  return _internal_squared_m();
+}
+inline void InitSqrtOramRequest::_internal_set_squared_m(uint32_t value) {
+  
+  _impl_.squared_m_ = value;
+}
+inline void InitSqrtOramRequest::set_squared_m(uint32_t value) {
+  _internal_set_squared_m(value);
+  // @@protoc_insertion_point(field_set:oram_impl.InitSqrtOramRequest.squared_m)
+}
+
+// uint32 block_size = 4;
+inline void InitSqrtOramRequest::clear_block_size() {
+  _impl_.block_size_ = 0u;
+}
+inline uint32_t InitSqrtOramRequest::_internal_block_size() const {
+  return _impl_.block_size_;
+}
+inline uint32_t InitSqrtOramRequest::block_size() const {
+  // @@protoc_insertion_point(field_get:oram_impl.InitSqrtOramRequest.block_size)
+  return _internal_block_size();
+}
+inline void InitSqrtOramRequest::_internal_set_block_size(uint32_t value) {
+  
+  _impl_.block_size_ = value;
+}
+inline void InitSqrtOramRequest::set_block_size(uint32_t value) {
+  _internal_set_block_size(value);
+  // @@protoc_insertion_point(field_set:oram_impl.InitSqrtOramRequest.block_size)
+}
+
+// -------------------------------------------------------------------
+
+// LoadSqrtOramRequest
+
+// .oram_impl.RequestHeader header = 1;
+inline bool LoadSqrtOramRequest::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool LoadSqrtOramRequest::has_header() const {
+  return _internal_has_header();
+}
+inline void LoadSqrtOramRequest::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::oram_impl::RequestHeader& LoadSqrtOramRequest::_internal_header() const {
+  const ::oram_impl::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
+      ::oram_impl::_RequestHeader_default_instance_);
+}
+inline const ::oram_impl::RequestHeader& LoadSqrtOramRequest::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.LoadSqrtOramRequest.header)
+  return _internal_header();
+}
+inline void LoadSqrtOramRequest::unsafe_arena_set_allocated_header(
+    ::oram_impl::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.LoadSqrtOramRequest.header)
+}
+inline ::oram_impl::RequestHeader* LoadSqrtOramRequest::release_header() {
+  
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::oram_impl::RequestHeader* LoadSqrtOramRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.LoadSqrtOramRequest.header)
+  
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::oram_impl::RequestHeader* LoadSqrtOramRequest::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::oram_impl::RequestHeader* LoadSqrtOramRequest::mutable_header() {
+  ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:oram_impl.LoadSqrtOramRequest.header)
+  return _msg;
+}
+inline void LoadSqrtOramRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.LoadSqrtOramRequest.header)
+}
+
+// repeated bytes contents = 2;
+inline int LoadSqrtOramRequest::_internal_contents_size() const {
+  return _impl_.contents_.size();
+}
+inline int LoadSqrtOramRequest::contents_size() const {
+  return _internal_contents_size();
+}
+inline void LoadSqrtOramRequest::clear_contents() {
+  _impl_.contents_.Clear();
+}
+inline std::string* LoadSqrtOramRequest::add_contents() {
+  std::string* _s = _internal_add_contents();
+  // @@protoc_insertion_point(field_add_mutable:oram_impl.LoadSqrtOramRequest.contents)
+  return _s;
+}
+inline const std::string& LoadSqrtOramRequest::_internal_contents(int index) const {
+  return _impl_.contents_.Get(index);
+}
+inline const std::string& LoadSqrtOramRequest::contents(int index) const {
+  // @@protoc_insertion_point(field_get:oram_impl.LoadSqrtOramRequest.contents)
+  return _internal_contents(index);
+}
+inline std::string* LoadSqrtOramRequest::mutable_contents(int index) {
+  // @@protoc_insertion_point(field_mutable:oram_impl.LoadSqrtOramRequest.contents)
+  return _impl_.contents_.Mutable(index);
+}
+inline void LoadSqrtOramRequest::set_contents(int index, const std::string& value) {
+  _impl_.contents_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:oram_impl.LoadSqrtOramRequest.contents)
+}
+inline void LoadSqrtOramRequest::set_contents(int index, std::string&& value) {
+  _impl_.contents_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:oram_impl.LoadSqrtOramRequest.contents)
+}
+inline void LoadSqrtOramRequest::set_contents(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.contents_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:oram_impl.LoadSqrtOramRequest.contents)
+}
+inline void LoadSqrtOramRequest::set_contents(int index, const void* value, size_t size) {
+  _impl_.contents_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:oram_impl.LoadSqrtOramRequest.contents)
+}
+inline std::string* LoadSqrtOramRequest::_internal_add_contents() {
+  return _impl_.contents_.Add();
+}
+inline void LoadSqrtOramRequest::add_contents(const std::string& value) {
+  _impl_.contents_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:oram_impl.LoadSqrtOramRequest.contents)
+}
+inline void LoadSqrtOramRequest::add_contents(std::string&& value) {
+  _impl_.contents_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:oram_impl.LoadSqrtOramRequest.contents)
+}
+inline void LoadSqrtOramRequest::add_contents(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.contents_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:oram_impl.LoadSqrtOramRequest.contents)
+}
+inline void LoadSqrtOramRequest::add_contents(const void* value, size_t size) {
+  _impl_.contents_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:oram_impl.LoadSqrtOramRequest.contents)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+LoadSqrtOramRequest::contents() const {
+  // @@protoc_insertion_point(field_list:oram_impl.LoadSqrtOramRequest.contents)
+  return _impl_.contents_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+LoadSqrtOramRequest::mutable_contents() {
+  // @@protoc_insertion_point(field_mutable_list:oram_impl.LoadSqrtOramRequest.contents)
+  return &_impl_.contents_;
+}
+
+// -------------------------------------------------------------------
+
+// FlatVectorMessage
+
+// .oram_impl.RequestHeader header = 1;
+inline bool FlatVectorMessage::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool FlatVectorMessage::has_header() const {
+  return _internal_has_header();
+}
+inline void FlatVectorMessage::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::oram_impl::RequestHeader& FlatVectorMessage::_internal_header() const {
+  const ::oram_impl::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
+      ::oram_impl::_RequestHeader_default_instance_);
+}
+inline const ::oram_impl::RequestHeader& FlatVectorMessage::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.FlatVectorMessage.header)
+  return _internal_header();
+}
+inline void FlatVectorMessage::unsafe_arena_set_allocated_header(
+    ::oram_impl::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.FlatVectorMessage.header)
+}
+inline ::oram_impl::RequestHeader* FlatVectorMessage::release_header() {
+  
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::oram_impl::RequestHeader* FlatVectorMessage::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.FlatVectorMessage.header)
+  
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::oram_impl::RequestHeader* FlatVectorMessage::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::oram_impl::RequestHeader* FlatVectorMessage::mutable_header() {
+  ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:oram_impl.FlatVectorMessage.header)
+  return _msg;
+}
+inline void FlatVectorMessage::set_allocated_header(::oram_impl::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.FlatVectorMessage.header)
+}
+
+// bytes content = 2;
+inline void FlatVectorMessage::clear_content() {
+  _impl_.content_.ClearToEmpty();
+}
+inline const std::string& FlatVectorMessage::content() const {
+  // @@protoc_insertion_point(field_get:oram_impl.FlatVectorMessage.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FlatVectorMessage::set_content(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.content_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:oram_impl.FlatVectorMessage.content)
+}
+inline std::string* FlatVectorMessage::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:oram_impl.FlatVectorMessage.content)
+  return _s;
+}
+inline const std::string& FlatVectorMessage::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void FlatVectorMessage::_internal_set_content(const std::string& value) {
+  
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FlatVectorMessage::_internal_mutable_content() {
+  
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FlatVectorMessage::release_content() {
+  // @@protoc_insertion_point(field_release:oram_impl.FlatVectorMessage.content)
+  return _impl_.content_.Release();
+}
+inline void FlatVectorMessage::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.FlatVectorMessage.content)
+}
+
+// -------------------------------------------------------------------
+
+// SqrtMessage
+
+// .oram_impl.RequestHeader header = 1;
+inline bool SqrtMessage::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool SqrtMessage::has_header() const {
+  return _internal_has_header();
+}
+inline void SqrtMessage::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::oram_impl::RequestHeader& SqrtMessage::_internal_header() const {
+  const ::oram_impl::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
+      ::oram_impl::_RequestHeader_default_instance_);
+}
+inline const ::oram_impl::RequestHeader& SqrtMessage::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.SqrtMessage.header)
+  return _internal_header();
+}
+inline void SqrtMessage::unsafe_arena_set_allocated_header(
+    ::oram_impl::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.SqrtMessage.header)
+}
+inline ::oram_impl::RequestHeader* SqrtMessage::release_header() {
+  
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::oram_impl::RequestHeader* SqrtMessage::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.SqrtMessage.header)
+  
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::oram_impl::RequestHeader* SqrtMessage::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::oram_impl::RequestHeader* SqrtMessage::mutable_header() {
+  ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:oram_impl.SqrtMessage.header)
+  return _msg;
+}
+inline void SqrtMessage::set_allocated_header(::oram_impl::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.SqrtMessage.header)
+}
+
+// bytes content = 2;
+inline void SqrtMessage::clear_content() {
+  _impl_.content_.ClearToEmpty();
+}
+inline const std::string& SqrtMessage::content() const {
+  // @@protoc_insertion_point(field_get:oram_impl.SqrtMessage.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SqrtMessage::set_content(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.content_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:oram_impl.SqrtMessage.content)
+}
+inline std::string* SqrtMessage::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:oram_impl.SqrtMessage.content)
+  return _s;
+}
+inline const std::string& SqrtMessage::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void SqrtMessage::_internal_set_content(const std::string& value) {
+  
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SqrtMessage::_internal_mutable_content() {
+  
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SqrtMessage::release_content() {
+  // @@protoc_insertion_point(field_release:oram_impl.SqrtMessage.content)
+  return _impl_.content_.Release();
+}
+inline void SqrtMessage::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.SqrtMessage.content)
+}
+
+// -------------------------------------------------------------------
+
+// WriteSqrtMessage
+
+// .oram_impl.RequestHeader header = 1;
+inline bool WriteSqrtMessage::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool WriteSqrtMessage::has_header() const {
+  return _internal_has_header();
+}
+inline void WriteSqrtMessage::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::oram_impl::RequestHeader& WriteSqrtMessage::_internal_header() const {
+  const ::oram_impl::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
+      ::oram_impl::_RequestHeader_default_instance_);
+}
+inline const ::oram_impl::RequestHeader& WriteSqrtMessage::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteSqrtMessage.header)
+  return _internal_header();
+}
+inline void WriteSqrtMessage::unsafe_arena_set_allocated_header(
+    ::oram_impl::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.WriteSqrtMessage.header)
+}
+inline ::oram_impl::RequestHeader* WriteSqrtMessage::release_header() {
+  
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::oram_impl::RequestHeader* WriteSqrtMessage::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.WriteSqrtMessage.header)
+  
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::oram_impl::RequestHeader* WriteSqrtMessage::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::oram_impl::RequestHeader* WriteSqrtMessage::mutable_header() {
+  ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:oram_impl.WriteSqrtMessage.header)
+  return _msg;
+}
+inline void WriteSqrtMessage::set_allocated_header(::oram_impl::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.WriteSqrtMessage.header)
+}
+
+// bytes content = 2;
+inline void WriteSqrtMessage::clear_content() {
+  _impl_.content_.ClearToEmpty();
+}
+inline const std::string& WriteSqrtMessage::content() const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteSqrtMessage.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WriteSqrtMessage::set_content(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.content_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:oram_impl.WriteSqrtMessage.content)
+}
+inline std::string* WriteSqrtMessage::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:oram_impl.WriteSqrtMessage.content)
+  return _s;
+}
+inline const std::string& WriteSqrtMessage::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void WriteSqrtMessage::_internal_set_content(const std::string& value) {
+  
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WriteSqrtMessage::_internal_mutable_content() {
+  
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WriteSqrtMessage::release_content() {
+  // @@protoc_insertion_point(field_release:oram_impl.WriteSqrtMessage.content)
+  return _impl_.content_.Release();
+}
+inline void WriteSqrtMessage::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.WriteSqrtMessage.content)
+}
+
+// bool write_to_cache = 3;
+inline void WriteSqrtMessage::clear_write_to_cache() {
+  _impl_.write_to_cache_ = false;
+}
+inline bool WriteSqrtMessage::_internal_write_to_cache() const {
+  return _impl_.write_to_cache_;
+}
+inline bool WriteSqrtMessage::write_to_cache() const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteSqrtMessage.write_to_cache)
+  return _internal_write_to_cache();
+}
+inline void WriteSqrtMessage::_internal_set_write_to_cache(bool value) {
+  
+  _impl_.write_to_cache_ = value;
+}
+inline void WriteSqrtMessage::set_write_to_cache(bool value) {
+  _internal_set_write_to_cache(value);
+  // @@protoc_insertion_point(field_set:oram_impl.WriteSqrtMessage.write_to_cache)
+}
+
+// uint32 pos = 4;
+inline void WriteSqrtMessage::clear_pos() {
+  _impl_.pos_ = 0u;
+}
+inline uint32_t WriteSqrtMessage::_internal_pos() const {
+  return _impl_.pos_;
+}
+inline uint32_t WriteSqrtMessage::pos() const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteSqrtMessage.pos)
+  return _internal_pos();
+}
+inline void WriteSqrtMessage::_internal_set_pos(uint32_t value) {
+  
+  _impl_.pos_ = value;
+}
+inline void WriteSqrtMessage::set_pos(uint32_t value) {
+  _internal_set_pos(value);
+  // @@protoc_insertion_point(field_set:oram_impl.WriteSqrtMessage.pos)
+}
+
+// -------------------------------------------------------------------
+
+// ReadShelterRequest
+
+// .oram_impl.RequestHeader header = 1;
+inline bool ReadShelterRequest::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool ReadShelterRequest::has_header() const {
+  return _internal_has_header();
+}
+inline void ReadShelterRequest::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::oram_impl::RequestHeader& ReadShelterRequest::_internal_header() const {
+  const ::oram_impl::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
+      ::oram_impl::_RequestHeader_default_instance_);
+}
+inline const ::oram_impl::RequestHeader& ReadShelterRequest::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.ReadShelterRequest.header)
+  return _internal_header();
+}
+inline void ReadShelterRequest::unsafe_arena_set_allocated_header(
+    ::oram_impl::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.ReadShelterRequest.header)
+}
+inline ::oram_impl::RequestHeader* ReadShelterRequest::release_header() {
+  
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::oram_impl::RequestHeader* ReadShelterRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.ReadShelterRequest.header)
+  
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::oram_impl::RequestHeader* ReadShelterRequest::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::oram_impl::RequestHeader* ReadShelterRequest::mutable_header() {
+  ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:oram_impl.ReadShelterRequest.header)
+  return _msg;
+}
+inline void ReadShelterRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.ReadShelterRequest.header)
+}
+
+// -------------------------------------------------------------------
+
+// ShelterMessage
+
+// repeated bytes contents = 1;
+inline int ShelterMessage::_internal_contents_size() const {
+  return _impl_.contents_.size();
+}
+inline int ShelterMessage::contents_size() const {
+  return _internal_contents_size();
+}
+inline void ShelterMessage::clear_contents() {
+  _impl_.contents_.Clear();
+}
+inline std::string* ShelterMessage::add_contents() {
+  std::string* _s = _internal_add_contents();
+  // @@protoc_insertion_point(field_add_mutable:oram_impl.ShelterMessage.contents)
+  return _s;
+}
+inline const std::string& ShelterMessage::_internal_contents(int index) const {
+  return _impl_.contents_.Get(index);
+}
+inline const std::string& ShelterMessage::contents(int index) const {
+  // @@protoc_insertion_point(field_get:oram_impl.ShelterMessage.contents)
+  return _internal_contents(index);
+}
+inline std::string* ShelterMessage::mutable_contents(int index) {
+  // @@protoc_insertion_point(field_mutable:oram_impl.ShelterMessage.contents)
+  return _impl_.contents_.Mutable(index);
+}
+inline void ShelterMessage::set_contents(int index, const std::string& value) {
+  _impl_.contents_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:oram_impl.ShelterMessage.contents)
+}
+inline void ShelterMessage::set_contents(int index, std::string&& value) {
+  _impl_.contents_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:oram_impl.ShelterMessage.contents)
+}
+inline void ShelterMessage::set_contents(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.contents_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:oram_impl.ShelterMessage.contents)
+}
+inline void ShelterMessage::set_contents(int index, const void* value, size_t size) {
+  _impl_.contents_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:oram_impl.ShelterMessage.contents)
+}
+inline std::string* ShelterMessage::_internal_add_contents() {
+  return _impl_.contents_.Add();
+}
+inline void ShelterMessage::add_contents(const std::string& value) {
+  _impl_.contents_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:oram_impl.ShelterMessage.contents)
+}
+inline void ShelterMessage::add_contents(std::string&& value) {
+  _impl_.contents_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:oram_impl.ShelterMessage.contents)
+}
+inline void ShelterMessage::add_contents(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.contents_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:oram_impl.ShelterMessage.contents)
+}
+inline void ShelterMessage::add_contents(const void* value, size_t size) {
+  _impl_.contents_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:oram_impl.ShelterMessage.contents)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+ShelterMessage::contents() const {
+  // @@protoc_insertion_point(field_list:oram_impl.ShelterMessage.contents)
+  return _impl_.contents_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+ShelterMessage::mutable_contents() {
+  // @@protoc_insertion_point(field_mutable_list:oram_impl.ShelterMessage.contents)
+  return &_impl_.contents_;
+}
+
+// -------------------------------------------------------------------
+
+// SqrtShuffleRequest
+
+// .oram_impl.RequestHeader header = 1;
+inline bool SqrtShuffleRequest::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool SqrtShuffleRequest::has_header() const {
+  return _internal_has_header();
+}
+inline void SqrtShuffleRequest::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::oram_impl::RequestHeader& SqrtShuffleRequest::_internal_header() const {
+  const ::oram_impl::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
+      ::oram_impl::_RequestHeader_default_instance_);
+}
+inline const ::oram_impl::RequestHeader& SqrtShuffleRequest::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.SqrtShuffleRequest.header)
+  return _internal_header();
+}
+inline void SqrtShuffleRequest::unsafe_arena_set_allocated_header(
+    ::oram_impl::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.SqrtShuffleRequest.header)
+}
+inline ::oram_impl::RequestHeader* SqrtShuffleRequest::release_header() {
+  
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::oram_impl::RequestHeader* SqrtShuffleRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.SqrtShuffleRequest.header)
+  
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::oram_impl::RequestHeader* SqrtShuffleRequest::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::oram_impl::RequestHeader* SqrtShuffleRequest::mutable_header() {
+  ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:oram_impl.SqrtShuffleRequest.header)
+  return _msg;
+}
+inline void SqrtShuffleRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.SqrtShuffleRequest.header)
+}
+
+// uint32 type = 2;
+inline void SqrtShuffleRequest::clear_type() {
+  _impl_.type_ = 0u;
+}
+inline uint32_t SqrtShuffleRequest::_internal_type() const {
+  return _impl_.type_;
+}
+inline uint32_t SqrtShuffleRequest::type() const {
+  // @@protoc_insertion_point(field_get:oram_impl.SqrtShuffleRequest.type)
+  return _internal_type();
+}
+inline void SqrtShuffleRequest::_internal_set_type(uint32_t value) {
+  
+  _impl_.type_ = value;
+}
+inline void SqrtShuffleRequest::set_type(uint32_t value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:oram_impl.SqrtShuffleRequest.type)
+}
+
+// uint32 temp_size = 3;
+inline void SqrtShuffleRequest::clear_temp_size() {
+  _impl_.temp_size_ = 0u;
+}
+inline uint32_t SqrtShuffleRequest::_internal_temp_size() const {
+  return _impl_.temp_size_;
+}
+inline uint32_t SqrtShuffleRequest::temp_size() const {
+  // @@protoc_insertion_point(field_get:oram_impl.SqrtShuffleRequest.temp_size)
+  return _internal_temp_size();
+}
+inline void SqrtShuffleRequest::_internal_set_temp_size(uint32_t value) {
+  
+  _impl_.temp_size_ = value;
+}
+inline void SqrtShuffleRequest::set_temp_size(uint32_t value) {
+  _internal_set_temp_size(value);
+  // @@protoc_insertion_point(field_set:oram_impl.SqrtShuffleRequest.temp_size)
+}
+
+// -------------------------------------------------------------------
+
+// ReadSqrtRangeRequest
+
+// .oram_impl.RequestHeader header = 1;
+inline bool ReadSqrtRangeRequest::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool ReadSqrtRangeRequest::has_header() const {
+  return _internal_has_header();
+}
+inline void ReadSqrtRangeRequest::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::oram_impl::RequestHeader& ReadSqrtRangeRequest::_internal_header() const {
+  const ::oram_impl::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
+      ::oram_impl::_RequestHeader_default_instance_);
+}
+inline const ::oram_impl::RequestHeader& ReadSqrtRangeRequest::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.ReadSqrtRangeRequest.header)
+  return _internal_header();
+}
+inline void ReadSqrtRangeRequest::unsafe_arena_set_allocated_header(
+    ::oram_impl::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.ReadSqrtRangeRequest.header)
+}
+inline ::oram_impl::RequestHeader* ReadSqrtRangeRequest::release_header() {
+  
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::oram_impl::RequestHeader* ReadSqrtRangeRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.ReadSqrtRangeRequest.header)
+  
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::oram_impl::RequestHeader* ReadSqrtRangeRequest::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::oram_impl::RequestHeader* ReadSqrtRangeRequest::mutable_header() {
+  ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:oram_impl.ReadSqrtRangeRequest.header)
+  return _msg;
+}
+inline void ReadSqrtRangeRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.ReadSqrtRangeRequest.header)
+}
+
+// uint32 area = 2;
+inline void ReadSqrtRangeRequest::clear_area() {
+  _impl_.area_ = 0u;
+}
+inline uint32_t ReadSqrtRangeRequest::_internal_area() const {
+  return _impl_.area_;
+}
+inline uint32_t ReadSqrtRangeRequest::area() const {
+  // @@protoc_insertion_point(field_get:oram_impl.ReadSqrtRangeRequest.area)
+  return _internal_area();
+}
+inline void ReadSqrtRangeRequest::_internal_set_area(uint32_t value) {
+  
+  _impl_.area_ = value;
+}
+inline void ReadSqrtRangeRequest::set_area(uint32_t value) {
+  _internal_set_area(value);
+  // @@protoc_insertion_point(field_set:oram_impl.ReadSqrtRangeRequest.area)
+}
+
+// repeated uint32 offsets = 3;
+inline int ReadSqrtRangeRequest::_internal_offsets_size() const {
+  return _impl_.offsets_.size();
+}
+inline int ReadSqrtRangeRequest::offsets_size() const {
+  return _internal_offsets_size();
+}
+inline void ReadSqrtRangeRequest::clear_offsets() {
+  _impl_.offsets_.Clear();
+}
+inline uint32_t ReadSqrtRangeRequest::_internal_offsets(int index) const {
+  return _impl_.offsets_.Get(index);
+}
+inline uint32_t ReadSqrtRangeRequest::offsets(int index) const {
+  // @@protoc_insertion_point(field_get:oram_impl.ReadSqrtRangeRequest.offsets)
+  return _internal_offsets(index);
+}
+inline void ReadSqrtRangeRequest::set_offsets(int index, uint32_t value) {
+  _impl_.offsets_.Set(index, value);
+  // @@protoc_insertion_point(field_set:oram_impl.ReadSqrtRangeRequest.offsets)
+}
+inline void ReadSqrtRangeRequest::_internal_add_offsets(uint32_t value) {
+  _impl_.offsets_.Add(value);
+}
+inline void ReadSqrtRangeRequest::add_offsets(uint32_t value) {
+  _internal_add_offsets(value);
+  // @@protoc_insertion_point(field_add:oram_impl.ReadSqrtRangeRequest.offsets)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ReadSqrtRangeRequest::_internal_offsets() const {
+  return _impl_.offsets_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ReadSqrtRangeRequest::offsets() const {
+  // @@protoc_insertion_point(field_list:oram_impl.ReadSqrtRangeRequest.offsets)
+  return _internal_offsets();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ReadSqrtRangeRequest::_internal_mutable_offsets() {
+  return &_impl_.offsets_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ReadSqrtRangeRequest::mutable_offsets() {
+  // @@protoc_insertion_point(field_mutable_list:oram_impl.ReadSqrtRangeRequest.offsets)
+  return _internal_mutable_offsets();
+}
+
+// repeated uint32 lengths = 4;
+inline int ReadSqrtRangeRequest::_internal_lengths_size() const {
+  return _impl_.lengths_.size();
+}
+inline int ReadSqrtRangeRequest::lengths_size() const {
+  return _internal_lengths_size();
+}
+inline void ReadSqrtRangeRequest::clear_lengths() {
+  _impl_.lengths_.Clear();
+}
+inline uint32_t ReadSqrtRangeRequest::_internal_lengths(int index) const {
+  return _impl_.lengths_.Get(index);
 }
-inline std::string* RequestHeader::release_version() {
-  // @@protoc_insertion_point(field_release:oram_impl.RequestHeader.version)
-  return _impl_.version_.Release();
+inline uint32_t ReadSqrtRangeRequest::lengths(int index) const {
+  // @@protoc_insertion_point(field_get:oram_impl.ReadSqrtRangeRequest.lengths)
+  return _internal_lengths(index);
 }
-inline void RequestHeader::set_allocated_version(std::string* version) {
-  if (version != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.version_.SetAllocated(version, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.version_.IsDefault()) {
-    _impl_.version_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.RequestHeader.version)
+inline void ReadSqrtRangeRequest::set_lengths(int index, uint32_t value) {
+  _impl_.lengths_.Set(index, value);
+  // @@protoc_insertion_point(field_set:oram_impl.ReadSqrtRangeRequest.lengths)
 }
-
-// uint32 id = 3;
-inline void RequestHeader::clear_id() {
-  _impl_.id_ = 0u;
+inline void ReadSqrtRangeRequest::_internal_add_lengths(uint32_t value) {
+  _impl_.lengths_.Add(value);
 }
-inline uint32_t RequestHeader::_internal_id() const {
-  return _impl_.id_;
+inline void ReadSqrtRangeRequest::add_lengths(uint32_t value) {
+  _internal_add_lengths(value);
+  // @@protoc_insertion_point(field_add:oram_impl.ReadSqrtRangeRequest.lengths)
 }
-inline uint32_t RequestHeader::id() const {
-  // @@protoc_insertion_point(field_get:oram_impl.RequestHeader.id)
-  return _internal_id();
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ReadSqrtRangeRequest::_internal_lengths() const {
+  return _impl_.lengths_;
 }
-inline void RequestHeader::_internal_set_id(uint32_t value) {
-  
-  _impl_.id_ = value;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ReadSqrtRangeRequest::lengths() const {
+  // @@protoc_insertion_point(field_list:oram_impl.ReadSqrtRangeRequest.lengths)
+  return _internal_lengths();
 }
-inline void RequestHeader::set_id(uint32_t value) {
-  _internal_set_id(value);
-  // @@protoc_insertion_point(field_set:oram_impl.RequestHeader.id)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ReadSqrtRangeRequest::_internal_mutable_lengths() {
+  return &_impl_.lengths_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ReadSqrtRangeRequest::mutable_lengths() {
+  // @@protoc_insertion_point(field_mutable_list:oram_impl.ReadSqrtRangeRequest.lengths)
+  return _internal_mutable_lengths();
 }
 
 // -------------------------------------------------------------------
 
-// PrintOramTreeRequest
+// SqrtRangeMessage
 
-// uint32 id = 1;
-inline void PrintOramTreeRequest::clear_id() {
-  _impl_.id_ = 0u;
+// repeated bytes contents = 1;
+inline int SqrtRangeMessage::_internal_contents_size() const {
+  return _impl_.contents_.size();
 }
-inline uint32_t PrintOramTreeRequest::_internal_id() const {
-  return _impl_.id_;
+inline int SqrtRangeMessage::contents_size() const {
+  return _internal_contents_size();
 }
-inline uint32_t PrintOramTreeRequest::id() const {
-  // @@protoc_insertion_point(field_get:oram_impl.PrintOramTreeRequest.id)
-  return _internal_id();
+inline void SqrtRangeMessage::clear_contents() {
+  _impl_.contents_.Clear();
 }
-inline void PrintOramTreeRequest::_internal_set_id(uint32_t value) {
-  
-  _impl_.id_ = value;
+inline std::string* SqrtRangeMessage::add_contents() {
+  std::string* _s = _internal_add_contents();
+  // @@protoc_insertion_point(field_add_mutable:oram_impl.SqrtRangeMessage.contents)
+  return _s;
 }
-inline void PrintOramTreeRequest::set_id(uint32_t value) {
-  _internal_set_id(value);
-  // @@protoc_insertion_point(field_set:oram_impl.PrintOramTreeRequest.id)
+inline const std::string& SqrtRangeMessage::_internal_contents(int index) const {
+  return _impl_.contents_.Get(index);
+}
+inline const std::string& SqrtRangeMessage::contents(int index) const {
+  // @@protoc_insertion_point(field_get:oram_impl.SqrtRangeMessage.contents)
+  return _internal_contents(index);
+}
+inline std::string* SqrtRangeMessage::mutable_contents(int index) {
+  // @@protoc_insertion_point(field_mutable:oram_impl.SqrtRangeMessage.contents)
+  return _impl_.contents_.Mutable(index);
+}
+inline void SqrtRangeMessage::set_contents(int index, const std::string& value) {
+  _impl_.contents_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:oram_impl.SqrtRangeMessage.contents)
+}
+inline void SqrtRangeMessage::set_contents(int index, std::string&& value) {
+  _impl_.contents_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:oram_impl.SqrtRangeMessage.contents)
+}
+inline void SqrtRangeMessage::set_contents(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.contents_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:oram_impl.SqrtRangeMessage.contents)
+}
+inline void SqrtRangeMessage::set_contents(int index, const void* value, size_t size) {
+  _impl_.contents_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:oram_impl.SqrtRangeMessage.contents)
+}
+inline std::string* SqrtRangeMessage::_internal_add_contents() {
+  return _impl_.contents_.Add();
+}
+inline void SqrtRangeMessage::add_contents(const std::string& value) {
+  _impl_.contents_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:oram_impl.SqrtRangeMessage.contents)
+}
+inline void SqrtRangeMessage::add_contents(std::string&& value) {
+  _impl_.contents_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:oram_impl.SqrtRangeMessage.contents)
+}
+inline void SqrtRangeMessage::add_contents(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.contents_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:oram_impl.SqrtRangeMessage.contents)
+}
+inline void SqrtRangeMessage::add_contents(const void* value, size_t size) {
+  _impl_.contents_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:oram_impl.SqrtRangeMessage.contents)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+SqrtRangeMessage::contents() const {
+  // @@protoc_insertion_point(field_list:oram_impl.SqrtRangeMessage.contents)
+  return _impl_.contents_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+SqrtRangeMessage::mutable_contents() {
+  // @@protoc_insertion_point(field_mutable_list:oram_impl.SqrtRangeMessage.contents)
+  return &_impl_.contents_;
 }
 
 // -------------------------------------------------------------------
 
-// HelloMessage
+// WriteSqrtRangeRequest
 
-// bytes content = 1;
-inline void HelloMessage::clear_content() {
-  _impl_.content_.ClearToEmpty();
+// .oram_impl.RequestHeader header = 1;
+inline bool WriteSqrtRangeRequest::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline const std::string& HelloMessage::content() const {
-  // @@protoc_insertion_point(field_get:oram_impl.HelloMessage.content)
-  return _internal_content();
+inline bool WriteSqrtRangeRequest::has_header() const {
+  return _internal_has_header();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void HelloMessage::set_content(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.content_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:oram_impl.HelloMessage.content)
+inline void WriteSqrtRangeRequest::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
 }
-inline std::string* HelloMessage::mutable_content() {
-  std::string* _s = _internal_mutable_content();
-  // @@protoc_insertion_point(field_mutable:oram_impl.HelloMessage.content)
-  return _s;
+inline const ::oram_impl::RequestHeader& WriteSqrtRangeRequest::_internal_header() const {
+  const ::oram_impl::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
+      ::oram_impl::_RequestHeader_default_instance_);
 }
-inline const std::string& HelloMessage::_internal_content() const {
-  return _impl_.content_.Get();
+inline const ::oram_impl::RequestHeader& WriteSqrtRangeRequest::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteSqrtRangeRequest.header)
+  return _internal_header();
 }
-inline void HelloMessage::_internal_set_content(const std::string& value) {
+inline void WriteSqrtRangeRequest::unsafe_arena_set_allocated_header(
+    ::oram_impl::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.WriteSqrtRangeRequest.header)
+}
+inline ::oram_impl::RequestHeader* WriteSqrtRangeRequest::release_header() {
   
-  _impl_.content_.Set(value, GetArenaForAllocation());
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline std::string* HelloMessage::_internal_mutable_content() {
+inline ::oram_impl::RequestHeader* WriteSqrtRangeRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.WriteSqrtRangeRequest.header)
   
-  return _impl_.content_.Mutable(GetArenaForAllocation());
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
 }
-inline std::string* HelloMessage::release_content() {
-  // @@protoc_insertion_point(field_release:oram_impl.HelloMessage.content)
-  return _impl_.content_.Release();
+inline ::oram_impl::RequestHeader* WriteSqrtRangeRequest::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
 }
-inline void HelloMessage::set_allocated_content(std::string* content) {
-  if (content != nullptr) {
+inline ::oram_impl::RequestHeader* WriteSqrtRangeRequest::mutable_header() {
+  ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:oram_impl.WriteSqrtRangeRequest.header)
+  return _msg;
+}
+inline void WriteSqrtRangeRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
     
   } else {
     
   }
-  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.content_.IsDefault()) {
-    _impl_.content_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.HelloMessage.content)
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.WriteSqrtRangeRequest.header)
 }
 
-// bytes iv = 2;
-inline void HelloMessage::clear_iv() {
-  _impl_.iv_.ClearToEmpty();
+// uint32 area = 2;
+inline void WriteSqrtRangeRequest::clear_area() {
+  _impl_.area_ = 0u;
 }
-inline const std::string& HelloMessage::iv() const {
-  // @@protoc_insertion_point(field_get:oram_impl.HelloMessage.iv)
-  return _internal_iv();
+inline uint32_t WriteSqrtRangeRequest::_internal_area() const {
+  return _impl_.area_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void HelloMessage::set_iv(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.iv_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:oram_impl.HelloMessage.iv)
+inline uint32_t WriteSqrtRangeRequest::area() const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteSqrtRangeRequest.area)
+  return _internal_area();
 }
-inline std::string* HelloMessage::mutable_iv() {
-  std::string* _s = _internal_mutable_iv();
-  // @@protoc_insertion_point(field_mutable:oram_impl.HelloMessage.iv)
-  return _s;
+inline void WriteSqrtRangeRequest::_internal_set_area(uint32_t value) {
+  
+  _impl_.area_ = value;
 }
-inline const std::string& HelloMessage::_internal_iv() const {
-  return _impl_.iv_.Get();
+inline void WriteSqrtRangeRequest::set_area(uint32_t value) {
+  _internal_set_area(value);
+  // @@protoc_insertion_point(field_set:oram_impl.WriteSqrtRangeRequest.area)
 }
-inline void HelloMessage::_internal_set_iv(const std::string& value) {
-  
-  _impl_.iv_.Set(value, GetArenaForAllocation());
+
+// uint32 offset = 3;
+inline void WriteSqrtRangeRequest::clear_offset() {
+  _impl_.offset_ = 0u;
 }
-inline std::string* HelloMessage::_internal_mutable_iv() {
-  
-  return _impl_.iv_.Mutable(GetArenaForAllocation());
+inline uint32_t WriteSqrtRangeRequest::_internal_offset() const {
+  return _impl_.offset_;
 }
-inline std::string* HelloMessage::release_iv() {
-  // @@protoc_insertion_point(field_release:oram_impl.HelloMessage.iv)
-  return _impl_.iv_.Release();
+inline uint32_t WriteSqrtRangeRequest::offset() const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteSqrtRangeRequest.offset)
+  return _internal_offset();
 }
-inline void HelloMessage::set_allocated_iv(std::string* iv) {
-  if (iv != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.iv_.SetAllocated(iv, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.iv_.IsDefault()) {
-    _impl_.iv_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.HelloMessage.iv)
+inline void WriteSqrtRangeRequest::_internal_set_offset(uint32_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void WriteSqrtRangeRequest::set_offset(uint32_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:oram_impl.WriteSqrtRangeRequest.offset)
 }
 
-// -------------------------------------------------------------------
-
-// KeyExchangeRequest
-
-// bytes public_key_client = 1;
-inline void KeyExchangeRequest::clear_public_key_client() {
-  _impl_.public_key_client_.ClearToEmpty();
+// repeated bytes contents = 4;
+inline int WriteSqrtRangeRequest::_internal_contents_size() const {
+  return _impl_.contents_.size();
 }
-inline const std::string& KeyExchangeRequest::public_key_client() const {
-  // @@protoc_insertion_point(field_get:oram_impl.KeyExchangeRequest.public_key_client)
-  return _internal_public_key_client();
+inline int WriteSqrtRangeRequest::contents_size() const {
+  return _internal_contents_size();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void KeyExchangeRequest::set_public_key_client(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.public_key_client_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:oram_impl.KeyExchangeRequest.public_key_client)
+inline void WriteSqrtRangeRequest::clear_contents() {
+  _impl_.contents_.Clear();
 }
-inline std::string* KeyExchangeRequest::mutable_public_key_client() {
-  std::string* _s = _internal_mutable_public_key_client();
-  // @@protoc_insertion_point(field_mutable:oram_impl.KeyExchangeRequest.public_key_client)
+inline std::string* WriteSqrtRangeRequest::add_contents() {
+  std::string* _s = _internal_add_contents();
+  // @@protoc_insertion_point(field_add_mutable:oram_impl.WriteSqrtRangeRequest.contents)
   return _s;
 }
-inline const std::string& KeyExchangeRequest::_internal_public_key_client() const {
-  return _impl_.public_key_client_.Get();
+inline const std::string& WriteSqrtRangeRequest::_internal_contents(int index) const {
+  return _impl_.contents_.Get(index);
 }
-inline void KeyExchangeRequest::_internal_set_public_key_client(const std::string& value) {
-  
-  _impl_.public_key_client_.Set(value, GetArenaForAllocation());
+inline const std::string& WriteSqrtRangeRequest::contents(int index) const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteSqrtRangeRequest.contents)
+  return _internal_contents(index);
 }
-inline std::string* KeyExchangeRequest::_internal_mutable_public_key_client() {
-  
-  return _impl_.public_key_client_.Mutable(GetArenaForAllocation());
+inline std::string* WriteSqrtRangeRequest::mutable_contents(int index) {
+  // @@protoc_insertion_point(field_mutable:oram_impl.WriteSqrtRangeRequest.contents)
+  return _impl_.contents_.Mutable(index);
 }
-inline std::string* KeyExchangeRequest::release_public_key_client() {
-  // @@protoc_insertion_point(field_release:oram_impl.KeyExchangeRequest.public_key_client)
-  return _impl_.public_key_client_.Release();
+inline void WriteSqrtRangeRequest::set_contents(int index, const std::string& value) {
+  _impl_.contents_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:oram_impl.WriteSqrtRangeRequest.contents)
 }
-inline void KeyExchangeRequest::set_allocated_public_key_client(std::string* public_key_client) {
-  if (public_key_client != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.public_key_client_.SetAllocated(public_key_client, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.public_key_client_.IsDefault()) {
-    _impl_.public_key_client_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.KeyExchangeRequest.public_key_client)
+inline void WriteSqrtRangeRequest::set_contents(int index, std::string&& value) {
+  _impl_.contents_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:oram_impl.WriteSqrtRangeRequest.contents)
 }
-
-// -------------------------------------------------------------------
-
-// KeyExchangeResponse
-
-// bytes public_key_server = 1;
-inline void KeyExchangeResponse::clear_public_key_server() {
-  _impl_.public_key_server_.ClearToEmpty();
+inline void WriteSqrtRangeRequest::set_contents(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.contents_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:oram_impl.WriteSqrtRangeRequest.contents)
 }
-inline const std::string& KeyExchangeResponse::public_key_server() const {
-  // @@protoc_insertion_point(field_get:oram_impl.KeyExchangeResponse.public_key_server)
-  return _internal_public_key_server();
+inline void WriteSqrtRangeRequest::set_contents(int index, const void* value, size_t size) {
+  _impl_.contents_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:oram_impl.WriteSqrtRangeRequest.contents)
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void KeyExchangeResponse::set_public_key_server(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.public_key_server_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:oram_impl.KeyExchangeResponse.public_key_server)
+inline std::string* WriteSqrtRangeRequest::_internal_add_contents() {
+  return _impl_.contents_.Add();
 }
-inline std::string* KeyExchangeResponse::mutable_public_key_server() {
-  std::string* _s = _internal_mutable_public_key_server();
-  // @@protoc_insertion_point(field_mutable:oram_impl.KeyExchangeResponse.public_key_server)
-  return _s;
+inline void WriteSqrtRangeRequest::add_contents(const std::string& value) {
+  _impl_.contents_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:oram_impl.WriteSqrtRangeRequest.contents)
 }
-inline const std::string& KeyExchangeResponse::_internal_public_key_server() const {
-  return _impl_.public_key_server_.Get();
+inline void WriteSqrtRangeRequest::add_contents(std::string&& value) {
+  _impl_.contents_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:oram_impl.WriteSqrtRangeRequest.contents)
 }
-inline void KeyExchangeResponse::_internal_set_public_key_server(const std::string& value) {
-  
-  _impl_.public_key_server_.Set(value, GetArenaForAllocation());
+inline void WriteSqrtRangeRequest::add_contents(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.contents_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:oram_impl.WriteSqrtRangeRequest.contents)
 }
-inline std::string* KeyExchangeResponse::_internal_mutable_public_key_server() {
-  
-  return _impl_.public_key_server_.Mutable(GetArenaForAllocation());
+inline void WriteSqrtRangeRequest::add_contents(const void* value, size_t size) {
+  _impl_.contents_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:oram_impl.WriteSqrtRangeRequest.contents)
 }
-inline std::string* KeyExchangeResponse::release_public_key_server() {
-  // @@protoc_insertion_point(field_release:oram_impl.KeyExchangeResponse.public_key_server)
-  return _impl_.public_key_server_.Release();
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+WriteSqrtRangeRequest::contents() const {
+  // @@protoc_insertion_point(field_list:oram_impl.WriteSqrtRangeRequest.contents)
+  return _impl_.contents_;
 }
-inline void KeyExchangeResponse::set_allocated_public_key_server(std::string* public_key_server) {
-  if (public_key_server != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.public_key_server_.SetAllocated(public_key_server, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.public_key_server_.IsDefault()) {
-    _impl_.public_key_server_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.KeyExchangeResponse.public_key_server)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+WriteSqrtRangeRequest::mutable_contents() {
+  // @@protoc_insertion_point(field_mutable_list:oram_impl.WriteSqrtRangeRequest.contents)
+  return &_impl_.contents_;
 }
 
 // -------------------------------------------------------------------
 
-// InitFlatOramRequest
+// InitLayeredOramRequest
 
 // .oram_impl.RequestHeader header = 1;
-inline bool InitFlatOramRequest::_internal_has_header() const {
+inline bool InitLayeredOramRequest::_internal_has_header() const {
   return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline bool InitFlatOramRequest::has_header() const {
+inline bool InitLayeredOramRequest::has_header() const {
   return _internal_has_header();
 }
-inline void InitFlatOramRequest::clear_header() {
+inline void InitLayeredOramRequest::clear_header() {
   if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
     delete _impl_.header_;
   }
   _impl_.header_ = nullptr;
 }
-inline const ::oram_impl::RequestHeader& InitFlatOramRequest::_internal_header() const {
+inline const ::oram_impl::RequestHeader& InitLayeredOramRequest::_internal_header() const {
   const ::oram_impl::RequestHeader* p = _impl_.header_;
   return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
       ::oram_impl::_RequestHeader_default_instance_);
 }
-inline const ::oram_impl::RequestHeader& InitFlatOramRequest::header() const {
-  // @@protoc_insertion_point(field_get:oram_impl.InitFlatOramRequest.header)
+inline const ::oram_impl::RequestHeader& InitLayeredOramRequest::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.InitLayeredOramRequest.header)
   return _internal_header();
 }
-inline void InitFlatOramRequest::unsafe_arena_set_allocated_header(
+inline void InitLayeredOramRequest::unsafe_arena_set_allocated_header(
     ::oram_impl::RequestHeader* header) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
@@ -3860,9 +8468,9 @@ inline void InitFlatOramRequest::unsafe_arena_set_allocated_header(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.InitFlatOramRequest.header)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.InitLayeredOramRequest.header)
 }
-inline ::oram_impl::RequestHeader* InitFlatOramRequest::release_header() {
+inline ::oram_impl::RequestHeader* InitLayeredOramRequest::release_header() {
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
@@ -3877,14 +8485,14 @@ inline ::oram_impl::RequestHeader* InitFlatOramRequest::release_header() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::oram_impl::RequestHeader* InitFlatOramRequest::unsafe_arena_release_header() {
-  // @@protoc_insertion_point(field_release:oram_impl.InitFlatOramRequest.header)
+inline ::oram_impl::RequestHeader* InitLayeredOramRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.InitLayeredOramRequest.header)
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
   return temp;
 }
-inline ::oram_impl::RequestHeader* InitFlatOramRequest::_internal_mutable_header() {
+inline ::oram_impl::RequestHeader* InitLayeredOramRequest::_internal_mutable_header() {
   
   if (_impl_.header_ == nullptr) {
     auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
@@ -3892,12 +8500,12 @@ inline ::oram_impl::RequestHeader* InitFlatOramRequest::_internal_mutable_header
   }
   return _impl_.header_;
 }
-inline ::oram_impl::RequestHeader* InitFlatOramRequest::mutable_header() {
+inline ::oram_impl::RequestHeader* InitLayeredOramRequest::mutable_header() {
   ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
-  // @@protoc_insertion_point(field_mutable:oram_impl.InitFlatOramRequest.header)
+  // @@protoc_insertion_point(field_mutable:oram_impl.InitLayeredOramRequest.header)
   return _msg;
 }
-inline void InitFlatOramRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
+inline void InitLayeredOramRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
     delete _impl_.header_;
@@ -3914,76 +8522,76 @@ inline void InitFlatOramRequest::set_allocated_header(::oram_impl::RequestHeader
     
   }
   _impl_.header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.InitFlatOramRequest.header)
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.InitLayeredOramRequest.header)
 }
 
-// uint32 capacity = 2;
-inline void InitFlatOramRequest::clear_capacity() {
-  _impl_.capacity_ = 0u;
+// uint32 level_num = 2;
+inline void InitLayeredOramRequest::clear_level_num() {
+  _impl_.level_num_ = 0u;
 }
-inline uint32_t InitFlatOramRequest::_internal_capacity() const {
-  return _impl_.capacity_;
+inline uint32_t InitLayeredOramRequest::_internal_level_num() const {
+  return _impl_.level_num_;
 }
-inline uint32_t InitFlatOramRequest::capacity() const {
-  // @@protoc_insertion_point(field_get:oram_impl.InitFlatOramRequest.capacity)
-  return _internal_capacity();
+inline uint32_t InitLayeredOramRequest::level_num() const {
+  // @@protoc_insertion_point(field_get:oram_impl.InitLayeredOramRequest.level_num)
+  return _internal_level_num();
 }
-inline void InitFlatOramRequest::_internal_set_capacity(uint32_t value) {
+inline void InitLayeredOramRequest::_internal_set_level_num(uint32_t value) {
   
-  _impl_.capacity_ = value;
+  _impl_.level_num_ = value;
 }
-inline void InitFlatOramRequest::set_capacity(uint32_t value) {
-  _internal_set_capacity(value);
-  // @@protoc_insertion_point(field_set:oram_impl.InitFlatOramRequest.capacity)
+inline void InitLayeredOramRequest::set_level_num(uint32_t value) {
+  _internal_set_level_num(value);
+  // @@protoc_insertion_point(field_set:oram_impl.InitLayeredOramRequest.level_num)
 }
 
 // uint32 block_size = 3;
-inline void InitFlatOramRequest::clear_block_size() {
+inline void InitLayeredOramRequest::clear_block_size() {
   _impl_.block_size_ = 0u;
 }
-inline uint32_t InitFlatOramRequest::_internal_block_size() const {
+inline uint32_t InitLayeredOramRequest::_internal_block_size() const {
   return _impl_.block_size_;
 }
-inline uint32_t InitFlatOramRequest::block_size() const {
-  // @@protoc_insertion_point(field_get:oram_impl.InitFlatOramRequest.block_size)
+inline uint32_t InitLayeredOramRequest::block_size() const {
+  // @@protoc_insertion_point(field_get:oram_impl.InitLayeredOramRequest.block_size)
   return _internal_block_size();
 }
-inline void InitFlatOramRequest::_internal_set_block_size(uint32_t value) {
+inline void InitLayeredOramRequest::_internal_set_block_size(uint32_t value) {
   
   _impl_.block_size_ = value;
 }
-inline void InitFlatOramRequest::set_block_size(uint32_t value) {
+inline void InitLayeredOramRequest::set_block_size(uint32_t value) {
   _internal_set_block_size(value);
-  // @@protoc_insertion_point(field_set:oram_impl.InitFlatOramRequest.block_size)
+  // @@protoc_insertion_point(field_set:oram_impl.InitLayeredOramRequest.block_size)
 }
 
 // -------------------------------------------------------------------
 
-// InitSqrtOramRequest
+// ReadLayeredRequest
 
 // .oram_impl.RequestHeader header = 1;
-inline bool InitSqrtOramRequest::_internal_has_header() const {
+inline bool ReadLayeredRequest::_internal_has_header() const {
   return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline bool InitSqrtOramRequest::has_header() const {
+inline bool ReadLayeredRequest::has_header() const {
   return _internal_has_header();
 }
-inline void InitSqrtOramRequest::clear_header() {
+inline void ReadLayeredRequest::clear_header() {
   if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
     delete _impl_.header_;
   }
   _impl_.header_ = nullptr;
 }
-inline const ::oram_impl::RequestHeader& InitSqrtOramRequest::_internal_header() const {
+inline const ::oram_impl::RequestHeader& ReadLayeredRequest::_internal_header() const {
   const ::oram_impl::RequestHeader* p = _impl_.header_;
   return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
       ::oram_impl::_RequestHeader_default_instance_);
 }
-inline const ::oram_impl::RequestHeader& InitSqrtOramRequest::header() const {
-  // @@protoc_insertion_point(field_get:oram_impl.InitSqrtOramRequest.header)
+inline const ::oram_impl::RequestHeader& ReadLayeredRequest::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.ReadLayeredRequest.header)
   return _internal_header();
 }
-inline void InitSqrtOramRequest::unsafe_arena_set_allocated_header(
+inline void ReadLayeredRequest::unsafe_arena_set_allocated_header(
     ::oram_impl::RequestHeader* header) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
@@ -3994,9 +8602,9 @@ inline void InitSqrtOramRequest::unsafe_arena_set_allocated_header(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.InitSqrtOramRequest.header)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.ReadLayeredRequest.header)
 }
-inline ::oram_impl::RequestHeader* InitSqrtOramRequest::release_header() {
+inline ::oram_impl::RequestHeader* ReadLayeredRequest::release_header() {
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
@@ -4011,14 +8619,14 @@ inline ::oram_impl::RequestHeader* InitSqrtOramRequest::release_header() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::oram_impl::RequestHeader* InitSqrtOramRequest::unsafe_arena_release_header() {
-  // @@protoc_insertion_point(field_release:oram_impl.InitSqrtOramRequest.header)
+inline ::oram_impl::RequestHeader* ReadLayeredRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.ReadLayeredRequest.header)
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
   return temp;
 }
-inline ::oram_impl::RequestHeader* InitSqrtOramRequest::_internal_mutable_header() {
+inline ::oram_impl::RequestHeader* ReadLayeredRequest::_internal_mutable_header() {
   
   if (_impl_.header_ == nullptr) {
     auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
@@ -4026,12 +8634,12 @@ inline ::oram_impl::RequestHeader* InitSqrtOramRequest::_internal_mutable_header
   }
   return _impl_.header_;
 }
-inline ::oram_impl::RequestHeader* InitSqrtOramRequest::mutable_header() {
+inline ::oram_impl::RequestHeader* ReadLayeredRequest::mutable_header() {
   ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
-  // @@protoc_insertion_point(field_mutable:oram_impl.InitSqrtOramRequest.header)
+  // @@protoc_insertion_point(field_mutable:oram_impl.ReadLayeredRequest.header)
   return _msg;
 }
-inline void InitSqrtOramRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
+inline void ReadLayeredRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
     delete _impl_.header_;
@@ -4048,96 +8656,209 @@ inline void InitSqrtOramRequest::set_allocated_header(::oram_impl::RequestHeader
     
   }
   _impl_.header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.InitSqrtOramRequest.header)
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.ReadLayeredRequest.header)
 }
 
-// uint32 capacity = 2;
-inline void InitSqrtOramRequest::clear_capacity() {
-  _impl_.capacity_ = 0u;
+// repeated uint32 levels = 2;
+inline int ReadLayeredRequest::_internal_levels_size() const {
+  return _impl_.levels_.size();
 }
-inline uint32_t InitSqrtOramRequest::_internal_capacity() const {
-  return _impl_.capacity_;
+inline int ReadLayeredRequest::levels_size() const {
+  return _internal_levels_size();
 }
-inline uint32_t InitSqrtOramRequest::capacity() const {
-  // @@protoc_insertion_point(field_get:oram_impl.InitSqrtOramRequest.capacity)
-  return _internal_capacity();
+inline void ReadLayeredRequest::clear_levels() {
+  _impl_.levels_.Clear();
 }
-inline void InitSqrtOramRequest::_internal_set_capacity(uint32_t value) {
-  
-  _impl_.capacity_ = value;
+inline uint32_t ReadLayeredRequest::_internal_levels(int index) const {
+  return _impl_.levels_.Get(index);
 }
-inline void InitSqrtOramRequest::set_capacity(uint32_t value) {
-  _internal_set_capacity(value);
-  // @@protoc_insertion_point(field_set:oram_impl.InitSqrtOramRequest.capacity)
+inline uint32_t ReadLayeredRequest::levels(int index) const {
+  // @@protoc_insertion_point(field_get:oram_impl.ReadLayeredRequest.levels)
+  return _internal_levels(index);
+}
+inline void ReadLayeredRequest::set_levels(int index, uint32_t value) {
+  _impl_.levels_.Set(index, value);
+  // @@protoc_insertion_point(field_set:oram_impl.ReadLayeredRequest.levels)
+}
+inline void ReadLayeredRequest::_internal_add_levels(uint32_t value) {
+  _impl_.levels_.Add(value);
+}
+inline void ReadLayeredRequest::add_levels(uint32_t value) {
+  _internal_add_levels(value);
+  // @@protoc_insertion_point(field_add:oram_impl.ReadLayeredRequest.levels)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ReadLayeredRequest::_internal_levels() const {
+  return _impl_.levels_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ReadLayeredRequest::levels() const {
+  // @@protoc_insertion_point(field_list:oram_impl.ReadLayeredRequest.levels)
+  return _internal_levels();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ReadLayeredRequest::_internal_mutable_levels() {
+  return &_impl_.levels_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ReadLayeredRequest::mutable_levels() {
+  // @@protoc_insertion_point(field_mutable_list:oram_impl.ReadLayeredRequest.levels)
+  return _internal_mutable_levels();
 }
 
-// uint32 squared_m = 3;
-inline void InitSqrtOramRequest::clear_squared_m() {
-  _impl_.squared_m_ = 0u;
+// repeated uint32 offsets = 3;
+inline int ReadLayeredRequest::_internal_offsets_size() const {
+  return _impl_.offsets_.size();
 }
-inline uint32_t InitSqrtOramRequest::_internal_squared_m() const {
-  return _impl_.squared_m_;
+inline int ReadLayeredRequest::offsets_size() const {
+  return _internal_offsets_size();
 }
-inline uint32_t InitSqrtOramRequest::squared_m() const {
-  // @@protoc_insertion_point(field_get:oram_impl.InitSqrtOramRequest.squared_m)
-  return _internal_squared_m();
+inline void ReadLayeredRequest::clear_offsets() {
+  _impl_.offsets_.Clear();
 }
-inline void InitSqrtOramRequest::_internal_set_squared_m(uint32_t value) {
-  
-  _impl_.squared_m_ = value;
+inline uint32_t ReadLayeredRequest::_internal_offsets(int index) const {
+  return _impl_.offsets_.Get(index);
 }
-inline void InitSqrtOramRequest::set_squared_m(uint32_t value) {
-  _internal_set_squared_m(value);
-  // @@protoc_insertion_point(field_set:oram_impl.InitSqrtOramRequest.squared_m)
+inline uint32_t ReadLayeredRequest::offsets(int index) const {
+  // @@protoc_insertion_point(field_get:oram_impl.ReadLayeredRequest.offsets)
+  return _internal_offsets(index);
+}
+inline void ReadLayeredRequest::set_offsets(int index, uint32_t value) {
+  _impl_.offsets_.Set(index, value);
+  // @@protoc_insertion_point(field_set:oram_impl.ReadLayeredRequest.offsets)
+}
+inline void ReadLayeredRequest::_internal_add_offsets(uint32_t value) {
+  _impl_.offsets_.Add(value);
+}
+inline void ReadLayeredRequest::add_offsets(uint32_t value) {
+  _internal_add_offsets(value);
+  // @@protoc_insertion_point(field_add:oram_impl.ReadLayeredRequest.offsets)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ReadLayeredRequest::_internal_offsets() const {
+  return _impl_.offsets_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ReadLayeredRequest::offsets() const {
+  // @@protoc_insertion_point(field_list:oram_impl.ReadLayeredRequest.offsets)
+  return _internal_offsets();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ReadLayeredRequest::_internal_mutable_offsets() {
+  return &_impl_.offsets_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ReadLayeredRequest::mutable_offsets() {
+  // @@protoc_insertion_point(field_mutable_list:oram_impl.ReadLayeredRequest.offsets)
+  return _internal_mutable_offsets();
 }
 
-// uint32 block_size = 4;
-inline void InitSqrtOramRequest::clear_block_size() {
-  _impl_.block_size_ = 0u;
+// -------------------------------------------------------------------
+
+// LayeredBlocksMessage
+
+// repeated bytes contents = 1;
+inline int LayeredBlocksMessage::_internal_contents_size() const {
+  return _impl_.contents_.size();
 }
-inline uint32_t InitSqrtOramRequest::_internal_block_size() const {
-  return _impl_.block_size_;
+inline int LayeredBlocksMessage::contents_size() const {
+  return _internal_contents_size();
 }
-inline uint32_t InitSqrtOramRequest::block_size() const {
-  // @@protoc_insertion_point(field_get:oram_impl.InitSqrtOramRequest.block_size)
-  return _internal_block_size();
+inline void LayeredBlocksMessage::clear_contents() {
+  _impl_.contents_.Clear();
 }
-inline void InitSqrtOramRequest::_internal_set_block_size(uint32_t value) {
-  
-  _impl_.block_size_ = value;
+inline std::string* LayeredBlocksMessage::add_contents() {
+  std::string* _s = _internal_add_contents();
+  // @@protoc_insertion_point(field_add_mutable:oram_impl.LayeredBlocksMessage.contents)
+  return _s;
 }
-inline void InitSqrtOramRequest::set_block_size(uint32_t value) {
-  _internal_set_block_size(value);
-  // @@protoc_insertion_point(field_set:oram_impl.InitSqrtOramRequest.block_size)
+inline const std::string& LayeredBlocksMessage::_internal_contents(int index) const {
+  return _impl_.contents_.Get(index);
+}
+inline const std::string& LayeredBlocksMessage::contents(int index) const {
+  // @@protoc_insertion_point(field_get:oram_impl.LayeredBlocksMessage.contents)
+  return _internal_contents(index);
+}
+inline std::string* LayeredBlocksMessage::mutable_contents(int index) {
+  // @@protoc_insertion_point(field_mutable:oram_impl.LayeredBlocksMessage.contents)
+  return _impl_.contents_.Mutable(index);
+}
+inline void LayeredBlocksMessage::set_contents(int index, const std::string& value) {
+  _impl_.contents_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:oram_impl.LayeredBlocksMessage.contents)
+}
+inline void LayeredBlocksMessage::set_contents(int index, std::string&& value) {
+  _impl_.contents_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:oram_impl.LayeredBlocksMessage.contents)
+}
+inline void LayeredBlocksMessage::set_contents(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.contents_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:oram_impl.LayeredBlocksMessage.contents)
+}
+inline void LayeredBlocksMessage::set_contents(int index, const void* value, size_t size) {
+  _impl_.contents_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:oram_impl.LayeredBlocksMessage.contents)
+}
+inline std::string* LayeredBlocksMessage::_internal_add_contents() {
+  return _impl_.contents_.Add();
+}
+inline void LayeredBlocksMessage::add_contents(const std::string& value) {
+  _impl_.contents_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:oram_impl.LayeredBlocksMessage.contents)
+}
+inline void LayeredBlocksMessage::add_contents(std::string&& value) {
+  _impl_.contents_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:oram_impl.LayeredBlocksMessage.contents)
+}
+inline void LayeredBlocksMessage::add_contents(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.contents_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:oram_impl.LayeredBlocksMessage.contents)
+}
+inline void LayeredBlocksMessage::add_contents(const void* value, size_t size) {
+  _impl_.contents_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:oram_impl.LayeredBlocksMessage.contents)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+LayeredBlocksMessage::contents() const {
+  // @@protoc_insertion_point(field_list:oram_impl.LayeredBlocksMessage.contents)
+  return _impl_.contents_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+LayeredBlocksMessage::mutable_contents() {
+  // @@protoc_insertion_point(field_mutable_list:oram_impl.LayeredBlocksMessage.contents)
+  return &_impl_.contents_;
 }
 
 // -------------------------------------------------------------------
 
-// LoadSqrtOramRequest
+// WriteLayeredRequest
 
 // .oram_impl.RequestHeader header = 1;
-inline bool LoadSqrtOramRequest::_internal_has_header() const {
+inline bool WriteLayeredRequest::_internal_has_header() const {
   return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline bool LoadSqrtOramRequest::has_header() const {
+inline bool WriteLayeredRequest::has_header() const {
   return _internal_has_header();
 }
-inline void LoadSqrtOramRequest::clear_header() {
+inline void WriteLayeredRequest::clear_header() {
   if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
     delete _impl_.header_;
   }
   _impl_.header_ = nullptr;
 }
-inline const ::oram_impl::RequestHeader& LoadSqrtOramRequest::_internal_header() const {
+inline const ::oram_impl::RequestHeader& WriteLayeredRequest::_internal_header() const {
   const ::oram_impl::RequestHeader* p = _impl_.header_;
   return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
       ::oram_impl::_RequestHeader_default_instance_);
 }
-inline const ::oram_impl::RequestHeader& LoadSqrtOramRequest::header() const {
-  // @@protoc_insertion_point(field_get:oram_impl.LoadSqrtOramRequest.header)
+inline const ::oram_impl::RequestHeader& WriteLayeredRequest::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteLayeredRequest.header)
   return _internal_header();
 }
-inline void LoadSqrtOramRequest::unsafe_arena_set_allocated_header(
+inline void WriteLayeredRequest::unsafe_arena_set_allocated_header(
     ::oram_impl::RequestHeader* header) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
@@ -4148,9 +8869,9 @@ inline void LoadSqrtOramRequest::unsafe_arena_set_allocated_header(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.LoadSqrtOramRequest.header)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.WriteLayeredRequest.header)
 }
-inline ::oram_impl::RequestHeader* LoadSqrtOramRequest::release_header() {
+inline ::oram_impl::RequestHeader* WriteLayeredRequest::release_header() {
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
@@ -4165,14 +8886,14 @@ inline ::oram_impl::RequestHeader* LoadSqrtOramRequest::release_header() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::oram_impl::RequestHeader* LoadSqrtOramRequest::unsafe_arena_release_header() {
-  // @@protoc_insertion_point(field_release:oram_impl.LoadSqrtOramRequest.header)
+inline ::oram_impl::RequestHeader* WriteLayeredRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.WriteLayeredRequest.header)
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
   return temp;
 }
-inline ::oram_impl::RequestHeader* LoadSqrtOramRequest::_internal_mutable_header() {
+inline ::oram_impl::RequestHeader* WriteLayeredRequest::_internal_mutable_header() {
   
   if (_impl_.header_ == nullptr) {
     auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
@@ -4180,12 +8901,12 @@ inline ::oram_impl::RequestHeader* LoadSqrtOramRequest::_internal_mutable_header
   }
   return _impl_.header_;
 }
-inline ::oram_impl::RequestHeader* LoadSqrtOramRequest::mutable_header() {
+inline ::oram_impl::RequestHeader* WriteLayeredRequest::mutable_header() {
   ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
-  // @@protoc_insertion_point(field_mutable:oram_impl.LoadSqrtOramRequest.header)
+  // @@protoc_insertion_point(field_mutable:oram_impl.WriteLayeredRequest.header)
   return _msg;
 }
-inline void LoadSqrtOramRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
+inline void WriteLayeredRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
     delete _impl_.header_;
@@ -4202,111 +8923,178 @@ inline void LoadSqrtOramRequest::set_allocated_header(::oram_impl::RequestHeader
     
   }
   _impl_.header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.LoadSqrtOramRequest.header)
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.WriteLayeredRequest.header)
 }
 
-// repeated bytes contents = 2;
-inline int LoadSqrtOramRequest::_internal_contents_size() const {
+// uint32 level = 2;
+inline void WriteLayeredRequest::clear_level() {
+  _impl_.level_ = 0u;
+}
+inline uint32_t WriteLayeredRequest::_internal_level() const {
+  return _impl_.level_;
+}
+inline uint32_t WriteLayeredRequest::level() const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteLayeredRequest.level)
+  return _internal_level();
+}
+inline void WriteLayeredRequest::_internal_set_level(uint32_t value) {
+  
+  _impl_.level_ = value;
+}
+inline void WriteLayeredRequest::set_level(uint32_t value) {
+  _internal_set_level(value);
+  // @@protoc_insertion_point(field_set:oram_impl.WriteLayeredRequest.level)
+}
+
+// repeated bytes contents = 3;
+inline int WriteLayeredRequest::_internal_contents_size() const {
   return _impl_.contents_.size();
 }
-inline int LoadSqrtOramRequest::contents_size() const {
+inline int WriteLayeredRequest::contents_size() const {
   return _internal_contents_size();
 }
-inline void LoadSqrtOramRequest::clear_contents() {
+inline void WriteLayeredRequest::clear_contents() {
   _impl_.contents_.Clear();
 }
-inline std::string* LoadSqrtOramRequest::add_contents() {
+inline std::string* WriteLayeredRequest::add_contents() {
   std::string* _s = _internal_add_contents();
-  // @@protoc_insertion_point(field_add_mutable:oram_impl.LoadSqrtOramRequest.contents)
+  // @@protoc_insertion_point(field_add_mutable:oram_impl.WriteLayeredRequest.contents)
   return _s;
 }
-inline const std::string& LoadSqrtOramRequest::_internal_contents(int index) const {
+inline const std::string& WriteLayeredRequest::_internal_contents(int index) const {
   return _impl_.contents_.Get(index);
 }
-inline const std::string& LoadSqrtOramRequest::contents(int index) const {
-  // @@protoc_insertion_point(field_get:oram_impl.LoadSqrtOramRequest.contents)
+inline const std::string& WriteLayeredRequest::contents(int index) const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteLayeredRequest.contents)
   return _internal_contents(index);
 }
-inline std::string* LoadSqrtOramRequest::mutable_contents(int index) {
-  // @@protoc_insertion_point(field_mutable:oram_impl.LoadSqrtOramRequest.contents)
+inline std::string* WriteLayeredRequest::mutable_contents(int index) {
+  // @@protoc_insertion_point(field_mutable:oram_impl.WriteLayeredRequest.contents)
   return _impl_.contents_.Mutable(index);
 }
-inline void LoadSqrtOramRequest::set_contents(int index, const std::string& value) {
+inline void WriteLayeredRequest::set_contents(int index, const std::string& value) {
   _impl_.contents_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:oram_impl.LoadSqrtOramRequest.contents)
+  // @@protoc_insertion_point(field_set:oram_impl.WriteLayeredRequest.contents)
 }
-inline void LoadSqrtOramRequest::set_contents(int index, std::string&& value) {
+inline void WriteLayeredRequest::set_contents(int index, std::string&& value) {
   _impl_.contents_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:oram_impl.LoadSqrtOramRequest.contents)
+  // @@protoc_insertion_point(field_set:oram_impl.WriteLayeredRequest.contents)
 }
-inline void LoadSqrtOramRequest::set_contents(int index, const char* value) {
+inline void WriteLayeredRequest::set_contents(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   _impl_.contents_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:oram_impl.LoadSqrtOramRequest.contents)
+  // @@protoc_insertion_point(field_set_char:oram_impl.WriteLayeredRequest.contents)
 }
-inline void LoadSqrtOramRequest::set_contents(int index, const void* value, size_t size) {
+inline void WriteLayeredRequest::set_contents(int index, const void* value, size_t size) {
   _impl_.contents_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:oram_impl.LoadSqrtOramRequest.contents)
+  // @@protoc_insertion_point(field_set_pointer:oram_impl.WriteLayeredRequest.contents)
 }
-inline std::string* LoadSqrtOramRequest::_internal_add_contents() {
+inline std::string* WriteLayeredRequest::_internal_add_contents() {
   return _impl_.contents_.Add();
 }
-inline void LoadSqrtOramRequest::add_contents(const std::string& value) {
+inline void WriteLayeredRequest::add_contents(const std::string& value) {
   _impl_.contents_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:oram_impl.LoadSqrtOramRequest.contents)
+  // @@protoc_insertion_point(field_add:oram_impl.WriteLayeredRequest.contents)
 }
-inline void LoadSqrtOramRequest::add_contents(std::string&& value) {
+inline void WriteLayeredRequest::add_contents(std::string&& value) {
   _impl_.contents_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:oram_impl.LoadSqrtOramRequest.contents)
+  // @@protoc_insertion_point(field_add:oram_impl.WriteLayeredRequest.contents)
 }
-inline void LoadSqrtOramRequest::add_contents(const char* value) {
+inline void WriteLayeredRequest::add_contents(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   _impl_.contents_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:oram_impl.LoadSqrtOramRequest.contents)
+  // @@protoc_insertion_point(field_add_char:oram_impl.WriteLayeredRequest.contents)
 }
-inline void LoadSqrtOramRequest::add_contents(const void* value, size_t size) {
+inline void WriteLayeredRequest::add_contents(const void* value, size_t size) {
   _impl_.contents_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:oram_impl.LoadSqrtOramRequest.contents)
+  // @@protoc_insertion_point(field_add_pointer:oram_impl.WriteLayeredRequest.contents)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-LoadSqrtOramRequest::contents() const {
-  // @@protoc_insertion_point(field_list:oram_impl.LoadSqrtOramRequest.contents)
+WriteLayeredRequest::contents() const {
+  // @@protoc_insertion_point(field_list:oram_impl.WriteLayeredRequest.contents)
   return _impl_.contents_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-LoadSqrtOramRequest::mutable_contents() {
-  // @@protoc_insertion_point(field_mutable_list:oram_impl.LoadSqrtOramRequest.contents)
+WriteLayeredRequest::mutable_contents() {
+  // @@protoc_insertion_point(field_mutable_list:oram_impl.WriteLayeredRequest.contents)
   return &_impl_.contents_;
 }
 
+// repeated uint32 cleared_levels = 4;
+inline int WriteLayeredRequest::_internal_cleared_levels_size() const {
+  return _impl_.cleared_levels_.size();
+}
+inline int WriteLayeredRequest::cleared_levels_size() const {
+  return _internal_cleared_levels_size();
+}
+inline void WriteLayeredRequest::clear_cleared_levels() {
+  _impl_.cleared_levels_.Clear();
+}
+inline uint32_t WriteLayeredRequest::_internal_cleared_levels(int index) const {
+  return _impl_.cleared_levels_.Get(index);
+}
+inline uint32_t WriteLayeredRequest::cleared_levels(int index) const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteLayeredRequest.cleared_levels)
+  return _internal_cleared_levels(index);
+}
+inline void WriteLayeredRequest::set_cleared_levels(int index, uint32_t value) {
+  _impl_.cleared_levels_.Set(index, value);
+  // @@protoc_insertion_point(field_set:oram_impl.WriteLayeredRequest.cleared_levels)
+}
+inline void WriteLayeredRequest::_internal_add_cleared_levels(uint32_t value) {
+  _impl_.cleared_levels_.Add(value);
+}
+inline void WriteLayeredRequest::add_cleared_levels(uint32_t value) {
+  _internal_add_cleared_levels(value);
+  // @@protoc_insertion_point(field_add:oram_impl.WriteLayeredRequest.cleared_levels)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+WriteLayeredRequest::_internal_cleared_levels() const {
+  return _impl_.cleared_levels_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+WriteLayeredRequest::cleared_levels() const {
+  // @@protoc_insertion_point(field_list:oram_impl.WriteLayeredRequest.cleared_levels)
+  return _internal_cleared_levels();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+WriteLayeredRequest::_internal_mutable_cleared_levels() {
+  return &_impl_.cleared_levels_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+WriteLayeredRequest::mutable_cleared_levels() {
+  // @@protoc_insertion_point(field_mutable_list:oram_impl.WriteLayeredRequest.cleared_levels)
+  return _internal_mutable_cleared_levels();
+}
+
 // -------------------------------------------------------------------
 
-// FlatVectorMessage
+// WriteLayeredRangeRequest
 
 // .oram_impl.RequestHeader header = 1;
-inline bool FlatVectorMessage::_internal_has_header() const {
+inline bool WriteLayeredRangeRequest::_internal_has_header() const {
   return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline bool FlatVectorMessage::has_header() const {
+inline bool WriteLayeredRangeRequest::has_header() const {
   return _internal_has_header();
 }
-inline void FlatVectorMessage::clear_header() {
+inline void WriteLayeredRangeRequest::clear_header() {
   if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
     delete _impl_.header_;
   }
   _impl_.header_ = nullptr;
 }
-inline const ::oram_impl::RequestHeader& FlatVectorMessage::_internal_header() const {
+inline const ::oram_impl::RequestHeader& WriteLayeredRangeRequest::_internal_header() const {
   const ::oram_impl::RequestHeader* p = _impl_.header_;
   return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
       ::oram_impl::_RequestHeader_default_instance_);
 }
-inline const ::oram_impl::RequestHeader& FlatVectorMessage::header() const {
-  // @@protoc_insertion_point(field_get:oram_impl.FlatVectorMessage.header)
+inline const ::oram_impl::RequestHeader& WriteLayeredRangeRequest::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteLayeredRangeRequest.header)
   return _internal_header();
 }
-inline void FlatVectorMessage::unsafe_arena_set_allocated_header(
+inline void WriteLayeredRangeRequest::unsafe_arena_set_allocated_header(
     ::oram_impl::RequestHeader* header) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
@@ -4317,9 +9105,9 @@ inline void FlatVectorMessage::unsafe_arena_set_allocated_header(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.FlatVectorMessage.header)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.WriteLayeredRangeRequest.header)
 }
-inline ::oram_impl::RequestHeader* FlatVectorMessage::release_header() {
+inline ::oram_impl::RequestHeader* WriteLayeredRangeRequest::release_header() {
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
@@ -4334,14 +9122,14 @@ inline ::oram_impl::RequestHeader* FlatVectorMessage::release_header() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::oram_impl::RequestHeader* FlatVectorMessage::unsafe_arena_release_header() {
-  // @@protoc_insertion_point(field_release:oram_impl.FlatVectorMessage.header)
+inline ::oram_impl::RequestHeader* WriteLayeredRangeRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.WriteLayeredRangeRequest.header)
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
   return temp;
 }
-inline ::oram_impl::RequestHeader* FlatVectorMessage::_internal_mutable_header() {
+inline ::oram_impl::RequestHeader* WriteLayeredRangeRequest::_internal_mutable_header() {
   
   if (_impl_.header_ == nullptr) {
     auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
@@ -4349,12 +9137,12 @@ inline ::oram_impl::RequestHeader* FlatVectorMessage::_internal_mutable_header()
   }
   return _impl_.header_;
 }
-inline ::oram_impl::RequestHeader* FlatVectorMessage::mutable_header() {
+inline ::oram_impl::RequestHeader* WriteLayeredRangeRequest::mutable_header() {
   ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
-  // @@protoc_insertion_point(field_mutable:oram_impl.FlatVectorMessage.header)
+  // @@protoc_insertion_point(field_mutable:oram_impl.WriteLayeredRangeRequest.header)
   return _msg;
 }
-inline void FlatVectorMessage::set_allocated_header(::oram_impl::RequestHeader* header) {
+inline void WriteLayeredRangeRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
     delete _impl_.header_;
@@ -4371,86 +9159,151 @@ inline void FlatVectorMessage::set_allocated_header(::oram_impl::RequestHeader*
     
   }
   _impl_.header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.FlatVectorMessage.header)
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.WriteLayeredRangeRequest.header)
 }
 
-// bytes content = 2;
-inline void FlatVectorMessage::clear_content() {
-  _impl_.content_.ClearToEmpty();
+// uint32 level = 2;
+inline void WriteLayeredRangeRequest::clear_level() {
+  _impl_.level_ = 0u;
 }
-inline const std::string& FlatVectorMessage::content() const {
-  // @@protoc_insertion_point(field_get:oram_impl.FlatVectorMessage.content)
-  return _internal_content();
+inline uint32_t WriteLayeredRangeRequest::_internal_level() const {
+  return _impl_.level_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void FlatVectorMessage::set_content(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.content_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:oram_impl.FlatVectorMessage.content)
+inline uint32_t WriteLayeredRangeRequest::level() const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteLayeredRangeRequest.level)
+  return _internal_level();
 }
-inline std::string* FlatVectorMessage::mutable_content() {
-  std::string* _s = _internal_mutable_content();
-  // @@protoc_insertion_point(field_mutable:oram_impl.FlatVectorMessage.content)
-  return _s;
+inline void WriteLayeredRangeRequest::_internal_set_level(uint32_t value) {
+  
+  _impl_.level_ = value;
 }
-inline const std::string& FlatVectorMessage::_internal_content() const {
-  return _impl_.content_.Get();
+inline void WriteLayeredRangeRequest::set_level(uint32_t value) {
+  _internal_set_level(value);
+  // @@protoc_insertion_point(field_set:oram_impl.WriteLayeredRangeRequest.level)
 }
-inline void FlatVectorMessage::_internal_set_content(const std::string& value) {
-  
-  _impl_.content_.Set(value, GetArenaForAllocation());
+
+// uint32 offset = 3;
+inline void WriteLayeredRangeRequest::clear_offset() {
+  _impl_.offset_ = 0u;
 }
-inline std::string* FlatVectorMessage::_internal_mutable_content() {
+inline uint32_t WriteLayeredRangeRequest::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline uint32_t WriteLayeredRangeRequest::offset() const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteLayeredRangeRequest.offset)
+  return _internal_offset();
+}
+inline void WriteLayeredRangeRequest::_internal_set_offset(uint32_t value) {
   
-  return _impl_.content_.Mutable(GetArenaForAllocation());
+  _impl_.offset_ = value;
 }
-inline std::string* FlatVectorMessage::release_content() {
-  // @@protoc_insertion_point(field_release:oram_impl.FlatVectorMessage.content)
-  return _impl_.content_.Release();
+inline void WriteLayeredRangeRequest::set_offset(uint32_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:oram_impl.WriteLayeredRangeRequest.offset)
 }
-inline void FlatVectorMessage::set_allocated_content(std::string* content) {
-  if (content != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.content_.IsDefault()) {
-    _impl_.content_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.FlatVectorMessage.content)
+
+// repeated bytes contents = 4;
+inline int WriteLayeredRangeRequest::_internal_contents_size() const {
+  return _impl_.contents_.size();
+}
+inline int WriteLayeredRangeRequest::contents_size() const {
+  return _internal_contents_size();
+}
+inline void WriteLayeredRangeRequest::clear_contents() {
+  _impl_.contents_.Clear();
+}
+inline std::string* WriteLayeredRangeRequest::add_contents() {
+  std::string* _s = _internal_add_contents();
+  // @@protoc_insertion_point(field_add_mutable:oram_impl.WriteLayeredRangeRequest.contents)
+  return _s;
+}
+inline const std::string& WriteLayeredRangeRequest::_internal_contents(int index) const {
+  return _impl_.contents_.Get(index);
+}
+inline const std::string& WriteLayeredRangeRequest::contents(int index) const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteLayeredRangeRequest.contents)
+  return _internal_contents(index);
+}
+inline std::string* WriteLayeredRangeRequest::mutable_contents(int index) {
+  // @@protoc_insertion_point(field_mutable:oram_impl.WriteLayeredRangeRequest.contents)
+  return _impl_.contents_.Mutable(index);
+}
+inline void WriteLayeredRangeRequest::set_contents(int index, const std::string& value) {
+  _impl_.contents_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:oram_impl.WriteLayeredRangeRequest.contents)
+}
+inline void WriteLayeredRangeRequest::set_contents(int index, std::string&& value) {
+  _impl_.contents_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:oram_impl.WriteLayeredRangeRequest.contents)
+}
+inline void WriteLayeredRangeRequest::set_contents(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.contents_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:oram_impl.WriteLayeredRangeRequest.contents)
+}
+inline void WriteLayeredRangeRequest::set_contents(int index, const void* value, size_t size) {
+  _impl_.contents_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:oram_impl.WriteLayeredRangeRequest.contents)
+}
+inline std::string* WriteLayeredRangeRequest::_internal_add_contents() {
+  return _impl_.contents_.Add();
+}
+inline void WriteLayeredRangeRequest::add_contents(const std::string& value) {
+  _impl_.contents_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:oram_impl.WriteLayeredRangeRequest.contents)
+}
+inline void WriteLayeredRangeRequest::add_contents(std::string&& value) {
+  _impl_.contents_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:oram_impl.WriteLayeredRangeRequest.contents)
+}
+inline void WriteLayeredRangeRequest::add_contents(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.contents_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:oram_impl.WriteLayeredRangeRequest.contents)
+}
+inline void WriteLayeredRangeRequest::add_contents(const void* value, size_t size) {
+  _impl_.contents_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:oram_impl.WriteLayeredRangeRequest.contents)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+WriteLayeredRangeRequest::contents() const {
+  // @@protoc_insertion_point(field_list:oram_impl.WriteLayeredRangeRequest.contents)
+  return _impl_.contents_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+WriteLayeredRangeRequest::mutable_contents() {
+  // @@protoc_insertion_point(field_mutable_list:oram_impl.WriteLayeredRangeRequest.contents)
+  return &_impl_.contents_;
 }
 
 // -------------------------------------------------------------------
 
-// SqrtMessage
+// LayeredControlRequest
 
 // .oram_impl.RequestHeader header = 1;
-inline bool SqrtMessage::_internal_has_header() const {
+inline bool LayeredControlRequest::_internal_has_header() const {
   return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline bool SqrtMessage::has_header() const {
+inline bool LayeredControlRequest::has_header() const {
   return _internal_has_header();
 }
-inline void SqrtMessage::clear_header() {
+inline void LayeredControlRequest::clear_header() {
   if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
     delete _impl_.header_;
   }
   _impl_.header_ = nullptr;
 }
-inline const ::oram_impl::RequestHeader& SqrtMessage::_internal_header() const {
+inline const ::oram_impl::RequestHeader& LayeredControlRequest::_internal_header() const {
   const ::oram_impl::RequestHeader* p = _impl_.header_;
   return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
       ::oram_impl::_RequestHeader_default_instance_);
 }
-inline const ::oram_impl::RequestHeader& SqrtMessage::header() const {
-  // @@protoc_insertion_point(field_get:oram_impl.SqrtMessage.header)
+inline const ::oram_impl::RequestHeader& LayeredControlRequest::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.LayeredControlRequest.header)
   return _internal_header();
 }
-inline void SqrtMessage::unsafe_arena_set_allocated_header(
+inline void LayeredControlRequest::unsafe_arena_set_allocated_header(
     ::oram_impl::RequestHeader* header) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
@@ -4461,9 +9314,9 @@ inline void SqrtMessage::unsafe_arena_set_allocated_header(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.SqrtMessage.header)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.LayeredControlRequest.header)
 }
-inline ::oram_impl::RequestHeader* SqrtMessage::release_header() {
+inline ::oram_impl::RequestHeader* LayeredControlRequest::release_header() {
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
@@ -4478,14 +9331,14 @@ inline ::oram_impl::RequestHeader* SqrtMessage::release_header() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::oram_impl::RequestHeader* SqrtMessage::unsafe_arena_release_header() {
-  // @@protoc_insertion_point(field_release:oram_impl.SqrtMessage.header)
+inline ::oram_impl::RequestHeader* LayeredControlRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.LayeredControlRequest.header)
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
   return temp;
 }
-inline ::oram_impl::RequestHeader* SqrtMessage::_internal_mutable_header() {
+inline ::oram_impl::RequestHeader* LayeredControlRequest::_internal_mutable_header() {
   
   if (_impl_.header_ == nullptr) {
     auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
@@ -4493,12 +9346,12 @@ inline ::oram_impl::RequestHeader* SqrtMessage::_internal_mutable_header() {
   }
   return _impl_.header_;
 }
-inline ::oram_impl::RequestHeader* SqrtMessage::mutable_header() {
+inline ::oram_impl::RequestHeader* LayeredControlRequest::mutable_header() {
   ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
-  // @@protoc_insertion_point(field_mutable:oram_impl.SqrtMessage.header)
+  // @@protoc_insertion_point(field_mutable:oram_impl.LayeredControlRequest.header)
   return _msg;
 }
-inline void SqrtMessage::set_allocated_header(::oram_impl::RequestHeader* header) {
+inline void LayeredControlRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
     delete _impl_.header_;
@@ -4515,86 +9368,163 @@ inline void SqrtMessage::set_allocated_header(::oram_impl::RequestHeader* header
     
   }
   _impl_.header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.SqrtMessage.header)
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.LayeredControlRequest.header)
 }
 
-// bytes content = 2;
-inline void SqrtMessage::clear_content() {
-  _impl_.content_.ClearToEmpty();
+// uint32 type = 2;
+inline void LayeredControlRequest::clear_type() {
+  _impl_.type_ = 0u;
 }
-inline const std::string& SqrtMessage::content() const {
-  // @@protoc_insertion_point(field_get:oram_impl.SqrtMessage.content)
-  return _internal_content();
+inline uint32_t LayeredControlRequest::_internal_type() const {
+  return _impl_.type_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void SqrtMessage::set_content(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.content_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:oram_impl.SqrtMessage.content)
+inline uint32_t LayeredControlRequest::type() const {
+  // @@protoc_insertion_point(field_get:oram_impl.LayeredControlRequest.type)
+  return _internal_type();
 }
-inline std::string* SqrtMessage::mutable_content() {
-  std::string* _s = _internal_mutable_content();
-  // @@protoc_insertion_point(field_mutable:oram_impl.SqrtMessage.content)
-  return _s;
+inline void LayeredControlRequest::_internal_set_type(uint32_t value) {
+  
+  _impl_.type_ = value;
 }
-inline const std::string& SqrtMessage::_internal_content() const {
-  return _impl_.content_.Get();
+inline void LayeredControlRequest::set_type(uint32_t value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:oram_impl.LayeredControlRequest.type)
 }
-inline void SqrtMessage::_internal_set_content(const std::string& value) {
+
+// uint32 level = 3;
+inline void LayeredControlRequest::clear_level() {
+  _impl_.level_ = 0u;
+}
+inline uint32_t LayeredControlRequest::_internal_level() const {
+  return _impl_.level_;
+}
+inline uint32_t LayeredControlRequest::level() const {
+  // @@protoc_insertion_point(field_get:oram_impl.LayeredControlRequest.level)
+  return _internal_level();
+}
+inline void LayeredControlRequest::_internal_set_level(uint32_t value) {
   
-  _impl_.content_.Set(value, GetArenaForAllocation());
+  _impl_.level_ = value;
 }
-inline std::string* SqrtMessage::_internal_mutable_content() {
+inline void LayeredControlRequest::set_level(uint32_t value) {
+  _internal_set_level(value);
+  // @@protoc_insertion_point(field_set:oram_impl.LayeredControlRequest.level)
+}
+
+// uint32 size = 4;
+inline void LayeredControlRequest::clear_size() {
+  _impl_.size_ = 0u;
+}
+inline uint32_t LayeredControlRequest::_internal_size() const {
+  return _impl_.size_;
+}
+inline uint32_t LayeredControlRequest::size() const {
+  // @@protoc_insertion_point(field_get:oram_impl.LayeredControlRequest.size)
+  return _internal_size();
+}
+inline void LayeredControlRequest::_internal_set_size(uint32_t value) {
   
-  return _impl_.content_.Mutable(GetArenaForAllocation());
+  _impl_.size_ = value;
+}
+inline void LayeredControlRequest::set_size(uint32_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:oram_impl.LayeredControlRequest.size)
+}
+
+// uint32 target = 5;
+inline void LayeredControlRequest::clear_target() {
+  _impl_.target_ = 0u;
+}
+inline uint32_t LayeredControlRequest::_internal_target() const {
+  return _impl_.target_;
+}
+inline uint32_t LayeredControlRequest::target() const {
+  // @@protoc_insertion_point(field_get:oram_impl.LayeredControlRequest.target)
+  return _internal_target();
+}
+inline void LayeredControlRequest::_internal_set_target(uint32_t value) {
+  
+  _impl_.target_ = value;
+}
+inline void LayeredControlRequest::set_target(uint32_t value) {
+  _internal_set_target(value);
+  // @@protoc_insertion_point(field_set:oram_impl.LayeredControlRequest.target)
+}
+
+// repeated uint32 cleared_levels = 6;
+inline int LayeredControlRequest::_internal_cleared_levels_size() const {
+  return _impl_.cleared_levels_.size();
+}
+inline int LayeredControlRequest::cleared_levels_size() const {
+  return _internal_cleared_levels_size();
+}
+inline void LayeredControlRequest::clear_cleared_levels() {
+  _impl_.cleared_levels_.Clear();
+}
+inline uint32_t LayeredControlRequest::_internal_cleared_levels(int index) const {
+  return _impl_.cleared_levels_.Get(index);
+}
+inline uint32_t LayeredControlRequest::cleared_levels(int index) const {
+  // @@protoc_insertion_point(field_get:oram_impl.LayeredControlRequest.cleared_levels)
+  return _internal_cleared_levels(index);
+}
+inline void LayeredControlRequest::set_cleared_levels(int index, uint32_t value) {
+  _impl_.cleared_levels_.Set(index, value);
+  // @@protoc_insertion_point(field_set:oram_impl.LayeredControlRequest.cleared_levels)
+}
+inline void LayeredControlRequest::_internal_add_cleared_levels(uint32_t value) {
+  _impl_.cleared_levels_.Add(value);
+}
+inline void LayeredControlRequest::add_cleared_levels(uint32_t value) {
+  _internal_add_cleared_levels(value);
+  // @@protoc_insertion_point(field_add:oram_impl.LayeredControlRequest.cleared_levels)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+LayeredControlRequest::_internal_cleared_levels() const {
+  return _impl_.cleared_levels_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+LayeredControlRequest::cleared_levels() const {
+  // @@protoc_insertion_point(field_list:oram_impl.LayeredControlRequest.cleared_levels)
+  return _internal_cleared_levels();
 }
-inline std::string* SqrtMessage::release_content() {
-  // @@protoc_insertion_point(field_release:oram_impl.SqrtMessage.content)
-  return _impl_.content_.Release();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+LayeredControlRequest::_internal_mutable_cleared_levels() {
+  return &_impl_.cleared_levels_;
 }
-inline void SqrtMessage::set_allocated_content(std::string* content) {
-  if (content != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.content_.IsDefault()) {
-    _impl_.content_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.SqrtMessage.content)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+LayeredControlRequest::mutable_cleared_levels() {
+  // @@protoc_insertion_point(field_mutable_list:oram_impl.LayeredControlRequest.cleared_levels)
+  return _internal_mutable_cleared_levels();
 }
 
 // -------------------------------------------------------------------
 
-// WriteSqrtMessage
+// InitTreeOramRequest
 
 // .oram_impl.RequestHeader header = 1;
-inline bool WriteSqrtMessage::_internal_has_header() const {
+inline bool InitTreeOramRequest::_internal_has_header() const {
   return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline bool WriteSqrtMessage::has_header() const {
+inline bool InitTreeOramRequest::has_header() const {
   return _internal_has_header();
 }
-inline void WriteSqrtMessage::clear_header() {
+inline void InitTreeOramRequest::clear_header() {
   if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
     delete _impl_.header_;
   }
   _impl_.header_ = nullptr;
 }
-inline const ::oram_impl::RequestHeader& WriteSqrtMessage::_internal_header() const {
+inline const ::oram_impl::RequestHeader& InitTreeOramRequest::_internal_header() const {
   const ::oram_impl::RequestHeader* p = _impl_.header_;
   return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
       ::oram_impl::_RequestHeader_default_instance_);
 }
-inline const ::oram_impl::RequestHeader& WriteSqrtMessage::header() const {
-  // @@protoc_insertion_point(field_get:oram_impl.WriteSqrtMessage.header)
+inline const ::oram_impl::RequestHeader& InitTreeOramRequest::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.InitTreeOramRequest.header)
   return _internal_header();
 }
-inline void WriteSqrtMessage::unsafe_arena_set_allocated_header(
+inline void InitTreeOramRequest::unsafe_arena_set_allocated_header(
     ::oram_impl::RequestHeader* header) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
@@ -4605,9 +9535,9 @@ inline void WriteSqrtMessage::unsafe_arena_set_allocated_header(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.WriteSqrtMessage.header)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.InitTreeOramRequest.header)
 }
-inline ::oram_impl::RequestHeader* WriteSqrtMessage::release_header() {
+inline ::oram_impl::RequestHeader* InitTreeOramRequest::release_header() {
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
@@ -4622,14 +9552,14 @@ inline ::oram_impl::RequestHeader* WriteSqrtMessage::release_header() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::oram_impl::RequestHeader* WriteSqrtMessage::unsafe_arena_release_header() {
-  // @@protoc_insertion_point(field_release:oram_impl.WriteSqrtMessage.header)
+inline ::oram_impl::RequestHeader* InitTreeOramRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.InitTreeOramRequest.header)
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
   return temp;
 }
-inline ::oram_impl::RequestHeader* WriteSqrtMessage::_internal_mutable_header() {
+inline ::oram_impl::RequestHeader* InitTreeOramRequest::_internal_mutable_header() {
   
   if (_impl_.header_ == nullptr) {
     auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
@@ -4637,12 +9567,12 @@ inline ::oram_impl::RequestHeader* WriteSqrtMessage::_internal_mutable_header()
   }
   return _impl_.header_;
 }
-inline ::oram_impl::RequestHeader* WriteSqrtMessage::mutable_header() {
+inline ::oram_impl::RequestHeader* InitTreeOramRequest::mutable_header() {
   ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
-  // @@protoc_insertion_point(field_mutable:oram_impl.WriteSqrtMessage.header)
+  // @@protoc_insertion_point(field_mutable:oram_impl.InitTreeOramRequest.header)
   return _msg;
 }
-inline void WriteSqrtMessage::set_allocated_header(::oram_impl::RequestHeader* header) {
+inline void InitTreeOramRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
     delete _impl_.header_;
@@ -4659,126 +9589,96 @@ inline void WriteSqrtMessage::set_allocated_header(::oram_impl::RequestHeader* h
     
   }
   _impl_.header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.WriteSqrtMessage.header)
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.InitTreeOramRequest.header)
 }
 
-// bytes content = 2;
-inline void WriteSqrtMessage::clear_content() {
-  _impl_.content_.ClearToEmpty();
-}
-inline const std::string& WriteSqrtMessage::content() const {
-  // @@protoc_insertion_point(field_get:oram_impl.WriteSqrtMessage.content)
-  return _internal_content();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void WriteSqrtMessage::set_content(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.content_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:oram_impl.WriteSqrtMessage.content)
-}
-inline std::string* WriteSqrtMessage::mutable_content() {
-  std::string* _s = _internal_mutable_content();
-  // @@protoc_insertion_point(field_mutable:oram_impl.WriteSqrtMessage.content)
-  return _s;
+// uint32 bucket_size = 2;
+inline void InitTreeOramRequest::clear_bucket_size() {
+  _impl_.bucket_size_ = 0u;
 }
-inline const std::string& WriteSqrtMessage::_internal_content() const {
-  return _impl_.content_.Get();
+inline uint32_t InitTreeOramRequest::_internal_bucket_size() const {
+  return _impl_.bucket_size_;
 }
-inline void WriteSqrtMessage::_internal_set_content(const std::string& value) {
-  
-  _impl_.content_.Set(value, GetArenaForAllocation());
+inline uint32_t InitTreeOramRequest::bucket_size() const {
+  // @@protoc_insertion_point(field_get:oram_impl.InitTreeOramRequest.bucket_size)
+  return _internal_bucket_size();
 }
-inline std::string* WriteSqrtMessage::_internal_mutable_content() {
+inline void InitTreeOramRequest::_internal_set_bucket_size(uint32_t value) {
   
-  return _impl_.content_.Mutable(GetArenaForAllocation());
-}
-inline std::string* WriteSqrtMessage::release_content() {
-  // @@protoc_insertion_point(field_release:oram_impl.WriteSqrtMessage.content)
-  return _impl_.content_.Release();
+  _impl_.bucket_size_ = value;
 }
-inline void WriteSqrtMessage::set_allocated_content(std::string* content) {
-  if (content != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.content_.IsDefault()) {
-    _impl_.content_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.WriteSqrtMessage.content)
+inline void InitTreeOramRequest::set_bucket_size(uint32_t value) {
+  _internal_set_bucket_size(value);
+  // @@protoc_insertion_point(field_set:oram_impl.InitTreeOramRequest.bucket_size)
 }
 
-// bool write_to_cache = 3;
-inline void WriteSqrtMessage::clear_write_to_cache() {
-  _impl_.write_to_cache_ = false;
+// uint32 bucket_num = 3;
+inline void InitTreeOramRequest::clear_bucket_num() {
+  _impl_.bucket_num_ = 0u;
 }
-inline bool WriteSqrtMessage::_internal_write_to_cache() const {
-  return _impl_.write_to_cache_;
+inline uint32_t InitTreeOramRequest::_internal_bucket_num() const {
+  return _impl_.bucket_num_;
 }
-inline bool WriteSqrtMessage::write_to_cache() const {
-  // @@protoc_insertion_point(field_get:oram_impl.WriteSqrtMessage.write_to_cache)
-  return _internal_write_to_cache();
+inline uint32_t InitTreeOramRequest::bucket_num() const {
+  // @@protoc_insertion_point(field_get:oram_impl.InitTreeOramRequest.bucket_num)
+  return _internal_bucket_num();
 }
-inline void WriteSqrtMessage::_internal_set_write_to_cache(bool value) {
+inline void InitTreeOramRequest::_internal_set_bucket_num(uint32_t value) {
   
-  _impl_.write_to_cache_ = value;
+  _impl_.bucket_num_ = value;
 }
-inline void WriteSqrtMessage::set_write_to_cache(bool value) {
-  _internal_set_write_to_cache(value);
-  // @@protoc_insertion_point(field_set:oram_impl.WriteSqrtMessage.write_to_cache)
+inline void InitTreeOramRequest::set_bucket_num(uint32_t value) {
+  _internal_set_bucket_num(value);
+  // @@protoc_insertion_point(field_set:oram_impl.InitTreeOramRequest.bucket_num)
 }
 
-// uint32 pos = 4;
-inline void WriteSqrtMessage::clear_pos() {
-  _impl_.pos_ = 0u;
+// uint32 block_size = 4;
+inline void InitTreeOramRequest::clear_block_size() {
+  _impl_.block_size_ = 0u;
 }
-inline uint32_t WriteSqrtMessage::_internal_pos() const {
-  return _impl_.pos_;
+inline uint32_t InitTreeOramRequest::_internal_block_size() const {
+  return _impl_.block_size_;
 }
-inline uint32_t WriteSqrtMessage::pos() const {
-  // @@protoc_insertion_point(field_get:oram_impl.WriteSqrtMessage.pos)
-  return _internal_pos();
+inline uint32_t InitTreeOramRequest::block_size() const {
+  // @@protoc_insertion_point(field_get:oram_impl.InitTreeOramRequest.block_size)
+  return _internal_block_size();
 }
-inline void WriteSqrtMessage::_internal_set_pos(uint32_t value) {
+inline void InitTreeOramRequest::_internal_set_block_size(uint32_t value) {
   
-  _impl_.pos_ = value;
+  _impl_.block_size_ = value;
 }
-inline void WriteSqrtMessage::set_pos(uint32_t value) {
-  _internal_set_pos(value);
-  // @@protoc_insertion_point(field_set:oram_impl.WriteSqrtMessage.pos)
+inline void InitTreeOramRequest::set_block_size(uint32_t value) {
+  _internal_set_block_size(value);
+  // @@protoc_insertion_point(field_set:oram_impl.InitTreeOramRequest.block_size)
 }
 
 // -------------------------------------------------------------------
 
-// SqrtPermMessage
+// ReadFlatRequest
 
 // .oram_impl.RequestHeader header = 1;
-inline bool SqrtPermMessage::_internal_has_header() const {
+inline bool ReadFlatRequest::_internal_has_header() const {
   return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline bool SqrtPermMessage::has_header() const {
+inline bool ReadFlatRequest::has_header() const {
   return _internal_has_header();
 }
-inline void SqrtPermMessage::clear_header() {
+inline void ReadFlatRequest::clear_header() {
   if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
     delete _impl_.header_;
   }
   _impl_.header_ = nullptr;
 }
-inline const ::oram_impl::RequestHeader& SqrtPermMessage::_internal_header() const {
+inline const ::oram_impl::RequestHeader& ReadFlatRequest::_internal_header() const {
   const ::oram_impl::RequestHeader* p = _impl_.header_;
   return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
       ::oram_impl::_RequestHeader_default_instance_);
 }
-inline const ::oram_impl::RequestHeader& SqrtPermMessage::header() const {
-  // @@protoc_insertion_point(field_get:oram_impl.SqrtPermMessage.header)
+inline const ::oram_impl::RequestHeader& ReadFlatRequest::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.ReadFlatRequest.header)
   return _internal_header();
 }
-inline void SqrtPermMessage::unsafe_arena_set_allocated_header(
+inline void ReadFlatRequest::unsafe_arena_set_allocated_header(
     ::oram_impl::RequestHeader* header) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
@@ -4789,9 +9689,9 @@ inline void SqrtPermMessage::unsafe_arena_set_allocated_header(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.SqrtPermMessage.header)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.ReadFlatRequest.header)
 }
-inline ::oram_impl::RequestHeader* SqrtPermMessage::release_header() {
+inline ::oram_impl::RequestHeader* ReadFlatRequest::release_header() {
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
@@ -4806,14 +9706,14 @@ inline ::oram_impl::RequestHeader* SqrtPermMessage::release_header() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::oram_impl::RequestHeader* SqrtPermMessage::unsafe_arena_release_header() {
-  // @@protoc_insertion_point(field_release:oram_impl.SqrtPermMessage.header)
+inline ::oram_impl::RequestHeader* ReadFlatRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.ReadFlatRequest.header)
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
   return temp;
 }
-inline ::oram_impl::RequestHeader* SqrtPermMessage::_internal_mutable_header() {
+inline ::oram_impl::RequestHeader* ReadFlatRequest::_internal_mutable_header() {
   
   if (_impl_.header_ == nullptr) {
     auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
@@ -4821,12 +9721,12 @@ inline ::oram_impl::RequestHeader* SqrtPermMessage::_internal_mutable_header() {
   }
   return _impl_.header_;
 }
-inline ::oram_impl::RequestHeader* SqrtPermMessage::mutable_header() {
+inline ::oram_impl::RequestHeader* ReadFlatRequest::mutable_header() {
   ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
-  // @@protoc_insertion_point(field_mutable:oram_impl.SqrtPermMessage.header)
+  // @@protoc_insertion_point(field_mutable:oram_impl.ReadFlatRequest.header)
   return _msg;
 }
-inline void SqrtPermMessage::set_allocated_header(::oram_impl::RequestHeader* header) {
+inline void ReadFlatRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
     delete _impl_.header_;
@@ -4843,83 +9743,36 @@ inline void SqrtPermMessage::set_allocated_header(::oram_impl::RequestHeader* he
     
   }
   _impl_.header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.SqrtPermMessage.header)
-}
-
-// repeated uint32 perms = 2;
-inline int SqrtPermMessage::_internal_perms_size() const {
-  return _impl_.perms_.size();
-}
-inline int SqrtPermMessage::perms_size() const {
-  return _internal_perms_size();
-}
-inline void SqrtPermMessage::clear_perms() {
-  _impl_.perms_.Clear();
-}
-inline uint32_t SqrtPermMessage::_internal_perms(int index) const {
-  return _impl_.perms_.Get(index);
-}
-inline uint32_t SqrtPermMessage::perms(int index) const {
-  // @@protoc_insertion_point(field_get:oram_impl.SqrtPermMessage.perms)
-  return _internal_perms(index);
-}
-inline void SqrtPermMessage::set_perms(int index, uint32_t value) {
-  _impl_.perms_.Set(index, value);
-  // @@protoc_insertion_point(field_set:oram_impl.SqrtPermMessage.perms)
-}
-inline void SqrtPermMessage::_internal_add_perms(uint32_t value) {
-  _impl_.perms_.Add(value);
-}
-inline void SqrtPermMessage::add_perms(uint32_t value) {
-  _internal_add_perms(value);
-  // @@protoc_insertion_point(field_add:oram_impl.SqrtPermMessage.perms)
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
-SqrtPermMessage::_internal_perms() const {
-  return _impl_.perms_;
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
-SqrtPermMessage::perms() const {
-  // @@protoc_insertion_point(field_list:oram_impl.SqrtPermMessage.perms)
-  return _internal_perms();
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
-SqrtPermMessage::_internal_mutable_perms() {
-  return &_impl_.perms_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
-SqrtPermMessage::mutable_perms() {
-  // @@protoc_insertion_point(field_mutable_list:oram_impl.SqrtPermMessage.perms)
-  return _internal_mutable_perms();
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.ReadFlatRequest.header)
 }
 
 // -------------------------------------------------------------------
 
-// InitTreeOramRequest
+// ReadFlatStreamRequest
 
 // .oram_impl.RequestHeader header = 1;
-inline bool InitTreeOramRequest::_internal_has_header() const {
+inline bool ReadFlatStreamRequest::_internal_has_header() const {
   return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline bool InitTreeOramRequest::has_header() const {
+inline bool ReadFlatStreamRequest::has_header() const {
   return _internal_has_header();
 }
-inline void InitTreeOramRequest::clear_header() {
+inline void ReadFlatStreamRequest::clear_header() {
   if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
     delete _impl_.header_;
   }
   _impl_.header_ = nullptr;
 }
-inline const ::oram_impl::RequestHeader& InitTreeOramRequest::_internal_header() const {
+inline const ::oram_impl::RequestHeader& ReadFlatStreamRequest::_internal_header() const {
   const ::oram_impl::RequestHeader* p = _impl_.header_;
   return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
       ::oram_impl::_RequestHeader_default_instance_);
 }
-inline const ::oram_impl::RequestHeader& InitTreeOramRequest::header() const {
-  // @@protoc_insertion_point(field_get:oram_impl.InitTreeOramRequest.header)
+inline const ::oram_impl::RequestHeader& ReadFlatStreamRequest::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.ReadFlatStreamRequest.header)
   return _internal_header();
 }
-inline void InitTreeOramRequest::unsafe_arena_set_allocated_header(
+inline void ReadFlatStreamRequest::unsafe_arena_set_allocated_header(
     ::oram_impl::RequestHeader* header) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
@@ -4930,9 +9783,9 @@ inline void InitTreeOramRequest::unsafe_arena_set_allocated_header(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.InitTreeOramRequest.header)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.ReadFlatStreamRequest.header)
 }
-inline ::oram_impl::RequestHeader* InitTreeOramRequest::release_header() {
+inline ::oram_impl::RequestHeader* ReadFlatStreamRequest::release_header() {
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
@@ -4947,14 +9800,14 @@ inline ::oram_impl::RequestHeader* InitTreeOramRequest::release_header() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::oram_impl::RequestHeader* InitTreeOramRequest::unsafe_arena_release_header() {
-  // @@protoc_insertion_point(field_release:oram_impl.InitTreeOramRequest.header)
+inline ::oram_impl::RequestHeader* ReadFlatStreamRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.ReadFlatStreamRequest.header)
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
   return temp;
 }
-inline ::oram_impl::RequestHeader* InitTreeOramRequest::_internal_mutable_header() {
+inline ::oram_impl::RequestHeader* ReadFlatStreamRequest::_internal_mutable_header() {
   
   if (_impl_.header_ == nullptr) {
     auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
@@ -4962,12 +9815,12 @@ inline ::oram_impl::RequestHeader* InitTreeOramRequest::_internal_mutable_header
   }
   return _impl_.header_;
 }
-inline ::oram_impl::RequestHeader* InitTreeOramRequest::mutable_header() {
+inline ::oram_impl::RequestHeader* ReadFlatStreamRequest::mutable_header() {
   ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
-  // @@protoc_insertion_point(field_mutable:oram_impl.InitTreeOramRequest.header)
+  // @@protoc_insertion_point(field_mutable:oram_impl.ReadFlatStreamRequest.header)
   return _msg;
 }
-inline void InitTreeOramRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
+inline void ReadFlatStreamRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
     delete _impl_.header_;
@@ -4984,96 +9837,56 @@ inline void InitTreeOramRequest::set_allocated_header(::oram_impl::RequestHeader
     
   }
   _impl_.header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.InitTreeOramRequest.header)
-}
-
-// uint32 bucket_size = 2;
-inline void InitTreeOramRequest::clear_bucket_size() {
-  _impl_.bucket_size_ = 0u;
-}
-inline uint32_t InitTreeOramRequest::_internal_bucket_size() const {
-  return _impl_.bucket_size_;
-}
-inline uint32_t InitTreeOramRequest::bucket_size() const {
-  // @@protoc_insertion_point(field_get:oram_impl.InitTreeOramRequest.bucket_size)
-  return _internal_bucket_size();
-}
-inline void InitTreeOramRequest::_internal_set_bucket_size(uint32_t value) {
-  
-  _impl_.bucket_size_ = value;
-}
-inline void InitTreeOramRequest::set_bucket_size(uint32_t value) {
-  _internal_set_bucket_size(value);
-  // @@protoc_insertion_point(field_set:oram_impl.InitTreeOramRequest.bucket_size)
-}
-
-// uint32 bucket_num = 3;
-inline void InitTreeOramRequest::clear_bucket_num() {
-  _impl_.bucket_num_ = 0u;
-}
-inline uint32_t InitTreeOramRequest::_internal_bucket_num() const {
-  return _impl_.bucket_num_;
-}
-inline uint32_t InitTreeOramRequest::bucket_num() const {
-  // @@protoc_insertion_point(field_get:oram_impl.InitTreeOramRequest.bucket_num)
-  return _internal_bucket_num();
-}
-inline void InitTreeOramRequest::_internal_set_bucket_num(uint32_t value) {
-  
-  _impl_.bucket_num_ = value;
-}
-inline void InitTreeOramRequest::set_bucket_num(uint32_t value) {
-  _internal_set_bucket_num(value);
-  // @@protoc_insertion_point(field_set:oram_impl.InitTreeOramRequest.bucket_num)
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.ReadFlatStreamRequest.header)
 }
 
-// uint32 block_size = 4;
-inline void InitTreeOramRequest::clear_block_size() {
-  _impl_.block_size_ = 0u;
+// uint32 chunk_blocks = 2;
+inline void ReadFlatStreamRequest::clear_chunk_blocks() {
+  _impl_.chunk_blocks_ = 0u;
 }
-inline uint32_t InitTreeOramRequest::_internal_block_size() const {
-  return _impl_.block_size_;
+inline uint32_t ReadFlatStreamRequest::_internal_chunk_blocks() const {
+  return _impl_.chunk_blocks_;
 }
-inline uint32_t InitTreeOramRequest::block_size() const {
-  // @@protoc_insertion_point(field_get:oram_impl.InitTreeOramRequest.block_size)
-  return _internal_block_size();
+inline uint32_t ReadFlatStreamRequest::chunk_blocks() const {
+  // @@protoc_insertion_point(field_get:oram_impl.ReadFlatStreamRequest.chunk_blocks)
+  return _internal_chunk_blocks();
 }
-inline void InitTreeOramRequest::_internal_set_block_size(uint32_t value) {
+inline void ReadFlatStreamRequest::_internal_set_chunk_blocks(uint32_t value) {
   
-  _impl_.block_size_ = value;
+  _impl_.chunk_blocks_ = value;
 }
-inline void InitTreeOramRequest::set_block_size(uint32_t value) {
-  _internal_set_block_size(value);
-  // @@protoc_insertion_point(field_set:oram_impl.InitTreeOramRequest.block_size)
+inline void ReadFlatStreamRequest::set_chunk_blocks(uint32_t value) {
+  _internal_set_chunk_blocks(value);
+  // @@protoc_insertion_point(field_set:oram_impl.ReadFlatStreamRequest.chunk_blocks)
 }
 
 // -------------------------------------------------------------------
 
-// ReadFlatRequest
+// FlatChunkMessage
 
 // .oram_impl.RequestHeader header = 1;
-inline bool ReadFlatRequest::_internal_has_header() const {
+inline bool FlatChunkMessage::_internal_has_header() const {
   return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline bool ReadFlatRequest::has_header() const {
+inline bool FlatChunkMessage::has_header() const {
   return _internal_has_header();
 }
-inline void ReadFlatRequest::clear_header() {
+inline void FlatChunkMessage::clear_header() {
   if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
     delete _impl_.header_;
   }
   _impl_.header_ = nullptr;
 }
-inline const ::oram_impl::RequestHeader& ReadFlatRequest::_internal_header() const {
+inline const ::oram_impl::RequestHeader& FlatChunkMessage::_internal_header() const {
   const ::oram_impl::RequestHeader* p = _impl_.header_;
   return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
       ::oram_impl::_RequestHeader_default_instance_);
 }
-inline const ::oram_impl::RequestHeader& ReadFlatRequest::header() const {
-  // @@protoc_insertion_point(field_get:oram_impl.ReadFlatRequest.header)
+inline const ::oram_impl::RequestHeader& FlatChunkMessage::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.FlatChunkMessage.header)
   return _internal_header();
 }
-inline void ReadFlatRequest::unsafe_arena_set_allocated_header(
+inline void FlatChunkMessage::unsafe_arena_set_allocated_header(
     ::oram_impl::RequestHeader* header) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
@@ -5084,9 +9897,9 @@ inline void ReadFlatRequest::unsafe_arena_set_allocated_header(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.ReadFlatRequest.header)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.FlatChunkMessage.header)
 }
-inline ::oram_impl::RequestHeader* ReadFlatRequest::release_header() {
+inline ::oram_impl::RequestHeader* FlatChunkMessage::release_header() {
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
@@ -5101,14 +9914,14 @@ inline ::oram_impl::RequestHeader* ReadFlatRequest::release_header() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::oram_impl::RequestHeader* ReadFlatRequest::unsafe_arena_release_header() {
-  // @@protoc_insertion_point(field_release:oram_impl.ReadFlatRequest.header)
+inline ::oram_impl::RequestHeader* FlatChunkMessage::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.FlatChunkMessage.header)
   
   ::oram_impl::RequestHeader* temp = _impl_.header_;
   _impl_.header_ = nullptr;
   return temp;
 }
-inline ::oram_impl::RequestHeader* ReadFlatRequest::_internal_mutable_header() {
+inline ::oram_impl::RequestHeader* FlatChunkMessage::_internal_mutable_header() {
   
   if (_impl_.header_ == nullptr) {
     auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
@@ -5116,12 +9929,12 @@ inline ::oram_impl::RequestHeader* ReadFlatRequest::_internal_mutable_header() {
   }
   return _impl_.header_;
 }
-inline ::oram_impl::RequestHeader* ReadFlatRequest::mutable_header() {
+inline ::oram_impl::RequestHeader* FlatChunkMessage::mutable_header() {
   ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
-  // @@protoc_insertion_point(field_mutable:oram_impl.ReadFlatRequest.header)
+  // @@protoc_insertion_point(field_mutable:oram_impl.FlatChunkMessage.header)
   return _msg;
 }
-inline void ReadFlatRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
+inline void FlatChunkMessage::set_allocated_header(::oram_impl::RequestHeader* header) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
     delete _impl_.header_;
@@ -5138,7 +9951,97 @@ inline void ReadFlatRequest::set_allocated_header(::oram_impl::RequestHeader* he
     
   }
   _impl_.header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:oram_impl.ReadFlatRequest.header)
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.FlatChunkMessage.header)
+}
+
+// uint64 offset = 2;
+inline void FlatChunkMessage::clear_offset() {
+  _impl_.offset_ = uint64_t{0u};
+}
+inline uint64_t FlatChunkMessage::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline uint64_t FlatChunkMessage::offset() const {
+  // @@protoc_insertion_point(field_get:oram_impl.FlatChunkMessage.offset)
+  return _internal_offset();
+}
+inline void FlatChunkMessage::_internal_set_offset(uint64_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void FlatChunkMessage::set_offset(uint64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:oram_impl.FlatChunkMessage.offset)
+}
+
+// bytes content = 3;
+inline void FlatChunkMessage::clear_content() {
+  _impl_.content_.ClearToEmpty();
+}
+inline const std::string& FlatChunkMessage::content() const {
+  // @@protoc_insertion_point(field_get:oram_impl.FlatChunkMessage.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FlatChunkMessage::set_content(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.content_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:oram_impl.FlatChunkMessage.content)
+}
+inline std::string* FlatChunkMessage::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:oram_impl.FlatChunkMessage.content)
+  return _s;
+}
+inline const std::string& FlatChunkMessage::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void FlatChunkMessage::_internal_set_content(const std::string& value) {
+  
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FlatChunkMessage::_internal_mutable_content() {
+  
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FlatChunkMessage::release_content() {
+  // @@protoc_insertion_point(field_release:oram_impl.FlatChunkMessage.content)
+  return _impl_.content_.Release();
+}
+inline void FlatChunkMessage::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.FlatChunkMessage.content)
+}
+
+// bool last = 4;
+inline void FlatChunkMessage::clear_last() {
+  _impl_.last_ = false;
+}
+inline bool FlatChunkMessage::_internal_last() const {
+  return _impl_.last_;
+}
+inline bool FlatChunkMessage::last() const {
+  // @@protoc_insertion_point(field_get:oram_impl.FlatChunkMessage.last)
+  return _internal_last();
+}
+inline void FlatChunkMessage::_internal_set_last(bool value) {
+  
+  _impl_.last_ = value;
+}
+inline void FlatChunkMessage::set_last(bool value) {
+  _internal_set_last(value);
+  // @@protoc_insertion_point(field_set:oram_impl.FlatChunkMessage.last)
 }
 
 // -------------------------------------------------------------------
@@ -5755,6 +10658,239 @@ inline void WritePathRequest::set_offset(uint32_t value) {
 
 // -------------------------------------------------------------------
 
+// BucketMessage
+
+// repeated bytes bucket = 1;
+inline int BucketMessage::_internal_bucket_size() const {
+  return _impl_.bucket_.size();
+}
+inline int BucketMessage::bucket_size() const {
+  return _internal_bucket_size();
+}
+inline void BucketMessage::clear_bucket() {
+  _impl_.bucket_.Clear();
+}
+inline std::string* BucketMessage::add_bucket() {
+  std::string* _s = _internal_add_bucket();
+  // @@protoc_insertion_point(field_add_mutable:oram_impl.BucketMessage.bucket)
+  return _s;
+}
+inline const std::string& BucketMessage::_internal_bucket(int index) const {
+  return _impl_.bucket_.Get(index);
+}
+inline const std::string& BucketMessage::bucket(int index) const {
+  // @@protoc_insertion_point(field_get:oram_impl.BucketMessage.bucket)
+  return _internal_bucket(index);
+}
+inline std::string* BucketMessage::mutable_bucket(int index) {
+  // @@protoc_insertion_point(field_mutable:oram_impl.BucketMessage.bucket)
+  return _impl_.bucket_.Mutable(index);
+}
+inline void BucketMessage::set_bucket(int index, const std::string& value) {
+  _impl_.bucket_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:oram_impl.BucketMessage.bucket)
+}
+inline void BucketMessage::set_bucket(int index, std::string&& value) {
+  _impl_.bucket_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:oram_impl.BucketMessage.bucket)
+}
+inline void BucketMessage::set_bucket(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.bucket_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:oram_impl.BucketMessage.bucket)
+}
+inline void BucketMessage::set_bucket(int index, const void* value, size_t size) {
+  _impl_.bucket_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:oram_impl.BucketMessage.bucket)
+}
+inline std::string* BucketMessage::_internal_add_bucket() {
+  return _impl_.bucket_.Add();
+}
+inline void BucketMessage::add_bucket(const std::string& value) {
+  _impl_.bucket_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:oram_impl.BucketMessage.bucket)
+}
+inline void BucketMessage::add_bucket(std::string&& value) {
+  _impl_.bucket_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:oram_impl.BucketMessage.bucket)
+}
+inline void BucketMessage::add_bucket(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.bucket_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:oram_impl.BucketMessage.bucket)
+}
+inline void BucketMessage::add_bucket(const void* value, size_t size) {
+  _impl_.bucket_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:oram_impl.BucketMessage.bucket)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+BucketMessage::bucket() const {
+  // @@protoc_insertion_point(field_list:oram_impl.BucketMessage.bucket)
+  return _impl_.bucket_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+BucketMessage::mutable_bucket() {
+  // @@protoc_insertion_point(field_mutable_list:oram_impl.BucketMessage.bucket)
+  return &_impl_.bucket_;
+}
+
+// -------------------------------------------------------------------
+
+// WriteFullPathRequest
+
+// .oram_impl.RequestHeader header = 1;
+inline bool WriteFullPathRequest::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool WriteFullPathRequest::has_header() const {
+  return _internal_has_header();
+}
+inline void WriteFullPathRequest::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::oram_impl::RequestHeader& WriteFullPathRequest::_internal_header() const {
+  const ::oram_impl::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::oram_impl::RequestHeader&>(
+      ::oram_impl::_RequestHeader_default_instance_);
+}
+inline const ::oram_impl::RequestHeader& WriteFullPathRequest::header() const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteFullPathRequest.header)
+  return _internal_header();
+}
+inline void WriteFullPathRequest::unsafe_arena_set_allocated_header(
+    ::oram_impl::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:oram_impl.WriteFullPathRequest.header)
+}
+inline ::oram_impl::RequestHeader* WriteFullPathRequest::release_header() {
+  
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::oram_impl::RequestHeader* WriteFullPathRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:oram_impl.WriteFullPathRequest.header)
+  
+  ::oram_impl::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::oram_impl::RequestHeader* WriteFullPathRequest::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::oram_impl::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::oram_impl::RequestHeader* WriteFullPathRequest::mutable_header() {
+  ::oram_impl::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:oram_impl.WriteFullPathRequest.header)
+  return _msg;
+}
+inline void WriteFullPathRequest::set_allocated_header(::oram_impl::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:oram_impl.WriteFullPathRequest.header)
+}
+
+// uint32 path = 2;
+inline void WriteFullPathRequest::clear_path() {
+  _impl_.path_ = 0u;
+}
+inline uint32_t WriteFullPathRequest::_internal_path() const {
+  return _impl_.path_;
+}
+inline uint32_t WriteFullPathRequest::path() const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteFullPathRequest.path)
+  return _internal_path();
+}
+inline void WriteFullPathRequest::_internal_set_path(uint32_t value) {
+  
+  _impl_.path_ = value;
+}
+inline void WriteFullPathRequest::set_path(uint32_t value) {
+  _internal_set_path(value);
+  // @@protoc_insertion_point(field_set:oram_impl.WriteFullPathRequest.path)
+}
+
+// repeated .oram_impl.BucketMessage buckets = 3;
+inline int WriteFullPathRequest::_internal_buckets_size() const {
+  return _impl_.buckets_.size();
+}
+inline int WriteFullPathRequest::buckets_size() const {
+  return _internal_buckets_size();
+}
+inline void WriteFullPathRequest::clear_buckets() {
+  _impl_.buckets_.Clear();
+}
+inline ::oram_impl::BucketMessage* WriteFullPathRequest::mutable_buckets(int index) {
+  // @@protoc_insertion_point(field_mutable:oram_impl.WriteFullPathRequest.buckets)
+  return _impl_.buckets_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::BucketMessage >*
+WriteFullPathRequest::mutable_buckets() {
+  // @@protoc_insertion_point(field_mutable_list:oram_impl.WriteFullPathRequest.buckets)
+  return &_impl_.buckets_;
+}
+inline const ::oram_impl::BucketMessage& WriteFullPathRequest::_internal_buckets(int index) const {
+  return _impl_.buckets_.Get(index);
+}
+inline const ::oram_impl::BucketMessage& WriteFullPathRequest::buckets(int index) const {
+  // @@protoc_insertion_point(field_get:oram_impl.WriteFullPathRequest.buckets)
+  return _internal_buckets(index);
+}
+inline ::oram_impl::BucketMessage* WriteFullPathRequest::_internal_add_buckets() {
+  return _impl_.buckets_.Add();
+}
+inline ::oram_impl::BucketMessage* WriteFullPathRequest::add_buckets() {
+  ::oram_impl::BucketMessage* _add = _internal_add_buckets();
+  // @@protoc_insertion_point(field_add:oram_impl.WriteFullPathRequest.buckets)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::oram_impl::BucketMessage >&
+WriteFullPathRequest::buckets() const {
+  // @@protoc_insertion_point(field_list:oram_impl.WriteFullPathRequest.buckets)
+  return _impl_.buckets_;
+}
+
+// -------------------------------------------------------------------
+
 // WritePathResponse
 
 #ifdef __GNUC__
@@ -5796,6 +10932,36 @@ inline void WritePathRequest::set_offset(uint32_t value) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -0,0 +1,142 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef ORAM_IMPL_SERVER_ASYNC_CALL_H_
+#define ORAM_IMPL_SERVER_ASYNC_CALL_H_
+
+#include <grpc++/grpc++.h>
+
+#include <functional>
+
+namespace oram_impl {
+// A call in flight on a completion queue; it is the tag of all of its events.
+class AsyncCall {
+ public:
+  // `ok` is false if the event failed, e.g., when the server shuts down.
+  virtual void Proceed(bool ok) = 0;
+
+  virtual ~AsyncCall() {}
+};
+
+// Serves one unary request with a synchronous handler. A call waits for a
+// request, re-arms a fresh call for the next one, runs the handler, and deletes
+// itself once the response is sent.
+template <typename Request, typename Response>
+class UnaryCall : public AsyncCall {
+ public:
+  using responder_t = grpc::ServerAsyncResponseWriter<Response>;
+  using request_fn_t =
+      std::function<void(grpc::ServerContext*, Request*, responder_t*,
+                         grpc::ServerCompletionQueue*, void*)>;
+  using handler_fn_t = std::function<grpc::Status(
+      grpc::ServerContext*, const Request*, Response*)>;
+
+ private:
+  const request_fn_t request_fn_;
+  const handler_fn_t handler_fn_;
+  grpc::ServerCompletionQueue* const cq_;
+
+  grpc::ServerContext context_;
+  Request request_;
+  Response response_;
+  responder_t responder_;
+  bool finished_;
+
+ public:
+  UnaryCall(const request_fn_t& request_fn, const handler_fn_t& handler_fn,
+            grpc::ServerCompletionQueue* const cq)
+      : request_fn_(request_fn),
+        handler_fn_(handler_fn),
+        cq_(cq),
+        responder_(&context_),
+        finished_(false) {
+    request_fn_(&context_, &request_, &responder_, cq_, this);
+  }
+
+  virtual void Proceed(bool ok) override {
+    if (!ok || finished_) {
+      delete this;
+      return;
+    }
+
+    new UnaryCall(request_fn_, handler_fn_, cq_);
+
+    const grpc::Status status = handler_fn_(&context_, &request_, &response_);
+    finished_ = true;
+    responder_.Finish(response_, status, this);
+  }
+};
+
+// Completes a deferred call; may be called from any thread, once.
+using finish_fn_t = std::function<void(const grpc::Status&)>;
+
+// Serves one unary request with a handler that completes it later by calling
+// `finish`, e.g., once the disk is done, so that the poller is not blocked.
+// The call may be deleted as soon as `finish` is called.
+template <typename Request, typename Response>
+class DeferredUnaryCall : public AsyncCall {
+ public:
+  using responder_t = grpc::ServerAsyncResponseWriter<Response>;
+  using request_fn_t =
+      std::function<void(grpc::ServerContext*, Request*, responder_t*,
+                         grpc::ServerCompletionQueue*, void*)>;
+  using handler_fn_t = std::function<void(
+      grpc::ServerContext*, const Request*, Response*, const finish_fn_t&)>;
+
+ private:
+  const request_fn_t request_fn_;
+  const handler_fn_t handler_fn_;
+  grpc::ServerCompletionQueue* const cq_;
+
+  grpc::ServerContext context_;
+  Request request_;
+  Response response_;
+  responder_t responder_;
+  bool finished_;
+
+ public:
+  DeferredUnaryCall(const request_fn_t& request_fn,
+                    const handler_fn_t& handler_fn,
+                    grpc::ServerCompletionQueue* const cq)
+      : request_fn_(request_fn),
+        handler_fn_(handler_fn),
+        cq_(cq),
+        responder_(&context_),
+        finished_(false) {
+    request_fn_(&context_, &request_, &responder_, cq_, this);
+  }
+
+  virtual void Proceed(bool ok) override {
+    if (!ok || finished_) {
+      delete this;
+      return;
+    }
+
+    new DeferredUnaryCall(request_fn_, handler_fn_, cq_);
+
+    // The call may be deleted once it is finished, so the handler runs from a
+    // copy and nothing is touched after it.
+    const handler_fn_t handler = handler_fn_;
+    handler(&context_, &request_, &response_,
+            [this](const grpc::Status& status) {
+              finished_ = true;
+              responder_.Finish(response_, status, this);
+            });
+  }
+};
+}  // namespace oram_impl
+
+#endif  // ORAM_IMPL_SERVER_ASYNC_CALL_H_
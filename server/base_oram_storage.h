@@ -18,10 +18,14 @@
 #define ORAM_IMPL_SERVER_BASE_ORAM_STORAGE_H_
 
 #include <cstdint>
+#include <mutex>
 
 #include "base/oram_defs.h"
+#include "base/oram_status.h"
 
 namespace oram_impl {
+class SnapshotWriter;
+
 class BaseOramServerStorage {
  protected:
   // The id.
@@ -34,6 +38,8 @@ class BaseOramServerStorage {
   const size_t block_size_;
   // The hash of the instance.
   const std::string instance_hash_;
+  // Serializes the requests to storages that are not synchronized inside.
+  std::mutex lock_;
 
  public:
   BaseOramServerStorage(uint32_t id, size_t capacity, size_t block_size,
@@ -52,7 +58,16 @@ class BaseOramServerStorage {
   }
   virtual std::string GetInstanceHash(void) const { return instance_hash_; }
   virtual size_t GetBlockSize(void) const { return block_size_; }
+  std::mutex& GetLock(void) { return lock_; }
   virtual float ReportStorage(void) const { return 0.0; }
+  virtual void LogStatistics(void) const {}
+  // Writes the content of the storage to a snapshot (see `oram_snapshot.h`)
+  // without blocking the requests for long. Each storage that supports
+  // snapshots also has a static `ReadSnapshot` that recreates it.
+  virtual OramStatus WriteSnapshot(SnapshotWriter* const writer) {
+    return OramStatus(StatusCode::kUnimplemented,
+                      "The storage does not support snapshots.", __func__);
+  }
 
   virtual ~BaseOramServerStorage() = 0;
 };
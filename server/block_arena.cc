@@ -0,0 +1,135 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "block_arena.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "oram_snapshot.h"
+
+namespace oram_impl {
+size_t BlockArena::ChunkSize(size_t chunk) const {
+  const size_t begin = chunk * kChunkSlots;
+  return std::min(kChunkSlots, size_ - begin) * stride_;
+}
+
+uint8_t* BlockArena::MutableSlot(size_t pos) {
+  std::shared_ptr<uint8_t[]>& chunk = chunks_[pos / kChunkSlots];
+  if (chunk.use_count() > 1) {
+    const size_t chunk_size = ChunkSize(pos / kChunkSlots);
+    std::shared_ptr<uint8_t[]> clone(new uint8_t[chunk_size]);
+    memcpy(clone.get(), chunk.get(), chunk_size);
+    chunk = std::move(clone);
+  }
+
+  return chunk.get() + (pos % kChunkSlots) * stride_;
+}
+
+void BlockArena::Assign(size_t size, size_t stride) {
+  stride_ = stride;
+  size_ = size;
+  // The content is left uninitialized; it is guarded by `occupied_`.
+  chunks_.resize((size + kChunkSlots - 1) / kChunkSlots);
+  for (size_t i = 0; i < chunks_.size(); i++) {
+    chunks_[i].reset(new uint8_t[ChunkSize(i)]);
+  }
+  occupied_.assign(size, false);
+}
+
+void BlockArena::Release(void) {
+  std::vector<std::shared_ptr<uint8_t[]>>().swap(chunks_);
+  size_ = 0;
+  std::vector<bool>().swap(occupied_);
+}
+
+void BlockArena::Swap(BlockArena& other) {
+  std::swap(stride_, other.stride_);
+  std::swap(size_, other.size_);
+  chunks_.swap(other.chunks_);
+  occupied_.swap(other.occupied_);
+}
+
+void BlockArena::CopyFrom(const BlockArena& other) {
+  stride_ = other.stride_;
+  size_ = other.size_;
+  chunks_ = other.chunks_;
+  occupied_ = other.occupied_;
+}
+
+std::string BlockArena::Get(size_t pos) const {
+  if (!occupied_[pos]) {
+    return "";
+  }
+
+  return std::string(reinterpret_cast<const char*>(Slot(pos)), stride_);
+}
+
+bool BlockArena::Set(size_t pos, const std::string& content) {
+  if (content.empty()) {
+    occupied_[pos] = false;
+    return true;
+  } else if (content.size() != stride_) {
+    return false;
+  }
+
+  memcpy(MutableSlot(pos), content.data(), stride_);
+  occupied_[pos] = true;
+  return true;
+}
+
+void BlockArena::WriteSnapshot(SnapshotWriter* const writer) const {
+  writer->WriteValue<uint64_t>(size_);
+  writer->WriteValue<uint64_t>(stride_);
+  const std::vector<uint8_t> occupied(occupied_.begin(), occupied_.end());
+  writer->Write(occupied.data(), occupied.size());
+
+  for (size_t i = 0; i < size_; i++) {
+    if (occupied_[i]) {
+      writer->Write(Slot(i), stride_);
+    }
+  }
+}
+
+bool BlockArena::ReadSnapshot(SnapshotReader* const reader) {
+  uint64_t size;
+  uint64_t stride;
+  if (!reader->ReadValue(&size) || !reader->ReadValue(&stride)) {
+    return false;
+  } else if (size == 0) {
+    Release();
+    return true;
+  }
+
+  std::vector<uint8_t> occupied(size);
+  if (!reader->Read(occupied.data(), size)) {
+    return false;
+  }
+
+  Assign(size, stride);
+  for (size_t i = 0; i < size_; i++) {
+    if (occupied[i] != 0) {
+      if (!reader->Read(MutableSlot(i), stride_)) {
+        return false;
+      }
+      occupied_[i] = true;
+    }
+  }
+
+  return true;
+}
+}  // namespace oram_impl
@@ -0,0 +1,82 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef ORAM_IMPL_SERVER_BLOCK_ARENA_H_
+#define ORAM_IMPL_SERVER_BLOCK_ARENA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace oram_impl {
+class SnapshotReader;
+class SnapshotWriter;
+
+// An array of fixed-size blocks stored back to back in a few large chunks.
+// Each slot is either empty or holds exactly `stride` bytes. Compared with a
+// vector of strings, there is no per-block heap allocation, and two arenas are
+// swapped by exchanging their pointers. A copy shares the chunks, and a chunk
+// still shared is cloned on its first write (copy-on-write), so a copy costs
+// little more than the chunks written while it lives.
+class BlockArena {
+  // The number of slots in a chunk.
+  static constexpr size_t kChunkSlots = 4096;
+
+  size_t stride_;
+  size_t size_;
+  std::vector<std::shared_ptr<uint8_t[]>> chunks_;
+  std::vector<bool> occupied_;
+
+  const uint8_t* Slot(size_t pos) const {
+    return chunks_[pos / kChunkSlots].get() + (pos % kChunkSlots) * stride_;
+  }
+  // Clones the chunk of the slot if it is shared.
+  uint8_t* MutableSlot(size_t pos);
+  size_t ChunkSize(size_t chunk) const;
+
+ public:
+  BlockArena() : stride_(0), size_(0) {}
+
+  // Drops the old content; all the slots are empty afterwards.
+  void Assign(size_t size, size_t stride);
+  void Release(void);
+  void Swap(BlockArena& other);
+  // Drops the old content; the chunks are shared until either arena writes
+  // them. The two may be used by different threads only if they are guarded
+  // by the same lock, including when they are dropped.
+  void CopyFrom(const BlockArena& other);
+
+  size_t Size(void) const { return size_; }
+  size_t Stride(void) const { return stride_; }
+  bool Empty(size_t pos) const { return !occupied_[pos]; }
+
+  // Returns an empty string for an empty slot.
+  std::string Get(size_t pos) const;
+  // Writing an empty string clears the slot. Returns false if the size of
+  // `content` does not match the stride.
+  bool Set(size_t pos, const std::string& content);
+  void Clear(size_t pos) { occupied_[pos] = false; }
+
+  // Only the occupied slots are written.
+  void WriteSnapshot(SnapshotWriter* const writer) const;
+  // Returns false if the snapshot is truncated.
+  bool ReadSnapshot(SnapshotReader* const reader);
+};
+}  // namespace oram_impl
+
+#endif  // ORAM_IMPL_SERVER_BLOCK_ARENA_H_
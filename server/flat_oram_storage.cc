@@ -23,4 +23,70 @@
 extern std::shared_ptr<spdlog::logger> logger;
 
 namespace oram_impl {
+server_flat_storage_t FlatOramServerStorage::GetStorage(void) {
+  std::lock_guard<std::mutex> guard(storage_lock_);
+  return storage_;
+}
+
+void FlatOramServerStorage::ResetStorage(void) {
+  std::lock_guard<std::mutex> guard(storage_lock_);
+  storage_.clear();
+}
+
+void FlatOramServerStorage::From(const server_flat_storage_t& storage) {
+  std::lock_guard<std::mutex> guard(storage_lock_);
+  storage_ = storage;
+}
+
+bool FlatOramServerStorage::ReadChunk(size_t offset, size_t length,
+                                      std::string* const out) {
+  std::lock_guard<std::mutex> guard(storage_lock_);
+  if (offset >= storage_.size()) {
+    return false;
+  }
+
+  out->assign(storage_, offset, length);
+  return true;
+}
+
+void FlatOramServerStorage::WriteChunk(size_t offset,
+                                       const std::string& content) {
+  std::lock_guard<std::mutex> guard(storage_lock_);
+  if (storage_.size() < offset + content.size()) {
+    storage_.resize(offset + content.size());
+  }
+
+  storage_.replace(offset, content.size(), content);
+}
+
+void FlatOramServerStorage::Truncate(size_t size) {
+  std::lock_guard<std::mutex> guard(storage_lock_);
+  if (size < storage_.size()) {
+    storage_.resize(size);
+  }
+}
+
+OramStatus FlatOramServerStorage::WriteSnapshot(SnapshotWriter* const writer) {
+  // Copied in memory first so that the streams are not held up by the disk.
+  const server_flat_storage_t storage = GetStorage();
+  writer->WriteString(storage);
+
+  return OramStatus::OK;
+}
+
+OramStatus FlatOramServerStorage::ReadSnapshot(
+    SnapshotReader* const reader, uint32_t id, size_t capacity,
+    size_t block_size, const std::string& instance_hash,
+    std::unique_ptr<BaseOramServerStorage>* const out) {
+  std::unique_ptr<FlatOramServerStorage> storage =
+      std::make_unique<FlatOramServerStorage>(id, capacity, block_size,
+                                              instance_hash);
+  if (!reader->ReadString(&storage->storage_)) {
+    return OramStatus(StatusCode::kInvalidArgument,
+                      "The flat storage is truncated.", __func__);
+  }
+
+  *out = std::move(storage);
+  return OramStatus::OK;
+}
 }  // namespace oram_impl
\ No newline at end of file
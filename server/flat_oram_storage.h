@@ -17,11 +17,18 @@
 #ifndef ORAM_IMPL_SERVER_FLAT_ORAM_STORAGE_H_
 #define ORAM_IMPL_SERVER_FLAT_ORAM_STORAGE_H_
 
+#include <memory>
+#include <mutex>
+
 #include "base_oram_storage.h"
+#include "oram_snapshot.h"
 
 namespace oram_impl {
 class FlatOramServerStorage : public BaseOramServerStorage {
   server_flat_storage_t storage_;
+  // A read stream and a write stream of the same scan run concurrently on
+  // disjoint regions of the storage.
+  std::mutex storage_lock_;
 
  public:
   FlatOramServerStorage(uint32_t id, size_t capacity, size_t block_size,
@@ -29,11 +36,22 @@ class FlatOramServerStorage : public BaseOramServerStorage {
       : BaseOramServerStorage(id, capacity, block_size, instance_hash,
                               OramStorageType::kFlatStorage) {}
 
-  virtual server_flat_storage_t GetStorage(void) { return storage_; }
-  virtual void ResetStorage(void) { storage_.clear(); }
-  virtual void From(const server_flat_storage_t& storage) {
-    storage_ = storage;
-  }
+  virtual server_flat_storage_t GetStorage(void);
+  virtual void ResetStorage(void);
+  virtual void From(const server_flat_storage_t& storage);
+
+  // Copies at most `length` bytes starting from `offset` into `out`. Returns
+  // false if `offset` is beyond the end of the storage.
+  bool ReadChunk(size_t offset, size_t length, std::string* const out);
+  // Overwrites the bytes starting from `offset`, growing the storage if needed.
+  void WriteChunk(size_t offset, const std::string& content);
+  void Truncate(size_t size);
+
+  virtual OramStatus WriteSnapshot(SnapshotWriter* const writer) override;
+  static OramStatus ReadSnapshot(
+      SnapshotReader* const reader, uint32_t id, size_t capacity,
+      size_t block_size, const std::string& instance_hash,
+      std::unique_ptr<BaseOramServerStorage>* const out);
 };
 }  // namespace oram_impl
 
@@ -0,0 +1,138 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "layered_oram_storage.h"
+
+#include <spdlog/logger.h>
+
+#include "base/oram_utils.h"
+
+extern std::shared_ptr<spdlog::logger> logger;
+
+namespace oram_impl {
+OramStatus LayeredOramServerStorage::ReadBlocks(
+    const std::vector<uint32_t>& levels, const std::vector<uint32_t>& offsets,
+    std::vector<std::string>* const out) {
+  if (levels.size() != offsets.size()) {
+    return OramStatus(StatusCode::kInvalidArgument,
+                      "The number of levels and offsets mismatch.", __func__);
+  }
+
+  for (size_t i = 0; i < levels.size(); i++) {
+    if (levels[i] >= storage_.size() ||
+        offsets[i] >= storage_[levels[i]].size()) {
+      const std::string error_message = oram_utils::StrCat(
+          "Cannot find the block at level ", levels[i], ", offset ",
+          offsets[i], ".");
+      return OramStatus(StatusCode::kObjectNotFound, error_message, __func__);
+    }
+
+    // Blocks are not removed on read: the client tracks which slots are stale
+    // and the whole level is discarded once it is merged into a lower one.
+    out->emplace_back(storage_[levels[i]][offsets[i]]);
+  }
+
+  return OramStatus::OK;
+}
+
+OramStatus LayeredOramServerStorage::WriteLevel(
+    uint32_t level,
+    const google::protobuf::RepeatedField<uint32_t>& cleared_levels,
+    server_layered_level_t&& contents) {
+  bool in_range = level < storage_.size();
+  for (const uint32_t cleared_level : cleared_levels) {
+    in_range &= cleared_level < storage_.size();
+  }
+  if (!in_range) {
+    return OramStatus(StatusCode::kOutOfRange, "The level is out of range.",
+                      __func__);
+  }
+
+  for (const uint32_t cleared_level : cleared_levels) {
+    server_layered_level_t().swap(storage_[cleared_level]);
+  }
+  // The old level is released with `contents`.
+  storage_[level].swap(contents);
+  return OramStatus::OK;
+}
+
+OramStatus LayeredOramServerStorage::AllocateLevel(uint32_t level,
+                                                   size_t size) {
+  if (level >= storage_.size()) {
+    return OramStatus(StatusCode::kOutOfRange, "The level is out of range.",
+                      __func__);
+  }
+
+  storage_[level].assign(size, "");
+  return OramStatus::OK;
+}
+
+OramStatus LayeredOramServerStorage::WriteRange(
+    uint32_t level, uint32_t offset,
+    const google::protobuf::RepeatedPtrField<std::string>& contents) {
+  if (level >= storage_.size() ||
+      (size_t)offset + contents.size() > storage_[level].size()) {
+    return OramStatus(StatusCode::kOutOfRange, "The range is out of the level.",
+                      __func__);
+  }
+
+  for (int i = 0; i < contents.size(); i++) {
+    storage_[level][offset + i] = contents.Get(i);
+  }
+
+  return OramStatus::OK;
+}
+
+OramStatus LayeredOramServerStorage::PromoteLevel(
+    uint32_t from, uint32_t to, size_t size,
+    const google::protobuf::RepeatedField<uint32_t>& cleared_levels) {
+  bool in_range = from < storage_.size() && to < storage_.size() &&
+                  size <= storage_[from].size();
+  for (const uint32_t cleared_level : cleared_levels) {
+    // The scratch level itself is never among the merged ones.
+    in_range &= cleared_level < storage_.size() && cleared_level != from;
+  }
+  if (!in_range) {
+    return OramStatus(StatusCode::kOutOfRange, "The level is out of range.",
+                      __func__);
+  }
+
+  for (const uint32_t cleared_level : cleared_levels) {
+    server_layered_level_t().swap(storage_[cleared_level]);
+  }
+
+  // The rest of `from` only holds dummies that were sorted to the end.
+  storage_[from].resize(size);
+  storage_[from].shrink_to_fit();
+  storage_[to].swap(storage_[from]);
+  if (from != to) {
+    server_layered_level_t().swap(storage_[from]);
+  }
+
+  return OramStatus::OK;
+}
+
+float LayeredOramServerStorage::ReportStorage(void) const {
+  size_t storage_size = 0ul;
+  for (const auto& level : storage_) {
+    for (const auto& block : level) {
+      storage_size += block.size();
+    }
+  }
+
+  return storage_size * 1.0 / POW2(20);
+}
+}  // namespace oram_impl
@@ -0,0 +1,66 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef ORAM_IMPL_SERVER_LAYERED_ORAM_STORAGE_H_
+#define ORAM_IMPL_SERVER_LAYERED_ORAM_STORAGE_H_
+
+#include <google/protobuf/repeated_field.h>
+
+#include "base_oram_storage.h"
+
+#include "base/oram_status.h"
+
+namespace oram_impl {
+// A storage organized as a stack of levels where each level is a flat array of
+// encrypted blocks. The server is oblivious to the semantics of each level: the
+// client decides which level is rebuilt and which levels are merged into it.
+class LayeredOramServerStorage : public BaseOramServerStorage {
+  server_layered_storage_t storage_;
+
+ public:
+  LayeredOramServerStorage(uint32_t id, size_t capacity, size_t block_size,
+                           const std::string& instance_hash)
+      : BaseOramServerStorage(id, capacity, block_size, instance_hash,
+                              OramStorageType::kLayeredStorage),
+        storage_(capacity) {}
+
+  OramStatus ReadBlocks(const std::vector<uint32_t>& levels,
+                        const std::vector<uint32_t>& offsets,
+                        std::vector<std::string>* const out);
+  // Drops the levels in `cleared_levels`, which the client merged, and swaps
+  // `contents` in as `level`, which may be one of them. Nothing is changed if
+  // any level is out of range.
+  OramStatus WriteLevel(
+      uint32_t level,
+      const google::protobuf::RepeatedField<uint32_t>& cleared_levels,
+      server_layered_level_t&& contents);
+  // Used by the client to rebuild a level piece by piece in a scratch level.
+  OramStatus AllocateLevel(uint32_t level, size_t size);
+  OramStatus WriteRange(
+      uint32_t level, uint32_t offset,
+      const google::protobuf::RepeatedPtrField<std::string>& contents);
+  // Drops the levels in `cleared_levels`, then moves the first `size` slots of
+  // `from` to `to` and discards `from`. Nothing is changed if any level is out
+  // of range.
+  OramStatus PromoteLevel(
+      uint32_t from, uint32_t to, size_t size,
+      const google::protobuf::RepeatedField<uint32_t>& cleared_levels);
+
+  virtual float ReportStorage(void) const override;
+};
+}  // namespace oram_impl
+
+#endif  // ORAM_IMPL_SERVER_LAYERED_ORAM_STORAGE_H_
@@ -71,6 +71,26 @@ int main(int argc, char* argv[]) {
       std::make_unique<oram_impl::ServerRunner>(
           config.server_address, config.server_port, config.key_path,
           config.crt_path);
+
+  oram_impl::TreeStorageOptions tree_storage_options;
+  tree_storage_options.type = config.tree_storage_engine;
+  tree_storage_options.path = config.tree_storage_path;
+  tree_storage_options.locked_levels = config.mmap_locked_levels;
+  tree_storage_options.huge_pages = config.mmap_huge_pages;
+  tree_storage_options.cached_levels = config.uring_cached_levels;
+  tree_storage_options.codec = config.block_codec;
+  server_runner->SetTreeStorageOptions(tree_storage_options);
+
+  oram_impl::ServerOptions server_options;
+  server_options.thread_num = config.server_thread_num;
+  server_options.max_message_size = config.max_message_size;
+  server_options.memory_quota = config.server_memory_quota;
+  server_options.max_threads = config.server_max_threads;
+  server_options.snapshot_path = config.snapshot_path;
+  server_options.snapshot_interval = config.snapshot_interval;
+  server_options.enable_wal = config.enable_wal;
+  server_options.wal_sync_policy = config.wal_sync_policy;
+  server_runner->SetServerOptions(server_options);
   server_runner->Run();
 
   return 0;
@@ -16,25 +16,81 @@
  */
 #include "oram_server.h"
 
+#include <pthread.h>
 #include <spdlog/fmt/bin_to_hex.h>
 
-#include <atomic>
+#include <algorithm>
+#include <filesystem>
+#include <future>
 #include <thread>
+#include <unordered_set>
 
 #include "base/oram_defs.h"
 #include "base/oram_utils.h"
 
-std::atomic_bool server_running;
-
 namespace oram_impl {
+BaseOramServerStorage* OramService::FindStorage(uint32_t id) {
+  auto iter = storages_.find(id);
+  return iter == storages_.end() ? nullptr : iter->second.get();
+}
+
+grpc::Status OramService::AddStorage(
+    uint32_t id, std::unique_ptr<BaseOramServerStorage> storage) {
+  std::unique_lock<std::shared_mutex> guard(storages_lock_);
+
+  grpc::Status status = CheckInitRequest(id);
+  if (status.ok()) {
+    storages_[id] = std::move(storage);
+  }
+
+  return status;
+}
+
+grpc::Status OramService::ReserveStorage(uint32_t id) {
+  std::unique_lock<std::shared_mutex> guard(storages_lock_);
+
+  grpc::Status status = CheckInitRequest(id);
+  if (status.ok()) {
+    reserved_ids_.emplace(id);
+  }
+
+  return status;
+}
+
+void OramService::ReleaseStorage(uint32_t id) {
+  std::unique_lock<std::shared_mutex> guard(storages_lock_);
+  reserved_ids_.erase(id);
+}
+
+void OramService::DropStorage(uint32_t id,
+                              const BaseOramServerStorage* const storage) {
+  std::unique_lock<std::shared_mutex> guard(storages_lock_);
+  if (FindStorage(id) == storage) {
+    storages_.erase(id);
+  }
+}
+
+grpc::Status OramService::CheckStreamStorage(
+    uint32_t id, const BaseOramServerStorage* const storage) {
+  if (FindStorage(id) != storage) {
+    const std::string error_message = oram_utils::StrCat(
+        "ORAM id: ", id, " was dropped while it was streamed.");
+    return grpc::Status(grpc::StatusCode::ABORTED, error_message);
+  }
+  return grpc::Status::OK;
+}
+
 grpc::Status OramService::CheckInitRequest(uint32_t id) {
-  if (storages_.find(id) != storages_.end()) {
+  if (storages_.find(id) != storages_.end() ||
+      reserved_ids_.find(id) != reserved_ids_.end()) {
     const std::string error_message =
         oram_utils::StrCat("ORAM id: ", id, " already exists.");
     return grpc::Status(grpc::StatusCode::ALREADY_EXISTS, error_message);
-  } else if (id >= kMaximumOramStorageNum) {
+  } else if (storages_.size() + reserved_ids_.size() >=
+             kMaximumOramStorageNum) {
     const std::string error_message = oram_utils::StrCat(
-        "PathORAM id: ", id, " exceeds the maximum number of ORAM storages: ",
+        "Cannot create ORAM id: ", id,
+        "; the server already holds the maximum number of ORAM storages: ",
         kMaximumOramStorageNum);
     return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, error_message);
   }
@@ -64,15 +120,58 @@ grpc::Status OramService::InitTreeOram(grpc::ServerContext* context,
   const uint32_t bucket_num = request->bucket_num();
   const size_t block_size = request->block_size();
 
-  // Do check.
-  grpc::Status status = CheckInitRequest(id);
+  // The engine may (re)create the file named after the id, so the id is taken
+  // before, and the storage is opened outside the lock.
+  grpc::Status status = ReserveStorage(id);
   if (!status.ok()) {
     return status;
   }
 
   // Create a new storage and initialize it.
-  storages_[id] = std::make_unique<TreeOramServerStorage>(
-      id, bucket_num, block_size, bucket_size, instance_hash);
+  std::unique_ptr<TreeOramServerStorage> storage =
+      std::make_unique<TreeOramServerStorage>(id, bucket_num, block_size,
+                                              bucket_size, instance_hash);
+  OramStatus open_status = storage->Open(tree_storage_options_);
+  if (!open_status.ok()) {
+    ERRS(logger, open_status.EmitString());
+    ReleaseStorage(id);
+    return grpc::Status(
+        open_status.error_code() == StatusCode::kOutOfMemory
+            ? grpc::StatusCode::RESOURCE_EXHAUSTED
+            : grpc::StatusCode::INTERNAL,
+        "Failed to create the tree storage.");
+  }
+
+  // The record takes its place in the log with the insertion, so that the log
+  // orders the creations with the resets as the table does; it is written
+  // after the table is released. The records of the writes to the storage
+  // follow it in the log, so none of them is acknowledged before it.
+  const BaseOramServerStorage* const created = storage.get();
+  uint64_t sequence = 0;
+  {
+    std::unique_lock<std::shared_mutex> guard(storages_lock_);
+    reserved_ids_.erase(id);
+
+    if (log_ != nullptr) {
+      storage->SetLog(log_.get());
+      open_status = log_->EnqueueCreateTree(id, bucket_num, block_size,
+                                            bucket_size, instance_hash,
+                                            &sequence);
+      if (!open_status.ok()) {
+        ERRS(logger, open_status.EmitString());
+        return grpc::Status(grpc::StatusCode::INTERNAL,
+                            "Failed to log the tree storage.");
+      }
+    }
+    storages_[id] = std::move(storage);
+  }
+
+  if (log_ != nullptr && !(open_status = log_->WaitFor(sequence)).ok()) {
+    ERRS(logger, open_status.EmitString());
+    DropStorage(id, created);
+    return grpc::Status(grpc::StatusCode::INTERNAL,
+                        "Failed to log the tree storage.");
+  }
 
   INFO(logger, "Tree ORAM successfully created. ID = {}", id);
 
@@ -91,15 +190,14 @@ grpc::Status OramService::InitFlatOram(grpc::ServerContext* context,
   const size_t capacity = request->capacity();
   const size_t block_size = request->block_size();
 
-  // Do check.
-  grpc::Status status = CheckInitRequest(id);
+  // Create a new storage and initialize it.
+  grpc::Status status =
+      AddStorage(id, std::make_unique<FlatOramServerStorage>(
+                         id, capacity, block_size, instance_hash));
   if (!status.ok()) {
     return status;
   }
 
-  storages_[id] = std::make_unique<FlatOramServerStorage>(
-      id, capacity, block_size, instance_hash);
-
   INFO(logger, "Flat ORAM successfully created. ID = {}", id);
 
   return grpc::Status::OK;
@@ -117,14 +215,14 @@ grpc::Status OramService::InitSqrtOram(grpc::ServerContext* context,
   const size_t block_size = request->block_size();
   const size_t squared_m = request->squared_m();
 
-  grpc::Status status = CheckInitRequest(id);
+  // Create a new storage and initialize it.
+  grpc::Status status =
+      AddStorage(id, std::make_unique<SqrtOramServerStorage>(
+                         id, capacity, block_size, squared_m, instance_hash));
   if (!status.ok()) {
     return status;
   }
 
-  storages_[id] = std::make_unique<SqrtOramServerStorage>(
-      id, capacity, block_size, squared_m, instance_hash);
-
   INFO(logger, "Sqrt Oram successfully created. ID = {}", id);
 
   return grpc::Status::OK;
@@ -139,17 +237,19 @@ grpc::Status OramService::ReadSqrtMemory(grpc::ServerContext* context,
   const uint32_t id = request->header().id();
   const std::string instance_hash = request->header().instance_hash();
 
+  std::shared_lock<std::shared_mutex> table_guard(storages_lock_);
   grpc::Status status = grpc::Status::OK;
   if (!(status = CheckIdValid(id)).ok()) {
     return status;
   }
 
   SqrtOramServerStorage* storage = nullptr;
-  status = CheckStorage(storages_[id].get(), instance_hash,
+  status = CheckStorage(FindStorage(id), instance_hash,
                         OramStorageType::kSqrtStorage, storage);
   if (!status.ok()) {
     return status;
   }
+  std::lock_guard<std::mutex> storage_guard(storage->GetLock());
 
   // Explanation:
   // 0 => shelter;
@@ -186,6 +286,37 @@ grpc::Status OramService::ReadSqrtMemory(grpc::ServerContext* context,
   return grpc::Status::OK;
 }
 
+grpc::Status OramService::ReadShelter(grpc::ServerContext* context,
+                                      const ReadShelterRequest* request,
+                                      ShelterMessage* response) {
+  INFO(logger, "From peer: {}, ReadShelter request received.",
+       context->peer());
+
+  const uint32_t id = request->header().id();
+  const std::string instance_hash = request->header().instance_hash();
+
+  std::shared_lock<std::shared_mutex> table_guard(storages_lock_);
+  grpc::Status status = grpc::Status::OK;
+  if (!(status = CheckIdValid(id)).ok()) {
+    return status;
+  }
+
+  SqrtOramServerStorage* storage = nullptr;
+  status = CheckStorage(FindStorage(id), instance_hash,
+                        OramStorageType::kSqrtStorage, storage);
+  if (!status.ok()) {
+    return status;
+  }
+  std::lock_guard<std::mutex> storage_guard(storage->GetLock());
+
+  std::vector<std::string> shelter = storage->ReadShelter();
+  for (auto& content : shelter) {
+    response->add_contents(std::move(content));
+  }
+
+  return grpc::Status::OK;
+}
+
 grpc::Status OramService::WriteSqrtMemory(grpc::ServerContext* context,
                                           const WriteSqrtMessage* request,
                                           google::protobuf::Empty* empty) {
@@ -195,49 +326,158 @@ grpc::Status OramService::WriteSqrtMemory(grpc::ServerContext* context,
   const uint32_t id = request->header().id();
   const std::string instance_hash = request->header().instance_hash();
 
+  std::shared_lock<std::shared_mutex> table_guard(storages_lock_);
   grpc::Status status = grpc::Status::OK;
   if (!(status = CheckIdValid(id)).ok()) {
     return status;
   }
 
   SqrtOramServerStorage* storage = nullptr;
-  status = CheckStorage(storages_[id].get(), instance_hash,
+  status = CheckStorage(FindStorage(id), instance_hash,
                         OramStorageType::kSqrtStorage, storage);
   if (!status.ok()) {
     return status;
   }
+  std::lock_guard<std::mutex> storage_guard(storage->GetLock());
 
-  const std::string content = request->content();
   const uint32_t tag = request->pos();
 
   // We ALWAYS write to the shelter.
-  storage->WriteBlockToShelter(tag, content);
+  if (!storage->WriteBlockToShelter(tag, request->content())) {
+    return grpc::Status(
+        grpc::StatusCode::INVALID_ARGUMENT,
+        oram_utils::StrCat("Cannot write the block of tag ", tag,
+                           " to the shelter."));
+  }
+  return grpc::Status::OK;
+}
+
+grpc::Status OramService::SqrtShuffleControl(
+    grpc::ServerContext* context, const SqrtShuffleRequest* request,
+    google::protobuf::Empty* empty) {
+  INFO(logger, "From peer: {}, SqrtShuffleControl request received.",
+       context->peer());
+
+  const uint32_t id = request->header().id();
+  const std::string instance_hash = request->header().instance_hash();
+
+  std::shared_lock<std::shared_mutex> table_guard(storages_lock_);
+  grpc::Status status = grpc::Status::OK;
+  if (!(status = CheckIdValid(id)).ok()) {
+    return status;
+  }
+
+  SqrtOramServerStorage* storage = nullptr;
+  status = CheckStorage(FindStorage(id), instance_hash,
+                        OramStorageType::kSqrtStorage, storage);
+  if (!status.ok()) {
+    return status;
+  }
+  std::lock_guard<std::mutex> storage_guard(storage->GetLock());
+
+  switch (request->type()) {
+    case kSqrtShuffleBegin:
+    case kSqrtShuffleBeginBackground: {
+      storage->BeginShuffle(request->temp_size(),
+                            request->type() == kSqrtShuffleBeginBackground);
+      break;
+    }
+    case kSqrtShuffleEnd: {
+      storage->EndShuffle();
+      break;
+    }
+    case kSqrtShuffleSwap: {
+      storage->SwapNext();
+      break;
+    }
+    default:
+      return grpc::Status(
+          grpc::StatusCode::INVALID_ARGUMENT,
+          oram_utils::StrCat("Unknown shuffle step: ", request->type()));
+  }
+
   return grpc::Status::OK;
 }
 
-grpc::Status OramService::SqrtPermute(grpc::ServerContext* context,
-                                      const SqrtPermMessage* request,
-                                      google::protobuf::Empty* empty) {
-  INFO(logger, "From peer: {}, SqrtPermute request received.", context->peer());
+grpc::Status OramService::ReadSqrtRange(grpc::ServerContext* context,
+                                        const ReadSqrtRangeRequest* request,
+                                        SqrtRangeMessage* response) {
+  INFO(logger, "From peer: {}, ReadSqrtRange request received.",
+       context->peer());
 
   const uint32_t id = request->header().id();
   const std::string instance_hash = request->header().instance_hash();
 
+  std::shared_lock<std::shared_mutex> table_guard(storages_lock_);
   grpc::Status status = grpc::Status::OK;
   if (!(status = CheckIdValid(id)).ok()) {
     return status;
   }
 
   SqrtOramServerStorage* storage = nullptr;
-  status = CheckStorage(storages_[id].get(), instance_hash,
+  status = CheckStorage(FindStorage(id), instance_hash,
                         OramStorageType::kSqrtStorage, storage);
   if (!status.ok()) {
     return status;
   }
+  std::lock_guard<std::mutex> storage_guard(storage->GetLock());
+
+  if (request->offsets_size() != request->lengths_size()) {
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "The offsets and the lengths do not match.");
+  }
+
+  std::vector<std::string> contents;
+  for (int i = 0; i < request->offsets_size(); i++) {
+    if (!storage->ReadRange(request->area(), request->offsets(i),
+                            request->lengths(i), &contents)) {
+      return grpc::Status(
+          grpc::StatusCode::OUT_OF_RANGE,
+          oram_utils::StrCat("Range [", request->offsets(i), ", +",
+                             request->lengths(i), ") is out of area ",
+                             request->area(), "."));
+    }
+  }
+
+  for (auto& content : contents) {
+    response->add_contents(std::move(content));
+  }
+
+  return grpc::Status::OK;
+}
+
+grpc::Status OramService::WriteSqrtRange(grpc::ServerContext* context,
+                                         const WriteSqrtRangeRequest* request,
+                                         google::protobuf::Empty* empty) {
+  INFO(logger, "From peer: {}, WriteSqrtRange request received.",
+       context->peer());
+
+  const uint32_t id = request->header().id();
+  const std::string instance_hash = request->header().instance_hash();
+
+  std::shared_lock<std::shared_mutex> table_guard(storages_lock_);
+  grpc::Status status = grpc::Status::OK;
+  if (!(status = CheckIdValid(id)).ok()) {
+    return status;
+  }
 
-  const std::vector<uint32_t> perm(request->perms().cbegin(),
-                                   request->perms().cend());
-  storage->DoPermute(perm);
+  SqrtOramServerStorage* storage = nullptr;
+  status = CheckStorage(FindStorage(id), instance_hash,
+                        OramStorageType::kSqrtStorage, storage);
+  if (!status.ok()) {
+    return status;
+  }
+  std::lock_guard<std::mutex> storage_guard(storage->GetLock());
+
+  if (!storage->WriteRange(request->area(), request->offset(),
+                           request->contents())) {
+    return grpc::Status(
+        grpc::StatusCode::OUT_OF_RANGE,
+        oram_utils::StrCat("Range [", request->offset(), ", +",
+                           request->contents_size(),
+                           ") is out of area ", request->area(),
+                           " or has malformed blocks."));
+  }
 
   return grpc::Status::OK;
 }
@@ -251,26 +491,222 @@ grpc::Status OramService::LoadSqrtOram(grpc::ServerContext* context,
   const uint32_t id = request->header().id();
   const std::string instance_hash = request->header().instance_hash();
 
+  std::shared_lock<std::shared_mutex> table_guard(storages_lock_);
   grpc::Status status = grpc::Status::OK;
   if (!(status = CheckIdValid(id)).ok()) {
     return status;
   }
 
   SqrtOramServerStorage* storage = nullptr;
-  status = CheckStorage(storages_[id].get(), instance_hash,
+  status = CheckStorage(FindStorage(id), instance_hash,
                         OramStorageType::kSqrtStorage, storage);
   if (!status.ok()) {
     return status;
   }
+  std::lock_guard<std::mutex> storage_guard(storage->GetLock());
 
-  const std::vector<std::string> content(request->contents().cbegin(),
-                                         request->contents().cend());
+  if (!storage->Fill(request->contents())) {
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "The blocks do not fit the Square Root ORAM.");
+  }
 
-  storage->Fill(content);
+  return grpc::Status::OK;
+}
+
+grpc::Status OramService::InitLayeredOram(grpc::ServerContext* context,
+                                          const InitLayeredOramRequest* request,
+                                          google::protobuf::Empty* empty) {
+  INFO(logger, "From peer: {}, InitLayeredOram request received.",
+       context->peer());
+
+  const uint32_t id = request->header().id();
+  const std::string instance_hash = request->header().instance_hash();
+  const size_t level_num = request->level_num();
+  const size_t block_size = request->block_size();
+
+  // Create a new storage and initialize it.
+  grpc::Status status =
+      AddStorage(id, std::make_unique<LayeredOramServerStorage>(
+                         id, level_num, block_size, instance_hash));
+  if (!status.ok()) {
+    return status;
+  }
+
+  INFO(logger, "Layered ORAM successfully created. ID = {}", id);
 
   return grpc::Status::OK;
 }
 
+grpc::Status OramService::ReadLayeredBlocks(grpc::ServerContext* context,
+                                            const ReadLayeredRequest* request,
+                                            LayeredBlocksMessage* response) {
+  INFO(logger, "From peer: {}, ReadLayeredBlocks request received.",
+       context->peer());
+
+  const uint32_t id = request->header().id();
+  const std::string instance_hash = request->header().instance_hash();
+
+  std::shared_lock<std::shared_mutex> table_guard(storages_lock_);
+  grpc::Status status = grpc::Status::OK;
+  if (!(status = CheckIdValid(id)).ok()) {
+    return status;
+  }
+
+  LayeredOramServerStorage* storage = nullptr;
+  status = CheckStorage(FindStorage(id), instance_hash,
+                        OramStorageType::kLayeredStorage, storage);
+  if (!status.ok()) {
+    return status;
+  }
+  std::lock_guard<std::mutex> storage_guard(storage->GetLock());
+
+  const std::vector<uint32_t> levels(request->levels().cbegin(),
+                                     request->levels().cend());
+  const std::vector<uint32_t> offsets(request->offsets().cbegin(),
+                                      request->offsets().cend());
+  std::vector<std::string> contents;
+  OramStatus oram_status = storage->ReadBlocks(levels, offsets, &contents);
+  if (!oram_status.ok()) {
+    const std::string error_message = oram_utils::StrCat(
+        "Failed to read layered ORAM id: ", id, ":\n ",
+        oram_status.EmitString());
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, error_message);
+  }
+
+  for (auto& content : contents) {
+    response->add_contents(std::move(content));
+  }
+
+  return status;
+}
+
+grpc::Status OramService::WriteLayeredLevel(grpc::ServerContext* context,
+                                            const WriteLayeredRequest* request,
+                                            google::protobuf::Empty* empty) {
+  INFO(logger, "From peer: {}, WriteLayeredLevel request received.",
+       context->peer());
+
+  const uint32_t id = request->header().id();
+  const std::string instance_hash = request->header().instance_hash();
+  const uint32_t level = request->level();
+
+  // The new level is built in a scratch level before any lock is taken, and
+  // is only swapped in once complete; a failed write changes no level.
+  server_layered_level_t contents(request->contents().cbegin(),
+                                  request->contents().cend());
+
+  std::shared_lock<std::shared_mutex> table_guard(storages_lock_);
+  grpc::Status status = grpc::Status::OK;
+  if (!(status = CheckIdValid(id)).ok()) {
+    return status;
+  }
+
+  LayeredOramServerStorage* storage = nullptr;
+  status = CheckStorage(FindStorage(id), instance_hash,
+                        OramStorageType::kLayeredStorage, storage);
+  if (!status.ok()) {
+    return status;
+  }
+  std::lock_guard<std::mutex> storage_guard(storage->GetLock());
+
+  OramStatus oram_status = storage->WriteLevel(
+      level, request->cleared_levels(), std::move(contents));
+  if (!oram_status.ok()) {
+    const std::string error_message = oram_utils::StrCat(
+        "Failed to write level: ", level, " in layered ORAM id: ", id, ":\n ",
+        oram_status.EmitString());
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, error_message);
+  }
+
+  return status;
+}
+
+grpc::Status OramService::WriteLayeredRange(
+    grpc::ServerContext* context, const WriteLayeredRangeRequest* request,
+    google::protobuf::Empty* empty) {
+  INFO(logger, "From peer: {}, WriteLayeredRange request received.",
+       context->peer());
+
+  const uint32_t id = request->header().id();
+  const std::string instance_hash = request->header().instance_hash();
+
+  std::shared_lock<std::shared_mutex> table_guard(storages_lock_);
+  grpc::Status status = grpc::Status::OK;
+  if (!(status = CheckIdValid(id)).ok()) {
+    return status;
+  }
+
+  LayeredOramServerStorage* storage = nullptr;
+  status = CheckStorage(FindStorage(id), instance_hash,
+                        OramStorageType::kLayeredStorage, storage);
+  if (!status.ok()) {
+    return status;
+  }
+  std::lock_guard<std::mutex> storage_guard(storage->GetLock());
+
+  OramStatus oram_status = storage->WriteRange(
+      request->level(), request->offset(), request->contents());
+  if (!oram_status.ok()) {
+    const std::string error_message = oram_utils::StrCat(
+        "Failed to write level: ", request->level(), " in layered ORAM id: ",
+        id, ":\n ", oram_status.EmitString());
+    return grpc::Status(grpc::StatusCode::OUT_OF_RANGE, error_message);
+  }
+
+  return status;
+}
+
+grpc::Status OramService::LayeredLevelControl(
+    grpc::ServerContext* context, const LayeredControlRequest* request,
+    google::protobuf::Empty* empty) {
+  INFO(logger, "From peer: {}, LayeredLevelControl request received.",
+       context->peer());
+
+  const uint32_t id = request->header().id();
+  const std::string instance_hash = request->header().instance_hash();
+
+  std::shared_lock<std::shared_mutex> table_guard(storages_lock_);
+  grpc::Status status = grpc::Status::OK;
+  if (!(status = CheckIdValid(id)).ok()) {
+    return status;
+  }
+
+  LayeredOramServerStorage* storage = nullptr;
+  status = CheckStorage(FindStorage(id), instance_hash,
+                        OramStorageType::kLayeredStorage, storage);
+  if (!status.ok()) {
+    return status;
+  }
+  std::lock_guard<std::mutex> storage_guard(storage->GetLock());
+
+  OramStatus oram_status;
+  switch (request->type()) {
+    case kLayeredAllocate: {
+      oram_status = storage->AllocateLevel(request->level(), request->size());
+      break;
+    }
+    case kLayeredPromote: {
+      oram_status =
+          storage->PromoteLevel(request->level(), request->target(),
+                                request->size(), request->cleared_levels());
+      break;
+    }
+    default:
+      return grpc::Status(
+          grpc::StatusCode::INVALID_ARGUMENT,
+          oram_utils::StrCat("Unknown level operation: ", request->type()));
+  }
+
+  if (!oram_status.ok()) {
+    const std::string error_message = oram_utils::StrCat(
+        "Failed to operate on level: ", request->level(),
+        " in layered ORAM id: ", id, ":\n ", oram_status.EmitString());
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, error_message);
+  }
+
+  return status;
+}
+
 grpc::Status OramService::ReadFlatMemory(grpc::ServerContext* context,
                                          const ReadFlatRequest* request,
                                          FlatVectorMessage* response) {
@@ -280,13 +716,14 @@ grpc::Status OramService::ReadFlatMemory(grpc::ServerContext* context,
   const uint32_t id = request->header().id();
   const std::string instance_hash = request->header().instance_hash();
 
+  std::shared_lock<std::shared_mutex> table_guard(storages_lock_);
   grpc::Status status = grpc::Status::OK;
   if (!(status = CheckIdValid(id)).ok()) {
     return status;
   }
 
   FlatOramServerStorage* storage = nullptr;
-  status = CheckStorage(storages_[id].get(), instance_hash,
+  status = CheckStorage(FindStorage(id), instance_hash,
                         OramStorageType::kFlatStorage, storage);
   if (!status.ok()) {
     return status;
@@ -307,13 +744,14 @@ grpc::Status OramService::WriteFlatMemory(grpc::ServerContext* context,
   const uint32_t id = request->header().id();
   const std::string instance_hash = request->header().instance_hash();
 
+  std::shared_lock<std::shared_mutex> table_guard(storages_lock_);
   grpc::Status status = grpc::Status::OK;
   if (!(status = CheckIdValid(id)).ok()) {
     return status;
   }
 
   FlatOramServerStorage* storage = nullptr;
-  status = CheckStorage(storages_[id].get(), instance_hash,
+  status = CheckStorage(FindStorage(id), instance_hash,
                         OramStorageType::kFlatStorage, storage);
   if (!status.ok()) {
     return status;
@@ -325,13 +763,174 @@ grpc::Status OramService::WriteFlatMemory(grpc::ServerContext* context,
   return status;
 }
 
+grpc::Status OramService::ReadFlatStream(
+    grpc::ServerContext* context, const ReadFlatStreamRequest* request,
+    grpc::ServerWriter<FlatChunkMessage>* writer) {
+  INFO(logger, "From peer: {}, ReadFlatStream request received.",
+       context->peer());
+
+  const uint32_t id = request->header().id();
+  const std::string instance_hash = request->header().instance_hash();
+
+  grpc::Status status = grpc::Status::OK;
+  // Kept alive, so that a storage created later under the same id is never
+  // taken for it.
+  std::shared_ptr<BaseOramServerStorage> held;
+  FlatOramServerStorage* storage = nullptr;
+  {
+    std::shared_lock<std::shared_mutex> table_guard(storages_lock_);
+    if (!(status = CheckIdValid(id)).ok()) {
+      return status;
+    }
+
+    held = storages_.at(id);
+    status = CheckStorage(held.get(), instance_hash,
+                          OramStorageType::kFlatStorage, storage);
+    if (!status.ok()) {
+      return status;
+    } else if (request->chunk_blocks() == 0) {
+      return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                          "The chunk size must be positive");
+    }
+  }
+
+  // The table is only held for each chunk, so that a slow client does not
+  // stall the creations and resets behind it; the stream ends if the storage
+  // is dropped meanwhile. Each chunk is copied out under the lock of the
+  // storage so that the chunks written back by the same scan can be applied
+  // meanwhile.
+  const size_t chunk_size = request->chunk_blocks() * storage->GetBlockSize();
+  FlatChunkMessage chunk;
+  for (size_t offset = 0;; offset += chunk_size) {
+    {
+      std::shared_lock<std::shared_mutex> table_guard(storages_lock_);
+      if (!(status = CheckStreamStorage(id, held.get())).ok()) {
+        return status;
+      } else if (!storage->ReadChunk(offset, chunk_size,
+                                     chunk.mutable_content())) {
+        break;
+      }
+    }
+
+    chunk.set_offset(offset);
+    if (!writer->Write(chunk)) {
+      return grpc::Status(grpc::StatusCode::CANCELLED,
+                          "The client has closed the stream");
+    }
+  }
+
+  return status;
+}
+
+grpc::Status OramService::WriteFlatStream(
+    grpc::ServerContext* context, grpc::ServerReader<FlatChunkMessage>* reader,
+    google::protobuf::Empty* empty) {
+  INFO(logger, "From peer: {}, WriteFlatStream request received.",
+       context->peer());
+
+  FlatChunkMessage chunk;
+  if (!reader->Read(&chunk)) {
+    // Nothing to write.
+    return grpc::Status::OK;
+  }
+
+  const uint32_t id = chunk.header().id();
+  const std::string instance_hash = chunk.header().instance_hash();
+
+  grpc::Status status = grpc::Status::OK;
+  // Kept alive, so that a storage created later under the same id is never
+  // taken for it.
+  std::shared_ptr<BaseOramServerStorage> held;
+  FlatOramServerStorage* storage = nullptr;
+  {
+    std::shared_lock<std::shared_mutex> table_guard(storages_lock_);
+    if (!(status = CheckIdValid(id)).ok()) {
+      return status;
+    }
+
+    held = storages_.at(id);
+    status = CheckStorage(held.get(), instance_hash,
+                          OramStorageType::kFlatStorage, storage);
+    if (!status.ok()) {
+      return status;
+    }
+  }
+
+  // As in `ReadFlatStream`, the table is only held for each chunk.
+  size_t end = 0;
+  bool last = false;
+  do {
+    if (chunk.content().size() % storage->GetBlockSize() != 0) {
+      return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                          "The chunk is not aligned to blocks");
+    }
+
+    std::shared_lock<std::shared_mutex> table_guard(storages_lock_);
+    if (!(status = CheckStreamStorage(id, held.get())).ok()) {
+      return status;
+    }
+    storage->WriteChunk(chunk.offset(), chunk.content());
+    end = std::max<size_t>(end, chunk.offset() + chunk.content().size());
+    last = chunk.last();
+  } while (!last && reader->Read(&chunk));
+
+  // The stream also ends when the client cancels it or breaks off, e.g.,
+  // after a failed scan; the chunks not written back yet must be kept then.
+  if (context->IsCancelled()) {
+    WARN(logger, "The write stream of ORAM id: {} was cancelled.", id);
+    return grpc::Status(grpc::StatusCode::CANCELLED,
+                        "The client has cancelled the stream");
+  } else if (!last) {
+    WARN(logger, "The write stream of ORAM id: {} ended early.", id);
+    return grpc::Status(grpc::StatusCode::ABORTED,
+                        "The stream ended before its last chunk");
+  }
+
+  std::shared_lock<std::shared_mutex> table_guard(storages_lock_);
+  if (!(status = CheckStreamStorage(id, held.get())).ok()) {
+    return status;
+  }
+  storage->Truncate(end);
+
+  return status;
+}
+
 grpc::Status OramService::ResetServer(grpc::ServerContext* context,
                                       const google::protobuf::Empty* request,
                                       google::protobuf::Empty* response) {
   INFO(logger, "From peer: {}, Reset server.", context->peer());
 
-  storages_.clear();
-  cryptor_.reset();
+  // Ordered with the creations under the table, and written after it is
+  // released.
+  uint64_t sequence = 0;
+  {
+    std::unique_lock<std::shared_mutex> guard(storages_lock_);
+    if (log_ != nullptr) {
+      OramStatus status = log_->EnqueueReset(&sequence);
+      if (!status.ok()) {
+        ERRS(logger, status.EmitString());
+        return grpc::Status(grpc::StatusCode::INTERNAL,
+                            "Failed to log the reset.");
+      }
+    }
+    storages_.clear();
+  }
+
+  if (log_ != nullptr) {
+    OramStatus status = log_->WaitFor(sequence);
+    if (!status.ok()) {
+      ERRS(logger, status.EmitString());
+      return grpc::Status(grpc::StatusCode::INTERNAL,
+                          "Failed to log the reset.");
+    }
+  }
+
+  {
+    // The next client samples its own keys, so the cryptor is kept usable
+    // instead of being dropped under the handlers that use it.
+    std::lock_guard<std::mutex> guard(cryptor_lock_);
+    cryptor_ = oram_crypto::Cryptor::GetInstance();
+  }
 
   return grpc::Status::OK;
 }
@@ -344,6 +943,7 @@ grpc::Status OramService::PrintOramTree(grpc::ServerContext* context,
 
   const uint32_t id = request->id();
 
+  std::shared_lock<std::shared_mutex> table_guard(storages_lock_);
   grpc::Status status = grpc::Status::OK;
   if (!(status = CheckIdValid(id)).ok()) {
     return status;
@@ -351,13 +951,13 @@ grpc::Status OramService::PrintOramTree(grpc::ServerContext* context,
 
   // Check if the storage is tree ORAM.
   TreeOramServerStorage* const storage =
-      dynamic_cast<TreeOramServerStorage* const>(storages_[id].get());
+      dynamic_cast<TreeOramServerStorage* const>(FindStorage(id));
   if (storage == nullptr ||
       storage->GetOramStorageType() != OramStorageType::kTreeStorage) {
     return grpc::Status(grpc::StatusCode::UNAVAILABLE, oram_type_mismatch_err);
   }
 
-  oram_utils::PrintOramTree(std::move(storage->GetStorage()));
+  storage->PrintOramTree();
 
   return status;
 }
@@ -374,6 +974,7 @@ grpc::Status OramService::ReadPath(grpc::ServerContext* context,
 
   INFO(logger, "PathORAM id: {}, path: {}, level: {}", id, path, level);
 
+  std::shared_lock<std::shared_mutex> table_guard(storages_lock_);
   grpc::Status status = grpc::Status::OK;
   if (!(status = CheckIdValid(id)).ok()) {
     return status;
@@ -381,7 +982,7 @@ grpc::Status OramService::ReadPath(grpc::ServerContext* context,
 
   // Check if the storage is tree ORAM.
   TreeOramServerStorage* storage = nullptr;
-  status = CheckStorage(storages_[id].get(), instance_hash,
+  status = CheckStorage(FindStorage(id), instance_hash,
                         OramStorageType::kTreeStorage, storage);
   if (!status.ok()) {
     return status;
@@ -428,6 +1029,7 @@ grpc::Status OramService::WritePath(grpc::ServerContext* context,
   const uint32_t path = request->path();
   const uint32_t offset = request->offset();
 
+  std::shared_lock<std::shared_mutex> table_guard(storages_lock_);
   grpc::Status server_status = grpc::Status::OK;
   if (!(server_status = CheckIdValid(id)).ok()) {
     return server_status;
@@ -435,7 +1037,7 @@ grpc::Status OramService::WritePath(grpc::ServerContext* context,
 
   // Check if the storage is tree ORAM.
   TreeOramServerStorage* storage = nullptr;
-  server_status = CheckStorage(storages_[id].get(), instance_hash,
+  server_status = CheckStorage(FindStorage(id), instance_hash,
                                OramStorageType::kTreeStorage, storage);
   if (!server_status.ok()) {
     return server_status;
@@ -465,11 +1067,138 @@ grpc::Status OramService::WritePath(grpc::ServerContext* context,
   return server_status;
 }
 
+grpc::Status OramService::ReadFullPath(grpc::ServerContext* context,
+                                       const ReadPathRequest* request,
+                                       ReadPathResponse* response) {
+  std::promise<grpc::Status> promise;
+  std::future<grpc::Status> result = promise.get_future();
+  BeginReadFullPath(context, request, response,
+                    [&promise](const grpc::Status& status) {
+                      promise.set_value(status);
+                    });
+
+  return result.get();
+}
+
+grpc::Status OramService::WriteFullPath(grpc::ServerContext* context,
+                                        const WriteFullPathRequest* request,
+                                        WritePathResponse* response) {
+  std::promise<grpc::Status> promise;
+  std::future<grpc::Status> result = promise.get_future();
+  BeginWriteFullPath(context, request, response,
+                     [&promise](const grpc::Status& status) {
+                       promise.set_value(status);
+                     });
+
+  return result.get();
+}
+
+void OramService::BeginReadFullPath(grpc::ServerContext* context,
+                                    const ReadPathRequest* request,
+                                    ReadPathResponse* response,
+                                    const finish_fn_t& finish) {
+  INFO(logger, "From peer: {}, ReadFullPath request received.",
+       context->peer());
+
+  const uint32_t id = request->header().id();
+  const std::string instance_hash = request->header().instance_hash();
+  const uint32_t path = request->path();
+
+  // The table is only held until the request is issued: a storage waits for
+  // its requests in flight before it is dropped.
+  std::shared_lock<std::shared_mutex> table_guard(storages_lock_);
+  grpc::Status status = grpc::Status::OK;
+  if (!(status = CheckIdValid(id)).ok()) {
+    finish(status);
+    return;
+  }
+
+  // Check if the storage is tree ORAM.
+  TreeOramServerStorage* storage = nullptr;
+  status = CheckStorage(FindStorage(id), instance_hash,
+                        OramStorageType::kTreeStorage, storage);
+  if (!status.ok()) {
+    finish(status);
+    return;
+  }
+
+  std::shared_ptr<p_oram_bucket_t> bucket =
+      std::make_shared<p_oram_bucket_t>();
+  storage->ReadFullPathAsync(
+      path, bucket.get(),
+      [id, path, bucket, response, finish](const OramStatus& read_status) {
+        if (!read_status.ok()) {
+          const std::string error_message = oram_utils::StrCat(
+              "Failed to read path: ", path, " in PathORAM id: ", id, ":\n ",
+              read_status.EmitString());
+          finish(grpc::Status(grpc::StatusCode::INTERNAL, error_message));
+          return;
+        }
+
+        for (const auto& block : *bucket) {
+          oram_utils::ConvertToString(&block, response->add_bucket());
+        }
+        finish(grpc::Status::OK);
+      });
+}
+
+void OramService::BeginWriteFullPath(grpc::ServerContext* context,
+                                     const WriteFullPathRequest* request,
+                                     WritePathResponse* response,
+                                     const finish_fn_t& finish) {
+  INFO(logger, "From peer: {}, WriteFullPath request received.",
+       context->peer());
+
+  const uint32_t id = request->header().id();
+  const std::string instance_hash = request->header().instance_hash();
+  const uint32_t path = request->path();
+
+  std::shared_lock<std::shared_mutex> table_guard(storages_lock_);
+  grpc::Status status = grpc::Status::OK;
+  if (!(status = CheckIdValid(id)).ok()) {
+    finish(status);
+    return;
+  }
+
+  // Check if the storage is tree ORAM.
+  TreeOramServerStorage* storage = nullptr;
+  status = CheckStorage(FindStorage(id), instance_hash,
+                        OramStorageType::kTreeStorage, storage);
+  if (!status.ok()) {
+    finish(status);
+    return;
+  }
+
+  p_oram_path_t buckets(request->buckets_size());
+  for (int i = 0; i < request->buckets_size(); i++) {
+    const auto& bucket = request->buckets(i).bucket();
+    buckets[i].resize(bucket.size());
+    for (int j = 0; j < bucket.size(); j++) {
+      oram_utils::ConvertToBlock(bucket[j], &buckets[i][j]);
+    }
+  }
+
+  // The buckets are copied by the engine before the call returns.
+  storage->WriteFullPathAsync(
+      path, buckets, [id, path, finish](const OramStatus& write_status) {
+        if (!write_status.ok()) {
+          const std::string error_message = oram_utils::StrCat(
+              "Failed to write path: ", path, " in PathORAM id: ", id, ":\n ",
+              write_status.EmitString());
+          finish(grpc::Status(grpc::StatusCode::INTERNAL, error_message));
+          return;
+        }
+
+        finish(grpc::Status::OK);
+      });
+}
+
 grpc::Status OramService::KeyExchange(grpc::ServerContext* context,
                                       const KeyExchangeRequest* request,
                                       KeyExchangeResponse* response) {
   const std::string public_key_client = request->public_key_client();
 
+  std::lock_guard<std::mutex> guard(cryptor_lock_);
   OramStatus status;
   if (!(status = cryptor_->SampleKeyPair()).ok()) {
     const std::string error_message = oram_utils::StrCat(
@@ -498,10 +1227,152 @@ grpc::Status OramService::CloseConnection(
     grpc::ServerContext* context, const google::protobuf::Empty* request,
     google::protobuf::Empty* response) {
   INFO(logger, "Closing connection...");
-  server_running = false;
+
+  // The server is shut down by `ServerRunner::Run`, as a handler cannot wait
+  // for itself to finish.
+  {
+    std::lock_guard<std::mutex> guard(closing_lock_);
+    closing_ = true;
+  }
+  closing_cv_.notify_all();
+
   return grpc::Status::OK;
 }
 
+void OramService::WaitForClose(void) {
+  std::unique_lock<std::mutex> guard(closing_lock_);
+  closing_cv_.wait(guard, [this]() { return closing_; });
+}
+
+bool OramService::WaitForClose(std::chrono::seconds timeout) {
+  std::unique_lock<std::mutex> guard(closing_lock_);
+  return closing_cv_.wait_for(guard, timeout, [this]() { return closing_; });
+}
+
+// The snapshot of storage `id` is "oram_<id>.snapshot".
+static std::string SnapshotName(uint32_t id) {
+  return oram_utils::StrCat("oram_", id, ".snapshot");
+}
+
+static bool IsSnapshotName(const std::string& name) {
+  const std::string prefix = "oram_";
+  const std::string suffix = ".snapshot";
+  return name.size() > prefix.size() + suffix.size() &&
+         name.compare(0, prefix.size(), prefix) == 0 &&
+         name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+OramStatus OramService::SaveSnapshots(const std::string& dir) {
+  std::error_code err;
+  std::filesystem::create_directories(dir, err);
+  if (err) {
+    return OramStatus(
+        StatusCode::kFileIOError,
+        oram_utils::StrCat("Cannot create ", dir, ": ", err.message()),
+        __func__);
+  }
+
+  // The table is only held to list the storages, so that no request waits
+  // for the disk. A storage dropped meanwhile is kept alive until its
+  // snapshot is written.
+  std::vector<std::pair<uint32_t, std::shared_ptr<BaseOramServerStorage>>>
+      storages;
+  {
+    std::shared_lock<std::shared_mutex> guard(storages_lock_);
+    storages.assign(storages_.begin(), storages_.end());
+  }
+  auto begin = std::chrono::high_resolution_clock::now();
+
+  std::vector<std::pair<uint32_t, BaseOramServerStorage*>> snapshotted;
+  for (const auto& storage : storages) {
+    const std::string name = SnapshotName(storage.first);
+    OramStatus status = SaveSnapshot(storage.second.get(),
+                                     oram_utils::StrCat(dir, "/", name));
+    if (status.error_code() == StatusCode::kUnimplemented) {
+      DBG(logger, "Storage {} is not snapshotted.", storage.first);
+      continue;
+    } else if (!status.ok()) {
+      return status.Append(OramStatus(
+          StatusCode::kServerError,
+          oram_utils::StrCat("Cannot snapshot storage ", storage.first),
+          __func__));
+    }
+    snapshotted.emplace_back(storage.first, storage.second.get());
+  }
+
+  // Only the snapshots of the storages still in the table are kept.
+  std::unordered_set<std::string> names;
+  {
+    std::shared_lock<std::shared_mutex> guard(storages_lock_);
+    for (const auto& storage : snapshotted) {
+      if (FindStorage(storage.first) == storage.second) {
+        names.emplace(SnapshotName(storage.first));
+      }
+    }
+  }
+  storages.clear();
+
+  // Otherwise they would be restored on the next start.
+  for (const auto& entry : std::filesystem::directory_iterator(dir, err)) {
+    const std::string name = entry.path().filename().string();
+    if (IsSnapshotName(name) && names.find(name) == names.end()) {
+      std::filesystem::remove(entry.path(), err);
+    }
+  }
+
+  auto end = std::chrono::high_resolution_clock::now();
+  INFO(logger, "Snapshotted {} storages in {} ms.", names.size(),
+       std::chrono::duration_cast<std::chrono::milliseconds>(end - begin)
+           .count());
+
+  return OramStatus::OK;
+}
+
+OramStatus OramService::LoadSnapshots(const std::string& dir) {
+  std::error_code err;
+  std::filesystem::directory_iterator iter(dir, err);
+  if (err) {
+    // Nothing has been snapshotted yet.
+    return OramStatus::OK;
+  }
+
+  auto begin = std::chrono::high_resolution_clock::now();
+  size_t restored = 0;
+  for (const auto& entry : iter) {
+    const std::string name = entry.path().filename().string();
+    if (!IsSnapshotName(name)) {
+      continue;
+    }
+
+    std::unique_ptr<BaseOramServerStorage> storage;
+    OramStatus status =
+        LoadSnapshot(entry.path().string(), tree_storage_options_, &storage);
+    if (!status.ok()) {
+      ERRS(logger, status.EmitString());
+      continue;
+    }
+
+    if (storage->GetOramStorageType() == OramStorageType::kTreeStorage) {
+      static_cast<TreeOramServerStorage*>(storage.get())->SetLog(log_.get());
+    }
+
+    const uint32_t id = storage->GetId();
+    const grpc::Status add_status = AddStorage(id, std::move(storage));
+    if (!add_status.ok()) {
+      ERRS(logger, add_status.error_message());
+      continue;
+    }
+    restored++;
+  }
+
+  auto end = std::chrono::high_resolution_clock::now();
+  INFO(logger, "Restored {} storages from {} in {} ms.", restored, dir,
+       std::chrono::duration_cast<std::chrono::milliseconds>(end - begin)
+           .count());
+
+  return OramStatus::OK;
+}
+
 grpc::Status OramService::SendHello(grpc::ServerContext* context,
                                     const HelloMessage* request,
                                     google::protobuf::Empty* empty) {
@@ -513,6 +1384,7 @@ grpc::Status OramService::SendHello(grpc::ServerContext* context,
   INFO(logger, "Received encrypted message: {}.",
        spdlog::to_hex(encrypted_message));
 
+  std::lock_guard<std::mutex> guard(cryptor_lock_);
   if (!(status = cryptor_->Decrypt((uint8_t*)encrypted_message.data(),
                                    encrypted_message.size(),
                                    (uint8_t*)iv.data(), &message))
@@ -532,8 +1404,10 @@ grpc::Status OramService::ReportServerInformation(
   INFO(logger, "Report server information...");
 
   double storage_size = 0;
+  std::shared_lock<std::shared_mutex> guard(storages_lock_);
   for (const auto& storage : storages_) {
     storage_size += storage.second->ReportStorage();
+    storage.second->LogStatistics();
   }
 
   INFO(logger, "The total storage size is {} MB.", storage_size);
@@ -565,10 +1439,168 @@ ServerRunner::ServerRunner(const std::string& address, uint32_t port,
   ssl_opts.pem_key_cert_pairs.emplace_back(pkcp);
   creds_ = grpc::SslServerCredentials(ssl_opts);
 
-  service_ = std::make_unique<OramService>();
+  service_ = std::make_unique<AsyncOramService>();
   is_initialized = true;
 }
 
+// Arms a call that serves `method` with the handler of `OramService`. The
+// handler is named explicitly, since `AsyncOramService` overrides it.
+#define ORAM_SERVE_UNARY(method, request_t, response_t)                      \
+  new UnaryCall<request_t, response_t>(                                       \
+      [service](grpc::ServerContext* context, request_t* request,            \
+                grpc::ServerAsyncResponseWriter<response_t>* responder,      \
+                grpc::ServerCompletionQueue* cq, void* tag) {                \
+        service->Request##method(context, request, responder, cq, cq, tag);  \
+      },                                                                      \
+      [service](grpc::ServerContext* context, const request_t* request,      \
+                response_t* response) {                                       \
+        return service->OramService::method(context, request, response);     \
+      },                                                                      \
+      cq)
+
+// As above, for a method whose `Begin<method>` handler completes it later.
+#define ORAM_SERVE_DEFERRED(method, request_t, response_t)                   \
+  new DeferredUnaryCall<request_t, response_t>(                               \
+      [service](grpc::ServerContext* context, request_t* request,            \
+                grpc::ServerAsyncResponseWriter<response_t>* responder,      \
+                grpc::ServerCompletionQueue* cq, void* tag) {                \
+        service->Request##method(context, request, responder, cq, cq, tag);  \
+      },                                                                      \
+      [service](grpc::ServerContext* context, const request_t* request,      \
+                response_t* response, const finish_fn_t& finish) {           \
+        service->Begin##method(context, request, response, finish);          \
+      },                                                                      \
+      cq)
+
+void ServerRunner::ServeUnaryCalls(grpc::ServerCompletionQueue* const cq) {
+  using google::protobuf::Empty;
+  AsyncOramService* const service = service_.get();
+
+  ORAM_SERVE_UNARY(InitTreeOram, InitTreeOramRequest, Empty);
+  ORAM_SERVE_UNARY(InitFlatOram, InitFlatOramRequest, Empty);
+  ORAM_SERVE_UNARY(InitSqrtOram, InitSqrtOramRequest, Empty);
+  ORAM_SERVE_UNARY(LoadSqrtOram, LoadSqrtOramRequest, Empty);
+  ORAM_SERVE_UNARY(PrintOramTree, PrintOramTreeRequest, Empty);
+  // A single bucket is served inline, so with the io_uring engine ReadPath and
+  // WritePath still wait for the disk on the poller; the full paths do not.
+  ORAM_SERVE_UNARY(ReadPath, ReadPathRequest, ReadPathResponse);
+  ORAM_SERVE_UNARY(WritePath, WritePathRequest, WritePathResponse);
+  ORAM_SERVE_DEFERRED(ReadFullPath, ReadPathRequest, ReadPathResponse);
+  ORAM_SERVE_DEFERRED(WriteFullPath, WriteFullPathRequest, WritePathResponse);
+  ORAM_SERVE_UNARY(ReadFlatMemory, ReadFlatRequest, FlatVectorMessage);
+  ORAM_SERVE_UNARY(WriteFlatMemory, FlatVectorMessage, Empty);
+  ORAM_SERVE_UNARY(ReadSqrtMemory, ReadSqrtRequest, SqrtMessage);
+  ORAM_SERVE_UNARY(ReadShelter, ReadShelterRequest, ShelterMessage);
+  ORAM_SERVE_UNARY(WriteSqrtMemory, WriteSqrtMessage, Empty);
+  ORAM_SERVE_UNARY(SqrtShuffleControl, SqrtShuffleRequest, Empty);
+  ORAM_SERVE_UNARY(ReadSqrtRange, ReadSqrtRangeRequest, SqrtRangeMessage);
+  ORAM_SERVE_UNARY(WriteSqrtRange, WriteSqrtRangeRequest, Empty);
+  ORAM_SERVE_UNARY(InitLayeredOram, InitLayeredOramRequest, Empty);
+  ORAM_SERVE_UNARY(ReadLayeredBlocks, ReadLayeredRequest,
+                   LayeredBlocksMessage);
+  ORAM_SERVE_UNARY(WriteLayeredLevel, WriteLayeredRequest, Empty);
+  ORAM_SERVE_UNARY(WriteLayeredRange, WriteLayeredRangeRequest, Empty);
+  ORAM_SERVE_UNARY(LayeredLevelControl, LayeredControlRequest, Empty);
+  ORAM_SERVE_UNARY(CloseConnection, Empty, Empty);
+  ORAM_SERVE_UNARY(KeyExchange, KeyExchangeRequest, KeyExchangeResponse);
+  ORAM_SERVE_UNARY(SendHello, HelloMessage, Empty);
+  ORAM_SERVE_UNARY(ReportServerInformation, Empty, Empty);
+  ORAM_SERVE_UNARY(ResetServer, Empty, Empty);
+}
+
+#undef ORAM_SERVE_UNARY
+#undef ORAM_SERVE_DEFERRED
+
+void ServerRunner::Poll(grpc::ServerCompletionQueue* const cq) {
+  ServeUnaryCalls(cq);
+
+  // Returns false once the queue is shut down and drained.
+  void* tag;
+  bool ok;
+  while (cq->Next(&tag, &ok)) {
+    static_cast<AsyncCall*>(tag)->Proceed(ok);
+  }
+}
+
+OramStatus OramService::ReplayLog(size_t* const replayed) {
+  std::unique_lock<std::shared_mutex> guard(storages_lock_);
+
+  auto apply = [this](const WalRecord& record) {
+    switch (record.type) {
+      case WalRecordType::kReset:
+        storages_.clear();
+        return OramStatus::OK;
+
+      case WalRecordType::kCreateTree: {
+        // Taken by the snapshot or by an earlier creation.
+        if (storages_.find(record.id) != storages_.end()) {
+          return OramStatus::OK;
+        } else if (storages_.size() >= kMaximumOramStorageNum) {
+          WARN(logger, "Skipped tree storage {}: too many storages.",
+               record.id);
+          return OramStatus::OK;
+        }
+
+        std::unique_ptr<TreeOramServerStorage> storage =
+            std::make_unique<TreeOramServerStorage>(
+                record.id, record.capacity, record.block_size,
+                record.bucket_size, record.instance_hash);
+        OramStatus status = storage->Open(tree_storage_options_);
+        if (!status.ok()) {
+          return status;
+        }
+        storage->SetLog(log_.get());
+        storages_[record.id] = std::move(storage);
+        return OramStatus::OK;
+      }
+
+      case WalRecordType::kBuckets: {
+        BaseOramServerStorage* const storage = FindStorage(record.id);
+        if (storage == nullptr ||
+            storage->GetOramStorageType() != OramStorageType::kTreeStorage) {
+          WARN(logger, "Skipped the buckets of unknown tree storage {}.",
+               record.id);
+          return OramStatus::OK;
+        }
+        return static_cast<TreeOramServerStorage*>(storage)->ReplayBuckets(
+            record.indices, record.buckets);
+      }
+
+      default:
+        return OramStatus(StatusCode::kInvalidArgument,
+                          "Unknown record of the log.", __func__);
+    }
+  };
+
+  auto begin = std::chrono::high_resolution_clock::now();
+  OramStatus status = log_->Replay(apply, replayed);
+  auto end = std::chrono::high_resolution_clock::now();
+  INFO(logger, "Replayed {} records of the log in {} ms.", *replayed,
+       std::chrono::duration_cast<std::chrono::milliseconds>(end - begin)
+           .count());
+
+  return status;
+}
+
+void ServerRunner::TakeSnapshots(void) {
+  // The records after the rotation are kept, as the snapshots may miss them.
+  uint64_t segment = 0;
+  if (service_->log_ != nullptr) {
+    OramStatus status = service_->log_->Rotate(&segment);
+    if (!status.ok()) {
+      ERRS(logger, status.EmitString());
+      return;
+    }
+  }
+
+  OramStatus status = service_->SaveSnapshots(options_.snapshot_path);
+  if (!status.ok()) {
+    ERRS(logger, status.EmitString());
+  } else if (service_->log_ != nullptr) {
+    service_->log_->DropSegmentsBefore(segment);
+  }
+}
+
 void ServerRunner::Run(void) {
   INFO(logger, "Starting server...");
 
@@ -577,29 +1609,120 @@ void ServerRunner::Run(void) {
     exit(1);
   }
 
+  // Initialize the cryptor.
+  service_->cryptor_ = oram_crypto::Cryptor::GetInstance();
+
+  const bool snapshot = !options_.snapshot_path.empty();
+  if (options_.enable_wal && !snapshot) {
+    WARN(logger, "The write-ahead log is disabled without a snapshot path.");
+  } else if (options_.enable_wal) {
+    if (options_.wal_sync_policy == WalSyncPolicy::kInvalid) {
+      ERRS(logger, "Unknown sync policy of the write-ahead log.");
+      exit(1);
+    }
+
+    service_->log_ = std::make_unique<WriteAheadLog>(
+        oram_utils::StrCat(options_.snapshot_path, "/wal"),
+        options_.wal_sync_policy);
+    OramStatus status = service_->log_->Open();
+    if (!status.ok()) {
+      ERRS(logger, status.EmitString());
+      exit(1);
+    }
+  }
+
+  // A partial state must not be served, nor checkpointed: a checkpoint drops
+  // the segments of the log that were not applied.
+  if (snapshot) {
+    OramStatus status = service_->LoadSnapshots(options_.snapshot_path);
+    if (!status.ok()) {
+      ERRS(logger, status.EmitString());
+      exit(1);
+    }
+  }
+
+  if (service_->log_ != nullptr) {
+    size_t replayed = 0;
+    OramStatus status = service_->ReplayLog(&replayed);
+    if (!status.ok()) {
+      ERRS(logger, status.EmitString());
+      exit(1);
+    }
+    // Checkpoint at once so that the next start does not replay them again.
+    if (replayed != 0) {
+      TakeSnapshots();
+    }
+  }
+
   grpc::ServerBuilder builder;
   const std::string address = oram_utils::StrCat(address_, ":", port_);
   builder.AddListeningPort(address, creds_);
   builder.RegisterService(service_.get());
+  builder.SetMaxReceiveMessageSize(options_.max_message_size);
+  builder.SetMaxSendMessageSize(options_.max_message_size);
 
-  std::shared_ptr<grpc::Server> server = builder.BuildAndStart();
-  INFO(logger, "Server started to listen on {}:{}.", address_, port_);
-  server_running = true;
+  grpc::ResourceQuota quota("oram_server");
+  if (options_.memory_quota != 0) {
+    quota.Resize(options_.memory_quota * POW2(20));
+  }
+  if (options_.max_threads != 0) {
+    quota.SetMaxThreads(options_.max_threads);
+  }
+  builder.SetResourceQuota(quota);
+
+  const size_t core_num = std::max(1u, std::thread::hardware_concurrency());
+  const size_t thread_num =
+      options_.thread_num == 0 ? core_num : options_.thread_num;
+  std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> cqs;
+  for (size_t i = 0; i < thread_num; i++) {
+    cqs.emplace_back(builder.AddCompletionQueue());
+  }
 
-  // Initialize the cryptor.
-  service_->cryptor_ = oram_crypto::Cryptor::GetInstance();
+  std::unique_ptr<grpc::Server> server = builder.BuildAndStart();
+  if (server == nullptr) {
+    ERRS(logger, "Cannot listen on {}:{}.", address_, port_);
+    exit(1);
+  }
+  INFO(logger, "Server started to listen on {}:{} with {} threads.", address_,
+       port_, thread_num);
+
+  // One thread per queue, each pinned to a core.
+  std::vector<std::thread> pollers;
+  for (size_t i = 0; i < thread_num; i++) {
+    pollers.emplace_back(&ServerRunner::Poll, this, cqs[i].get());
+
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(i % core_num, &cpu_set);
+    if (pthread_setaffinity_np(pollers.back().native_handle(),
+                               sizeof(cpu_set_t), &cpu_set) != 0) {
+      WARN(logger, "Cannot pin thread {} to core {}.", i, i % core_num);
+    }
+  }
 
-  // Start a monitor thread.
-  std::thread monitor_thread([&, this]() {
-    while (server_running) {
-      // Wake up every 100 miliseconds and check if the server is still
-      // running.
-      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  if (snapshot && options_.snapshot_interval != 0) {
+    const std::chrono::seconds interval(options_.snapshot_interval);
+    while (!service_->WaitForClose(interval)) {
+      TakeSnapshots();
     }
-    server->Shutdown();
-  });
-  monitor_thread.detach();
+  } else {
+    service_->WaitForClose();
+  }
+  INFO(logger, "Shutting down the server...");
+
+  // The pending calls come back as failed events and are released by the
+  // pollers, which return once their queues are drained.
+  server->Shutdown();
+  for (auto& cq : cqs) {
+    cq->Shutdown();
+  }
+  for (auto& poller : pollers) {
+    poller.join();
+  }
 
-  server->Wait();
+  // Every request has been served by now.
+  if (snapshot) {
+    TakeSnapshots();
+  }
 }
 }  // namespace oram_impl
\ No newline at end of file
@@ -20,30 +20,75 @@
 #include <grpc++/grpc++.h>
 #include <spdlog/spdlog.h>
 
+#include <chrono>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <thread>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "base/oram_crypto.h"
 #include "base/oram_utils.h"
+#include "async_call.h"
+#include "oram_snapshot.h"
 #include "oram_storage.h"
+#include "tree_storage_engine.h"
+#include "write_ahead_log.h"
 #include "protos/messages.grpc.pb.h"
 #include "protos/messages.pb.h"
 
 extern std::shared_ptr<spdlog::logger> logger;
 
 namespace oram_impl {
-class OramService final : public oram_server::Service {
+class OramService : public oram_server::Service {
  private:
   friend class ServerRunner;
 
   std::shared_ptr<oram_crypto::Cryptor> cryptor_;
-  std::unordered_map<uint32_t, std::unique_ptr<BaseOramServerStorage>>
+  // Key exchanges and resets may run concurrently on the pollers.
+  std::mutex cryptor_lock_;
+  // Shared with the snapshots, which keep the storages they write alive.
+  std::unordered_map<uint32_t, std::shared_ptr<BaseOramServerStorage>>
       storages_;
-
+  // Clients may create and access instances concurrently (e.g., the Partition
+  // ORAM sets up its partitions in parallel), so the table is guarded. The
+  // handlers hold it shared while they use a storage, so that a storage is
+  // never dropped under them (the streams hold it for each chunk); only adding
+  // and dropping storages take it exclusively. Accesses to the same storage are synchronized by the storage.
+  std::shared_mutex storages_lock_;
+  // How the tree storages created afterwards are laid out.
+  TreeStorageOptions tree_storage_options_;
+  // The ids of the storages being created outside the lock, which count as
+  // taken. Guarded by `storages_lock_`.
+  std::unordered_set<uint32_t> reserved_ids_;
+  // Logs the changes to the tree storages; may be null.
+  std::unique_ptr<WriteAheadLog> log_;
+
+  // Set when a client asks the server to close.
+  bool closing_ = false;
+  std::mutex closing_lock_;
+  std::condition_variable closing_cv_;
+
+  grpc::Status AddStorage(uint32_t id,
+                          std::unique_ptr<BaseOramServerStorage> storage);
+  // Takes `id` for a storage whose creation opens files, so that a duplicate
+  // request is rejected before it touches the files of the live storage.
+  grpc::Status ReserveStorage(uint32_t id);
+  // Gives back a reserved id whose storage could not be created.
+  void ReleaseStorage(uint32_t id);
+  // Drops the storage under `id` unless it was replaced meanwhile.
+  void DropStorage(uint32_t id, const BaseOramServerStorage* const storage);
+  // Must be called with `storages_lock_` held.
   grpc::Status CheckInitRequest(uint32_t id);
   grpc::Status CheckIdValid(uint32_t id);
+  // Whether a streamed storage is still the one under `id`.
+  grpc::Status CheckStreamStorage(uint32_t id,
+                                  const BaseOramServerStorage* const storage);
+  BaseOramServerStorage* FindStorage(uint32_t id);
 
  public:
   grpc::Status InitTreeOram(grpc::ServerContext* context,
@@ -74,6 +119,24 @@ class OramService final : public oram_server::Service {
                          const WritePathRequest* request,
                          WritePathResponse* response) override;
 
+  grpc::Status ReadFullPath(grpc::ServerContext* context,
+                            const ReadPathRequest* request,
+                            ReadPathResponse* response) override;
+
+  grpc::Status WriteFullPath(grpc::ServerContext* context,
+                             const WriteFullPathRequest* request,
+                             WritePathResponse* response) override;
+
+  // The above complete through `finish` once the engine is done, possibly on
+  // another thread, so that the pollers do not wait for the disk.
+  void BeginReadFullPath(grpc::ServerContext* context,
+                         const ReadPathRequest* request,
+                         ReadPathResponse* response, const finish_fn_t& finish);
+  void BeginWriteFullPath(grpc::ServerContext* context,
+                          const WriteFullPathRequest* request,
+                          WritePathResponse* response,
+                          const finish_fn_t& finish);
+
   grpc::Status ReadFlatMemory(grpc::ServerContext* context,
                               const ReadFlatRequest* request,
                               FlatVectorMessage* response) override;
@@ -82,17 +145,57 @@ class OramService final : public oram_server::Service {
                                const FlatVectorMessage* request,
                                google::protobuf::Empty* empty) override;
 
+  grpc::Status ReadFlatStream(
+      grpc::ServerContext* context, const ReadFlatStreamRequest* request,
+      grpc::ServerWriter<FlatChunkMessage>* writer) override;
+
+  grpc::Status WriteFlatStream(grpc::ServerContext* context,
+                               grpc::ServerReader<FlatChunkMessage>* reader,
+                               google::protobuf::Empty* empty) override;
+
   grpc::Status ReadSqrtMemory(grpc::ServerContext* context,
                               const ReadSqrtRequest* request,
                               SqrtMessage* response) override;
 
+  grpc::Status ReadShelter(grpc::ServerContext* context,
+                           const ReadShelterRequest* request,
+                           ShelterMessage* response) override;
+
   grpc::Status WriteSqrtMemory(grpc::ServerContext* context,
                                const WriteSqrtMessage* request,
                                google::protobuf::Empty* empty) override;
 
-  grpc::Status SqrtPermute(grpc::ServerContext* context,
-                           const SqrtPermMessage* message,
-                           google::protobuf::Empty* empty) override;
+  grpc::Status SqrtShuffleControl(grpc::ServerContext* context,
+                                  const SqrtShuffleRequest* request,
+                                  google::protobuf::Empty* empty) override;
+
+  grpc::Status ReadSqrtRange(grpc::ServerContext* context,
+                             const ReadSqrtRangeRequest* request,
+                             SqrtRangeMessage* response) override;
+
+  grpc::Status WriteSqrtRange(grpc::ServerContext* context,
+                              const WriteSqrtRangeRequest* request,
+                              google::protobuf::Empty* empty) override;
+
+  grpc::Status InitLayeredOram(grpc::ServerContext* context,
+                               const InitLayeredOramRequest* request,
+                               google::protobuf::Empty* empty) override;
+
+  grpc::Status ReadLayeredBlocks(grpc::ServerContext* context,
+                                 const ReadLayeredRequest* request,
+                                 LayeredBlocksMessage* response) override;
+
+  grpc::Status WriteLayeredLevel(grpc::ServerContext* context,
+                                 const WriteLayeredRequest* request,
+                                 google::protobuf::Empty* empty) override;
+
+  grpc::Status WriteLayeredRange(grpc::ServerContext* context,
+                                 const WriteLayeredRangeRequest* request,
+                                 google::protobuf::Empty* empty) override;
+
+  grpc::Status LayeredLevelControl(grpc::ServerContext* context,
+                                   const LayeredControlRequest* request,
+                                   google::protobuf::Empty* empty) override;
 
   grpc::Status CloseConnection(grpc::ServerContext* context,
                                const google::protobuf::Empty* request,
@@ -113,23 +216,99 @@ class OramService final : public oram_server::Service {
   grpc::Status ResetServer(grpc::ServerContext* context,
                            const google::protobuf::Empty* request,
                            google::protobuf::Empty* response) override;
+
+  // Blocks until a client closes the connection.
+  void WaitForClose(void);
+  // Returns false if no client closes the connection within `timeout`.
+  bool WaitForClose(std::chrono::seconds timeout);
+
+  // Snapshots every storage into `dir` and removes the snapshots of the
+  // storages that are gone. Storages without snapshots are skipped.
+  OramStatus SaveSnapshots(const std::string& dir);
+  // Restores the storages from the snapshots in `dir`; must be called before
+  // the server starts. Broken snapshots are skipped.
+  OramStatus LoadSnapshots(const std::string& dir);
+  // Applies the write-ahead log on top of the snapshots.
+  OramStatus ReplayLog(size_t* const replayed);
+};
+
+// The unary methods are served from the completion queues of `ServerRunner`,
+// which invoke the handlers of `OramService`; the two streaming methods are
+// left to the synchronous thread pool of gRPC.
+using AsyncOramService = oram_server::WithAsyncMethod_InitTreeOram<
+    oram_server::WithAsyncMethod_InitFlatOram<
+    oram_server::WithAsyncMethod_InitSqrtOram<
+    oram_server::WithAsyncMethod_LoadSqrtOram<
+    oram_server::WithAsyncMethod_PrintOramTree<
+    oram_server::WithAsyncMethod_ReadPath<
+    oram_server::WithAsyncMethod_WritePath<
+    oram_server::WithAsyncMethod_ReadFullPath<
+    oram_server::WithAsyncMethod_WriteFullPath<
+    oram_server::WithAsyncMethod_ReadFlatMemory<
+    oram_server::WithAsyncMethod_WriteFlatMemory<
+    oram_server::WithAsyncMethod_ReadSqrtMemory<
+    oram_server::WithAsyncMethod_ReadShelter<
+    oram_server::WithAsyncMethod_WriteSqrtMemory<
+    oram_server::WithAsyncMethod_SqrtShuffleControl<
+    oram_server::WithAsyncMethod_ReadSqrtRange<
+    oram_server::WithAsyncMethod_WriteSqrtRange<
+    oram_server::WithAsyncMethod_InitLayeredOram<
+    oram_server::WithAsyncMethod_ReadLayeredBlocks<
+    oram_server::WithAsyncMethod_WriteLayeredLevel<
+    oram_server::WithAsyncMethod_WriteLayeredRange<
+    oram_server::WithAsyncMethod_LayeredLevelControl<
+    oram_server::WithAsyncMethod_CloseConnection<
+    oram_server::WithAsyncMethod_KeyExchange<
+    oram_server::WithAsyncMethod_SendHello<
+    oram_server::WithAsyncMethod_ReportServerInformation<
+    oram_server::WithAsyncMethod_ResetServer<
+    OramService>>>>>>>>>>>>>>>>>>>>>>>>>>>;
+
+struct ServerOptions {
+  // The number of threads polling the completion queues (0 = one per core).
+  size_t thread_num = 0;
+  // The maximum size of a message in bytes.
+  size_t max_message_size = 64 * 1024 * 1024;
+  // The memory quota in megabytes (0 = unlimited).
+  size_t memory_quota = 0;
+  // The maximum number of threads of gRPC (0 = unlimited).
+  size_t max_threads = 0;
+  // The directory of the snapshots of the storages (empty = no snapshots).
+  std::string snapshot_path;
+  // How often the snapshots are taken in seconds (0 = only at shutdown).
+  uint32_t snapshot_interval = 0;
+  // Log the write-backs to the tree storages next to the snapshots.
+  bool enable_wal = false;
+  WalSyncPolicy wal_sync_policy = WalSyncPolicy::kAlways;
 };
 
 class ServerRunner {
  private:
-  std::unique_ptr<OramService> service_;
+  std::unique_ptr<AsyncOramService> service_;
 
   // Networking configurations.
   std::string address_;
   uint32_t port_;
   std::shared_ptr<grpc::ServerCredentials> creds_;
+  ServerOptions options_;
 
   bool is_initialized;
 
+  // Arms a call for every unary method on the queue.
+  void ServeUnaryCalls(grpc::ServerCompletionQueue* const cq);
+  void Poll(grpc::ServerCompletionQueue* const cq);
+  void TakeSnapshots(void);
+
  public:
   ServerRunner(const std::string& address, uint32_t port,
                const std::string& key_path, const std::string& crt_path);
 
+  void SetTreeStorageOptions(const TreeStorageOptions& options) {
+    service_->tree_storage_options_ = options;
+  }
+
+  void SetServerOptions(const ServerOptions& options) { options_ = options; }
+
   void Run(void);
 };
 
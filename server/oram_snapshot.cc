@@ -0,0 +1,291 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "oram_snapshot.h"
+
+#include <fcntl.h>
+#include <spdlog/logger.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "base/oram_utils.h"
+#include "oram_storage.h"
+
+extern std::shared_ptr<spdlog::logger> logger;
+
+namespace oram_impl {
+static const uint64_t kSnapshotMagic = 0x50414e534d41524full;
+static const uint32_t kSnapshotVersion = 1;
+// The writes are issued in chunks of this size.
+static const size_t kSnapshotBufferSize = 1 << 20;
+
+static OramStatus SnapshotIOError(const std::string& what,
+                                  const std::string& path, int err,
+                                  const std::string& location) {
+  return OramStatus(
+      StatusCode::kFileIOError,
+      oram_utils::StrCat("Cannot ", what, " ", path, ": ", strerror(err)),
+      location);
+}
+
+OramStatus SnapshotWriter::Open(const std::string& path) {
+  path_ = path;
+  temp_path_ = oram_utils::StrCat(path, ".tmp");
+  fd_ = open(temp_path_.data(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+  if (fd_ == -1) {
+    return SnapshotIOError("create", temp_path_, errno, __func__);
+  }
+
+  crypto_generichash_init(&state_, nullptr, 0, crypto_generichash_BYTES);
+  buffer_.reserve(kSnapshotBufferSize);
+  status_ = OramStatus::OK;
+
+  return OramStatus::OK;
+}
+
+void SnapshotWriter::Flush(void) {
+  size_t written = 0;
+  while (status_.ok() && written < buffer_.size()) {
+    const ssize_t ret =
+        write(fd_, buffer_.data() + written, buffer_.size() - written);
+    if (ret == -1 && errno != EINTR) {
+      status_ = SnapshotIOError("write", temp_path_, errno, __func__);
+    } else if (ret > 0) {
+      written += ret;
+    }
+  }
+
+  buffer_.clear();
+}
+
+void SnapshotWriter::Write(const void* data, size_t size) {
+  if (!status_.ok()) {
+    return;
+  }
+
+  crypto_generichash_update(&state_, reinterpret_cast<const uint8_t*>(data),
+                            size);
+  buffer_.append(reinterpret_cast<const char*>(data), size);
+  if (buffer_.size() >= kSnapshotBufferSize) {
+    Flush();
+  }
+}
+
+void SnapshotWriter::WriteString(const std::string& value) {
+  WriteValue<uint64_t>(value.size());
+  Write(value.data(), value.size());
+}
+
+OramStatus SnapshotWriter::Commit(void) {
+  uint8_t sum[crypto_generichash_BYTES];
+  crypto_generichash_final(&state_, sum, sizeof(sum));
+  if (status_.ok()) {
+    buffer_.append(reinterpret_cast<const char*>(sum), sizeof(sum));
+    Flush();
+  }
+
+  if (status_.ok() && fsync(fd_) != 0) {
+    status_ = SnapshotIOError("sync", temp_path_, errno, __func__);
+  }
+  close(fd_);
+  fd_ = -1;
+
+  if (status_.ok() && rename(temp_path_.data(), path_.data()) != 0) {
+    status_ = SnapshotIOError("rename", temp_path_, errno, __func__);
+  }
+  if (!status_.ok()) {
+    unlink(temp_path_.data());
+    return status_;
+  }
+
+  // Persist the rename as well.
+  const size_t slash = path_.rfind('/');
+  const std::string dir =
+      slash == std::string::npos ? "." : path_.substr(0, slash + 1);
+  const int dir_fd = open(dir.data(), O_RDONLY | O_DIRECTORY);
+  if (dir_fd != -1) {
+    fsync(dir_fd);
+    close(dir_fd);
+  }
+
+  return OramStatus::OK;
+}
+
+SnapshotWriter::~SnapshotWriter() {
+  // Abandoned before committed.
+  if (fd_ != -1) {
+    close(fd_);
+    unlink(temp_path_.data());
+  }
+}
+
+OramStatus SnapshotReader::Open(const std::string& path) {
+  fd_ = open(path.data(), O_RDONLY);
+  if (fd_ == -1) {
+    return SnapshotIOError("open", path, errno, __func__);
+  }
+
+  struct stat file_stat;
+  if (fstat(fd_, &file_stat) != 0) {
+    return SnapshotIOError("stat", path, errno, __func__);
+  }
+  size_ = file_stat.st_size;
+  if (size_ < crypto_generichash_BYTES) {
+    return OramStatus(StatusCode::kInvalidArgument,
+                      oram_utils::StrCat(path, " is truncated."), __func__);
+  }
+
+  void* const base = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+  if (base == MAP_FAILED) {
+    return SnapshotIOError("map", path, errno, __func__);
+  }
+  base_ = reinterpret_cast<const uint8_t*>(base);
+  madvise(base, size_, MADV_SEQUENTIAL);
+
+  limit_ = size_ - crypto_generichash_BYTES;
+  uint8_t sum[crypto_generichash_BYTES];
+  crypto_generichash(sum, sizeof(sum), base_, limit_, nullptr, 0);
+  if (memcmp(sum, base_ + limit_, sizeof(sum)) != 0) {
+    return OramStatus(StatusCode::kInvalidArgument,
+                      oram_utils::StrCat(path, " is corrupted."), __func__);
+  }
+
+  return OramStatus::OK;
+}
+
+bool SnapshotReader::Read(void* const data, size_t size) {
+  if (size > limit_ - cursor_) {
+    return false;
+  }
+
+  memcpy(data, base_ + cursor_, size);
+  cursor_ += size;
+  return true;
+}
+
+bool SnapshotReader::ReadString(std::string* const value) {
+  uint64_t size;
+  if (!ReadValue(&size) || size > limit_ - cursor_) {
+    return false;
+  }
+
+  value->assign(reinterpret_cast<const char*>(base_ + cursor_), size);
+  cursor_ += size;
+  return true;
+}
+
+SnapshotReader::~SnapshotReader() {
+  if (base_ != nullptr) {
+    munmap(const_cast<uint8_t*>(base_), size_);
+  }
+  if (fd_ != -1) {
+    close(fd_);
+  }
+}
+
+OramStatus SaveSnapshot(BaseOramServerStorage* const storage,
+                        const std::string& path) {
+  SnapshotWriter writer;
+  OramStatus status = writer.Open(path);
+  if (!status.ok()) {
+    return status;
+  }
+
+  writer.WriteValue(kSnapshotMagic);
+  writer.WriteValue(kSnapshotVersion);
+  writer.WriteValue(static_cast<uint32_t>(storage->GetOramStorageType()));
+  writer.WriteValue<uint32_t>(storage->GetId());
+  writer.WriteValue<uint64_t>(storage->GetCapacity());
+  writer.WriteValue<uint64_t>(storage->GetBlockSize());
+  writer.WriteString(storage->GetInstanceHash());
+
+  status = storage->WriteSnapshot(&writer);
+  if (!status.ok()) {
+    return status;
+  }
+
+  return writer.Commit();
+}
+
+OramStatus LoadSnapshot(const std::string& path,
+                        const TreeStorageOptions& options,
+                        std::unique_ptr<BaseOramServerStorage>* const out) {
+  SnapshotReader reader;
+  OramStatus status = reader.Open(path);
+  if (!status.ok()) {
+    return status;
+  }
+
+  uint64_t magic;
+  uint32_t version;
+  uint32_t type;
+  uint32_t id;
+  uint64_t capacity;
+  uint64_t block_size;
+  std::string instance_hash;
+  if (!reader.ReadValue(&magic) || !reader.ReadValue(&version) ||
+      magic != kSnapshotMagic) {
+    return OramStatus(StatusCode::kInvalidArgument,
+                      oram_utils::StrCat(path, " is not a snapshot."),
+                      __func__);
+  } else if (version != kSnapshotVersion) {
+    return OramStatus(StatusCode::kVersionMismatch,
+                      oram_utils::StrCat("Unsupported snapshot version ",
+                                         version, " of ", path),
+                      __func__);
+  } else if (!reader.ReadValue(&type) || !reader.ReadValue(&id) ||
+             !reader.ReadValue(&capacity) || !reader.ReadValue(&block_size) ||
+             !reader.ReadString(&instance_hash)) {
+    return OramStatus(StatusCode::kInvalidArgument,
+                      oram_utils::StrCat(path, " is truncated."), __func__);
+  }
+
+  switch (static_cast<OramStorageType>(type)) {
+    case OramStorageType::kTreeStorage:
+      status = TreeOramServerStorage::ReadSnapshot(
+          &reader, id, capacity, block_size, instance_hash, options, out);
+      break;
+    case OramStorageType::kFlatStorage:
+      status = FlatOramServerStorage::ReadSnapshot(
+          &reader, id, capacity, block_size, instance_hash, out);
+      break;
+    case OramStorageType::kSqrtStorage:
+      status = SqrtOramServerStorage::ReadSnapshot(
+          &reader, id, capacity, block_size, instance_hash, out);
+      break;
+    default:
+      status = OramStatus(StatusCode::kInvalidArgument,
+                          "Unknown storage type.", __func__);
+  }
+
+  if (status.ok() && !reader.Exhausted()) {
+    status = OramStatus(StatusCode::kInvalidArgument,
+                        "Trailing bytes after the storage.", __func__);
+  }
+  if (!status.ok()) {
+    out->reset();
+    return status.Append(OramStatus(
+        StatusCode::kInvalidArgument,
+        oram_utils::StrCat("Cannot load ", path), __func__));
+  }
+
+  return OramStatus::OK;
+}
+}  // namespace oram_impl
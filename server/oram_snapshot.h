@@ -0,0 +1,107 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef ORAM_IMPL_SERVER_ORAM_SNAPSHOT_H_
+#define ORAM_IMPL_SERVER_ORAM_SNAPSHOT_H_
+
+#include <sodium.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "base/oram_status.h"
+#include "tree_storage_engine.h"
+
+namespace oram_impl {
+class BaseOramServerStorage;
+
+// A snapshot is the image of one storage in a file:
+//
+// | magic | version | type | id | capacity | block size | hash | body | sum |
+//
+// where the body is written by the storage and the sum is the BLAKE2b digest
+// of everything before it. The file is written aside and renamed into place,
+// so a crash never leaves a torn snapshot behind.
+class SnapshotWriter {
+  std::string path_;
+  std::string temp_path_;
+  int fd_;
+  std::string buffer_;
+  crypto_generichash_state state_;
+  OramStatus status_;
+
+  void Flush(void);
+
+ public:
+  SnapshotWriter() : fd_(-1) {}
+
+  OramStatus Open(const std::string& path);
+  // Errors are sticky and reported by `Commit`.
+  void Write(const void* data, size_t size);
+  template <typename T>
+  void WriteValue(const T& value) {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Only plain values can be written.");
+    Write(&value, sizeof(T));
+  }
+  void WriteString(const std::string& value);
+  // Appends the sum and atomically replaces the snapshot at `path`.
+  OramStatus Commit(void);
+
+  ~SnapshotWriter();
+};
+
+// Maps a snapshot and verifies its sum before anything is read.
+class SnapshotReader {
+  int fd_;
+  const uint8_t* base_;
+  size_t size_;
+  // The end of the body.
+  size_t limit_;
+  size_t cursor_;
+
+ public:
+  SnapshotReader() : fd_(-1), base_(nullptr), size_(0), limit_(0), cursor_(0) {}
+
+  OramStatus Open(const std::string& path);
+  // All return false if the body is exhausted.
+  bool Read(void* const data, size_t size);
+  template <typename T>
+  bool ReadValue(T* const value) {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Only plain values can be read.");
+    return Read(value, sizeof(T));
+  }
+  bool ReadString(std::string* const value);
+  bool Exhausted(void) const { return cursor_ == limit_; }
+
+  ~SnapshotReader();
+};
+
+// Writes the snapshot of `storage` to `path`. The storage keeps serving
+// requests meanwhile.
+OramStatus SaveSnapshot(BaseOramServerStorage* const storage,
+                        const std::string& path);
+// Recreates a storage from the snapshot at `path`; tree storages are laid out
+// by `options`.
+OramStatus LoadSnapshot(const std::string& path,
+                        const TreeStorageOptions& options,
+                        std::unique_ptr<BaseOramServerStorage>* const out);
+}  // namespace oram_impl
+
+#endif  // ORAM_IMPL_SERVER_ORAM_SNAPSHOT_H_
@@ -19,6 +19,7 @@
 
 #include "base_oram_storage.h"
 #include "flat_oram_storage.h"
+#include "layered_oram_storage.h"
 #include "tree_oram_storage.h"
 #include "sqrt_oram_storage.h"
 
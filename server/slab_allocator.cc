@@ -0,0 +1,65 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "slab_allocator.h"
+
+#include "base/oram_utils.h"
+
+namespace oram_impl {
+SlabAllocator::SlabAllocator(size_t max_slot_size)
+    : max_slot_size_(max_slot_size),
+      classes_(ClassOf(max_slot_size) + 1),
+      slab_bytes_(0) {
+  for (auto& size_class : classes_) {
+    size_class.unused = 0;
+  }
+}
+
+uint8_t* SlabAllocator::Allocate(size_t size) {
+  PANIC_IF(size == 0 || size > max_slot_size_,
+           "The slot is larger than the slab allows.");
+
+  const size_t slot_size = SlotSize(size);
+  std::lock_guard<std::mutex> guard(lock_);
+  SizeClass& size_class = classes_[ClassOf(size)];
+
+  if (!size_class.free_slots.empty()) {
+    uint8_t* const slot = size_class.free_slots.back();
+    size_class.free_slots.pop_back();
+    return slot;
+  }
+
+  if (size_class.unused == 0) {
+    const size_t slots = SlotsPerSlab(slot_size);
+    size_class.slabs.emplace_back(new uint8_t[slots * slot_size]);
+    size_class.unused = slots;
+    slab_bytes_ += slots * slot_size;
+  }
+
+  // Carved from the end of the last slab.
+  return size_class.slabs.back().get() + --size_class.unused * slot_size;
+}
+
+void SlabAllocator::Free(uint8_t* const slot, size_t size) {
+  std::lock_guard<std::mutex> guard(lock_);
+  classes_[ClassOf(size)].free_slots.emplace_back(slot);
+}
+
+size_t SlabAllocator::ReportBytes(void) const {
+  std::lock_guard<std::mutex> guard(lock_);
+  return slab_bytes_;
+}
+}  // namespace oram_impl
@@ -0,0 +1,75 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef ORAM_IMPL_SERVER_SLAB_ALLOCATOR_H_
+#define ORAM_IMPL_SERVER_SLAB_ALLOCATOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace oram_impl {
+// Hands out slots of a few fixed sizes (multiples of `kSlabGranularity`)
+// carved from large slabs. Freed slots go to the free list of their size and
+// are never returned to the heap, so a long-running server neither calls the
+// allocator of the heap per block nor fragments it.
+class SlabAllocator {
+  struct SizeClass {
+    std::vector<std::unique_ptr<uint8_t[]>> slabs;
+    // The slots not carved from the last slab yet.
+    size_t unused;
+    std::vector<uint8_t*> free_slots;
+  };
+
+  static constexpr size_t kSlabGranularity = 64;
+  static constexpr size_t kSlabBytes = 1 << 20;
+
+  const size_t max_slot_size_;
+  std::vector<SizeClass> classes_;
+  size_t slab_bytes_;
+  // Slots are rarely taken or returned once the storage is warm.
+  mutable std::mutex lock_;
+
+  size_t ClassOf(size_t size) const {
+    return (size + kSlabGranularity - 1) / kSlabGranularity - 1;
+  }
+  size_t SlotsPerSlab(size_t slot_size) const {
+    return slot_size >= kSlabBytes ? 1 : kSlabBytes / slot_size;
+  }
+
+ public:
+  explicit SlabAllocator(size_t max_slot_size);
+
+  SlabAllocator(const SlabAllocator&) = delete;
+  SlabAllocator& operator=(const SlabAllocator&) = delete;
+
+  // The size of the slot that holds `size` bytes.
+  size_t SlotSize(size_t size) const {
+    return (ClassOf(size) + 1) * kSlabGranularity;
+  }
+  // `size` is between 1 and `max_slot_size`.
+  uint8_t* Allocate(size_t size);
+  // `size` is the one the slot was allocated for.
+  void Free(uint8_t* const slot, size_t size);
+
+  // The memory of the slabs in bytes.
+  size_t ReportBytes(void) const;
+};
+}  // namespace oram_impl
+
+#endif  // ORAM_IMPL_SERVER_SLAB_ALLOCATOR_H_
@@ -26,72 +26,125 @@ namespace oram_impl {
 bool SqrtOramServerStorage::Check(uint32_t pos, uint32_t type) {
   switch (type) {
     case 0:
-      return true;
+      return pos < shelter_.size();
 
     case 1:
-      return pos <= main_memory_.size() + dummy_.size();
+      return pos < memory_.Size();
 
     case 2:
-      return true;
+      return (size_t)pos + capacity_ < memory_.Size();
 
     default:
       return false;
   }
 }
 
-void SqrtOramServerStorage::DoPermute(const std::vector<uint32_t>& perm) {
-  PANIC_IF(perm.size() != main_memory_.size() + dummy_.size(),
-           "The permutation size is wrong!");
-
-  // Server needs to reconstruct the memory layout. In short, it has two tasks:
-  //    1. Update the memory using shelter's information. Since we have stored
-  //       tag information in the shelter, we can easily update the main memory.
-  //    2. Permute the main memory according to the uploaded data provided by
-  //       the client.
+BlockArena* SqrtOramServerStorage::Area(uint32_t area) {
+  switch (area) {
+    case kSqrtMemoryArea:
+      return &memory_;
+    case kSqrtTempArea:
+      return &temp_;
+    case kSqrtNextArea:
+      return &next_;
+    default:
+      return nullptr;
+  }
+}
 
-  // Step 1: Update the memory.
+void SqrtOramServerStorage::MergeShelter(void) {
+  // Update the memory using shelter's information. Since we have stored tag
+  // information in the shelter, we can easily update the main memory. The tags
+  // have already been revealed by the accesses.
   for (size_t i = 0; i < shelter_.size(); i++) {
     const uint32_t tag = shelter_[i].first;
-    const std::string data = shelter_[i].second;
-
-    if (tag != kInvalidMask && !data.empty()) {
-      // Check which one should we update.
-      if (tag < main_memory_.size()) {
-        main_memory_[tag] = data;
-      } else {
-        dummy_[tag - main_memory_.size()] = data;
-      }
+
+    if (tag != kInvalidMask && !shelter_[i].second.empty()) {
+      // Both have been checked by `WriteBlockToShelter`.
+      memory_.Set(tag, shelter_[i].second);
     }
 
     // Clear the shelter.
     shelter_[i] = std::make_pair(kInvalidMask, "");
   }
+}
+
+// The permutation itself is done by the client which streams the memory
+// through the temporary area; see `SquareRootOramController::Shuffle`.
+void SqrtOramServerStorage::BeginShuffle(size_t temp_size, bool background) {
+  if (background) {
+    next_.Assign(memory_.Size(), block_size_);
+  } else {
+    MergeShelter();
+  }
+  temp_.Assign(temp_size, block_size_);
+}
 
-  // Step 2: Permute the memory.
-  // This permutation is done at the tag level.
-  std::vector<std::string> assembled_arr = main_memory_;
-  assembled_arr.insert(assembled_arr.end(), dummy_.begin(), dummy_.end());
-  oram_utils::PermuteBy(perm, assembled_arr);
+void SqrtOramServerStorage::EndShuffle(void) {
+  // Release the memory.
+  temp_.Release();
+}
+
+void SqrtOramServerStorage::SwapNext(void) {
+  PANIC_IF(next_.Size() != memory_.Size(),
+           "There is no next memory to swap in!");
+
+  // The client has folded the shelter into the next memory already.
+  memory_.Swap(next_);
+  for (auto& slot : shelter_) {
+    slot = std::make_pair(kInvalidMask, "");
+  }
 
-  // Copy it back.
-  for (size_t i = 0; i < assembled_arr.size(); i++) {
-    if (i < main_memory_.size()) {
-      main_memory_[i] = assembled_arr[i];
-    } else {
-      dummy_[i - main_memory_.size()] = assembled_arr[i];
+  // Release the memory.
+  next_.Release();
+  temp_.Release();
+}
+
+bool SqrtOramServerStorage::ReadRange(uint32_t area, uint32_t offset,
+                                      uint32_t length,
+                                      std::vector<std::string>* const out) {
+  const BlockArena* const arena = Area(area);
+  if (arena == nullptr || (size_t)offset + length > arena->Size()) {
+    return false;
+  }
+
+  for (size_t i = offset; i < (size_t)offset + length; i++) {
+    out->emplace_back(arena->Get(i));
+  }
+
+  return true;
+}
+
+bool SqrtOramServerStorage::WriteRange(
+    uint32_t area, uint32_t offset,
+    const google::protobuf::RepeatedPtrField<std::string>& contents) {
+  BlockArena* const arena = Area(area);
+  if (arena == nullptr || (size_t)offset + contents.size() > arena->Size()) {
+    return false;
+  }
+
+  for (int i = 0; i < contents.size(); i++) {
+    if (!arena->Set(offset + i, contents.Get(i))) {
+      return false;
     }
   }
+
+  return true;
 }
 
-void SqrtOramServerStorage::WriteBlockToShelter(uint32_t tag,
+bool SqrtOramServerStorage::WriteBlockToShelter(uint32_t tag,
                                                 const std::string& data) {
+  if (tag >= memory_.Size() || data.size() != block_size_) {
+    return false;
+  }
+
   // Scan and find an available space.
   for (size_t i = 0; i < shelter_.size(); i++) {
     if (shelter_[i].second.empty() && shelter_[i].first == kInvalidMask) {
       shelter_[i].first = tag;
       shelter_[i].second = data;
 
-      return;
+      return true;
     }
   }
 
@@ -105,30 +158,113 @@ std::string SqrtOramServerStorage::ReadBlockFromShelter(uint32_t pos) {
   return ans;
 }
 
-std::string SqrtOramServerStorage::ReadBlockFromMain(uint32_t pos) {
-  if (pos < main_memory_.size()) {
-    return main_memory_[pos];
-  } else {
-    return ReadBlockFromDummy(pos - main_memory_.size());
+std::vector<std::string> SqrtOramServerStorage::ReadShelter(void) const {
+  // The shelter is append-only within an epoch; a block written again lands in
+  // a later slot, and `MergeShelter` applies the slots in order, so nothing
+  // needs to be removed here.
+  std::vector<std::string> ans;
+  ans.reserve(shelter_.size());
+  for (const auto& slot : shelter_) {
+    ans.emplace_back(slot.second);
   }
+
+  return ans;
+}
+
+std::string SqrtOramServerStorage::ReadBlockFromMain(uint32_t pos) {
+  // The dummies follow the main memory.
+  return memory_.Get(pos);
 }
 
 std::string SqrtOramServerStorage::ReadBlockFromDummy(uint32_t pos) {
   // It is meaningless to remove a block from dummy. So we keep it.
-  // There is no offset anymore.
-  return dummy_[pos];
-}
-
-void SqrtOramServerStorage::Fill(const std::vector<std::string>& data) {
-  for (size_t i = 0; i < data.size(); i++) {
-    if (i < capacity_) {
-      main_memory_.emplace_back(data[i]);
-    } else {
-      dummy_.emplace_back(data[i]);
-      // Initialize the shelter.
-      shelter_.emplace_back(std::make_pair(kInvalidMask, ""));
+  return memory_.Get(capacity_ + pos);
+}
+
+bool SqrtOramServerStorage::Fill(
+    const google::protobuf::RepeatedPtrField<std::string>& data) {
+  if ((size_t)data.size() < capacity_) {
+    return false;
+  }
+
+  memory_.Assign(data.size(), block_size_);
+  for (int i = 0; i < data.size(); i++) {
+    if (!memory_.Set(i, data.Get(i))) {
+      return false;
     }
   }
+
+  // Initialize the shelter: one slot per dummy.
+  shelter_.assign(data.size() - capacity_, std::make_pair(kInvalidMask, ""));
+
+  return true;
+}
+
+OramStatus SqrtOramServerStorage::WriteSnapshot(SnapshotWriter* const writer) {
+  // The copies share the blocks with the storage, which clones a chunk only
+  // when it writes to it before the snapshot is done. They are dropped under
+  // the lock, as the storage checks under it if a chunk is still shared.
+  BlockArena memory;
+  BlockArena temp;
+  BlockArena next;
+  server_sqrt_shelter_t shelter;
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    memory.CopyFrom(memory_);
+    temp.CopyFrom(temp_);
+    next.CopyFrom(next_);
+    shelter = shelter_;
+  }
+
+  writer->WriteValue<uint64_t>(squared_m_);
+  memory.WriteSnapshot(writer);
+  temp.WriteSnapshot(writer);
+  next.WriteSnapshot(writer);
+  writer->WriteValue<uint64_t>(shelter.size());
+  for (const auto& slot : shelter) {
+    writer->WriteValue(slot.first);
+    writer->WriteString(slot.second);
+  }
+
+  std::lock_guard<std::mutex> guard(lock_);
+  memory.Release();
+  temp.Release();
+  next.Release();
+
+  return OramStatus::OK;
 }
 
-}  // namespace oram_impl
\ No newline at end of file
+OramStatus SqrtOramServerStorage::ReadSnapshot(
+    SnapshotReader* const reader, uint32_t id, size_t capacity,
+    size_t block_size, const std::string& instance_hash,
+    std::unique_ptr<BaseOramServerStorage>* const out) {
+  const OramStatus truncated(StatusCode::kInvalidArgument,
+                             "The sqrt storage is truncated.", __func__);
+
+  uint64_t squared_m;
+  if (!reader->ReadValue(&squared_m)) {
+    return truncated;
+  }
+
+  std::unique_ptr<SqrtOramServerStorage> storage =
+      std::make_unique<SqrtOramServerStorage>(id, capacity, block_size,
+                                              squared_m, instance_hash);
+  uint64_t shelter_size;
+  if (!storage->memory_.ReadSnapshot(reader) ||
+      !storage->temp_.ReadSnapshot(reader) ||
+      !storage->next_.ReadSnapshot(reader) ||
+      !reader->ReadValue(&shelter_size)) {
+    return truncated;
+  }
+
+  storage->shelter_.resize(shelter_size);
+  for (auto& slot : storage->shelter_) {
+    if (!reader->ReadValue(&slot.first) || !reader->ReadString(&slot.second)) {
+      return truncated;
+    }
+  }
+
+  *out = std::move(storage);
+  return OramStatus::OK;
+}
+}  // namespace oram_impl
@@ -17,18 +17,32 @@
 #ifndef ORAM_IMPL_SERVER_SQRT_ORAM_STORAGE_H_
 #define ORAM_IMPL_SERVER_SQRT_ORAM_STORAGE_H_
 
+#include <google/protobuf/repeated_field.h>
+
+#include <memory>
+
 #include "base_oram_storage.h"
+#include "block_arena.h"
+#include "oram_snapshot.h"
 
 namespace oram_impl {
 class SqrtOramServerStorage : public BaseOramServerStorage {
-  server_sqrt_storage_t main_memory_;
+  // The permuted memory: m blocks of main memory followed by \sqrt{m} dummies.
+  BlockArena memory_;
   // Shelter is a vector of [tag, data]. The tag field is used to track the
   // blocks in the main memory in case we need to update them.
   server_sqrt_shelter_t shelter_;
-  server_sqrt_storage_t dummy_;
+  // The scratch space of the oblivious shuffle; only allocated during it.
+  BlockArena temp_;
+  // The memory of the next epoch if the shuffle runs in the background.
+  BlockArena next_;
 
   size_t squared_m_;
 
+  // Returns nullptr if there is no such area.
+  BlockArena* Area(uint32_t area);
+  void MergeShelter(void);
+
  public:
   SqrtOramServerStorage(uint32_t id, size_t capacity, size_t block_size,
                         size_t squared_m, const std::string& instance_hash)
@@ -38,11 +52,35 @@ class SqrtOramServerStorage : public BaseOramServerStorage {
   bool Check(uint32_t pos, uint32_t type);
   // Position may need to "shrink to fit".
   std::string ReadBlockFromShelter(uint32_t pos);
+  // Returns all the slots of the shelter without removing them.
+  std::vector<std::string> ReadShelter(void) const;
   std::string ReadBlockFromMain(uint32_t pos);
   std::string ReadBlockFromDummy(uint32_t pos);
-  void WriteBlockToShelter(uint32_t tag, const std::string& data);
-  void Fill(const std::vector<std::string>& data);
-  void DoPermute(const std::vector<uint32_t>& perm);
+  // Returns false if the tag or the size of the block is invalid.
+  bool WriteBlockToShelter(uint32_t tag, const std::string& data);
+  // Returns false if any of the blocks is not of the block size.
+  bool Fill(const google::protobuf::RepeatedPtrField<std::string>& data);
+
+  // A background shuffle leaves the memory and the shelter untouched.
+  void BeginShuffle(size_t temp_size, bool background);
+  void EndShuffle(void);
+  // Ends a background shuffle.
+  void SwapNext(void);
+  // Both return false if any of the slots is out of the area (or, for writes,
+  // any of the blocks is not of the block size).
+  bool ReadRange(uint32_t area, uint32_t offset, uint32_t length,
+                 std::vector<std::string>* const out);
+  bool WriteRange(
+      uint32_t area, uint32_t offset,
+      const google::protobuf::RepeatedPtrField<std::string>& contents);
+
+  // The areas are shared copy-on-write with the snapshot, which is written
+  // outside the lock of the storage.
+  virtual OramStatus WriteSnapshot(SnapshotWriter* const writer) override;
+  static OramStatus ReadSnapshot(
+      SnapshotReader* const reader, uint32_t id, size_t capacity,
+      size_t block_size, const std::string& instance_hash,
+      std::unique_ptr<BaseOramServerStorage>* const out);
 };
 }  // namespace oram_impl
 
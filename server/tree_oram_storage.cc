@@ -18,6 +18,9 @@
 
 #include <spdlog/logger.h>
 
+#include <algorithm>
+#include <future>
+
 #include "base/oram_utils.h"
 
 extern std::shared_ptr<spdlog::logger> logger;
@@ -29,60 +32,39 @@ TreeOramServerStorage::TreeOramServerStorage(uint32_t id, size_t capacity,
                                              const std::string& instance_hash)
     : BaseOramServerStorage(id, capacity, block_size, instance_hash,
                             OramStorageType::kTreeStorage),
-      bucket_size_(bucket_size) {
+      bucket_size_(bucket_size),
+      log_(nullptr),
+      snapshotting_(false) {
   level_ = std::ceil(LOG_BASE(capacity_ + 1, 2)) - 1;
 
   DBG(logger, "level = {}, capacity = {}", level_, capacity);
+}
 
-  for (uint32_t i = 0; i <= level_; i++) {
-    // Initialize dummy blocks into the storage.
-    const uint32_t cur_size = POW2(i);
-
-    for (uint32_t j = 0; j < cur_size; j++) {
-      const server_storage_tag_t tag = std::make_pair(i, j);
-      server_storage_data data;
-      storage_[tag] = data;
-    }
-  }
+OramStatus TreeOramServerStorage::Open(const TreeStorageOptions& options) {
+  // A complete tree with `level_ + 1` levels.
+  return CreateTreeStorageEngine(options, id_, instance_hash_,
+                                 POW2(level_ + 1) - 1, bucket_size_,
+                                 &storage_);
 }
 
 OramStatus TreeOramServerStorage::ReadPath(uint32_t level, uint32_t path,
                                            p_oram_bucket_t* const out_bucket) {
   // The offset should be calculated by the level and path.
   const uint32_t offset = std::floor(path * 1. / POW2(level_ - level));
-  const server_storage_tag_t tag = std::make_pair(level, offset);
   INFO(logger, "Read offset {} at level {} for path {}.", offset, level, path);
 
-  auto iter = storage_.find(tag);
-  if (iter == storage_.end()) {
-    // Not found.
-    return OramStatus(StatusCode::kObjectNotFound, "Cannot find the bucket.",
-                      __func__);
-  } else {
-    for (auto& data : iter->second) {
-      if (!data.empty()) {
-        // Decompress the data.
-        oram_block_t block;
-        size_t size;
-
-        OramStatus status = oram_utils::DataDecompress(
-            reinterpret_cast<const uint8_t*>(data.data()), data.size(),
-            reinterpret_cast<uint8_t*>(&block), &size);
-        if (!status.ok()) {
-          return status.Append(OramStatus(StatusCode::kInvalidOperation,
-                                          "Cannot Read from the server",
-                                          __func__));
-        }
-
-        out_bucket->emplace_back(block);
-
-        // Clear the data.
-        data.clear();
-      }
-    }
-
-    return OramStatus::OK;
+  const size_t index = BucketIndex(level, offset);
+  bucket_guard_t guard = LockBuckets({index});
+  OramStatus status = PreserveBuckets({index});
+  if (status.ok()) {
+    status = storage_->TakeBucket(index, out_bucket);
   }
+  if (!status.ok()) {
+    return status.Append(OramStatus(StatusCode::kInvalidOperation,
+                                    "Cannot Read from the server", __func__));
+  }
+
+  return OramStatus::OK;
 }
 
 OramStatus TreeOramServerStorage::WritePath(uint32_t level, uint32_t path,
@@ -96,62 +78,327 @@ OramStatus TreeOramServerStorage::AccurateWritePath(
     uint32_t level, uint32_t offset, const p_oram_bucket_t& in_bucket,
     oram_impl::Type type) {
   INFO(logger, "Write offset {} at level {}. ", offset, level);
-  const server_storage_tag_t tag = std::make_pair(level, offset);
 
-  auto iter = storage_.find(tag);
-  uint8_t buf[DEFAULT_COMPRESSED_BUF_SIZE];
+  // Every bucket is written once on initialization, so both types replace
+  // the bucket. This also lets a restored storage be initialized again.
+  const size_t index = BucketIndex(level, offset);
+  bucket_guard_t guard = LockBuckets({index});
+  OramStatus status = PreserveBuckets({index});
+  // Logged under the stripe, so that the log orders the writes to a bucket
+  // as they are applied.
+  if (status.ok() && log_ != nullptr) {
+    status = log_->AppendBucket(id_, index, in_bucket);
+  }
+  if (status.ok()) {
+    status = storage_->PutBucket(index, in_bucket);
+  }
+  if (!status.ok()) {
+    return status.Append(OramStatus(StatusCode::kInvalidOperation,
+                                    "Cannot write to the server", __func__));
+  }
 
-  if (type == oram_impl::Type::kInit) {
-    for (size_t i = 0; i < in_bucket.size(); i++) {
-      size_t compressed_size;
-      OramStatus status = oram_utils::DataCompress(
-          (uint8_t*)(&in_bucket[i]), ORAM_BLOCK_SIZE, buf, &compressed_size);
+  return OramStatus::OK;
+}
 
-      if (!status.ok()) {
-        return status.Append(OramStatus(StatusCode::kInvalidOperation,
-                                        "Cannot write to the server",
-                                        __func__));
-      }
+void TreeOramServerStorage::StripeLock::lock(void) {
+  std::unique_lock<std::mutex> guard(lock_);
+  released_.wait(guard, [this]() { return !held_; });
+  held_ = true;
+}
 
-      iter->second.emplace_back(
-          std::string(reinterpret_cast<const char*>(buf), compressed_size));
-    }
+void TreeOramServerStorage::StripeLock::unlock(void) {
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    held_ = false;
+  }
+  released_.notify_one();
+}
+
+TreeOramServerStorage::bucket_guard_t TreeOramServerStorage::LockBuckets(
+    const std::vector<size_t>& indices) const {
+  std::vector<size_t> stripes;
+  for (size_t index : indices) {
+    stripes.emplace_back(index % kBucketStripes);
+  }
+  std::sort(stripes.begin(), stripes.end());
+  stripes.erase(std::unique(stripes.begin(), stripes.end()), stripes.end());
+
+  bucket_guard_t guard;
+  for (size_t stripe : stripes) {
+    guard.emplace_back(stripes_[stripe]);
+  }
+
+  return guard;
+}
+
+TreeOramServerStorage::bucket_guard_t TreeOramServerStorage::LockAllBuckets(
+    void) const {
+  bucket_guard_t guard;
+  for (auto& stripe : stripes_) {
+    guard.emplace_back(stripe);
+  }
+
+  return guard;
+}
 
+OramStatus TreeOramServerStorage::CopyBucket(size_t index,
+                                             p_oram_bucket_t* const out) {
+  OramStatus status = storage_->TakeBucket(index, out);
+  if (status.ok()) {
+    status = storage_->PutBucket(index, *out);
+  }
+
+  return status;
+}
+
+OramStatus TreeOramServerStorage::PreserveBuckets(
+    const std::vector<size_t>& indices) {
+  if (!snapshotting_) {
     return OramStatus::OK;
   }
 
-  if (iter == storage_.end() && type == oram_impl::Type::kNormal) {
-    // Not found.
-    return OramStatus(StatusCode::kObjectNotFound, "Cannot find the bucket.",
+  for (size_t index : indices) {
+    if (captured_[index] != 0) {
+      continue;
+    }
+
+    p_oram_bucket_t bucket;
+    OramStatus status = CopyBucket(index, &bucket);
+    if (!status.ok()) {
+      return status;
+    }
+
+    captured_[index] = 1;
+    std::lock_guard<std::mutex> guard(preserved_lock_);
+    preserved_.emplace(index, std::move(bucket));
+  }
+
+  return OramStatus::OK;
+}
+
+OramStatus TreeOramServerStorage::WriteSnapshot(SnapshotWriter* const writer) {
+  std::lock_guard<std::mutex> snapshot_guard(snapshot_lock_);
+  const size_t bucket_num = storage_->GetBucketNum();
+  {
+    bucket_guard_t guard = LockAllBuckets();
+    captured_.assign(bucket_num, 0);
+    snapshotting_ = true;
+  }
+
+  writer->WriteValue<uint64_t>(bucket_size_);
+  writer->WriteValue<uint64_t>(bucket_num);
+
+  OramStatus status = OramStatus::OK;
+  p_oram_bucket_t bucket;
+  for (size_t index = 0; index < bucket_num && status.ok(); index++) {
+    bucket.clear();
+    {
+      bucket_guard_t guard = LockBuckets({index});
+      if (captured_[index] != 0) {
+        std::lock_guard<std::mutex> preserved_guard(preserved_lock_);
+        auto iter = preserved_.find(index);
+        bucket = std::move(iter->second);
+        preserved_.erase(iter);
+      } else {
+        status = CopyBucket(index, &bucket);
+        captured_[index] = 1;
+      }
+    }
+
+    writer->WriteValue<uint32_t>(bucket.size());
+    writer->Write(bucket.data(), bucket.size() * ORAM_BLOCK_SIZE);
+  }
+
+  {
+    bucket_guard_t guard = LockAllBuckets();
+    snapshotting_ = false;
+    std::vector<uint8_t>().swap(captured_);
+  }
+  std::lock_guard<std::mutex> preserved_guard(preserved_lock_);
+  preserved_.clear();
+
+  return status;
+}
+
+OramStatus TreeOramServerStorage::ReadSnapshot(
+    SnapshotReader* const reader, uint32_t id, size_t capacity,
+    size_t block_size, const std::string& instance_hash,
+    const TreeStorageOptions& options,
+    std::unique_ptr<BaseOramServerStorage>* const out) {
+  const OramStatus truncated(StatusCode::kInvalidArgument,
+                             "The tree storage is truncated.", __func__);
+
+  uint64_t bucket_size;
+  uint64_t bucket_num;
+  if (!reader->ReadValue(&bucket_size) || !reader->ReadValue(&bucket_num)) {
+    return truncated;
+  }
+
+  std::unique_ptr<TreeOramServerStorage> storage =
+      std::make_unique<TreeOramServerStorage>(id, capacity, block_size,
+                                              bucket_size, instance_hash);
+  OramStatus status = storage->Open(options);
+  if (!status.ok()) {
+    return status;
+  } else if (storage->storage_->GetBucketNum() != bucket_num) {
+    return OramStatus(StatusCode::kInvalidArgument,
+                      "The geometry of the tree storage mismatches.",
                       __func__);
-  } else {
-    iter->second.clear();
+  }
 
-    for (size_t i = 0; i < in_bucket.size(); i++) {
-      size_t compressed_size;
-      OramStatus status = oram_utils::DataCompress(
-          (uint8_t*)(&in_bucket[i]), ORAM_BLOCK_SIZE, buf, &compressed_size);
+  // The buckets are put in batches so that engines backed by the disk write
+  // them together.
+  static const size_t kRestoreBatch = 256;
+  std::vector<size_t> indices;
+  p_oram_path_t buckets;
+  for (size_t index = 0; index < bucket_num; index++) {
+    uint32_t count;
+    if (!reader->ReadValue(&count) || count > bucket_size) {
+      return truncated;
+    }
+
+    p_oram_bucket_t bucket(count);
+    if (!reader->Read(bucket.data(), count * ORAM_BLOCK_SIZE)) {
+      return truncated;
+    }
+    indices.emplace_back(index);
+    buckets.emplace_back(std::move(bucket));
+
+    if (indices.size() == kRestoreBatch || index + 1 == bucket_num) {
+      status = storage->storage_->PutBuckets(indices, buckets);
       if (!status.ok()) {
-        return status.Append(OramStatus(StatusCode::kInvalidOperation,
-                                        "Cannot write to the server",
-                                        __func__));
+        return status;
       }
+      indices.clear();
+      buckets.clear();
+    }
+  }
+
+  *out = std::move(storage);
+  return OramStatus::OK;
+}
+
+std::vector<size_t> TreeOramServerStorage::PathIndices(uint32_t path) const {
+  std::vector<size_t> indices;
+  for (uint32_t level = 0; level <= level_; level++) {
+    indices.emplace_back(BucketIndex(level, path >> (level_ - level)));
+  }
+
+  return indices;
+}
+
+OramStatus TreeOramServerStorage::ReadFullPath(
+    uint32_t path, p_oram_bucket_t* const out_bucket) {
+  std::promise<OramStatus> promise;
+  std::future<OramStatus> result = promise.get_future();
+  ReadFullPathAsync(path, out_bucket, [&promise](const OramStatus& status) {
+    promise.set_value(status);
+  });
+
+  return result.get();
+}
 
-      iter->second.emplace_back(
-          std::string(reinterpret_cast<const char*>(buf), compressed_size));
+OramStatus TreeOramServerStorage::WriteFullPath(uint32_t path,
+                                                const p_oram_path_t& in_path) {
+  std::promise<OramStatus> promise;
+  std::future<OramStatus> result = promise.get_future();
+  WriteFullPathAsync(path, in_path, [&promise](const OramStatus& status) {
+    promise.set_value(status);
+  });
+
+  return result.get();
+}
+
+void TreeOramServerStorage::ReadFullPathAsync(uint32_t path,
+                                              p_oram_bucket_t* const out_bucket,
+                                              const done_fn_t& done) {
+  INFO(logger, "Read path {}.", path);
+
+  if ((path >> level_) != 0) {
+    done(OramStatus(StatusCode::kInvalidArgument, "The path is invalid.",
+                    __func__));
+    return;
+  }
+
+  const std::vector<size_t> indices = PathIndices(path);
+  std::shared_ptr<bucket_guard_t> guard =
+      std::make_shared<bucket_guard_t>(LockBuckets(indices));
+  auto complete = [guard, done](OramStatus status) {
+    // Released first, as `done` may let the storage be dropped.
+    guard->clear();
+    if (!status.ok()) {
+      status.Append(OramStatus(StatusCode::kInvalidOperation,
+                               "Cannot Read from the server", __func__));
     }
+    done(status);
+  };
 
-    return OramStatus::OK;
+  OramStatus status = PreserveBuckets(indices);
+  if (!status.ok()) {
+    complete(status);
+    return;
   }
+  storage_->TakeBucketsAsync(indices, out_bucket, complete);
 }
 
-float TreeOramServerStorage::ReportStorage(void) const {
-  // Calculate the overall size of the storage in Megabytes.
-  uint64_t storage_size = 0;
-  for (const auto& iter : storage_) {
-    storage_size += iter.second.size() * sizeof(oram_block_t);
+void TreeOramServerStorage::WriteFullPathAsync(uint32_t path,
+                                               const p_oram_path_t& in_path,
+                                               const done_fn_t& done) {
+  INFO(logger, "Write path {}.", path);
+
+  if ((path >> level_) != 0 || in_path.size() != level_ + 1) {
+    done(OramStatus(StatusCode::kInvalidArgument,
+                    "The path or its buckets are invalid.", __func__));
+    return;
   }
 
-  return storage_size * 1. / POW2(20);
+  const std::vector<size_t> indices = PathIndices(path);
+  std::shared_ptr<bucket_guard_t> guard =
+      std::make_shared<bucket_guard_t>(LockBuckets(indices));
+  auto complete = [guard, done](OramStatus status) {
+    guard->clear();
+    if (!status.ok()) {
+      status.Append(OramStatus(StatusCode::kInvalidOperation,
+                               "Cannot write to the server", __func__));
+    }
+    done(status);
+  };
+
+  OramStatus status = PreserveBuckets(indices);
+  if (status.ok() && log_ != nullptr) {
+    status = log_->AppendBuckets(id_, indices, in_path);
+  }
+  if (!status.ok()) {
+    complete(status);
+    return;
+  }
+  storage_->PutBucketsAsync(indices, in_path, complete);
+}
+
+OramStatus TreeOramServerStorage::ReplayBuckets(
+    const std::vector<size_t>& indices, const p_oram_path_t& buckets) {
+  bucket_guard_t guard = LockBuckets(indices);
+  return storage_->PutBuckets(indices, buckets);
+}
+
+void TreeOramServerStorage::PrintOramTree(void) const {
+  bucket_guard_t guard = LockAllBuckets();
+  DBG(logger, "The size of the ORAM tree is {}", storage_->GetBucketNum());
+
+  storage_->ForEachBlock([](size_t index, const oram_block_t& block) {
+    DBG(logger, "Bucket {}: id: {}, type: {}", index, block.header.block_id,
+        (int)block.header.type);
+  });
+}
+
+TreeOramServerStorage::~TreeOramServerStorage() {
+  // The engine may still be completing requests that hold the buckets.
+  bucket_guard_t guard = LockAllBuckets();
+}
+
+float TreeOramServerStorage::ReportStorage(void) const {
+  // Calculate the overall size of the storage in Megabytes.
+  bucket_guard_t guard = LockAllBuckets();
+  return storage_->ReportBytes() * 1. / POW2(20);
 }
 }  // namespace oram_impl
\ No newline at end of file
@@ -17,23 +17,83 @@
 #ifndef ORAM_IMPL_SERVER_TREE_ORAM_STORAGE_H_
 #define ORAM_IMPL_SERVER_TREE_ORAM_STORAGE_H_
 
+#include <array>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 #include "base_oram_storage.h"
 
 #include "base/oram_status.h"
+#include "oram_snapshot.h"
 #include "protos/messages.pb.h"
+#include "tree_storage_engine.h"
+#include "write_ahead_log.h"
 
 namespace oram_impl {
 class TreeOramServerStorage : public BaseOramServerStorage {
-  server_tree_storage_t storage_;
+  std::unique_ptr<TreeStorageEngine> storage_;
   // The level of the oram tree.
   uint32_t level_;
   // The size of each bucket.
   size_t bucket_size_;
+  // Where the write-backs are logged; may be null.
+  WriteAheadLog* log_;
+
+  // The index of the bucket in heap order.
+  size_t BucketIndex(uint32_t level, uint32_t offset) const {
+    return POW2(level) - 1 + offset;
+  }
+  std::vector<size_t> PathIndices(uint32_t path) const;
+
+  // A mutex that may be released by another thread than the one that took it,
+  // as the buckets of an asynchronous request are released by the engine.
+  class StripeLock {
+    std::mutex lock_;
+    std::condition_variable released_;
+    bool held_ = false;
+
+   public:
+    void lock(void);
+    void unlock(void);
+  };
+
+  // Requests on disjoint buckets run in parallel: bucket i is guarded by
+  // stripe i % kBucketStripes, and the stripes are taken in ascending order.
+  static constexpr size_t kBucketStripes = 64;
+  mutable std::array<StripeLock, kBucketStripes> stripes_;
+
+  using bucket_guard_t = std::vector<std::unique_lock<StripeLock>>;
+  bucket_guard_t LockBuckets(const std::vector<size_t>& indices) const;
+  bucket_guard_t LockAllBuckets(void) const;
+
+  // A snapshot is taken bucket by bucket while the requests go on. To keep it
+  // consistent, the first request to change a bucket the snapshot has not
+  // reached yet preserves the old content for it (copy-on-write). The flags
+  // are guarded by the stripes of the buckets.
+  bool snapshotting_;
+  std::vector<uint8_t> captured_;
+  std::unordered_map<size_t, p_oram_bucket_t> preserved_;
+  std::mutex preserved_lock_;
+  // Only one snapshot at a time.
+  std::mutex snapshot_lock_;
+
+  // Returns the bucket without emptying it.
+  OramStatus CopyBucket(size_t index, p_oram_bucket_t* const out);
+  // Must be called with the stripes of `indices` held, before the buckets are
+  // taken or replaced.
+  OramStatus PreserveBuckets(const std::vector<size_t>& indices);
 
  public:
   TreeOramServerStorage(uint32_t id, size_t capacity, size_t block_size,
                         size_t bucket_size, const std::string& instance_hash);
 
+  // Must be called before the storage is accessed.
+  OramStatus Open(const TreeStorageOptions& options);
+  void SetLog(WriteAheadLog* const log) { log_ = log; }
+
   OramStatus ReadPath(uint32_t level, uint32_t path,
                       p_oram_bucket_t* const out_bucket);
   OramStatus WritePath(uint32_t level, uint32_t path,
@@ -41,10 +101,35 @@ class TreeOramServerStorage : public BaseOramServerStorage {
   OramStatus AccurateWritePath(uint32_t level, uint32_t offset,
                                const p_oram_bucket_t& in_bucket,
                                oram_impl::Type type);
+  // Read or write the buckets on the path from the root to the leaf at once.
+  OramStatus ReadFullPath(uint32_t path, p_oram_bucket_t* const out_bucket);
+  OramStatus WriteFullPath(uint32_t path, const p_oram_path_t& in_path);
+  // The asynchronous versions of the above, which keep the buckets locked
+  // until the engine is done and then call `done`, possibly on another thread.
+  // `out_bucket` must outlive the call.
+  using done_fn_t = TreeStorageEngine::done_fn_t;
+  void ReadFullPathAsync(uint32_t path, p_oram_bucket_t* const out_bucket,
+                         const done_fn_t& done);
+  void WriteFullPathAsync(uint32_t path, const p_oram_path_t& in_path,
+                          const done_fn_t& done);
+  // Applies a record of the log, which is not logged again.
+  OramStatus ReplayBuckets(const std::vector<size_t>& indices,
+                           const p_oram_path_t& buckets);
 
-  server_tree_storage_t GetStorage(void) const { return storage_; }
+  void PrintOramTree(void) const;
 
   virtual float ReportStorage(void) const;
+  virtual void LogStatistics(void) const { storage_->LogStatistics(id_); }
+
+  virtual OramStatus WriteSnapshot(SnapshotWriter* const writer) override;
+  static OramStatus ReadSnapshot(
+      SnapshotReader* const reader, uint32_t id, size_t capacity,
+      size_t block_size, const std::string& instance_hash,
+      const TreeStorageOptions& options,
+      std::unique_ptr<BaseOramServerStorage>* const out);
+
+  // Waits for the requests in flight.
+  virtual ~TreeOramServerStorage();
 };
 }  // namespace oram_impl
 
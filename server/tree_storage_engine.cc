@@ -0,0 +1,1273 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "tree_storage_engine.h"
+
+#include <fcntl.h>
+#include <sodium.h>
+#include <spdlog/logger.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <future>
+
+#include "base/oram_utils.h"
+
+extern std::shared_ptr<spdlog::logger> logger;
+
+namespace oram_impl {
+static const uint64_t kMmapFileMagic = 0x4d41524f45455254ull;
+
+// The files backing the trees are named after the ids, so they also record
+// the instance they belong to by a digest of its hash.
+static const size_t kInstanceDigestSize = crypto_generichash_BYTES;
+
+static void DigestInstance(const std::string& instance_hash,
+                           uint8_t* const out) {
+  crypto_generichash(out, kInstanceDigestSize,
+                     reinterpret_cast<const uint8_t*>(instance_hash.data()),
+                     instance_hash.size(), nullptr, 0);
+}
+
+// The first page of a file backing a tree. The pages of the mapping reach the
+// disk in any order, so a file left by a crash is not `clean` and is
+// recreated.
+struct MmapFileHeader {
+  uint64_t magic;
+  uint64_t bucket_num;
+  uint64_t bucket_size;
+  uint64_t block_size;
+  uint64_t clean;
+  uint8_t instance_digest[kInstanceDigestSize];
+};
+
+// The codec of the map engine is bypassed if it does not compress the first
+// `kCodecProbeBlocks` blocks to at most `kCodecMaxRatio` of their size.
+static const uint64_t kCodecProbeBlocks = 1024;
+static const double kCodecMaxRatio = 0.9;
+
+static size_t RoundUp(size_t size, size_t alignment) {
+  return (size + alignment - 1) / alignment * alignment;
+}
+
+static OramStatus CheckIndex(size_t index, size_t bucket_num) {
+  if (index >= bucket_num) {
+    return OramStatus(StatusCode::kObjectNotFound, "Cannot find the bucket.",
+                      __func__);
+  }
+
+  return OramStatus::OK;
+}
+
+static OramStatus CannotReserve(size_t bucket_num) {
+  return OramStatus(
+      StatusCode::kOutOfMemory,
+      oram_utils::StrCat("Cannot reserve the memory of ", bucket_num,
+                         " buckets"),
+      __func__);
+}
+
+OramStatus TreeStorageEngine::TakeBuckets(const std::vector<size_t>& indices,
+                                          p_oram_bucket_t* const out) {
+  for (size_t index : indices) {
+    OramStatus status = TakeBucket(index, out);
+    if (!status.ok()) {
+      return status;
+    }
+  }
+
+  return OramStatus::OK;
+}
+
+OramStatus TreeStorageEngine::PutBuckets(const std::vector<size_t>& indices,
+                                         const p_oram_path_t& in) {
+  if (indices.size() != in.size()) {
+    return OramStatus(StatusCode::kInvalidArgument,
+                      "The number of buckets does not match.", __func__);
+  }
+
+  for (size_t i = 0; i < indices.size(); i++) {
+    OramStatus status = PutBucket(indices[i], in[i]);
+    if (!status.ok()) {
+      return status;
+    }
+  }
+
+  return OramStatus::OK;
+}
+
+void TreeStorageEngine::TakeBucketsAsync(const std::vector<size_t>& indices,
+                                         p_oram_bucket_t* const out,
+                                         const done_fn_t& done) {
+  done(TakeBuckets(indices, out));
+}
+
+void TreeStorageEngine::PutBucketsAsync(const std::vector<size_t>& indices,
+                                        const p_oram_path_t& in,
+                                        const done_fn_t& done) {
+  done(PutBuckets(indices, in));
+}
+
+ZeroedMemory::ZeroedMemory(size_t size) : base_(nullptr), size_(size) {
+  if (size_ == 0) {
+    return;
+  }
+
+  // Only the address space is reserved.
+  base_ = mmap(nullptr, size_, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  if (base_ == MAP_FAILED) {
+    base_ = nullptr;
+  }
+}
+
+ZeroedMemory::~ZeroedMemory() {
+  if (base_ != nullptr) {
+    munmap(base_, size_);
+  }
+}
+
+MapTreeStorageEngine::MapTreeStorageEngine(size_t bucket_num,
+                                           size_t bucket_size,
+                                           BlockCodec codec)
+    : TreeStorageEngine(bucket_num, bucket_size),
+      directory_(bucket_num * sizeof(MapBucket*)),
+      buckets_(directory_.As<MapBucket*>()),
+      // The codec tag and the block stored as is.
+      slab_(ORAM_BLOCK_SIZE + 1),
+      codec_(codec),
+      bypass_codec_(codec == BlockCodec::kNone),
+      raw_bytes_(0),
+      compressed_bytes_(0),
+      compressed_blocks_(0) {}
+
+MapTreeStorageEngine::~MapTreeStorageEngine() {
+  for (size_t i = 0; i < bucket_num_; i++) {
+    delete buckets_[i];
+  }
+}
+
+OramStatus MapTreeStorageEngine::Encode(const oram_block_t& block,
+                                        uint8_t* const out,
+                                        size_t* const size) {
+  // The first byte tells the codec of the block.
+  size_t compressed_size = 0;
+  BlockCodec codec = BlockCodec::kNone;
+
+  if (!bypass_codec_) {
+    OramStatus status = oram_utils::DataCompress(
+        codec_, reinterpret_cast<const uint8_t*>(&block), ORAM_BLOCK_SIZE,
+        out + 1, DEFAULT_COMPRESSED_BUF_SIZE - 1, &compressed_size);
+    if (!status.ok()) {
+      return status;
+    }
+    codec = codec_;
+
+    const uint64_t raw = raw_bytes_ += ORAM_BLOCK_SIZE;
+    const uint64_t compressed = compressed_bytes_ += compressed_size;
+    if (++compressed_blocks_ == kCodecProbeBlocks &&
+        compressed > raw * kCodecMaxRatio) {
+      INFO(logger, "{} only compresses the blocks to {:.3f}; bypassing it.",
+           oram_utils::CodecToName(codec_), compressed * 1. / raw);
+      bypass_codec_ = true;
+    }
+  }
+
+  // Incompressible blocks are stored as is.
+  if (codec == BlockCodec::kNone || compressed_size >= ORAM_BLOCK_SIZE) {
+    codec = BlockCodec::kNone;
+    compressed_size = ORAM_BLOCK_SIZE;
+    memcpy(out + 1, &block, ORAM_BLOCK_SIZE);
+  }
+
+  out[0] = static_cast<uint8_t>(codec);
+  *size = compressed_size + 1;
+
+  return OramStatus::OK;
+}
+
+void MapTreeStorageEngine::Store(const uint8_t* const data, size_t size,
+                                 EncodedBlock* const out) {
+  if (out->capacity < size) {
+    if (out->slot != nullptr) {
+      slab_.Free(out->slot, out->capacity);
+    }
+    out->slot = slab_.Allocate(size);
+    out->capacity = slab_.SlotSize(size);
+  }
+  memcpy(out->slot, data, size);
+  out->size = size;
+}
+
+OramStatus MapTreeStorageEngine::Decode(const EncodedBlock& data,
+                                        oram_block_t* const block) const {
+  if (data.size == 0) {
+    return OramStatus(StatusCode::kInvalidArgument, "The block is empty.",
+                      __func__);
+  }
+
+  size_t size;
+  OramStatus status = oram_utils::DataDecompress(
+      static_cast<BlockCodec>(data.slot[0]), data.slot + 1, data.size - 1,
+      reinterpret_cast<uint8_t*>(block), ORAM_BLOCK_SIZE, &size);
+  if (!status.ok()) {
+    return status;
+  } else if (size != ORAM_BLOCK_SIZE) {
+    return OramStatus(StatusCode::kInvalidArgument, "The block is truncated.",
+                      __func__);
+  }
+
+  return OramStatus::OK;
+}
+
+OramStatus MapTreeStorageEngine::TakeBucket(size_t index,
+                                            p_oram_bucket_t* const out) {
+  OramStatus status = CheckIndex(index, bucket_num_);
+  if (!status.ok()) {
+    return status;
+  }
+
+  MapBucket* const bucket = buckets_[index];
+  if (bucket == nullptr) {
+    return OramStatus::OK;
+  }
+
+  for (size_t i = 0; i < bucket->size; i++) {
+    oram_block_t block;
+    status = Decode(bucket->blocks[i], &block);
+    if (!status.ok()) {
+      return status;
+    }
+
+    out->emplace_back(block);
+  }
+  bucket->size = 0;
+
+  return OramStatus::OK;
+}
+
+OramStatus MapTreeStorageEngine::PutBucket(size_t index,
+                                           const p_oram_bucket_t& in) {
+  OramStatus status = CheckIndex(index, bucket_num_);
+  if (!status.ok()) {
+    return status;
+  }
+
+  if (in.size() > bucket_size_) {
+    return OramStatus(StatusCode::kOutOfRange, "The bucket is full.",
+                      __func__);
+  }
+
+  // Every block is encoded before any slot is overwritten, so that a block the
+  // codec fails on leaves the bucket as it was. The buffers are kept per
+  // thread for the next writes.
+  static thread_local std::vector<uint8_t> encoded;
+  static thread_local std::vector<size_t> sizes;
+  encoded.resize(in.size() * DEFAULT_COMPRESSED_BUF_SIZE);
+  sizes.resize(in.size());
+  for (size_t i = 0; i < in.size(); i++) {
+    status = Encode(in[i], encoded.data() + i * DEFAULT_COMPRESSED_BUF_SIZE,
+                    &sizes[i]);
+    if (!status.ok()) {
+      return status;
+    }
+  }
+
+  if (buckets_[index] == nullptr) {
+    if (in.empty()) {
+      return OramStatus::OK;
+    }
+    buckets_[index] = new MapBucket();
+  }
+
+  MapBucket& bucket = *buckets_[index];
+  if (bucket.blocks.size() < in.size()) {
+    bucket.blocks.resize(in.size());
+  }
+
+  for (size_t i = 0; i < in.size(); i++) {
+    Store(encoded.data() + i * DEFAULT_COMPRESSED_BUF_SIZE, sizes[i],
+          &bucket.blocks[i]);
+  }
+  bucket.size = in.size();
+
+  return OramStatus::OK;
+}
+
+void MapTreeStorageEngine::ForEachBlock(
+    const std::function<void(size_t, const oram_block_t&)>& visit) {
+  for (size_t index = 0; index < bucket_num_; index++) {
+    const MapBucket* const bucket = buckets_[index];
+    for (size_t i = 0; bucket != nullptr && i < bucket->size; i++) {
+      oram_block_t block;
+      OramStatus status = Decode(bucket->blocks[i], &block);
+      if (!status.ok()) {
+        ERRS(logger, status.EmitString());
+      } else {
+        visit(index, block);
+      }
+    }
+  }
+}
+
+void MapTreeStorageEngine::LogStatistics(uint32_t id) const {
+  const uint64_t raw = raw_bytes_;
+  INFO(logger, "Storage {}: {} compressed {} blocks to {:.3f}{}.", id,
+       oram_utils::CodecToName(codec_), compressed_blocks_.load(),
+       raw == 0 ? 1. : compressed_bytes_ * 1. / raw,
+       bypass_codec_ ? " (bypassed)" : "");
+}
+
+size_t MapTreeStorageEngine::ReportBytes(void) const {
+  size_t bytes = slab_.ReportBytes();
+  for (size_t index = 0; index < bucket_num_; index++) {
+    if (buckets_[index] != nullptr) {
+      bytes += sizeof(MapBucket) +
+               buckets_[index]->blocks.capacity() * sizeof(EncodedBlock);
+    }
+  }
+
+  return bytes;
+}
+
+ArrayTreeStorageEngine::ArrayTreeStorageEngine(size_t bucket_num,
+                                               size_t bucket_size)
+    : TreeStorageEngine(bucket_num, bucket_size),
+      block_memory_(bucket_num * bucket_size * ORAM_BLOCK_SIZE),
+      count_memory_(bucket_num * sizeof(uint32_t)),
+      blocks_(block_memory_.As<oram_block_t>()),
+      counts_(count_memory_.As<uint32_t>()) {}
+
+OramStatus ArrayTreeStorageEngine::TakeBucket(size_t index,
+                                              p_oram_bucket_t* const out) {
+  OramStatus status = CheckIndex(index, bucket_num_);
+  if (!status.ok()) {
+    return status;
+  }
+
+  // Untouched buckets are left untouched.
+  if (counts_[index] != 0) {
+    const oram_block_t* const begin = blocks_ + index * bucket_size_;
+    out->insert(out->end(), begin, begin + counts_[index]);
+    counts_[index] = 0;
+  }
+
+  return OramStatus::OK;
+}
+
+OramStatus ArrayTreeStorageEngine::PutBucket(size_t index,
+                                             const p_oram_bucket_t& in) {
+  OramStatus status = CheckIndex(index, bucket_num_);
+  if (!status.ok()) {
+    return status;
+  }
+
+  if (in.size() > bucket_size_) {
+    return OramStatus(StatusCode::kOutOfRange, "The bucket is full.",
+                      __func__);
+  }
+
+  if (!in.empty() || counts_[index] != 0) {
+    std::copy(in.begin(), in.end(), blocks_ + index * bucket_size_);
+    counts_[index] = in.size();
+  }
+
+  return OramStatus::OK;
+}
+
+void ArrayTreeStorageEngine::ForEachBlock(
+    const std::function<void(size_t, const oram_block_t&)>& visit) {
+  for (size_t i = 0; i < bucket_num_; i++) {
+    for (size_t j = 0; j < counts_[i]; j++) {
+      visit(i, blocks_[i * bucket_size_ + j]);
+    }
+  }
+}
+
+size_t ArrayTreeStorageEngine::ReportBytes(void) const {
+  // The reserved array is mostly never touched; only the buckets holding
+  // blocks are counted, which approximates the memory committed.
+  size_t bytes = bucket_num_ * sizeof(uint32_t);
+  for (size_t i = 0; i < bucket_num_; i++) {
+    if (counts_[i] != 0) {
+      bytes += bucket_size_ * ORAM_BLOCK_SIZE;
+    }
+  }
+
+  return bytes;
+}
+
+MmapTreeStorageEngine::MmapTreeStorageEngine(
+    size_t bucket_num, size_t bucket_size, int fd, uint8_t* const base,
+    size_t file_size, size_t count_offset, size_t block_offset)
+    : ArrayTreeStorageEngine(
+          bucket_num, bucket_size,
+          reinterpret_cast<oram_block_t*>(base + block_offset),
+          reinterpret_cast<uint32_t*>(base + count_offset)),
+      fd_(fd),
+      base_(base),
+      file_size_(file_size),
+      locked_size_(0) {}
+
+OramStatus MmapTreeStorageEngine::Open(
+    const std::string& path, const std::string& instance_hash,
+    size_t bucket_num, size_t bucket_size, const TreeStorageOptions& options,
+    std::unique_ptr<TreeStorageEngine>* const out) {
+  const size_t page_size = sysconf(_SC_PAGESIZE);
+  const size_t count_offset = page_size;
+  const size_t block_offset =
+      RoundUp(count_offset + bucket_num * sizeof(uint32_t), page_size);
+  const size_t file_size = RoundUp(
+      block_offset + bucket_num * bucket_size * ORAM_BLOCK_SIZE, page_size);
+
+  const int fd = open(path.data(), O_RDWR | O_CREAT, 0600);
+  if (fd == -1) {
+    return OramStatus(StatusCode::kFileIOError,
+                      oram_utils::StrCat("Cannot open ", path, ": ",
+                                         strerror(errno)),
+                      __func__);
+  }
+
+  // The file may still back a live tree, e.g., of another server on the same
+  // directory; it must not be truncated under it.
+  if (flock(fd, LOCK_EX | LOCK_NB) != 0) {
+    const int err = errno;
+    close(fd);
+    return OramStatus(StatusCode::kFileIOError,
+                      oram_utils::StrCat(path, " is in use: ", strerror(err)),
+                      __func__);
+  }
+
+  // Check if the file holds a tree of the same geometry and instance that
+  // was closed.
+  MmapFileHeader expected = {kMmapFileMagic, bucket_num, bucket_size,
+                             ORAM_BLOCK_SIZE, 1, {}};
+  DigestInstance(instance_hash, expected.instance_digest);
+  MmapFileHeader header;
+  struct stat file_stat;
+  const bool restored =
+      fstat(fd, &file_stat) == 0 &&
+      static_cast<size_t>(file_stat.st_size) == file_size &&
+      pread(fd, &header, sizeof(header), 0) == sizeof(header) &&
+      memcmp(&header, &expected, sizeof(header)) == 0;
+
+  // Truncating first zeroes the counts of a stale file. Until the engine is
+  // closed, the file on the disk is not consistent.
+  expected.clean = 0;
+  int err = 0;
+  if (!restored) {
+    err = ftruncate(fd, 0) == 0 ? posix_fallocate(fd, 0, file_size) : errno;
+  }
+  if (err == 0 && (pwrite(fd, &expected, sizeof(expected), 0) !=
+                       sizeof(expected) ||
+                   fdatasync(fd) != 0)) {
+    err = errno;
+  }
+  if (err != 0) {
+    close(fd);
+    return OramStatus(StatusCode::kFileIOError,
+                      oram_utils::StrCat("Cannot allocate ", path, ": ",
+                                         strerror(err)),
+                      __func__);
+  }
+
+  void* const base =
+      mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (base == MAP_FAILED) {
+    const int err = errno;
+    close(fd);
+    return OramStatus(StatusCode::kOutOfMemory,
+                      oram_utils::StrCat("Cannot map ", path, ": ",
+                                         strerror(err)),
+                      __func__);
+  }
+
+  INFO(logger, "{} {} ({} MB).", restored ? "Restored" : "Created", path,
+       file_size / POW2(20));
+
+  MmapTreeStorageEngine* const engine = new MmapTreeStorageEngine(
+      bucket_num, bucket_size, fd, reinterpret_cast<uint8_t*>(base),
+      file_size, count_offset, block_offset);
+  engine->Advise(options);
+  out->reset(engine);
+
+  return OramStatus::OK;
+}
+
+void MmapTreeStorageEngine::Advise(const TreeStorageOptions& options) {
+  const size_t page_size = sysconf(_SC_PAGESIZE);
+
+  if (options.huge_pages && madvise(base_, file_size_, MADV_HUGEPAGE) != 0) {
+    WARN(logger, "Huge pages are unavailable: {}", strerror(errno));
+  }
+
+  // The top levels are touched by every access.
+  const size_t locked_buckets = std::min<size_t>(
+      (1ull << std::min<uint32_t>(options.locked_levels, 63)) - 1,
+      bucket_num_);
+  const uint8_t* const blocks = reinterpret_cast<uint8_t*>(blocks_);
+  const size_t locked_end =
+      RoundUp(blocks - base_ + locked_buckets * bucket_size_ * ORAM_BLOCK_SIZE,
+              page_size);
+  locked_size_ = std::min(locked_end, file_size_);
+  if (mlock(base_, locked_size_) != 0) {
+    WARN(logger, "Cannot lock the top {} levels: {}", options.locked_levels,
+         strerror(errno));
+    locked_size_ = 0;
+  }
+
+  // The buckets below are read at random.
+  if (locked_end < file_size_ &&
+      madvise(base_ + locked_end, file_size_ - locked_end, MADV_RANDOM) != 0) {
+    WARN(logger, "madvise failed: {}", strerror(errno));
+  }
+}
+
+size_t MmapTreeStorageEngine::ReportBytes(void) const {
+  // Only the locked part is sure to be in memory.
+  return locked_size_;
+}
+
+MmapTreeStorageEngine::~MmapTreeStorageEngine() {
+  // The file is clean only once every page has reached the disk.
+  if (msync(base_, file_size_, MS_SYNC) == 0) {
+    reinterpret_cast<MmapFileHeader*>(base_)->clean = 1;
+    msync(base_, sizeof(MmapFileHeader), MS_SYNC);
+  } else {
+    ERRS(logger, "Cannot write back the tree: {}", strerror(errno));
+  }
+  munmap(base_, file_size_);
+  close(fd_);
+}
+
+#ifdef ORAM_HAS_LIBURING
+static const unsigned kUringQueueDepth = 256;
+static const size_t kDirectIoAlignment = 4096;
+
+// Buffers for direct I/O must be aligned.
+struct AlignedFree {
+  void operator()(uint8_t* const buf) const { free(buf); }
+};
+using aligned_buf_t = std::unique_ptr<uint8_t[], AlignedFree>;
+
+static aligned_buf_t AllocAligned(size_t size) {
+  void* buf = nullptr;
+  if (posix_memalign(&buf, kDirectIoAlignment, std::max<size_t>(size, 1)) !=
+      0) {
+    PANIC("Cannot allocate the buffer for direct I/O.");
+  }
+
+  return aligned_buf_t(reinterpret_cast<uint8_t*>(buf));
+}
+
+struct UringTreeStorageEngine::Request {
+  // The slot below the cache, for reads.
+  size_t slot;
+  uint64_t offset;
+  size_t length;
+  uint8_t* buf;
+  Batch* batch;
+  // Started only after every request submitted before it has completed.
+  bool drain;
+};
+
+// The requests of a call and their buffer. Once submitted, a batch is only
+// touched by the reaper, which runs `complete` after the last request and
+// deletes the batch.
+struct UringTreeStorageEngine::Batch {
+  std::vector<Request> requests;
+  aligned_buf_t buf;
+  // For puts: the new count of each bucket, and the pages of the counts.
+  std::vector<std::pair<size_t, uint32_t>> counts;
+  aligned_buf_t count_buf;
+  std::function<void(const Batch&)> complete;
+  std::atomic_size_t pending{0};
+  std::atomic_int error{0};
+
+  OramStatus Status(void) const {
+    if (error != 0) {
+      return OramStatus(StatusCode::kFileIOError,
+                        oram_utils::StrCat("The bucket I/O failed: ",
+                                           strerror(error)),
+                        __func__);
+    }
+
+    return OramStatus::OK;
+  }
+};
+
+// Runs an asynchronous call and waits for it; never on the reaper.
+static OramStatus WaitFor(
+    const std::function<void(const TreeStorageEngine::done_fn_t&)>& call) {
+  std::promise<OramStatus> promise;
+  std::future<OramStatus> result = promise.get_future();
+  call([&promise](const OramStatus& status) { promise.set_value(status); });
+
+  return result.get();
+}
+
+static const uint64_t kUringFileMagic = 0x474e495245455254ull;
+
+// The first block of a file backing a tree for the io_uring engine. A file
+// left by a crash is not `clean`: it holds every completed put, but the
+// buckets being put at the time may be torn, which the client detects by
+// their MAC tags.
+struct UringFileHeader {
+  uint64_t magic;
+  uint64_t bucket_num;
+  uint64_t bucket_size;
+  uint64_t block_size;
+  uint64_t clean;
+  uint8_t instance_digest[kInstanceDigestSize];
+};
+
+UringTreeStorageEngine::UringTreeStorageEngine(
+    size_t bucket_num, size_t bucket_size, const std::string& instance_hash,
+    size_t cached_buckets, int fd, size_t slot_size, size_t slot_offset)
+    : TreeStorageEngine(bucket_num, bucket_size),
+      instance_hash_(instance_hash),
+      cache_(cached_buckets, bucket_size),
+      cached_buckets_(cached_buckets),
+      count_memory_((bucket_num - cached_buckets) * sizeof(uint32_t)),
+      counts_(count_memory_.As<uint32_t>()),
+      // Whole pages, so that any page can be copied out.
+      file_count_memory_(slot_offset - kDirectIoAlignment),
+      file_counts_(file_count_memory_.As<uint32_t>()),
+      fd_(fd),
+      slot_size_(slot_size),
+      slot_offset_(slot_offset),
+      ring_ready_(false) {}
+
+static OramStatus WriteUringHeader(int fd, const UringFileHeader& header) {
+  aligned_buf_t buf = AllocAligned(kDirectIoAlignment);
+  memset(buf.get(), 0, kDirectIoAlignment);
+  memcpy(buf.get(), &header, sizeof(header));
+  if (pwrite(fd, buf.get(), kDirectIoAlignment, 0) !=
+          static_cast<ssize_t>(kDirectIoAlignment) ||
+      fdatasync(fd) != 0) {
+    return OramStatus(StatusCode::kFileIOError,
+                      oram_utils::StrCat("Cannot write the header: ",
+                                         strerror(errno)),
+                      __func__);
+  }
+
+  return OramStatus::OK;
+}
+
+OramStatus UringTreeStorageEngine::Open(
+    const std::string& path, const std::string& instance_hash,
+    size_t bucket_num, size_t bucket_size, const TreeStorageOptions& options,
+    std::unique_ptr<TreeStorageEngine>* const out) {
+  const size_t cached_buckets = std::min<size_t>(
+      (1ull << std::min<uint32_t>(options.cached_levels, 63)) - 1,
+      bucket_num);
+  const size_t slot_size =
+      RoundUp(bucket_size * ORAM_BLOCK_SIZE, kDirectIoAlignment);
+  // | header | counts | a slot per bucket |. The cached buckets have their
+  // slots too, so the file does not depend on how many levels are cached.
+  const size_t count_size =
+      RoundUp(bucket_num * sizeof(uint32_t), kDirectIoAlignment);
+  const size_t slot_offset = kDirectIoAlignment + count_size;
+  const size_t file_size = slot_offset + bucket_num * slot_size;
+
+  int fd = open(path.data(), O_RDWR | O_CREAT | O_DIRECT, 0600);
+  if (fd == -1 && errno == EINVAL) {
+    // Some file systems (e.g., tmpfs) do not support direct I/O.
+    WARN(logger, "Direct I/O is unavailable for {}.", path);
+    fd = open(path.data(), O_RDWR | O_CREAT, 0600);
+  }
+  if (fd == -1) {
+    return OramStatus(StatusCode::kFileIOError,
+                      oram_utils::StrCat("Cannot open ", path, ": ",
+                                         strerror(errno)),
+                      __func__);
+  }
+
+  // As for the mmap engine, a file backing a live tree is left alone.
+  if (flock(fd, LOCK_EX | LOCK_NB) != 0) {
+    const int err = errno;
+    close(fd);
+    return OramStatus(StatusCode::kFileIOError,
+                      oram_utils::StrCat(path, " is in use: ", strerror(err)),
+                      __func__);
+  }
+
+  // Check if the file holds a tree of the same geometry and instance.
+  UringFileHeader expected = {kUringFileMagic, bucket_num, bucket_size,
+                              ORAM_BLOCK_SIZE, 0, {}};
+  DigestInstance(instance_hash, expected.instance_digest);
+  UringFileHeader found = {};
+  aligned_buf_t header = AllocAligned(kDirectIoAlignment);
+  struct stat file_stat;
+  bool restored = fstat(fd, &file_stat) == 0 &&
+                  static_cast<size_t>(file_stat.st_size) == file_size &&
+                  pread(fd, header.get(), kDirectIoAlignment, 0) ==
+                      static_cast<ssize_t>(kDirectIoAlignment);
+  if (restored) {
+    memcpy(&found, header.get(), sizeof(found));
+    restored = found.magic == expected.magic &&
+               found.bucket_num == expected.bucket_num &&
+               found.bucket_size == expected.bucket_size &&
+               found.block_size == expected.block_size &&
+               memcmp(found.instance_digest, expected.instance_digest,
+                      kInstanceDigestSize) == 0;
+  }
+  if (restored && !found.clean) {
+    WARN(logger, "{} was not closed cleanly; the buckets being put then may "
+         "be torn.", path);
+  }
+
+  if (!restored) {
+    // Truncating first zeroes the counts of a stale file.
+    const int err = ftruncate(fd, 0) == 0 ? posix_fallocate(fd, 0, file_size)
+                                          : errno;
+    if (err != 0) {
+      close(fd);
+      return OramStatus(StatusCode::kFileIOError,
+                        oram_utils::StrCat("Cannot allocate ", path, ": ",
+                                           strerror(err)),
+                        __func__);
+    }
+  }
+
+  std::unique_ptr<UringTreeStorageEngine> engine(
+      new UringTreeStorageEngine(bucket_num, bucket_size, instance_hash,
+                                 cached_buckets, fd, slot_size, slot_offset));
+  if (!engine->cache_.IsReserved() || !engine->count_memory_.IsReserved() ||
+      !engine->file_count_memory_.IsReserved()) {
+    return CannotReserve(bucket_num);
+  }
+  if (restored) {
+    OramStatus status = engine->Restore();
+    if (!status.ok()) {
+      return status;
+    }
+  }
+
+  // Until the engine is closed, a put may be torn by a crash.
+  OramStatus status = WriteUringHeader(fd, expected);
+  if (!status.ok()) {
+    return status;
+  }
+
+  const int ret = io_uring_queue_init(kUringQueueDepth, &engine->ring_, 0);
+  if (ret < 0) {
+    return OramStatus(StatusCode::kExternalError,
+                      oram_utils::StrCat("Cannot set up io_uring: ",
+                                         strerror(-ret)),
+                      __func__);
+  }
+  engine->ring_ready_ = true;
+  engine->reaper_ = std::thread(&UringTreeStorageEngine::Reap, engine.get());
+
+  INFO(logger, "{} {} with {} buckets cached.",
+       restored ? "Restored" : "Created", path, cached_buckets);
+  *out = std::move(engine);
+
+  return OramStatus::OK;
+}
+
+OramStatus UringTreeStorageEngine::Restore(void) {
+  // The mapping is page-aligned, so it is read into directly.
+  const size_t count_size = slot_offset_ - kDirectIoAlignment;
+  if (pread(fd_, file_counts_, count_size, kDirectIoAlignment) !=
+      static_cast<ssize_t>(count_size)) {
+    return OramStatus(StatusCode::kFileIOError,
+                      oram_utils::StrCat("Cannot read the counts: ",
+                                         strerror(errno)),
+                      __func__);
+  }
+
+  const uint32_t* const all_counts = file_counts_;
+  if (std::any_of(all_counts, all_counts + bucket_num_,
+                  [this](uint32_t count) { return count > bucket_size_; })) {
+    return OramStatus(StatusCode::kFileIOError, "The counts are corrupted.",
+                      __func__);
+  }
+
+  aligned_buf_t buf = AllocAligned(slot_size_);
+  for (size_t i = 0; i < cached_buckets_; i++) {
+    if (all_counts[i] == 0) {
+      continue;
+    } else if (pread(fd_, buf.get(), slot_size_, SlotOffset(i)) !=
+                   static_cast<ssize_t>(slot_size_)) {
+      return OramStatus(StatusCode::kFileIOError,
+                        oram_utils::StrCat("Cannot read bucket ", i),
+                        __func__);
+    }
+
+    const oram_block_t* const blocks =
+        reinterpret_cast<const oram_block_t*>(buf.get());
+    OramStatus status = cache_.PutBucket(
+        i, p_oram_bucket_t(blocks, blocks + all_counts[i]));
+    if (!status.ok()) {
+      return status;
+    }
+  }
+  memcpy(counts_, all_counts + cached_buckets_,
+         (bucket_num_ - cached_buckets_) * sizeof(uint32_t));
+
+  return OramStatus::OK;
+}
+
+OramStatus UringTreeStorageEngine::Close(void) {
+  // Write back the cached buckets and the counts of all the buckets.
+  const size_t count_size = slot_offset_ - kDirectIoAlignment;
+  aligned_buf_t counts = AllocAligned(count_size);
+  memset(counts.get(), 0, count_size);
+  uint32_t* const all_counts = reinterpret_cast<uint32_t*>(counts.get());
+
+  aligned_buf_t buf = AllocAligned(slot_size_);
+  for (size_t i = 0; i < cached_buckets_; i++) {
+    p_oram_bucket_t bucket;
+    OramStatus status = cache_.TakeBucket(i, &bucket);
+    if (!status.ok()) {
+      return status;
+    } else if (bucket.empty()) {
+      continue;
+    }
+
+    memcpy(buf.get(), bucket.data(), bucket.size() * ORAM_BLOCK_SIZE);
+    if (pwrite(fd_, buf.get(), slot_size_, SlotOffset(i)) !=
+        static_cast<ssize_t>(slot_size_)) {
+      return OramStatus(StatusCode::kFileIOError,
+                        oram_utils::StrCat("Cannot write bucket ", i, ": ",
+                                           strerror(errno)),
+                        __func__);
+    }
+    all_counts[i] = bucket.size();
+  }
+  memcpy(all_counts + cached_buckets_, counts_,
+         (bucket_num_ - cached_buckets_) * sizeof(uint32_t));
+
+  if (pwrite(fd_, counts.get(), count_size, kDirectIoAlignment) !=
+          static_cast<ssize_t>(count_size) ||
+      fdatasync(fd_) != 0) {
+    return OramStatus(StatusCode::kFileIOError,
+                      oram_utils::StrCat("Cannot write the counts: ",
+                                         strerror(errno)),
+                      __func__);
+  }
+
+  UringFileHeader header = {kUringFileMagic, bucket_num_, bucket_size_,
+                            ORAM_BLOCK_SIZE, 1, {}};
+  DigestInstance(instance_hash_, header.instance_digest);
+  return WriteUringHeader(fd_, header);
+}
+
+void UringTreeStorageEngine::AddCountRequests(Batch* const batch) {
+  const size_t counts_per_page = kDirectIoAlignment / sizeof(uint32_t);
+  std::vector<size_t> pages;
+  for (const auto& count : batch->counts) {
+    file_counts_[count.first] = count.second;
+    pages.emplace_back(count.first / counts_per_page);
+  }
+  std::sort(pages.begin(), pages.end());
+  pages.erase(std::unique(pages.begin(), pages.end()), pages.end());
+
+  // The pages are copied now, so that they hold the counts of every put
+  // submitted before; draining orders them after the buckets of those puts.
+  batch->count_buf = AllocAligned(pages.size() * kDirectIoAlignment);
+  for (size_t i = 0; i < pages.size(); i++) {
+    uint8_t* const buf = batch->count_buf.get() + i * kDirectIoAlignment;
+    memcpy(buf, file_counts_ + pages[i] * counts_per_page, kDirectIoAlignment);
+    batch->requests.push_back({0, kDirectIoAlignment * (pages[i] + 1),
+                               kDirectIoAlignment, buf, nullptr, true});
+  }
+}
+
+int UringTreeStorageEngine::SubmitQueued(void) {
+  int ret;
+  while ((ret = io_uring_submit(&ring_)) < 0) {
+    if (ret != -EINTR && ret != -EAGAIN && ret != -EBUSY) {
+      return ret;
+    }
+  }
+
+  return 0;
+}
+
+OramStatus UringTreeStorageEngine::Submit(Batch* const batch, bool write) {
+  std::unique_lock<std::mutex> lock(submit_lock_);
+  if (write) {
+    AddCountRequests(batch);
+  }
+
+  if (batch->requests.empty()) {
+    lock.unlock();
+    batch->complete(*batch);
+    delete batch;
+    return OramStatus::OK;
+  }
+
+  batch->pending = batch->requests.size();
+
+  size_t issued = 0;
+  int ret = 0;
+  for (auto& request : batch->requests) {
+    request.batch = batch;
+
+    struct io_uring_sqe* sqe = io_uring_get_sqe(&ring_);
+    if (sqe == nullptr) {
+      // The submission queue is full.
+      if ((ret = SubmitQueued()) != 0) {
+        break;
+      } else if ((sqe = io_uring_get_sqe(&ring_)) == nullptr) {
+        ret = -EBUSY;
+        break;
+      }
+    }
+
+    if (write) {
+      io_uring_prep_write(sqe, fd_, request.buf, request.length,
+                          request.offset);
+    } else {
+      io_uring_prep_read(sqe, fd_, request.buf, request.length,
+                         request.offset);
+    }
+    if (request.drain) {
+      io_uring_sqe_set_flags(sqe, IOSQE_IO_DRAIN);
+    }
+    io_uring_sqe_set_data(sqe, &request);
+    issued++;
+  }
+
+  // The requests prepared but not submitted go out with the next submission.
+  if (ret == 0) {
+    ret = SubmitQueued();
+  }
+  if (ret == 0) {
+    return OramStatus::OK;
+  }
+
+  // The batch stays alive while anything issued is pending.
+  batch->error = -ret;
+  const size_t dropped = batch->requests.size() - issued;
+  lock.unlock();
+  if (dropped != 0 && batch->pending.fetch_sub(dropped) == dropped) {
+    batch->complete(*batch);
+    delete batch;
+  }
+
+  return OramStatus(StatusCode::kExternalError,
+                    oram_utils::StrCat("Cannot submit to io_uring: ",
+                                       strerror(-ret)),
+                    __func__);
+}
+
+void UringTreeStorageEngine::Reap(void) {
+  while (true) {
+    struct io_uring_cqe* cqe = nullptr;
+    const int ret = io_uring_wait_cqe(&ring_, &cqe);
+    if (ret == -EINTR) {
+      continue;
+    } else if (ret < 0) {
+      PANIC("Cannot wait for io_uring.");
+    }
+
+    Request* const request =
+        reinterpret_cast<Request*>(io_uring_cqe_get_data(cqe));
+    const int res = cqe->res;
+    io_uring_cqe_seen(&ring_, cqe);
+
+    // Posted by the destructor.
+    if (request == nullptr) {
+      return;
+    }
+
+    Batch* const batch = request->batch;
+    if (res < 0) {
+      batch->error = -res;
+    } else if (static_cast<size_t>(res) != request->length) {
+      batch->error = EIO;
+    }
+    if (--batch->pending == 0) {
+      batch->complete(*batch);
+      delete batch;
+    }
+  }
+}
+
+OramStatus UringTreeStorageEngine::TakeBucket(size_t index,
+                                              p_oram_bucket_t* const out) {
+  return TakeBuckets({index}, out);
+}
+
+OramStatus UringTreeStorageEngine::PutBucket(size_t index,
+                                             const p_oram_bucket_t& in) {
+  return PutBuckets({index}, {in});
+}
+
+OramStatus UringTreeStorageEngine::TakeBuckets(
+    const std::vector<size_t>& indices, p_oram_bucket_t* const out) {
+  return WaitFor([&](const done_fn_t& done) {
+    TakeBucketsAsync(indices, out, done);
+  });
+}
+
+OramStatus UringTreeStorageEngine::PutBuckets(
+    const std::vector<size_t>& indices, const p_oram_path_t& in) {
+  return WaitFor([&](const done_fn_t& done) {
+    PutBucketsAsync(indices, in, done);
+  });
+}
+
+void UringTreeStorageEngine::TakeBucketsAsync(
+    const std::vector<size_t>& indices, p_oram_bucket_t* const out,
+    const done_fn_t& done) {
+  // Read the non-empty buckets on the disk into one buffer.
+  std::unique_ptr<Batch> batch = std::make_unique<Batch>();
+  size_t buf_size = 0;
+  for (size_t index : indices) {
+    OramStatus status = CheckIndex(index, bucket_num_);
+    if (!status.ok()) {
+      done(status);
+      return;
+    }
+
+    if (index >= cached_buckets_ && counts_[index - cached_buckets_] != 0) {
+      const size_t length =
+          RoundUp(counts_[index - cached_buckets_] * ORAM_BLOCK_SIZE,
+                  kDirectIoAlignment);
+      batch->requests.push_back({index - cached_buckets_, SlotOffset(index),
+                                 length, nullptr, nullptr, false});
+      buf_size += length;
+    }
+  }
+
+  batch->buf = AllocAligned(buf_size);
+  size_t offset = 0;
+  for (auto& request : batch->requests) {
+    request.buf = batch->buf.get() + offset;
+    offset += request.length;
+  }
+
+  batch->complete = [this, indices, out, done](const Batch& batch) {
+    OramStatus status = batch.Status();
+    auto request = batch.requests.begin();
+    for (size_t i = 0; i < indices.size() && status.ok(); i++) {
+      const size_t index = indices[i];
+      if (index < cached_buckets_) {
+        status = cache_.TakeBucket(index, out);
+      } else if (request != batch.requests.end() &&
+                 request->slot == index - cached_buckets_) {
+        const oram_block_t* const begin =
+            reinterpret_cast<const oram_block_t*>(request->buf);
+        out->insert(out->end(), begin, begin + counts_[request->slot]);
+        counts_[request->slot] = 0;
+        request++;
+      }
+    }
+
+    done(status);
+  };
+  OramStatus status = Submit(batch.release(), false);
+  if (!status.ok()) {
+    ERRS(logger, status.EmitString());
+  }
+}
+
+void UringTreeStorageEngine::PutBucketsAsync(
+    const std::vector<size_t>& indices, const p_oram_path_t& in,
+    const done_fn_t& done) {
+  if (indices.size() != in.size()) {
+    done(OramStatus(StatusCode::kInvalidArgument,
+                    "The number of buckets does not match.", __func__));
+    return;
+  }
+
+  std::unique_ptr<Batch> batch = std::make_unique<Batch>();
+  size_t buf_size = 0;
+  for (size_t i = 0; i < indices.size(); i++) {
+    OramStatus status = CheckIndex(indices[i], bucket_num_);
+    if (!status.ok()) {
+      done(status);
+      return;
+    } else if (in[i].size() > bucket_size_) {
+      done(OramStatus(StatusCode::kOutOfRange, "The bucket is full.",
+                      __func__));
+      return;
+    }
+
+    if (!in[i].empty()) {
+      const size_t length =
+          RoundUp(in[i].size() * ORAM_BLOCK_SIZE, kDirectIoAlignment);
+      batch->requests.push_back(
+          {0, SlotOffset(indices[i]), length, nullptr, nullptr, false});
+      buf_size += length;
+    }
+    batch->counts.emplace_back(indices[i], in[i].size());
+  }
+
+  // All the buckets are copied here, and the cached ones are also put in
+  // memory right away, so `in` is not needed after the call returns.
+  batch->buf = AllocAligned(buf_size);
+  size_t offset = 0;
+  std::vector<uint32_t> counts;
+  for (size_t i = 0, r = 0; i < indices.size(); i++) {
+    if (indices[i] < cached_buckets_) {
+      OramStatus status = cache_.PutBucket(indices[i], in[i]);
+      if (!status.ok()) {
+        done(status);
+        return;
+      }
+    }
+    if (!in[i].empty()) {
+      Request& request = batch->requests[r++];
+      request.buf = batch->buf.get() + offset;
+      memcpy(request.buf, in[i].data(), in[i].size() * ORAM_BLOCK_SIZE);
+      offset += request.length;
+    }
+    counts.emplace_back(in[i].size());
+  }
+
+  batch->complete = [this, indices, counts, done](const Batch& batch) {
+    OramStatus status = batch.Status();
+    if (status.ok()) {
+      for (size_t i = 0; i < indices.size(); i++) {
+        if (indices[i] >= cached_buckets_) {
+          counts_[indices[i] - cached_buckets_] = counts[i];
+        }
+      }
+    }
+
+    done(status);
+  };
+  OramStatus status = Submit(batch.release(), true);
+  if (!status.ok()) {
+    ERRS(logger, status.EmitString());
+  }
+}
+
+void UringTreeStorageEngine::ForEachBlock(
+    const std::function<void(size_t, const oram_block_t&)>& visit) {
+  cache_.ForEachBlock(visit);
+
+  aligned_buf_t buf = AllocAligned(slot_size_);
+  for (size_t i = 0; i < bucket_num_ - cached_buckets_; i++) {
+    if (counts_[i] == 0) {
+      continue;
+    }
+
+    if (pread(fd_, buf.get(), slot_size_, SlotOffset(i + cached_buckets_)) !=
+        static_cast<ssize_t>(slot_size_)) {
+      ERRS(logger, "Cannot read bucket {}: {}", i + cached_buckets_,
+           strerror(errno));
+      continue;
+    }
+
+    const oram_block_t* const blocks =
+        reinterpret_cast<const oram_block_t*>(buf.get());
+    for (size_t j = 0; j < counts_[i]; j++) {
+      visit(i + cached_buckets_, blocks[j]);
+    }
+  }
+}
+
+size_t UringTreeStorageEngine::ReportBytes(void) const {
+  return cache_.ReportBytes() +
+         (2 * bucket_num_ - cached_buckets_) * sizeof(uint32_t);
+}
+
+UringTreeStorageEngine::~UringTreeStorageEngine() {
+  if (ring_ready_) {
+    // Stop the reaper.
+    {
+      std::lock_guard<std::mutex> lock(submit_lock_);
+      struct io_uring_sqe* sqe = io_uring_get_sqe(&ring_);
+      if (sqe == nullptr) {
+        SubmitQueued();
+        sqe = io_uring_get_sqe(&ring_);
+      }
+      PANIC_IF(sqe == nullptr, "Cannot stop the reaper.");
+      // Drained, so that it completes after every batch before it.
+      io_uring_prep_nop(sqe);
+      io_uring_sqe_set_flags(sqe, IOSQE_IO_DRAIN);
+      io_uring_sqe_set_data(sqe, nullptr);
+      SubmitQueued();
+    }
+    reaper_.join();
+    io_uring_queue_exit(&ring_);
+
+    OramStatus status = Close();
+    if (!status.ok()) {
+      ERRS(logger, status.EmitString());
+    }
+  }
+
+  close(fd_);
+}
+#endif
+
+OramStatus CreateTreeStorageEngine(
+    const TreeStorageOptions& options, uint32_t id,
+    const std::string& instance_hash, size_t bucket_num, size_t bucket_size,
+    std::unique_ptr<TreeStorageEngine>* const out) {
+  switch (options.type) {
+    case TreeStorageEngineType::kMap: {
+      // Check that the codec is built in.
+      const oram_block_t block = {};
+      uint8_t buf[DEFAULT_COMPRESSED_BUF_SIZE];
+      size_t size;
+      OramStatus status = oram_utils::DataCompress(
+          options.codec, reinterpret_cast<const uint8_t*>(&block),
+          ORAM_BLOCK_SIZE, buf, sizeof(buf), &size);
+      if (!status.ok()) {
+        return status;
+      }
+
+      auto engine = std::make_unique<MapTreeStorageEngine>(
+          bucket_num, bucket_size, options.codec);
+      if (!engine->IsReserved()) {
+        return CannotReserve(bucket_num);
+      }
+      *out = std::move(engine);
+      return OramStatus::OK;
+    }
+    case TreeStorageEngineType::kArray: {
+      auto engine =
+          std::make_unique<ArrayTreeStorageEngine>(bucket_num, bucket_size);
+      if (!engine->IsReserved()) {
+        return CannotReserve(bucket_num);
+      }
+      *out = std::move(engine);
+      return OramStatus::OK;
+    }
+    case TreeStorageEngineType::kMmap:
+      return MmapTreeStorageEngine::Open(
+          oram_utils::StrCat(options.path, "/tree_", id, ".oram"),
+          instance_hash, bucket_num, bucket_size, options, out);
+    case TreeStorageEngineType::kUring:
+#ifdef ORAM_HAS_LIBURING
+      return UringTreeStorageEngine::Open(
+          oram_utils::StrCat(options.path, "/tree_", id, ".uring"),
+          instance_hash, bucket_num, bucket_size, options, out);
+#else
+      return OramStatus(StatusCode::kUnimplemented,
+                        "The server is built without liburing.", __func__);
+#endif
+    default:
+      return OramStatus(StatusCode::kInvalidArgument,
+                        "Unknown tree storage engine.", __func__);
+  }
+}
+}  // namespace oram_impl
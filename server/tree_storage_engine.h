@@ -0,0 +1,344 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef ORAM_IMPL_SERVER_TREE_STORAGE_ENGINE_H_
+#define ORAM_IMPL_SERVER_TREE_STORAGE_ENGINE_H_
+
+#ifdef ORAM_HAS_LIBURING
+#include <liburing.h>
+#endif
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "base/oram_defs.h"
+#include "base/oram_status.h"
+#include "slab_allocator.h"
+
+namespace oram_impl {
+// How the tree storages of the server are created.
+struct TreeStorageOptions {
+  TreeStorageEngineType type = TreeStorageEngineType::kArray;
+  // The directory of the files backing the storages.
+  std::string path = ".";
+  // The number of top levels pinned in memory.
+  uint32_t locked_levels = 10;
+  bool huge_pages = false;
+  // The number of top levels cached in memory in front of the disk.
+  uint32_t cached_levels = 10;
+  // How the map engine compresses the blocks.
+  BlockCodec codec = BlockCodec::kNone;
+};
+
+// Zero-filled anonymous memory whose pages are only committed when written,
+// so that the untouched part of a sparse tree costs nothing.
+class ZeroedMemory {
+  void* base_;
+  size_t size_;
+
+ public:
+  // Check `IsReserved` before use: the memory may not have been reserved.
+  explicit ZeroedMemory(size_t size);
+
+  ZeroedMemory(const ZeroedMemory&) = delete;
+  ZeroedMemory& operator=(const ZeroedMemory&) = delete;
+
+  bool IsReserved(void) const { return size_ == 0 || base_ != nullptr; }
+
+  template <typename T>
+  T* As(void) const {
+    return reinterpret_cast<T*>(base_);
+  }
+
+  ~ZeroedMemory();
+};
+
+// Holds the buckets of a tree storage. Buckets are addressed by their index in
+// heap (BFS) order, i.e., the bucket at `offset` on `level` is the
+// (2^level - 1 + offset)-th one. Requests on disjoint buckets may run
+// concurrently.
+class TreeStorageEngine {
+ protected:
+  const size_t bucket_num_;
+  // The maximum number of blocks in a bucket.
+  const size_t bucket_size_;
+
+ public:
+  TreeStorageEngine(size_t bucket_num, size_t bucket_size)
+      : bucket_num_(bucket_num), bucket_size_(bucket_size) {}
+
+  // Appends the blocks of the bucket to `out` and empties the bucket.
+  virtual OramStatus TakeBucket(size_t index, p_oram_bucket_t* const out) = 0;
+  // Replaces the blocks of the bucket.
+  virtual OramStatus PutBucket(size_t index, const p_oram_bucket_t& in) = 0;
+  // The batched versions of the above, e.g., for all the buckets on a path.
+  // Engines backed by the disk issue the buckets together.
+  virtual OramStatus TakeBuckets(const std::vector<size_t>& indices,
+                                 p_oram_bucket_t* const out);
+  virtual OramStatus PutBuckets(const std::vector<size_t>& indices,
+                                const p_oram_path_t& in);
+  // The asynchronous versions of the batched calls. `done` is called once the
+  // buckets are taken into `out`, which must outlive the call, or put; engines
+  // backed by the disk may call it on another thread. The others call it
+  // inline.
+  using done_fn_t = std::function<void(const OramStatus&)>;
+  virtual void TakeBucketsAsync(const std::vector<size_t>& indices,
+                                p_oram_bucket_t* const out,
+                                const done_fn_t& done);
+  virtual void PutBucketsAsync(const std::vector<size_t>& indices,
+                               const p_oram_path_t& in, const done_fn_t& done);
+  // Visits every block stored, for debugging.
+  virtual void ForEachBlock(
+      const std::function<void(size_t, const oram_block_t&)>& visit) = 0;
+  // The memory held by the engine in bytes.
+  virtual size_t ReportBytes(void) const = 0;
+  virtual void LogStatistics(uint32_t id) const {}
+
+  size_t GetBucketNum(void) const { return bucket_num_; }
+  size_t GetBucketSize(void) const { return bucket_size_; }
+
+  virtual ~TreeStorageEngine() {}
+};
+
+// A bucket is created on its first write, and every block is compressed by the
+// codec of the storage into a slot of a slab. The blocks are mostly
+// ciphertexts, so the codec is bypassed once it is seen not to pay off.
+class MapTreeStorageEngine : public TreeStorageEngine {
+  struct EncodedBlock {
+    uint8_t* slot = nullptr;
+    uint32_t capacity = 0;
+    uint32_t size = 0;
+  };
+  // Only the first `size` blocks are used. The slots of the others are kept
+  // for the next writes, so a warm bucket is written without any allocation.
+  struct MapBucket {
+    std::vector<EncodedBlock> blocks;
+    size_t size = 0;
+  };
+
+  // The buckets by index; null for the buckets never written, which read as
+  // empty. Every entry is guarded by the lock of its bucket.
+  ZeroedMemory directory_;
+  MapBucket** const buckets_;
+  SlabAllocator slab_;
+
+  const BlockCodec codec_;
+  std::atomic_bool bypass_codec_;
+  // The bytes given to and returned by the codec.
+  std::atomic_uint64_t raw_bytes_;
+  std::atomic_uint64_t compressed_bytes_;
+  std::atomic_uint64_t compressed_blocks_;
+
+  // Writes the codec tag and the (compressed) block to `out`, which holds
+  // `DEFAULT_COMPRESSED_BUF_SIZE` bytes.
+  OramStatus Encode(const oram_block_t& block, uint8_t* const out,
+                    size_t* const size);
+  // Reuses the slot of `out` if it is large enough.
+  void Store(const uint8_t* const data, size_t size, EncodedBlock* const out);
+  OramStatus Decode(const EncodedBlock& data, oram_block_t* const block) const;
+
+ public:
+  MapTreeStorageEngine(size_t bucket_num, size_t bucket_size,
+                       BlockCodec codec = BlockCodec::kNone);
+
+  bool IsReserved(void) const { return directory_.IsReserved(); }
+
+  virtual OramStatus TakeBucket(size_t index,
+                                p_oram_bucket_t* const out) override;
+  virtual OramStatus PutBucket(size_t index,
+                               const p_oram_bucket_t& in) override;
+  virtual void ForEachBlock(
+      const std::function<void(size_t, const oram_block_t&)>& visit) override;
+  virtual size_t ReportBytes(void) const override;
+  virtual void LogStatistics(uint32_t id) const override;
+
+  virtual ~MapTreeStorageEngine();
+};
+
+// The buckets are fixed-stride slices of one contiguous array in heap order,
+// so there is no allocation per block and a bucket is read or written with a
+// single copy. The array is zeroed memory, i.e., all the buckets start empty
+// and only the pages written to are committed.
+class ArrayTreeStorageEngine : public TreeStorageEngine {
+  ZeroedMemory block_memory_;
+  ZeroedMemory count_memory_;
+
+ protected:
+  // Bucket i occupies blocks_[i * bucket_size_, (i + 1) * bucket_size_).
+  oram_block_t* blocks_;
+  // The number of blocks in each bucket.
+  uint32_t* counts_;
+
+  // For engines that own the memory of the array elsewhere.
+  ArrayTreeStorageEngine(size_t bucket_num, size_t bucket_size,
+                         oram_block_t* const blocks, uint32_t* const counts)
+      : TreeStorageEngine(bucket_num, bucket_size),
+        block_memory_(0),
+        count_memory_(0),
+        blocks_(blocks),
+        counts_(counts) {}
+
+ public:
+  ArrayTreeStorageEngine(size_t bucket_num, size_t bucket_size);
+
+  bool IsReserved(void) const {
+    return block_memory_.IsReserved() && count_memory_.IsReserved();
+  }
+
+  virtual OramStatus TakeBucket(size_t index,
+                                p_oram_bucket_t* const out) override;
+  virtual OramStatus PutBucket(size_t index,
+                               const p_oram_bucket_t& in) override;
+  virtual void ForEachBlock(
+      const std::function<void(size_t, const oram_block_t&)>& visit) override;
+  virtual size_t ReportBytes(void) const override;
+};
+
+// The array engine laid over a preallocated file mapped into memory, so the
+// tree may be larger than the memory and survives restarts. The file is:
+//
+// | header (a page) | bucket counts | blocks |
+//
+// Because of the heap order, the top levels are a prefix of the counts and of
+// the blocks, which are locked into memory; the rest is left to the page cache.
+class MmapTreeStorageEngine : public ArrayTreeStorageEngine {
+  int fd_;
+  uint8_t* base_;
+  size_t file_size_;
+  size_t locked_size_;
+
+  MmapTreeStorageEngine(size_t bucket_num, size_t bucket_size, int fd,
+                        uint8_t* const base, size_t file_size,
+                        size_t count_offset, size_t block_offset);
+
+  void Advise(const TreeStorageOptions& options);
+
+ public:
+  // Maps the file at `path`. An existing file of the same geometry and
+  // instance that was closed cleanly is mapped as is; otherwise the file is
+  // (re)created.
+  static OramStatus Open(const std::string& path,
+                         const std::string& instance_hash, size_t bucket_num,
+                         size_t bucket_size, const TreeStorageOptions& options,
+                         std::unique_ptr<TreeStorageEngine>* const out);
+
+  virtual size_t ReportBytes(void) const override;
+
+  virtual ~MmapTreeStorageEngine();
+};
+
+#ifdef ORAM_HAS_LIBURING
+// Keeps the top levels in memory in front of a file read and written with
+// direct I/O, one slot per bucket. Every put is written to the file, the
+// cached buckets included, so the cache only saves reads and the file survives
+// a crash. The buckets of a batch are submitted to io_uring together, and a
+// single thread reaps the completions of all the requests and completes the
+// asynchronous calls.
+class UringTreeStorageEngine : public TreeStorageEngine {
+  struct Batch;
+  struct Request;
+
+  // Recorded in the header of the file.
+  const std::string instance_hash_;
+  ArrayTreeStorageEngine cache_;
+  const size_t cached_buckets_;
+  // The number of blocks in each slot of the file below the cache. They are
+  // kept in memory so that empty buckets are never read and taking a bucket
+  // needs no write.
+  ZeroedMemory count_memory_;
+  uint32_t* const counts_;
+  // The counts of all the buckets as the file has them, guarded by
+  // `submit_lock_`. A put updates them on submission and writes their pages
+  // after its buckets.
+  ZeroedMemory file_count_memory_;
+  uint32_t* const file_counts_;
+  int fd_;
+  // The size of a slot, aligned for direct I/O.
+  size_t slot_size_;
+  // Where the slot of the first bucket begins in the file.
+  size_t slot_offset_;
+
+  struct io_uring ring_;
+  bool ring_ready_;
+  std::mutex submit_lock_;
+  std::thread reaper_;
+
+  UringTreeStorageEngine(size_t bucket_num, size_t bucket_size,
+                         const std::string& instance_hash,
+                         size_t cached_buckets, int fd, size_t slot_size,
+                         size_t slot_offset);
+
+  size_t SlotOffset(size_t index) const {
+    return slot_offset_ + index * slot_size_;
+  }
+  // Reads back the counts and the cached buckets of an existing file.
+  OramStatus Restore(void);
+  // Writes back what is only kept in memory and marks the file clean.
+  OramStatus Close(void);
+
+  // Issues the requests of the batch and hands it over to the reaper. If not
+  // all of them can be issued, the batch fails once the issued ones complete.
+  OramStatus Submit(Batch* const batch, bool write);
+  // Adds the writes of the pages of the counts that a put changes.
+  void AddCountRequests(Batch* const batch);
+  // Returns 0 or the negated errno.
+  int SubmitQueued(void);
+  void Reap(void);
+
+ public:
+  // Opens the file at `path`. A file of the same geometry and instance is
+  // restored; otherwise the file is (re)created.
+  static OramStatus Open(const std::string& path,
+                         const std::string& instance_hash, size_t bucket_num,
+                         size_t bucket_size, const TreeStorageOptions& options,
+                         std::unique_ptr<TreeStorageEngine>* const out);
+
+  virtual OramStatus TakeBucket(size_t index,
+                                p_oram_bucket_t* const out) override;
+  virtual OramStatus PutBucket(size_t index,
+                               const p_oram_bucket_t& in) override;
+  virtual OramStatus TakeBuckets(const std::vector<size_t>& indices,
+                                 p_oram_bucket_t* const out) override;
+  virtual OramStatus PutBuckets(const std::vector<size_t>& indices,
+                                const p_oram_path_t& in) override;
+  // `done` is called by the reaper, unless no bucket is on the disk.
+  virtual void TakeBucketsAsync(const std::vector<size_t>& indices,
+                                p_oram_bucket_t* const out,
+                                const done_fn_t& done) override;
+  virtual void PutBucketsAsync(const std::vector<size_t>& indices,
+                               const p_oram_path_t& in,
+                               const done_fn_t& done) override;
+  virtual void ForEachBlock(
+      const std::function<void(size_t, const oram_block_t&)>& visit) override;
+  virtual size_t ReportBytes(void) const override;
+
+  virtual ~UringTreeStorageEngine();
+};
+#endif
+
+// Creates the engine of the tree storage `id` of the instance.
+OramStatus CreateTreeStorageEngine(
+    const TreeStorageOptions& options, uint32_t id,
+    const std::string& instance_hash, size_t bucket_num, size_t bucket_size,
+    std::unique_ptr<TreeStorageEngine>* const out);
+}  // namespace oram_impl
+
+#endif  // ORAM_IMPL_SERVER_TREE_STORAGE_ENGINE_H_
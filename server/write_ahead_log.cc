@@ -0,0 +1,501 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "write_ahead_log.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sodium.h>
+#include <spdlog/logger.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <type_traits>
+
+#include "base/oram_utils.h"
+
+extern std::shared_ptr<spdlog::logger> logger;
+
+namespace oram_impl {
+// How often the log is synchronized under `WalSyncPolicy::kPeriodic`.
+static const std::chrono::milliseconds kWalSyncPeriod(10);
+static const size_t kWalSumSize = crypto_generichash_BYTES_MIN;
+// | size | type |
+static const size_t kWalHeaderSize = sizeof(uint32_t) + sizeof(uint8_t);
+
+template <typename T>
+static void Put(std::string* const out, const T& value) {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "Only plain values can be logged.");
+  out->append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+static void PutBucket(std::string* const out, size_t index,
+                      const p_oram_bucket_t& bucket) {
+  Put<uint64_t>(out, index);
+  Put<uint32_t>(out, bucket.size());
+  out->append(reinterpret_cast<const char*>(bucket.data()),
+              bucket.size() * ORAM_BLOCK_SIZE);
+}
+
+// Reads the payload of a record.
+class WalCursor {
+  const uint8_t* cur_;
+  const uint8_t* const end_;
+
+ public:
+  WalCursor(const uint8_t* begin, size_t size)
+      : cur_(begin), end_(begin + size) {}
+
+  bool Get(void* const data, size_t size) {
+    if (size > static_cast<size_t>(end_ - cur_)) {
+      return false;
+    }
+
+    memcpy(data, cur_, size);
+    cur_ += size;
+    return true;
+  }
+
+  template <typename T>
+  bool Get(T* const value) {
+    return Get(value, sizeof(T));
+  }
+
+  bool Done(void) const { return cur_ == end_; }
+};
+
+static bool DecodeRecord(WalRecordType type, WalCursor* const cursor,
+                         WalRecord* const record) {
+  record->type = type;
+  switch (type) {
+    case WalRecordType::kCreateTree: {
+      uint64_t size;
+      if (!cursor->Get(&record->id) || !cursor->Get(&record->capacity) ||
+          !cursor->Get(&record->block_size) ||
+          !cursor->Get(&record->bucket_size) || !cursor->Get(&size)) {
+        return false;
+      }
+      record->instance_hash.resize(size);
+      return cursor->Get(&record->instance_hash[0], size) && cursor->Done();
+    }
+
+    case WalRecordType::kBuckets: {
+      uint32_t num;
+      if (!cursor->Get(&record->id) || !cursor->Get(&num)) {
+        return false;
+      }
+      for (uint32_t i = 0; i < num; i++) {
+        uint64_t index;
+        uint32_t count;
+        if (!cursor->Get(&index) || !cursor->Get(&count)) {
+          return false;
+        }
+        p_oram_bucket_t bucket(count);
+        if (!cursor->Get(bucket.data(), count * ORAM_BLOCK_SIZE)) {
+          return false;
+        }
+        record->indices.emplace_back(index);
+        record->buckets.emplace_back(std::move(bucket));
+      }
+      return cursor->Done();
+    }
+
+    case WalRecordType::kReset:
+      return cursor->Done();
+
+    default:
+      return false;
+  }
+}
+
+WriteAheadLog::WriteAheadLog(const std::string& dir, WalSyncPolicy policy)
+    : dir_(dir),
+      policy_(policy),
+      fd_(-1),
+      segment_(0),
+      appended_(0),
+      written_(0),
+      flushing_(false),
+      stopping_(false) {}
+
+std::string WriteAheadLog::SegmentPath(uint64_t segment) const {
+  return oram_utils::StrCat(dir_, "/wal_", segment, ".log");
+}
+
+std::vector<uint64_t> WriteAheadLog::ListSegments(void) const {
+  std::vector<uint64_t> segments;
+  DIR* const dir = opendir(dir_.data());
+  if (dir == nullptr) {
+    return segments;
+  }
+
+  while (struct dirent* entry = readdir(dir)) {
+    unsigned long long segment;
+    char suffix[8];
+    if (sscanf(entry->d_name, "wal_%llu.%7s", &segment, suffix) == 2 &&
+        strcmp(suffix, "log") == 0) {
+      segments.emplace_back(segment);
+    }
+  }
+  closedir(dir);
+
+  std::sort(segments.begin(), segments.end());
+  return segments;
+}
+
+OramStatus WriteAheadLog::OpenSegment(uint64_t segment) {
+  const std::string path = SegmentPath(segment);
+  const int fd = open(path.data(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+  if (fd == -1) {
+    return OramStatus(StatusCode::kFileIOError,
+                      oram_utils::StrCat("Cannot create ", path, ": ",
+                                         strerror(errno)),
+                      __func__);
+  }
+
+  if (fd_ != -1) {
+    close(fd_);
+  }
+  fd_ = fd;
+  segment_ = segment;
+
+  return OramStatus::OK;
+}
+
+OramStatus WriteAheadLog::Open(void) {
+  if (mkdir(dir_.data(), 0700) != 0 && errno != EEXIST) {
+    return OramStatus(StatusCode::kFileIOError,
+                      oram_utils::StrCat("Cannot create ", dir_, ": ",
+                                         strerror(errno)),
+                      __func__);
+  }
+
+  const std::vector<uint64_t> segments = ListSegments();
+  OramStatus status =
+      OpenSegment(segments.empty() ? 0 : segments.back() + 1);
+  if (!status.ok()) {
+    return status;
+  }
+
+  if (policy_ == WalSyncPolicy::kPeriodic) {
+    syncer_ = std::thread(&WriteAheadLog::Sync, this);
+  }
+
+  return OramStatus::OK;
+}
+
+OramStatus WriteAheadLog::Replay(
+    const std::function<OramStatus(const WalRecord&)>& apply,
+    size_t* const replayed) {
+  *replayed = 0;
+
+  for (uint64_t segment : ListSegments()) {
+    if (segment >= segment_) {
+      break;
+    }
+
+    const std::string path = SegmentPath(segment);
+    const int fd = open(path.data(), O_RDONLY);
+    struct stat file_stat;
+    if (fd == -1 || fstat(fd, &file_stat) != 0) {
+      const int err = errno;
+      if (fd != -1) {
+        close(fd);
+      }
+      return OramStatus(StatusCode::kFileIOError,
+                        oram_utils::StrCat("Cannot open ", path, ": ",
+                                           strerror(err)),
+                        __func__);
+    }
+
+    const size_t size = file_stat.st_size;
+    void* const base =
+        size == 0 ? nullptr
+                  : mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+      return OramStatus(StatusCode::kFileIOError,
+                        oram_utils::StrCat("Cannot map ", path, ": ",
+                                           strerror(errno)),
+                        __func__);
+    } else if (base != nullptr) {
+      madvise(base, size, MADV_SEQUENTIAL);
+    }
+
+    const uint8_t* const data = reinterpret_cast<const uint8_t*>(base);
+    size_t offset = 0;
+    bool broken = false;
+    OramStatus status = OramStatus::OK;
+    while (status.ok() && offset < size) {
+      uint32_t payload_size = 0;
+      if (size - offset >= kWalHeaderSize) {
+        memcpy(&payload_size, data + offset, sizeof(uint32_t));
+      }
+      const size_t record_size = kWalHeaderSize + payload_size + kWalSumSize;
+
+      uint8_t sum[kWalSumSize];
+      if (size - offset < record_size ||
+          crypto_generichash(sum, kWalSumSize, data + offset,
+                             record_size - kWalSumSize, nullptr, 0) != 0 ||
+          memcmp(sum, data + offset + record_size - kWalSumSize,
+                 kWalSumSize) != 0) {
+        broken = true;
+        break;
+      }
+
+      const WalRecordType type =
+          static_cast<WalRecordType>(data[offset + sizeof(uint32_t)]);
+      WalCursor cursor(data + offset + kWalHeaderSize, payload_size);
+      WalRecord record;
+      if (!DecodeRecord(type, &cursor, &record)) {
+        broken = true;
+        break;
+      }
+
+      status = apply(record);
+      offset += record_size;
+      (*replayed)++;
+    }
+
+    if (base != nullptr) {
+      munmap(base, size);
+    }
+    if (!status.ok()) {
+      return status;
+    } else if (broken) {
+      // Only the last record written before a crash can be torn, and the
+      // next segment was started after the restart.
+      WARN(logger, "The log is broken at {} of {}; the rest is discarded.",
+           offset, path);
+    }
+  }
+
+  return OramStatus::OK;
+}
+
+void WriteAheadLog::Flush(std::unique_lock<std::mutex>& guard) {
+  flushing_ = true;
+  std::string batch;
+  batch.swap(pending_);
+  const uint64_t last = appended_;
+  const int fd = fd_;
+  guard.unlock();
+
+  OramStatus status = OramStatus::OK;
+  size_t done = 0;
+  while (status.ok() && done < batch.size()) {
+    const ssize_t ret = write(fd, batch.data() + done, batch.size() - done);
+    if (ret == -1 && errno != EINTR) {
+      status = OramStatus(StatusCode::kFileIOError,
+                          oram_utils::StrCat("Cannot write the log: ",
+                                             strerror(errno)),
+                          __func__);
+    } else if (ret > 0) {
+      done += ret;
+    }
+  }
+  if (status.ok() && policy_ == WalSyncPolicy::kAlways && fdatasync(fd) != 0) {
+    status = OramStatus(StatusCode::kFileIOError,
+                        oram_utils::StrCat("Cannot sync the log: ",
+                                           strerror(errno)),
+                        __func__);
+  }
+
+  guard.lock();
+  flushing_ = false;
+  if (status.ok()) {
+    written_ = last;
+  } else {
+    status_ = status;
+  }
+  flushed_cv_.notify_all();
+}
+
+void WriteAheadLog::Sync(void) {
+  std::unique_lock<std::mutex> guard(lock_);
+  uint64_t synced = 0;
+  while (!stopping_) {
+    stopping_cv_.wait_for(guard, kWalSyncPeriod);
+    // Under the lock, so that the segment is not switched meanwhile. Writers
+    // only wait if they append at the same moment.
+    if (written_ != synced && fdatasync(fd_) == 0) {
+      synced = written_;
+    }
+  }
+}
+
+OramStatus WriteAheadLog::Enqueue(WalRecordType type,
+                                  const std::string& payload,
+                                  uint64_t* const sequence) {
+  std::string record;
+  record.reserve(kWalHeaderSize + payload.size() + kWalSumSize);
+  Put<uint32_t>(&record, payload.size());
+  Put<uint8_t>(&record, static_cast<uint8_t>(type));
+  record.append(payload);
+  uint8_t sum[kWalSumSize];
+  crypto_generichash(sum, kWalSumSize,
+                     reinterpret_cast<const uint8_t*>(record.data()),
+                     record.size(), nullptr, 0);
+  record.append(reinterpret_cast<const char*>(sum), kWalSumSize);
+
+  std::unique_lock<std::mutex> guard(lock_);
+  if (!status_.ok()) {
+    return status_;
+  }
+
+  pending_.append(record);
+  *sequence = ++appended_;
+
+  return OramStatus::OK;
+}
+
+OramStatus WriteAheadLog::WaitFor(uint64_t sequence) {
+  std::unique_lock<std::mutex> guard(lock_);
+  // Group commit: a writer that finds no flush in progress writes out all the
+  // pending records, including those appended while the last flush ran.
+  while (written_ < sequence && status_.ok()) {
+    if (flushing_) {
+      flushed_cv_.wait(guard);
+    } else {
+      Flush(guard);
+    }
+  }
+
+  return status_;
+}
+
+OramStatus WriteAheadLog::Append(WalRecordType type,
+                                 const std::string& payload) {
+  uint64_t sequence = 0;
+  OramStatus status = Enqueue(type, payload, &sequence);
+
+  return status.ok() ? WaitFor(sequence) : status;
+}
+
+OramStatus WriteAheadLog::EnqueueCreateTree(uint32_t id, size_t capacity,
+                                            size_t block_size,
+                                            size_t bucket_size,
+                                            const std::string& instance_hash,
+                                            uint64_t* const sequence) {
+  std::string payload;
+  Put<uint32_t>(&payload, id);
+  Put<uint64_t>(&payload, capacity);
+  Put<uint64_t>(&payload, block_size);
+  Put<uint64_t>(&payload, bucket_size);
+  Put<uint64_t>(&payload, instance_hash.size());
+  payload.append(instance_hash);
+
+  return Enqueue(WalRecordType::kCreateTree, payload, sequence);
+}
+
+OramStatus WriteAheadLog::AppendCreateTree(uint32_t id, size_t capacity,
+                                           size_t block_size,
+                                           size_t bucket_size,
+                                           const std::string& instance_hash) {
+  uint64_t sequence = 0;
+  OramStatus status = EnqueueCreateTree(id, capacity, block_size, bucket_size,
+                                        instance_hash, &sequence);
+
+  return status.ok() ? WaitFor(sequence) : status;
+}
+
+OramStatus WriteAheadLog::AppendBuckets(uint32_t id,
+                                        const std::vector<size_t>& indices,
+                                        const p_oram_path_t& buckets) {
+  std::string payload;
+  Put<uint32_t>(&payload, id);
+  Put<uint32_t>(&payload, indices.size());
+  for (size_t i = 0; i < indices.size(); i++) {
+    PutBucket(&payload, indices[i], buckets[i]);
+  }
+
+  return Append(WalRecordType::kBuckets, payload);
+}
+
+OramStatus WriteAheadLog::AppendBucket(uint32_t id, size_t index,
+                                       const p_oram_bucket_t& bucket) {
+  std::string payload;
+  Put<uint32_t>(&payload, id);
+  Put<uint32_t>(&payload, 1);
+  PutBucket(&payload, index, bucket);
+
+  return Append(WalRecordType::kBuckets, payload);
+}
+
+OramStatus WriteAheadLog::EnqueueReset(uint64_t* const sequence) {
+  return Enqueue(WalRecordType::kReset, "", sequence);
+}
+
+OramStatus WriteAheadLog::AppendReset(void) {
+  return Append(WalRecordType::kReset, "");
+}
+
+OramStatus WriteAheadLog::Rotate(uint64_t* const segment) {
+  std::unique_lock<std::mutex> guard(lock_);
+  while (flushing_ || !pending_.empty()) {
+    if (flushing_) {
+      flushed_cv_.wait(guard);
+    } else {
+      Flush(guard);
+    }
+  }
+
+  // The sealed segment must be durable before the snapshots replace it.
+  if (!status_.ok()) {
+    return status_;
+  } else if (fdatasync(fd_) != 0) {
+    return OramStatus(StatusCode::kFileIOError,
+                      oram_utils::StrCat("Cannot sync the log: ",
+                                         strerror(errno)),
+                      __func__);
+  }
+
+  OramStatus status = OpenSegment(segment_ + 1);
+  *segment = segment_;
+
+  return status;
+}
+
+void WriteAheadLog::DropSegmentsBefore(uint64_t segment) {
+  for (uint64_t old_segment : ListSegments()) {
+    if (old_segment < segment) {
+      unlink(SegmentPath(old_segment).data());
+    }
+  }
+}
+
+WriteAheadLog::~WriteAheadLog() {
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    stopping_ = true;
+  }
+  stopping_cv_.notify_all();
+  if (syncer_.joinable()) {
+    syncer_.join();
+  }
+
+  if (fd_ != -1) {
+    fdatasync(fd_);
+    close(fd_);
+  }
+}
+}  // namespace oram_impl
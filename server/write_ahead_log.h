@@ -0,0 +1,139 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef ORAM_IMPL_SERVER_WRITE_AHEAD_LOG_H_
+#define ORAM_IMPL_SERVER_WRITE_AHEAD_LOG_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "base/oram_defs.h"
+#include "base/oram_status.h"
+
+namespace oram_impl {
+enum class WalRecordType : uint8_t {
+  kCreateTree = 0,
+  kBuckets = 1,
+  kReset = 2,
+};
+
+struct WalRecord {
+  WalRecordType type;
+  uint32_t id;
+  // For kCreateTree.
+  uint64_t capacity;
+  uint64_t block_size;
+  uint64_t bucket_size;
+  std::string instance_hash;
+  // For kBuckets.
+  std::vector<size_t> indices;
+  p_oram_path_t buckets;
+};
+
+// The log of the changes to the tree storages since the last snapshots. Each
+// write-back is appended as one record before it is acknowledged, and the
+// records of concurrent writers are written (and synchronized) together.
+//
+// The log is a sequence of segments "wal_<n>.log" of records
+//
+// | size | type | payload | sum |
+//
+// where the sum is a BLAKE2b digest of the rest, so that a record torn by a
+// crash is detected. A checkpoint starts a new segment; the older segments are
+// dropped once the snapshots are taken. Replaying a record replaces buckets,
+// so replaying records the snapshots already have is harmless.
+class WriteAheadLog {
+  const std::string dir_;
+  const WalSyncPolicy policy_;
+
+  std::mutex lock_;
+  int fd_;
+  uint64_t segment_;
+  // The records not written yet.
+  std::string pending_;
+  // The number of records appended and written.
+  uint64_t appended_;
+  uint64_t written_;
+  bool flushing_;
+  std::condition_variable flushed_cv_;
+  // Once a write fails, the log refuses any more records.
+  OramStatus status_;
+
+  // For `WalSyncPolicy::kPeriodic`.
+  std::thread syncer_;
+  bool stopping_;
+  std::condition_variable stopping_cv_;
+
+  std::string SegmentPath(uint64_t segment) const;
+  // The segments on the disk in order.
+  std::vector<uint64_t> ListSegments(void) const;
+  OramStatus OpenSegment(uint64_t segment);
+  // Writes the pending records; `guard` is released meanwhile.
+  void Flush(std::unique_lock<std::mutex>& guard);
+  void Sync(void);
+  // Adds the record after those appended before and returns its sequence
+  // number without writing it.
+  OramStatus Enqueue(WalRecordType type, const std::string& payload,
+                     uint64_t* const sequence);
+  OramStatus Append(WalRecordType type, const std::string& payload);
+
+ public:
+  WriteAheadLog(const std::string& dir, WalSyncPolicy policy);
+
+  // Starts a new segment after the existing ones.
+  OramStatus Open(void);
+  // Applies the records of the segments before the current one in order. The
+  // rest of a segment after a broken record is skipped.
+  OramStatus Replay(const std::function<OramStatus(const WalRecord&)>& apply,
+                    size_t* const replayed);
+
+  // Each returns once the record is written as required by the policy.
+  OramStatus AppendCreateTree(uint32_t id, size_t capacity, size_t block_size,
+                              size_t bucket_size,
+                              const std::string& instance_hash);
+  OramStatus AppendBuckets(uint32_t id, const std::vector<size_t>& indices,
+                           const p_oram_path_t& buckets);
+  OramStatus AppendBucket(uint32_t id, size_t index,
+                          const p_oram_bucket_t& bucket);
+  OramStatus AppendReset(void);
+
+  // The same records, split into taking their place in the log and waiting
+  // until they are written, so that a caller can order a record under its own
+  // lock and wait for the disk after releasing it.
+  OramStatus EnqueueCreateTree(uint32_t id, size_t capacity, size_t block_size,
+                               size_t bucket_size,
+                               const std::string& instance_hash,
+                               uint64_t* const sequence);
+  OramStatus EnqueueReset(uint64_t* const sequence);
+  // Returns once the records up to `sequence` are written as required by the
+  // policy.
+  OramStatus WaitFor(uint64_t sequence);
+
+  // Seals the current segment and starts a new one, whose number is returned.
+  // The records before are covered by snapshots taken afterwards.
+  OramStatus Rotate(uint64_t* const segment);
+  void DropSegmentsBefore(uint64_t segment);
+
+  ~WriteAheadLog();
+};
+}  // namespace oram_impl
+
+#endif  // ORAM_IMPL_SERVER_WRITE_AHEAD_LOG_H_
@@ -0,0 +1,83 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <spdlog/spdlog.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "base/oram_crypto.h"
+#include "base/oram_utils.h"
+
+std::shared_ptr<spdlog::logger> logger =
+    spdlog::stdout_color_mt("oram_crypto_bench");
+
+// Reports the throughput of sealing and opening blocks under every AEAD suite
+// available on this host. Usage: oram_crypto_bench [block_num] [rounds]
+int main(int argc, char* argv[]) {
+  const size_t block_num = argc > 1 ? std::stoul(argv[1]) : 1ul << 14;
+  const size_t rounds = argc > 2 ? std::stoul(argv[2]) : 16;
+
+  std::shared_ptr<oram_crypto::Cryptor> cryptor =
+      oram_crypto::Cryptor::GetInstance();
+  cryptor->NoNeedForSessionKey();
+  const oram_crypto::AeadSuite selected = cryptor->GetSuite();
+  INFO(logger, "Selected suite on this host: {}.",
+       oram_crypto::SuiteToName(selected));
+
+  std::vector<oram_impl::oram_block_t> blocks(block_num);
+  oram_crypto::RandomBytes(reinterpret_cast<uint8_t*>(blocks.data()),
+                           blocks.size() * ORAM_BLOCK_SIZE);
+
+  for (oram_crypto::AeadSuite suite : {oram_crypto::AeadSuite::kAes256Gcm,
+                                       oram_crypto::AeadSuite::kChaCha20Poly1305,
+                                       oram_crypto::AeadSuite::kAegis256}) {
+    const std::string name = oram_crypto::SuiteToName(suite);
+    if (!cryptor->SetSuite(suite).ok()) {
+      INFO(logger, "{}: not available.", name);
+      continue;
+    }
+
+    std::chrono::nanoseconds encrypt_time(0);
+    std::chrono::nanoseconds decrypt_time(0);
+    for (size_t i = 0; i < rounds; i++) {
+      auto begin = std::chrono::high_resolution_clock::now();
+      oram_utils::CheckStatus(
+          cryptor->EncryptBlocks(blocks.data(), blocks.size()),
+          "Encryption failed");
+      auto mid = std::chrono::high_resolution_clock::now();
+      oram_utils::CheckStatus(
+          cryptor->DecryptBlocks(blocks.data(), blocks.size()),
+          "Decryption failed");
+      auto end = std::chrono::high_resolution_clock::now();
+
+      encrypt_time += mid - begin;
+      decrypt_time += end - mid;
+    }
+
+    // Bytes per nanosecond is GB/s; report MB/s.
+    const double bytes = 1.0 * rounds * block_num * ORAM_BLOCK_SIZE;
+    INFO(logger, "{}: encrypt {:.1f} MB/s, decrypt {:.1f} MB/s.", name,
+         bytes / encrypt_time.count() * 1e3,
+         bytes / decrypt_time.count() * 1e3);
+  }
+
+  cryptor->SetSuite(selected);
+
+  return 0;
+}
@@ -0,0 +1,121 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <sodium.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "base/oram_crypto.h"
+#include "base/oram_prp.h"
+
+std::shared_ptr<spdlog::logger> logger =
+    spdlog::stdout_color_mt("oram_prp_test");
+
+// Checks that `Prp` is a bijection on domains of every shape, including those
+// far from a power of two where most of the cycle-walking happens, and that
+// `RandomPermutation` built on it yields a permutation.
+static size_t failures = 0;
+
+#define EXPECT(cond)                                                    \
+  do {                                                                  \
+    if (!(cond)) {                                                      \
+      logger->error("{}:{}: expected {}", __FILE__, __LINE__, #cond);   \
+      failures++;                                                       \
+    }                                                                   \
+  } while (0)
+
+static bool IsPermutation(std::vector<uint32_t> values) {
+  std::sort(values.begin(), values.end());
+  for (size_t i = 0; i < values.size(); i++) {
+    if (values[i] != i) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void TestPrp(uint32_t domain) {
+  uint8_t key[ORAM_PRP_KEY_SIZE];
+  randombytes_buf(key, sizeof(key));
+  const oram_crypto::Prp prp(domain, key);
+
+  std::vector<uint32_t> single(domain);
+  for (uint32_t i = 0; i < domain; i++) {
+    single[i] = prp.Permute(i);
+  }
+  EXPECT(IsPermutation(single));
+
+  // The batch agrees with the single calls, also in place.
+  std::vector<uint32_t> batch(domain);
+  std::iota(batch.begin(), batch.end(), 0);
+  prp.PermuteBatch(batch.data(), batch.data(), batch.size());
+  EXPECT(batch == single);
+
+  // The same key gives the same permutation.
+  const oram_crypto::Prp again(domain, key);
+  bool same = true;
+  for (uint32_t i = 0; i < domain && same; i++) {
+    same = again.Permute(i) == single[i];
+  }
+  EXPECT(same);
+
+  if (domain >= 8) {
+    // A fresh key almost never gives the same permutation.
+    uint8_t other_key[ORAM_PRP_KEY_SIZE];
+    randombytes_buf(other_key, sizeof(other_key));
+    const oram_crypto::Prp other(domain, other_key);
+    bool differs = false;
+    for (uint32_t i = 0; i < domain && !differs; i++) {
+      differs = other.Permute(i) != single[i];
+    }
+    EXPECT(differs);
+  }
+}
+
+static void TestRandomPermutation(uint32_t size) {
+  std::vector<uint32_t> array(size);
+  std::iota(array.begin(), array.end(), 0);
+  EXPECT(oram_crypto::RandomPermutation(array).ok());
+  EXPECT(IsPermutation(array));
+}
+
+int main(void) {
+  spdlog::set_default_logger(logger);
+  logger->set_level(spdlog::level::warn);
+
+  if (sodium_init() == -1) {
+    logger->error("Cannot initialize libsodium.");
+    return 1;
+  }
+
+  for (const uint32_t domain :
+       {1u, 2u, 3u, 17u, 1000u, 65536u, 65537u, 100003u}) {
+    TestPrp(domain);
+    TestRandomPermutation(domain);
+  }
+
+  if (failures != 0) {
+    logger->error("{} checks failed.", failures);
+    return 1;
+  }
+  logger->warn("All checks passed.");
+
+  return 0;
+}
@@ -0,0 +1,112 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <grpc++/grpc++.h>
+#include <spdlog/spdlog.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+#include "core/square_root_oram_controller.h"
+#include "parse/oram_parse.h"
+
+std::shared_ptr<spdlog::logger> logger =
+    spdlog::stdout_color_mt("oram_shuffle_bench");
+
+// The number of reshuffles measured.
+static const size_t kShuffleRounds = 3;
+
+// Exposes the reshuffle of the Square Root ORAM, which is otherwise only run
+// every \sqrt{m} accesses.
+class ShuffleBench : public oram_impl::SquareRootOramController {
+ public:
+  ShuffleBench(uint32_t id, size_t block_num)
+      : SquareRootOramController(id, true, block_num) {}
+
+  oram_impl::OramStatus Reshuffle(void) {
+    oram_impl::OramStatus status = ResamplePermutation();
+    return status.ok() ? Shuffle() : status;
+  }
+};
+
+// Reports the throughput of the oblivious reshuffle of a Square Root ORAM of
+// `block_num` blocks against a running server. The server and the size are
+// read from the configuration as for `oram_test_client`.
+int main(int argc, char* argv[]) {
+  oram_parse::YamlParser parser;
+  oram_impl::OramConfig config;
+  oram_impl::OramStatus status = parser.Parse(config);
+  if (status.error_code() == oram_impl::StatusCode::kFileNotFound &&
+      !parser.IgnoreCommandLineArgs()) {
+    status = parser.FromCommandLine(argc, argv, config);
+    if (!status.ok()) {
+      logger->warn(status.EmitString());
+    }
+  }
+
+  logger->set_level(static_cast<spdlog::level::level_enum>(config.log_level));
+  spdlog::set_default_logger(logger);
+
+  grpc::SslCredentialsOptions ssl_opts;
+  ssl_opts.pem_root_certs = oram_utils::ReadKeyCrtFile(config.crt_path);
+  std::shared_ptr<oram_impl::oram_server::Stub> stub =
+      oram_impl::oram_server::NewStub(grpc::CreateChannel(
+          oram_utils::StrCat(config.server_address, ":", config.server_port),
+          grpc::SslCredentials(ssl_opts)));
+
+  std::shared_ptr<oram_crypto::Cryptor> cryptor =
+      oram_crypto::Cryptor::GetInstance();
+  ShuffleBench controller(config.id, config.block_num);
+  controller.SetStub(stub);
+  if (config.disable_debugging) {
+    cryptor->NoNeedForSessionKey();
+  } else {
+    oram_utils::CheckStatus(controller.KeyNegotiate(),
+                            "Cannot negotiate the session key");
+  }
+
+  oram_utils::CheckStatus(controller.InitOram(), "Cannot create the ORAM");
+
+  std::vector<oram_impl::oram_block_t> data(config.block_num);
+  for (size_t i = 0; i < data.size(); i++) {
+    memset(reinterpret_cast<void*>(&data[i]), 0, ORAM_BLOCK_SIZE);
+    data[i].header.block_id = i;
+    data[i].header.type = oram_impl::BlockType::kNormal;
+  }
+  oram_utils::CheckStatus(controller.FillWithData(data),
+                          "Cannot fill the ORAM");
+  std::vector<oram_impl::oram_block_t>().swap(data);
+
+  std::chrono::microseconds total(0);
+  for (size_t i = 0; i < kShuffleRounds; i++) {
+    auto begin = std::chrono::high_resolution_clock::now();
+    oram_utils::CheckStatus(controller.Reshuffle(), "The reshuffle failed");
+    auto end = std::chrono::high_resolution_clock::now();
+    total += std::chrono::duration_cast<std::chrono::microseconds>(end - begin);
+  }
+
+  // Counted once per block, though each crosses the temporary area on the way.
+  const double blocks = 1.0 * kShuffleRounds * config.block_num;
+  const double seconds = std::max<int64_t>(total.count(), 1) / 1e6;
+  INFO(logger, "Reshuffled {} blocks {} times: {:.0f} blocks/s, {:.1f} MB/s.",
+       config.block_num, kShuffleRounds, blocks / seconds,
+       blocks * ORAM_BLOCK_SIZE / seconds / POW2(20));
+
+  return 0;
+}
@@ -0,0 +1,429 @@
+/*
+ Copyright (c) 2022 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <fcntl.h>
+#include <sodium.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+#include <spdlog/spdlog.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/oram_utils.h"
+#include "server/block_arena.h"
+#include "server/oram_snapshot.h"
+#include "server/tree_oram_storage.h"
+#include "server/tree_storage_engine.h"
+#include "server/write_ahead_log.h"
+
+std::shared_ptr<spdlog::logger> logger =
+    spdlog::stdout_color_mt("oram_storage_test");
+
+// Exercises the recovery paths of the server storages without a server: the
+// write-ahead log, the snapshots, the copy-on-write block arena, and the tree
+// storage engines. Exits with a non-zero status if any check fails.
+using namespace oram_impl;
+
+static size_t failures = 0;
+
+#define EXPECT(cond)                                                    \
+  do {                                                                  \
+    if (!(cond)) {                                                      \
+      logger->error("{}:{}: expected {}", __FILE__, __LINE__, #cond);   \
+      failures++;                                                       \
+    }                                                                   \
+  } while (0)
+
+#define EXPECT_OK(expr)                                                 \
+  do {                                                                  \
+    const OramStatus _status = (expr);                                  \
+    if (!_status.ok()) {                                                \
+      logger->error("{}:{}: {}", __FILE__, __LINE__,                    \
+                    _status.EmitString());                              \
+      failures++;                                                       \
+    }                                                                   \
+  } while (0)
+
+static const std::string kInstanceHash = "oram_storage_test";
+
+static oram_block_t MakeBlock(uint32_t id) {
+  oram_block_t block = {};
+  block.header.block_id = id;
+  block.header.type = BlockType::kNormal;
+  memset(block.data, id & 0xff, sizeof(block.data));
+  return block;
+}
+
+static bool SameBlock(const oram_block_t& lhs, const oram_block_t& rhs) {
+  return memcmp(&lhs, &rhs, ORAM_BLOCK_SIZE) == 0;
+}
+
+static std::vector<uint32_t> SortedIds(const p_oram_bucket_t& blocks) {
+  std::vector<uint32_t> ids;
+  for (const auto& block : blocks) {
+    ids.emplace_back(block.header.block_id);
+  }
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+
+// A scratch directory removed at exit.
+class TempDir {
+  std::string path_;
+
+ public:
+  TempDir() {
+    char path[] = "/tmp/oram_storage_test.XXXXXX";
+    if (mkdtemp(path) == nullptr) {
+      PANIC("Cannot create a scratch directory.");
+    }
+    path_ = path;
+  }
+
+  std::string Sub(const std::string& name) const {
+    return oram_utils::StrCat(path_, "/", name);
+  }
+
+  ~TempDir() { std::filesystem::remove_all(path_); }
+};
+
+static void FlipByte(const std::string& path, off_t offset) {
+  const int fd = open(path.data(), O_RDWR);
+  uint8_t byte;
+  if (fd == -1 || pread(fd, &byte, 1, offset) != 1) {
+    PANIC("Cannot read the file to corrupt.");
+  }
+  byte ^= 0xff;
+  if (pwrite(fd, &byte, 1, offset) != 1) {
+    PANIC("Cannot corrupt the file.");
+  }
+  close(fd);
+}
+
+static std::vector<WalRecord> ReplayAll(const std::string& dir) {
+  std::vector<WalRecord> records;
+  WriteAheadLog log(dir, WalSyncPolicy::kAlways);
+  EXPECT_OK(log.Open());
+
+  size_t replayed = 0;
+  EXPECT_OK(log.Replay(
+      [&records](const WalRecord& record) {
+        records.emplace_back(record);
+        return OramStatus::OK;
+      },
+      &replayed));
+  EXPECT(replayed == records.size());
+
+  return records;
+}
+
+static void TestWalReplay(const TempDir& temp) {
+  const std::string dir = temp.Sub("wal_replay");
+  {
+    WriteAheadLog log(dir, WalSyncPolicy::kAlways);
+    EXPECT_OK(log.Open());
+    EXPECT_OK(log.AppendCreateTree(1, 15, ORAM_BLOCK_SIZE, 4, kInstanceHash));
+    EXPECT_OK(log.AppendBucket(1, 3, {MakeBlock(30)}));
+    EXPECT_OK(log.AppendBuckets(1, {0, 2}, {{MakeBlock(0)}, {}}));
+    uint64_t sequence = 0;
+    EXPECT_OK(log.EnqueueReset(&sequence));
+    EXPECT_OK(log.WaitFor(sequence));
+  }
+
+  const std::vector<WalRecord> records = ReplayAll(dir);
+  EXPECT(records.size() == 4);
+  if (records.size() != 4) {
+    return;
+  }
+
+  EXPECT(records[0].type == WalRecordType::kCreateTree);
+  EXPECT(records[0].id == 1 && records[0].capacity == 15 &&
+         records[0].bucket_size == 4);
+  EXPECT(records[0].instance_hash == kInstanceHash);
+
+  EXPECT(records[1].type == WalRecordType::kBuckets);
+  EXPECT(records[1].indices == std::vector<size_t>({3}));
+  EXPECT(records[1].buckets.size() == 1 &&
+         records[1].buckets[0].size() == 1 &&
+         SameBlock(records[1].buckets[0][0], MakeBlock(30)));
+
+  EXPECT(records[2].indices == std::vector<size_t>({0, 2}));
+  EXPECT(records[2].buckets.size() == 2 && records[2].buckets[1].empty());
+
+  EXPECT(records[3].type == WalRecordType::kReset);
+}
+
+// Only the rest of a broken segment is discarded; the later segments are
+// still replayed.
+static void TestWalBrokenRecords(const TempDir& temp) {
+  for (const bool torn : {true, false}) {
+    const std::string dir =
+        temp.Sub(torn ? "wal_torn" : "wal_corrupted");
+    {
+      WriteAheadLog log(dir, WalSyncPolicy::kAlways);
+      EXPECT_OK(log.Open());
+      for (uint32_t i = 0; i < 3; i++) {
+        EXPECT_OK(log.AppendBucket(1, i, {MakeBlock(i)}));
+      }
+    }
+
+    // The three records are of the same size.
+    const std::string segment = oram_utils::StrCat(dir, "/wal_0.log");
+    const size_t size = std::filesystem::file_size(segment);
+    if (torn) {
+      // A crash in the middle of the last record.
+      std::filesystem::resize_file(segment, size - 5);
+    } else {
+      FlipByte(segment, size / 3 + 10);
+    }
+
+    {
+      WriteAheadLog log(dir, WalSyncPolicy::kAlways);
+      EXPECT_OK(log.Open());
+      EXPECT_OK(log.AppendBucket(1, 7, {MakeBlock(7)}));
+    }
+
+    const std::vector<WalRecord> records = ReplayAll(dir);
+    std::vector<size_t> indices;
+    for (const auto& record : records) {
+      indices.insert(indices.end(), record.indices.begin(),
+                     record.indices.end());
+    }
+    EXPECT(indices == (torn ? std::vector<size_t>({0, 1, 7})
+                            : std::vector<size_t>({0, 7})));
+  }
+}
+
+static void TestWalDropSegments(const TempDir& temp) {
+  const std::string dir = temp.Sub("wal_drop");
+  {
+    WriteAheadLog log(dir, WalSyncPolicy::kAlways);
+    EXPECT_OK(log.Open());
+    EXPECT_OK(log.AppendBucket(1, 0, {MakeBlock(0)}));
+
+    // The records before are covered by a checkpoint.
+    uint64_t segment = 0;
+    EXPECT_OK(log.Rotate(&segment));
+    EXPECT(segment == 1);
+    EXPECT_OK(log.AppendBucket(1, 1, {MakeBlock(1)}));
+    log.DropSegmentsBefore(segment);
+
+    EXPECT(!std::filesystem::exists(oram_utils::StrCat(dir, "/wal_0.log")));
+    EXPECT(std::filesystem::exists(oram_utils::StrCat(dir, "/wal_1.log")));
+  }
+
+  const std::vector<WalRecord> records = ReplayAll(dir);
+  EXPECT(records.size() == 1 &&
+         records[0].indices == std::vector<size_t>({1}));
+}
+
+static void TestSnapshotRoundTrip(const TempDir& temp) {
+  TreeStorageOptions options;
+  options.type = TreeStorageEngineType::kArray;
+
+  // Four levels, eight paths.
+  TreeOramServerStorage storage(5, 15, ORAM_BLOCK_SIZE, 4, kInstanceHash);
+  EXPECT_OK(storage.Open(options));
+  // Path 0 is written last, so the root is its own.
+  const p_oram_path_t path_0 = {{MakeBlock(1)}, {}, {}, {MakeBlock(2)}};
+  const p_oram_path_t path_5 = {{}, {MakeBlock(3)}, {}, {MakeBlock(4)}};
+  EXPECT_OK(storage.WriteFullPath(5, path_5));
+  EXPECT_OK(storage.WriteFullPath(0, path_0));
+
+  const std::string path = temp.Sub("tree_5.snapshot");
+  EXPECT_OK(SaveSnapshot(&storage, path));
+
+  std::unique_ptr<BaseOramServerStorage> loaded;
+  EXPECT_OK(LoadSnapshot(path, options, &loaded));
+  TreeOramServerStorage* const tree =
+      dynamic_cast<TreeOramServerStorage*>(loaded.get());
+  EXPECT(tree != nullptr);
+  if (tree == nullptr) {
+    return;
+  }
+  EXPECT(tree->GetId() == 5 && tree->GetInstanceHash() == kInstanceHash);
+
+  p_oram_bucket_t blocks;
+  EXPECT_OK(tree->ReadFullPath(0, &blocks));
+  EXPECT(SortedIds(blocks) == std::vector<uint32_t>({1, 2}));
+  blocks.clear();
+  EXPECT_OK(tree->ReadFullPath(5, &blocks));
+  EXPECT(SortedIds(blocks) == std::vector<uint32_t>({3, 4}));
+
+  // A snapshot whose sum does not match is refused.
+  FlipByte(path, std::filesystem::file_size(path) / 2);
+  loaded.reset();
+  EXPECT(!LoadSnapshot(path, options, &loaded).ok());
+}
+
+static void TestBlockArenaCopyOnWrite(void) {
+  // More slots than a chunk holds.
+  const size_t slots = 5000;
+  const std::string first(16, 'a');
+  const std::string second(16, 'b');
+
+  BlockArena arena;
+  arena.Assign(slots, first.size());
+  EXPECT(arena.Set(1, first));
+  EXPECT(arena.Set(4500, first));
+  EXPECT(!arena.Set(2, "short"));
+  EXPECT(arena.Empty(2));
+
+  BlockArena copy;
+  copy.CopyFrom(arena);
+  EXPECT(copy.Size() == slots && copy.Get(1) == first);
+
+  // Writes on either side are not seen by the other.
+  EXPECT(arena.Set(1, second));
+  EXPECT(copy.Set(4500, second));
+  EXPECT(arena.Get(1) == second && copy.Get(1) == first);
+  EXPECT(arena.Get(4500) == first && copy.Get(4500) == second);
+
+  copy.Clear(1);
+  EXPECT(copy.Empty(1) && !arena.Empty(1));
+
+  copy.Release();
+  EXPECT(arena.Get(1) == second && arena.Get(4500) == first);
+}
+
+static void TestEngine(const TreeStorageOptions& options,
+                       const std::string& name) {
+  const size_t failed = failures;
+  std::unique_ptr<TreeStorageEngine> engine;
+  EXPECT_OK(CreateTreeStorageEngine(options, 1, kInstanceHash, 15, 4,
+                                    &engine));
+  if (engine == nullptr) {
+    return;
+  }
+
+  EXPECT_OK(engine->PutBuckets(
+      {0, 7, 14}, {{MakeBlock(1)}, {MakeBlock(2), MakeBlock(3)}, {}}));
+
+  p_oram_bucket_t bucket;
+  EXPECT_OK(engine->TakeBucket(7, &bucket));
+  EXPECT(bucket.size() == 2 && SameBlock(bucket[0], MakeBlock(2)) &&
+         SameBlock(bucket[1], MakeBlock(3)));
+  // Taking empties the bucket.
+  bucket.clear();
+  EXPECT_OK(engine->TakeBucket(7, &bucket));
+  EXPECT(bucket.empty());
+
+  const p_oram_bucket_t full(5, MakeBlock(9));
+  EXPECT(engine->PutBucket(3, full).error_code() == StatusCode::kOutOfRange);
+  EXPECT(!engine->TakeBucket(15, &bucket).ok());
+
+  EXPECT_OK(engine->TakeBuckets({0, 14}, &bucket));
+  EXPECT(SortedIds(bucket) == std::vector<uint32_t>({1}));
+
+  if (failures != failed) {
+    logger->error("The {} engine failed.", name);
+  }
+}
+
+// The engines backed by a file restore the buckets of the same instance only.
+static void TestEngineRestore(const TreeStorageOptions& options,
+                              const std::string& name) {
+  const size_t failed = failures;
+  {
+    std::unique_ptr<TreeStorageEngine> engine;
+    EXPECT_OK(CreateTreeStorageEngine(options, 2, kInstanceHash, 15, 4,
+                                      &engine));
+    if (engine == nullptr) {
+      return;
+    }
+    EXPECT_OK(engine->PutBuckets({0, 12}, {{MakeBlock(1)}, {MakeBlock(2)}}));
+
+    // The file is held by the live engine.
+    std::unique_ptr<TreeStorageEngine> other;
+    EXPECT(!CreateTreeStorageEngine(options, 2, kInstanceHash, 15, 4, &other)
+                .ok());
+  }
+
+  {
+    std::unique_ptr<TreeStorageEngine> engine;
+    EXPECT_OK(CreateTreeStorageEngine(options, 2, kInstanceHash, 15, 4,
+                                      &engine));
+    p_oram_bucket_t bucket;
+    EXPECT_OK(engine->TakeBuckets({0, 12}, &bucket));
+    EXPECT(SortedIds(bucket) == std::vector<uint32_t>({1, 2}));
+    EXPECT_OK(engine->PutBucket(12, {MakeBlock(2)}));
+  }
+
+  {
+    std::unique_ptr<TreeStorageEngine> engine;
+    EXPECT_OK(CreateTreeStorageEngine(options, 2, "another instance", 15, 4,
+                                      &engine));
+    p_oram_bucket_t bucket;
+    EXPECT_OK(engine->TakeBuckets({0, 12}, &bucket));
+    EXPECT(bucket.empty());
+  }
+
+  if (failures != failed) {
+    logger->error("The {} engine failed to restore.", name);
+  }
+}
+
+static void TestEngines(const TempDir& temp) {
+  TreeStorageOptions options;
+  options.path = temp.Sub("");
+  options.locked_levels = 1;
+  options.cached_levels = 1;
+
+  options.type = TreeStorageEngineType::kMap;
+  TestEngine(options, "map");
+  options.type = TreeStorageEngineType::kArray;
+  TestEngine(options, "array");
+  options.type = TreeStorageEngineType::kMmap;
+  TestEngine(options, "mmap");
+  TestEngineRestore(options, "mmap");
+#ifdef ORAM_HAS_LIBURING
+  options.type = TreeStorageEngineType::kUring;
+  TestEngine(options, "uring");
+  TestEngineRestore(options, "uring");
+#endif
+}
+
+int main(void) {
+  spdlog::set_default_logger(logger);
+  logger->set_level(spdlog::level::warn);
+
+  if (sodium_init() == -1) {
+    logger->error("Cannot initialize libsodium.");
+    return 1;
+  }
+
+  TempDir temp;
+  TestWalReplay(temp);
+  TestWalBrokenRecords(temp);
+  TestWalDropSegments(temp);
+  TestSnapshotRoundTrip(temp);
+  TestBlockArenaCopyOnWrite();
+  TestEngines(temp);
+
+  if (failures != 0) {
+    logger->error("{} checks failed.", failures);
+    return 1;
+  }
+  logger->warn("All checks passed.");
+
+  return 0;
+}